@@ -22,6 +22,10 @@ BENCHMARK(BM_basic_fma_rand_double_std)->RangeMultiplier(2)->Range(8, 8<<10)->Co
 
 BENCHMARK(BM_basic_fma_rand_double_ccmath)->RangeMultiplier(2)->Range(8, 8<<10)->Complexity();
 
+BENCHMARK(BM_basic_fma_array_double_std)->RangeMultiplier(2)->Range(8, 8<<10)->Complexity();
+
+BENCHMARK(BM_basic_fma_array_double_ccmath_batch)->RangeMultiplier(2)->Range(8, 8<<10)->Complexity();
+
 BENCHMARK_MAIN();
 
 // NOLINTEND
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <benchmark/benchmark.h>
 #include <ccmath/ccmath.hpp>
 #include <cmath>
+#include <vector>
 
 namespace bm = benchmark;
 
@@ -81,4 +82,34 @@ static void BM_basic_fma_rand_double_ccmath(benchmark::State& state) {
 	state.SetComplexityN(state.range(0));
 }
 
+static void BM_basic_fma_array_double_std(benchmark::State& state) {
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0));
+	auto randomDoubles2 = ran.generateRandomDoubles(state.range(0));
+	auto randomDoubles3 = ran.generateRandomDoubles(state.range(0));
+	std::vector<double> out(randomDoubles.size());
+	while (state.KeepRunning()) {
+		for (size_t i = 0; i < randomDoubles.size(); ++i) {
+			out[i] = std::fma(randomDoubles[i], randomDoubles2[i], randomDoubles3[i]);
+		}
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_basic_fma_array_double_ccmath_batch(benchmark::State& state) {
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0));
+	auto randomDoubles2 = ran.generateRandomDoubles(state.range(0));
+	auto randomDoubles3 = ran.generateRandomDoubles(state.range(0));
+	std::vector<double> out(randomDoubles.size());
+	while (state.KeepRunning()) {
+		ccm::batch::fma(randomDoubles.data(), randomDoubles2.data(), randomDoubles3.data(), out.data(), out.size());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
 // NOLINTEND
\ No newline at end of file
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "batch.bench.hpp"
+
+// NOLINTBEGIN
+
+BENCHMARK(BM_exponential_exp_loop_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_exp_loop_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_exp_batch_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_log_loop_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_log_loop_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_log_batch_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
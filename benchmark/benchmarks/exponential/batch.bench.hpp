@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+#include <vector>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+// Element-wise loops over the scalar functions, used as the baseline for the batch API.
+
+static void BM_exponential_exp_loop_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -700.0, 700.0);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i) { out[i] = std::exp(randomDoubles[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_exponential_exp_loop_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -700.0, 700.0);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i) { out[i] = ccm::internal::impl::exp_double_impl(randomDoubles[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_exponential_exp_batch_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -700.0, 700.0);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::exp(randomDoubles.data(), out.data(), randomDoubles.size());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_exponential_log_loop_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), 1e-6, 1e6);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i) { out[i] = std::log(randomDoubles[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_exponential_log_loop_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), 1e-6, 1e6);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i) { out[i] = ccm::internal::log_double(randomDoubles[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_exponential_log_batch_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), 1e-6, 1e6);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::log(randomDoubles.data(), out.data(), randomDoubles.size());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+// NOLINTEND
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "gather.bench.hpp"
+
+// NOLINTBEGIN
+
+BENCHMARK_TEMPLATE(BM_exponential_gather_table, ccm::intrin::abi::scalar)->Arg(1024)->Arg(64 << 10);
+BENCHMARK_TEMPLATE(BM_exponential_gather_poly, ccm::intrin::abi::scalar)->Arg(1024)->Arg(64 << 10);
+
+BENCHMARK_TEMPLATE(BM_exponential_gather_table, ccm::intrin::abi::pack<4>)->Arg(1024)->Arg(64 << 10);
+BENCHMARK_TEMPLATE(BM_exponential_gather_poly, ccm::intrin::abi::pack<4>)->Arg(1024)->Arg(64 << 10);
+
+#ifdef CCMATH_HAS_SIMD_SSE2
+BENCHMARK_TEMPLATE(BM_exponential_gather_table, ccm::intrin::abi::sse2)->Arg(1024)->Arg(64 << 10);
+BENCHMARK_TEMPLATE(BM_exponential_gather_poly, ccm::intrin::abi::sse2)->Arg(1024)->Arg(64 << 10);
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX2
+BENCHMARK_TEMPLATE(BM_exponential_gather_table, ccm::intrin::abi::avx2)->Arg(1024)->Arg(64 << 10);
+BENCHMARK_TEMPLATE(BM_exponential_gather_poly, ccm::intrin::abi::avx2)->Arg(1024)->Arg(64 << 10);
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX512F
+BENCHMARK_TEMPLATE(BM_exponential_gather_table, ccm::intrin::abi::avx512)->Arg(1024)->Arg(64 << 10);
+BENCHMARK_TEMPLATE(BM_exponential_gather_poly, ccm::intrin::abi::avx512)->Arg(1024)->Arg(64 << 10);
+#endif
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/ccmath.hpp>
+#include <ccmath/internal/math/runtime/simd/simd.hpp>
+#include <ccmath/math/exponential/impl/table_gen.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+// 2^x for x in [-1/2, 1/2) on one ABI, either by gathering the scale of 2^(k/N) from the exp table, as the exp kernels
+// do, or from a table free polynomial of the same accuracy. The faster of the two is the better choice of a vector exp
+// kernel on that target. The lanes counter is the simd width.
+
+template <class Abi>
+static void BM_exponential_gather_table(benchmark::State & state)
+{
+	using data	= ccm::internal::exp_data<double>;
+	using V		= ccm::intrin::simd<double, Abi>;
+	using BitsV = ccm::intrin::simd<std::uint64_t, Abi>;
+	constexpr std::size_t width = static_cast<std::size_t>(V::size());
+
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -0.5, 0.5);
+	std::vector<double> out(randomDoubles.size());
+	const V scale_n(static_cast<double>(data::table_size));
+	const V shift(data::shift);
+	const BitsV index_mask(std::uint64_t{data::table_size - 1});
+	const BitsV one(std::uint64_t{1});
+
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i + width <= randomDoubles.size(); i += width)
+		{
+			const V x(&randomDoubles[i], ccm::intrin::element_aligned_tag());
+			const BitsV k	  = ccm::intrin::bit_cast<BitsV>(x * scale_n + shift);
+			const BitsV index = ((k & index_mask) << 1) | one;
+			const BitsV sbits = ccm::intrin::gather(data::tab.data(), index) + (k << static_cast<int>(52 - data::table_bits));
+			ccm::intrin::bit_cast<V>(sbits).copy_to(&out[i], ccm::intrin::element_aligned_tag());
+		}
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.counters["lanes"] = static_cast<double>(width);
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+template <class Abi>
+static void BM_exponential_gather_poly(benchmark::State & state)
+{
+	using V						= ccm::intrin::simd<double, Abi>;
+	constexpr std::size_t width = static_cast<std::size_t>(V::size());
+	// Degree 12 keeps the Taylor error of 2^x below 2^-52 on [-1/2, 1/2].
+	constexpr std::array<double, 12> poly = ccm::internal::table_gen::make_exp2_poly<12>();
+
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -0.5, 0.5);
+	std::vector<double> out(randomDoubles.size());
+
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i + width <= randomDoubles.size(); i += width)
+		{
+			const V x(&randomDoubles[i], ccm::intrin::element_aligned_tag());
+			V p(poly[poly.size() - 1]);
+			for (std::size_t j = poly.size() - 1; j-- > 0;) { p = p * x + V(poly[j]); }
+			(p * x + V(1.0)).copy_to(&out[i], ccm::intrin::element_aligned_tag());
+		}
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.counters["lanes"] = static_cast<double>(width);
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+// NOLINTEND
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "scalar.bench.hpp"
+
+// NOLINTBEGIN
+
+BENCHMARK(BM_exponential_expm1_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_expm1_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_expm1f_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_expm1f_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_log1p_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_log1p_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_log1pf_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_log1pf_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_log10_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_log10_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_log10f_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_exponential_log10f_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+// expm1, log1p and log10 from ccm and std over the same random inputs, in double and float. Each pair of results
+// shows whether a build can switch to the ccm functions without losing throughput.
+
+template <typename T, typename Function>
+static void run_exponential_scalar(benchmark::State & state, double min, double max, Function function)
+{
+	ccm::bench::Randomizer ran;
+	const auto randomDoubles = ran.generateRandomDoubles(state.range(0), min, max);
+	const std::vector<T> in(randomDoubles.begin(), randomDoubles.end());
+	std::vector<T> out(in.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < in.size(); ++i) { out[i] = function(in[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_exponential_expm1_std(benchmark::State & state)
+{
+	run_exponential_scalar<double>(state, -10.0, 10.0, [](double x) { return std::expm1(x); });
+}
+
+static void BM_exponential_expm1_ccm(benchmark::State & state)
+{
+	run_exponential_scalar<double>(state, -10.0, 10.0, [](double x) { return ccm::expm1(x); });
+}
+
+static void BM_exponential_expm1f_std(benchmark::State & state)
+{
+	run_exponential_scalar<float>(state, -10.0, 10.0, [](float x) { return std::expm1(x); });
+}
+
+static void BM_exponential_expm1f_ccm(benchmark::State & state)
+{
+	run_exponential_scalar<float>(state, -10.0, 10.0, [](float x) { return ccm::expm1f(x); });
+}
+
+static void BM_exponential_log1p_std(benchmark::State & state)
+{
+	run_exponential_scalar<double>(state, -0.9, 100.0, [](double x) { return std::log1p(x); });
+}
+
+static void BM_exponential_log1p_ccm(benchmark::State & state)
+{
+	run_exponential_scalar<double>(state, -0.9, 100.0, [](double x) { return ccm::log1p(x); });
+}
+
+static void BM_exponential_log1pf_std(benchmark::State & state)
+{
+	run_exponential_scalar<float>(state, -0.9, 100.0, [](float x) { return std::log1p(x); });
+}
+
+static void BM_exponential_log1pf_ccm(benchmark::State & state)
+{
+	run_exponential_scalar<float>(state, -0.9, 100.0, [](float x) { return ccm::log1pf(x); });
+}
+
+static void BM_exponential_log10_std(benchmark::State & state)
+{
+	run_exponential_scalar<double>(state, 0.001, 1000000.0, [](double x) { return std::log10(x); });
+}
+
+static void BM_exponential_log10_ccm(benchmark::State & state)
+{
+	run_exponential_scalar<double>(state, 0.001, 1000000.0, [](double x) { return ccm::log10(x); });
+}
+
+static void BM_exponential_log10f_std(benchmark::State & state)
+{
+	run_exponential_scalar<float>(state, 0.001, 1000000.0, [](float x) { return std::log10(x); });
+}
+
+static void BM_exponential_log10f_ccm(benchmark::State & state)
+{
+	run_exponential_scalar<float>(state, 0.001, 1000000.0, [](float x) { return ccm::log10f(x); });
+}
+
+// NOLINTEND
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "tables.bench.hpp"
+
+// NOLINTBEGIN
+
+BENCHMARK_TEMPLATE(BM_exponential_exp_table, 5)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_exp_table, 6)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_exp_table, 7)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_exp_table, 8)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_exp2_table, 5)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_exp2_table, 6)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_exp2_table, 7)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_exp2_table, 8)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_log_table, 5)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_log_table, 6)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_log_table, 7)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_log_table, 8)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_log2_table, 5)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_log2_table, 6)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_log2_table, 7)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_log2_table, 8)->RangeMultiplier(4)->Range(64, 64 << 8)->Complexity();
+
+BENCHMARK_TEMPLATE(BM_exponential_log_lookup, false)->ArgsProduct({{64, 1024}, {0, 32 << 10}});
+
+BENCHMARK_TEMPLATE(BM_exponential_log_lookup, true)->ArgsProduct({{64, 1024}, {0, 32 << 10}});
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
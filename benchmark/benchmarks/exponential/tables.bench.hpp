@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/ccmath.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+// The double precision exp and log kernels instantiated with 2^TableBits table entries. The table_bytes counter reports
+// the lookup table footprint of each variant.
+
+template <std::size_t TableBits>
+static void BM_exponential_exp_table(benchmark::State & state)
+{
+	using data = ccm::internal::exp_double_data<TableBits>;
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -700.0, 700.0);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i) { out[i] = ccm::internal::impl::exp_double_impl<TableBits>(randomDoubles[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.counters["table_bytes"] = static_cast<double>(sizeof(data::tab));
+	state.counters["poly_order"]  = static_cast<double>(data::poly_order);
+	state.SetComplexityN(state.range(0));
+}
+
+template <std::size_t TableBits>
+static void BM_exponential_exp2_table(benchmark::State & state)
+{
+	using data = ccm::internal::exp2_double_data<TableBits>;
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1000.0, 1000.0);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i) { out[i] = ccm::internal::impl::exp2_double_impl<TableBits>(randomDoubles[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.counters["table_bytes"] = static_cast<double>(sizeof(data::tab));
+	state.counters["poly_order"]  = static_cast<double>(data::poly_order);
+	state.SetComplexityN(state.range(0));
+}
+
+template <std::size_t TableBits>
+static void BM_exponential_log_table(benchmark::State & state)
+{
+	using data = ccm::internal::log_double_data<TableBits>;
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), 1e-6, 1e6);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i) { out[i] = ccm::internal::impl::log_double_impl<TableBits>(randomDoubles[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.counters["table_bytes"] = static_cast<double>(sizeof(data::tab));
+	state.counters["poly_order"]  = static_cast<double>(data::poly_order);
+	state.SetComplexityN(state.range(0));
+}
+
+template <std::size_t TableBits>
+static void BM_exponential_log2_table(benchmark::State & state)
+{
+	using data = ccm::internal::log2_double_data<TableBits>;
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), 1e-6, 1e6);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i) { out[i] = ccm::internal::impl::log2_double_impl<TableBits>(randomDoubles[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.counters["table_bytes"] = static_cast<double>(sizeof(data::tab));
+	state.counters["poly_order"]  = static_cast<double>(data::poly_order);
+	state.SetComplexityN(state.range(0));
+}
+
+// Lookups in the double precision log table at random indices. Between two batches of lookups a competing working set of
+// state.range(1) bytes is touched, as when the L1 is shared with other kernels. The split variant reads the same values
+// from the former layout of two arrays, {invc, logc, logclo} and {chi, clo}. The lines_per_lookup counter reports the
+// average number of cache lines one lookup touches.
+
+struct log_split_entry
+{
+	double invc;
+	double logc;
+	double logclo;
+};
+
+struct log_split_entry2
+{
+	double chi;
+	double clo;
+};
+
+static double count_lines(const void * first, std::size_t first_size, const void * second, std::size_t second_size)
+{
+	const auto line = [](const void * p) { return reinterpret_cast<std::uintptr_t>(p) / 64; };
+	const auto last = [](const void * p, std::size_t size) { return (reinterpret_cast<std::uintptr_t>(p) + size - 1) / 64; };
+	double lines	= static_cast<double>(last(first, first_size) - line(first) + 1);
+	if (second != nullptr) { lines += static_cast<double>(last(second, second_size) - line(second) + 1); }
+	return lines;
+}
+
+template <bool Split>
+static void BM_exponential_log_lookup(benchmark::State & state)
+{
+	const auto & tab = ccm::internal::log_data<double>::tab;
+	std::vector<log_split_entry> split(tab.size());
+	std::vector<log_split_entry2> split2(tab.size());
+	for (std::size_t i = 0; i < tab.size(); ++i)
+	{
+		split[i]  = {tab[i].invc, tab[i].logc, static_cast<double>(tab[i].logclo)};
+		split2[i] = {tab[i].chi, static_cast<double>(tab[i].clo)};
+	}
+
+	std::mt19937 gen(42);
+	std::vector<std::size_t> indices(static_cast<std::size_t>(state.range(0)));
+	for (auto & index : indices) { index = gen() % tab.size(); }
+	std::vector<double> out(indices.size());
+	std::vector<std::uint64_t> other(static_cast<std::size_t>(state.range(1)) / sizeof(std::uint64_t) + 1);
+
+	double lines = 0.0;
+	for (const auto index : indices)
+	{
+		lines += Split ? count_lines(&split[index], sizeof(log_split_entry), &split2[index], sizeof(log_split_entry2))
+					   : count_lines(&tab[index], sizeof(tab[index]), nullptr, 0);
+	}
+
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < other.size(); i += 8) { other[i] += i; }
+		benchmark::DoNotOptimize(other.data());
+
+		for (std::size_t i = 0; i < indices.size(); ++i)
+		{
+			const std::size_t index = indices[i];
+			if constexpr (Split) { out[i] = (split[index].invc - split2[index].chi - split2[index].clo) * split[index].logc + split[index].logclo; }
+			else { out[i] = (tab[index].invc - tab[index].chi - static_cast<double>(tab[index].clo)) * tab[index].logc + static_cast<double>(tab[index].logclo); }
+		}
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.counters["lines_per_lookup"] = lines / static_cast<double>(indices.size());
+	state.counters["table_bytes"]	   = static_cast<double>(Split ? tab.size() * (sizeof(log_split_entry) + sizeof(log_split_entry2)) : sizeof(tab));
+}
+
+// NOLINTEND
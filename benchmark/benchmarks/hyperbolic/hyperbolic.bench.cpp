@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "hyperbolic.bench.hpp"
+
+// NOLINTBEGIN
+
+BENCHMARK(BM_hyperbolic_sinh_cosh_loop_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_hyperbolic_sinh_cosh_loop_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_hyperbolic_sinhcosh_loop_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_hyperbolic_sinhcosh_batch_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_hyperbolic_tanh_loop_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_hyperbolic_tanh_loop_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_hyperbolic_tanh_batch_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+#include <vector>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+// Hyperbolic sine and cosine of the same arguments, computed separately and with sinhcosh, which evaluates e^|x| once.
+
+static void BM_hyperbolic_sinh_cosh_loop_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -10.0, 10.0);
+	std::vector<double> sinh_out(randomDoubles.size());
+	std::vector<double> cosh_out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i)
+		{
+			sinh_out[i] = std::sinh(randomDoubles[i]);
+			cosh_out[i] = std::cosh(randomDoubles[i]);
+		}
+		benchmark::DoNotOptimize(sinh_out.data());
+		benchmark::DoNotOptimize(cosh_out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_hyperbolic_sinh_cosh_loop_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -10.0, 10.0);
+	std::vector<double> sinh_out(randomDoubles.size());
+	std::vector<double> cosh_out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i)
+		{
+			sinh_out[i] = ccm::sinh(randomDoubles[i]);
+			cosh_out[i] = ccm::cosh(randomDoubles[i]);
+		}
+		benchmark::DoNotOptimize(sinh_out.data());
+		benchmark::DoNotOptimize(cosh_out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_hyperbolic_sinhcosh_loop_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -10.0, 10.0);
+	std::vector<double> sinh_out(randomDoubles.size());
+	std::vector<double> cosh_out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i) { ccm::sinhcosh(randomDoubles[i], &sinh_out[i], &cosh_out[i]); }
+		benchmark::DoNotOptimize(sinh_out.data());
+		benchmark::DoNotOptimize(cosh_out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_hyperbolic_sinhcosh_batch_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -10.0, 10.0);
+	std::vector<double> sinh_out(randomDoubles.size());
+	std::vector<double> cosh_out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::sinhcosh(randomDoubles.data(), sinh_out.data(), cosh_out.data(), randomDoubles.size());
+		benchmark::DoNotOptimize(sinh_out.data());
+		benchmark::DoNotOptimize(cosh_out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+// tanh over the range where it has not yet saturated, as used for activation functions.
+
+static void BM_hyperbolic_tanh_loop_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -10.0, 10.0);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i) { out[i] = std::tanh(randomDoubles[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_hyperbolic_tanh_loop_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -10.0, 10.0);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i) { out[i] = ccm::tanh(randomDoubles[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_hyperbolic_tanh_batch_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -10.0, 10.0);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::tanh(randomDoubles.data(), out.data(), randomDoubles.size());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+// NOLINTEND
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "nearest.bench.hpp"
+
+// NOLINTBEGIN
+
+BENCHMARK(BM_nearest_floor_rand_double_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_floor_rand_double_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_floor_rand_small_double_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_floor_rand_small_double_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_nearest_ceil_rand_double_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_ceil_rand_double_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_ceil_rand_small_double_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_ceil_rand_small_double_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_nearest_round_rand_double_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_round_rand_double_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_round_rand_small_double_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_round_rand_small_double_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_nearest_rint_rand_double_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_rint_rand_double_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_rint_rand_small_double_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_rint_rand_small_double_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_nearest_nearbyint_rand_double_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_nearbyint_rand_double_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_nearbyint_rand_small_double_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+BENCHMARK(BM_nearest_nearbyint_rand_small_double_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+// The random inputs cover small fractions as well as magnitudes close to 2^52,
+// where the old iterative floor took the longest.
+
+static void BM_nearest_floor_rand_double_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1e15, 1e15);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(std::floor(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_floor_rand_double_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1e15, 1e15);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(ccm::floor(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_floor_rand_small_double_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(std::floor(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_floor_rand_small_double_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(ccm::floor(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_ceil_rand_double_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1e15, 1e15);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(std::ceil(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_ceil_rand_double_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1e15, 1e15);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(ccm::ceil(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_ceil_rand_small_double_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(std::ceil(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_ceil_rand_small_double_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(ccm::ceil(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_round_rand_double_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1e15, 1e15);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(std::round(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_round_rand_double_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1e15, 1e15);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(ccm::round(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_round_rand_small_double_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(std::round(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_round_rand_small_double_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(ccm::round(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_rint_rand_double_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1e15, 1e15);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(std::rint(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_rint_rand_double_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1e15, 1e15);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(ccm::rint(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_rint_rand_small_double_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(std::rint(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_rint_rand_small_double_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(ccm::rint(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_nearbyint_rand_double_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1e15, 1e15);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(std::nearbyint(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_nearbyint_rand_double_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1e15, 1e15);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(ccm::nearbyint(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_nearbyint_rand_small_double_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(std::nearbyint(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_nearest_nearbyint_rand_small_double_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	while (state.KeepRunning())
+	{
+		for (auto x : randomDoubles) { benchmark::DoNotOptimize(ccm::nearbyint(x)); }
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+// NOLINTEND
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "cbrt.bench.hpp"
+
+// NOLINTBEGIN
+
+BENCHMARK(BM_power_cbrt_std<double>)->Arg(cbrt_bm_count);
+BENCHMARK(BM_power_cbrt_pow<double>)->Arg(cbrt_bm_count);
+BENCHMARK(BM_power_cbrt_ccm<double>)->Arg(cbrt_bm_count);
+
+BENCHMARK(BM_power_cbrt_std<float>)->Arg(cbrt_bm_count);
+BENCHMARK(BM_power_cbrt_pow<float>)->Arg(cbrt_bm_count);
+BENCHMARK(BM_power_cbrt_ccm<float>)->Arg(cbrt_bm_count);
+
+#ifndef CCM_BM_CONFIG_NO_RT
+BENCHMARK(BM_power_cbrt_ccm_batch<double>)->Arg(cbrt_bm_count);
+BENCHMARK(BM_power_cbrt_ccm_batch<float>)->Arg(cbrt_bm_count);
+#endif
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
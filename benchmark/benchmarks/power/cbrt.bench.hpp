@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/math/batch/power.hpp>
+#include <ccmath/math/power/cbrt.hpp>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+constexpr std::int64_t cbrt_bm_count = 4096;
+
+// Linear light values in [0, 1], the input of the Lab and Oklab conversions, which take three cube roots per pixel.
+template <class T>
+std::vector<T> cbrt_bm_inputs(std::int64_t count)
+{
+	ccm::bench::Randomizer ran(1);
+	auto randomDoubles = ran.generateRandomDoubles(count, 0.0, 1.0);
+	return std::vector<T>(randomDoubles.begin(), randomDoubles.end());
+}
+
+template <class T>
+static void BM_power_cbrt_std(benchmark::State & state)
+{
+	const auto x = cbrt_bm_inputs<T>(state.range(0));
+	std::vector<T> out(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < x.size(); ++i) { out[i] = std::cbrt(x[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T>
+static void BM_power_cbrt_ccm(benchmark::State & state)
+{
+	const auto x = cbrt_bm_inputs<T>(state.range(0));
+	std::vector<T> out(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < x.size(); ++i) { out[i] = ccm::cbrt(x[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// The common workaround: pow(x, 1/3), which is neither exact for cubes nor defined for negative x.
+template <class T>
+static void BM_power_cbrt_pow(benchmark::State & state)
+{
+	const auto x = cbrt_bm_inputs<T>(state.range(0));
+	std::vector<T> out(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < x.size(); ++i) { out[i] = std::pow(x[i], T{1} / T{3}); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#ifndef CCM_BM_CONFIG_NO_RT
+// Arrays
+
+template <class T>
+static void BM_power_cbrt_ccm_batch(benchmark::State & state)
+{
+	const auto x = cbrt_bm_inputs<T>(state.range(0));
+	std::vector<T> out(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::cbrt(x.data(), out.data(), out.size());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+#endif
+
+// NOLINTEND
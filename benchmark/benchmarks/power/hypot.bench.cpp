@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "hypot.bench.hpp"
+
+// NOLINTBEGIN
+
+BENCHMARK(BM_power_hypot_naive<double>)->Arg(hypot_bm_count);
+BENCHMARK(BM_power_hypot_std<double>)->Arg(hypot_bm_count);
+BENCHMARK(BM_power_hypot_ccm<double>)->Arg(hypot_bm_count);
+BENCHMARK(BM_power_hypot3_std<double>)->Arg(hypot_bm_count);
+BENCHMARK(BM_power_hypot3_ccm<double>)->Arg(hypot_bm_count);
+BENCHMARK(BM_power_norm_naive<double>)->Arg(hypot_bm_count);
+BENCHMARK(BM_power_norm_ccm<double>)->Arg(hypot_bm_count);
+
+BENCHMARK(BM_power_hypot_naive<float>)->Arg(hypot_bm_count);
+BENCHMARK(BM_power_hypot_std<float>)->Arg(hypot_bm_count);
+BENCHMARK(BM_power_hypot_ccm<float>)->Arg(hypot_bm_count);
+BENCHMARK(BM_power_norm_naive<float>)->Arg(hypot_bm_count);
+BENCHMARK(BM_power_norm_ccm<float>)->Arg(hypot_bm_count);
+
+#ifndef CCM_BM_CONFIG_NO_RT
+BENCHMARK(BM_power_hypot_ccm_batch<double>)->Arg(hypot_bm_count);
+BENCHMARK(BM_power_hypot_ccm_batch<float>)->Arg(hypot_bm_count);
+#endif
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
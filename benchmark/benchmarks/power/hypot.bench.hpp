@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/ext/norm.hpp>
+#include <ccmath/math/batch/power.hpp>
+#include <ccmath/math/power/hypot.hpp>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+constexpr std::int64_t hypot_bm_count = 4096;
+
+// Coordinates in [-1000, 1000], the range of the vector normalization workloads that still use sqrt(x * x + y * y).
+template <class T>
+std::vector<T> hypot_bm_inputs(std::int64_t count, unsigned seed)
+{
+	ccm::bench::Randomizer ran(seed);
+	auto randomDoubles = ran.generateRandomDoubles(count, -1000.0, 1000.0);
+	return std::vector<T>(randomDoubles.begin(), randomDoubles.end());
+}
+
+// The unsafe baseline: overflows for coordinates beyond 2^511 and loses everything below 2^-537.
+template <class T>
+static void BM_power_hypot_naive(benchmark::State & state)
+{
+	const auto x = hypot_bm_inputs<T>(state.range(0), 1);
+	const auto y = hypot_bm_inputs<T>(state.range(0), 2);
+	std::vector<T> out(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < x.size(); ++i) { out[i] = std::sqrt(x[i] * x[i] + y[i] * y[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T>
+static void BM_power_hypot_std(benchmark::State & state)
+{
+	const auto x = hypot_bm_inputs<T>(state.range(0), 1);
+	const auto y = hypot_bm_inputs<T>(state.range(0), 2);
+	std::vector<T> out(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < x.size(); ++i) { out[i] = std::hypot(x[i], y[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T>
+static void BM_power_hypot_ccm(benchmark::State & state)
+{
+	const auto x = hypot_bm_inputs<T>(state.range(0), 1);
+	const auto y = hypot_bm_inputs<T>(state.range(0), 2);
+	std::vector<T> out(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < x.size(); ++i) { out[i] = ccm::hypot(x[i], y[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T>
+static void BM_power_hypot3_std(benchmark::State & state)
+{
+	const auto x = hypot_bm_inputs<T>(state.range(0), 1);
+	const auto y = hypot_bm_inputs<T>(state.range(0), 2);
+	const auto z = hypot_bm_inputs<T>(state.range(0), 3);
+	std::vector<T> out(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < x.size(); ++i) { out[i] = std::hypot(x[i], y[i], z[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T>
+static void BM_power_hypot3_ccm(benchmark::State & state)
+{
+	const auto x = hypot_bm_inputs<T>(state.range(0), 1);
+	const auto y = hypot_bm_inputs<T>(state.range(0), 2);
+	const auto z = hypot_bm_inputs<T>(state.range(0), 3);
+	std::vector<T> out(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < x.size(); ++i) { out[i] = ccm::hypot(x[i], y[i], z[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// The norm of a whole array: the naive sum of squares against ccm::ext::norm.
+template <class T>
+static void BM_power_norm_naive(benchmark::State & state)
+{
+	const auto x = hypot_bm_inputs<T>(state.range(0), 1);
+	for ([[maybe_unused]] auto _ : state)
+	{
+		T sum = 0;
+		for (const T v : x) { sum += v * v; }
+		benchmark::DoNotOptimize(std::sqrt(sum));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T>
+static void BM_power_norm_ccm(benchmark::State & state)
+{
+	const auto x = hypot_bm_inputs<T>(state.range(0), 1);
+	for ([[maybe_unused]] auto _ : state) { benchmark::DoNotOptimize(ccm::ext::norm(x)); }
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#ifndef CCM_BM_CONFIG_NO_RT
+// Arrays
+
+template <class T>
+static void BM_power_hypot_ccm_batch(benchmark::State & state)
+{
+	const auto x = hypot_bm_inputs<T>(state.range(0), 1);
+	const auto y = hypot_bm_inputs<T>(state.range(0), 2);
+	std::vector<T> out(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::hypot(x.data(), y.data(), out.data(), out.size());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+#endif
+
+// NOLINTEND
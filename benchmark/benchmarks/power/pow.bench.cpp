@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "pow.bench.hpp"
+
+// NOLINTBEGIN
+
+// Arguments are {count, 2 * exponent}: x^3, x^15, x^-2, x^0.5, x^-0.5 and the general path with x^2.5.
+BENCHMARK(BM_power_pow_std<double>)->ArgsProduct({{pow_bm_count}, {6, 30, -4, 1, -1, 5}});
+BENCHMARK(BM_power_pow_ccm<double>)->ArgsProduct({{pow_bm_count}, {6, 30, -4, 1, -1, 5}});
+BENCHMARK(BM_power_pow_ccm_n<double, 3>)->Arg(pow_bm_count);
+BENCHMARK(BM_power_pow_ccm_n<double, 15>)->Arg(pow_bm_count);
+BENCHMARK(BM_power_pow_ccm_n<double, -2>)->Arg(pow_bm_count);
+
+// Arguments are {count, input set}: random pairs and bases near 1, see pow_bm_pairs.
+BENCHMARK(BM_power_pow_pairs_std<double>)->ArgsProduct({{pow_bm_count}, {0, 1}});
+BENCHMARK(BM_power_pow_pairs_ccm<double>)->ArgsProduct({{pow_bm_count}, {0, 1}});
+
+BENCHMARK(BM_power_pow_std<float>)->ArgsProduct({{pow_bm_count}, {6, 30, -4, 1, -1, 5}});
+BENCHMARK(BM_power_pow_ccm<float>)->ArgsProduct({{pow_bm_count}, {6, 30, -4, 1, -1, 5}});
+BENCHMARK(BM_power_pow_ccm_n<float, 3>)->Arg(pow_bm_count);
+BENCHMARK(BM_power_pow_ccm_n<float, 15>)->Arg(pow_bm_count);
+BENCHMARK(BM_power_pow_ccm_n<float, -2>)->Arg(pow_bm_count);
+
+BENCHMARK(BM_power_pow_pairs_std<float>)->ArgsProduct({{pow_bm_count}, {0, 1}});
+BENCHMARK(BM_power_pow_pairs_ccm<float>)->ArgsProduct({{pow_bm_count}, {0, 1}});
+
+#ifndef CCM_BM_CONFIG_NO_RT
+BENCHMARK(BM_power_pow_pairs_ccm_batch<double>)->ArgsProduct({{pow_bm_count}, {0, 1}});
+BENCHMARK(BM_power_pow_array_ccm_batch<double>)->ArgsProduct({{pow_bm_count}, {6, 30, -4, 1, -1, 5}});
+BENCHMARK(BM_power_pow_base_std<double>)->Arg(pow_bm_count);
+BENCHMARK(BM_power_pow_base_ccm_batch<double>)->Arg(pow_bm_count);
+
+BENCHMARK(BM_power_pow_pairs_ccm_batch<float>)->ArgsProduct({{pow_bm_count}, {0, 1}});
+BENCHMARK(BM_power_pow_array_ccm_batch<float>)->ArgsProduct({{pow_bm_count}, {6, 30, -4, 1, -1, 5}});
+BENCHMARK(BM_power_pow_base_std<float>)->Arg(pow_bm_count);
+BENCHMARK(BM_power_pow_base_ccm_batch<float>)->Arg(pow_bm_count);
+#endif
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
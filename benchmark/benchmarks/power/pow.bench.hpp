@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/math/batch/power.hpp>
+#include <ccmath/math/power/pow.hpp>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+constexpr std::int64_t pow_bm_count = 4096;
+
+template <class T>
+std::vector<T> pow_bm_inputs(std::int64_t count)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(count, 0.5, 2.0);
+	return std::vector<T>(randomDoubles.begin(), randomDoubles.end());
+}
+
+// The exponent is range(1) / 2, read at runtime so that the dispatch on it is measured.
+template <class T>
+T pow_bm_exponent(const benchmark::State & state)
+{
+	return static_cast<T>(state.range(1)) / T{2};
+}
+
+template <class T>
+static void BM_power_pow_std(benchmark::State & state)
+{
+	const auto in  = pow_bm_inputs<T>(state.range(0));
+	const T exp	   = pow_bm_exponent<T>(state);
+	std::vector<T> out(in.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < in.size(); ++i) { out[i] = std::pow(in[i], exp); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T>
+static void BM_power_pow_ccm(benchmark::State & state)
+{
+	const auto in  = pow_bm_inputs<T>(state.range(0));
+	const T exp	   = pow_bm_exponent<T>(state);
+	std::vector<T> out(in.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < in.size(); ++i) { out[i] = ccm::pow(in[i], exp); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// ccm::pow<N>, with the exponent fixed at compile time.
+template <class T, int N>
+static void BM_power_pow_ccm_n(benchmark::State & state)
+{
+	const auto in = pow_bm_inputs<T>(state.range(0));
+	std::vector<T> out(in.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < in.size(); ++i) { out[i] = ccm::pow<N>(in[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Inputs for the general path, picked by range(1): 0 is x uniform in (0, 100] and y in [-10, 10], 1 is x within 2^-10
+// of 1 and y in [-1000, 1000], where log(x) is tiny and has to keep its relative precision.
+template <class T>
+std::vector<std::pair<T, T>> pow_bm_pairs(std::int64_t count, std::int64_t set)
+{
+	ccm::bench::Randomizer ran;
+	const auto xs = set == 0 ? ran.generateRandomDoubles(count, 0x1p-20, 100.0) : ran.generateRandomDoubles(count, 1.0 - 0x1p-10, 1.0 + 0x1p-10);
+	const auto ys = set == 0 ? ran.generateRandomDoubles(count, -10.0, 10.0) : ran.generateRandomDoubles(count, -1000.0, 1000.0);
+	std::vector<std::pair<T, T>> pairs;
+	pairs.reserve(xs.size());
+	for (std::size_t i = 0; i < xs.size(); ++i) { pairs.emplace_back(static_cast<T>(xs[i]), static_cast<T>(ys[i])); }
+	return pairs;
+}
+
+template <class T>
+static void BM_power_pow_pairs_std(benchmark::State & state)
+{
+	const auto in = pow_bm_pairs<T>(state.range(0), state.range(1));
+	std::vector<T> out(in.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < in.size(); ++i) { out[i] = std::pow(in[i].first, in[i].second); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T>
+static void BM_power_pow_pairs_ccm(benchmark::State & state)
+{
+	const auto in = pow_bm_pairs<T>(state.range(0), state.range(1));
+	std::vector<T> out(in.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < in.size(); ++i) { out[i] = ccm::pow(in[i].first, in[i].second); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#ifndef CCM_BM_CONFIG_NO_RT
+// Arrays
+
+// Every pair of a pow_bm_pairs set through ccm::batch::pow, with the bases and exponents in two arrays.
+template <class T>
+static void BM_power_pow_pairs_ccm_batch(benchmark::State & state)
+{
+	const auto in = pow_bm_pairs<T>(state.range(0), state.range(1));
+	std::vector<T> bases(in.size());
+	std::vector<T> exps(in.size());
+	for (std::size_t i = 0; i < in.size(); ++i)
+	{
+		bases[i] = in[i].first;
+		exps[i]	 = in[i].second;
+	}
+	std::vector<T> out(in.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::pow(bases.data(), exps.data(), out.data(), out.size());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// An array raised to one exponent, as in BM_power_pow_std.
+template <class T>
+static void BM_power_pow_array_ccm_batch(benchmark::State & state)
+{
+	const auto in = pow_bm_inputs<T>(state.range(0));
+	const T exp	  = pow_bm_exponent<T>(state);
+	std::vector<T> out(in.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::pow(in.data(), exp, out.data(), out.size());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// One base raised to an array of exponents in [-10, 10].
+template <class T>
+static void BM_power_pow_base_std(benchmark::State & state)
+{
+	const auto in = pow_bm_pairs<T>(state.range(0), 0);
+	std::vector<T> out(in.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < in.size(); ++i) { out[i] = std::pow(static_cast<T>(1.7), in[i].second); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T>
+static void BM_power_pow_base_ccm_batch(benchmark::State & state)
+{
+	const auto in = pow_bm_pairs<T>(state.range(0), 0);
+	std::vector<T> exps(in.size());
+	for (std::size_t i = 0; i < in.size(); ++i) { exps[i] = in[i].second; }
+	std::vector<T> out(in.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::pow(static_cast<T>(1.7), exps.data(), out.data(), out.size());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+#endif
+
+// NOLINTEND
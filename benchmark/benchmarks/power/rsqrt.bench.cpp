@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "rsqrt.bench.hpp"
+
+// NOLINTBEGIN
+
+BENCHMARK(BM_power_rsqrt_std<double>)->RangeMultiplier(4)->Range(64, 8 << 10)->Complexity();
+BENCHMARK(BM_power_rsqrt_ccm<double, rsqrt_precision::exact>)->RangeMultiplier(4)->Range(64, 8 << 10)->Complexity();
+BENCHMARK(BM_power_rsqrt_ccm<double, rsqrt_precision::newton>)->RangeMultiplier(4)->Range(64, 8 << 10)->Complexity();
+BENCHMARK(BM_power_rsqrt_ccm<double, rsqrt_precision::estimate>)->RangeMultiplier(4)->Range(64, 8 << 10)->Complexity();
+BENCHMARK(BM_power_rsqrt_ccm_simd<double, rsqrt_precision::newton>)->RangeMultiplier(4)->Range(64, 8 << 10)->Complexity();
+BENCHMARK(BM_power_rsqrt_ccm_simd<double, rsqrt_precision::estimate>)->RangeMultiplier(4)->Range(64, 8 << 10)->Complexity();
+
+BENCHMARK(BM_power_rsqrt_std<float>)->RangeMultiplier(4)->Range(64, 8 << 10)->Complexity();
+BENCHMARK(BM_power_rsqrt_ccm<float, rsqrt_precision::exact>)->RangeMultiplier(4)->Range(64, 8 << 10)->Complexity();
+BENCHMARK(BM_power_rsqrt_ccm<float, rsqrt_precision::newton>)->RangeMultiplier(4)->Range(64, 8 << 10)->Complexity();
+BENCHMARK(BM_power_rsqrt_ccm<float, rsqrt_precision::estimate>)->RangeMultiplier(4)->Range(64, 8 << 10)->Complexity();
+BENCHMARK(BM_power_rsqrt_ccm_simd<float, rsqrt_precision::newton>)->RangeMultiplier(4)->Range(64, 8 << 10)->Complexity();
+BENCHMARK(BM_power_rsqrt_ccm_simd<float, rsqrt_precision::estimate>)->RangeMultiplier(4)->Range(64, 8 << 10)->Complexity();
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/ext/rsqrt.hpp>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+using ccm::ext::rsqrt_precision;
+
+template <class T>
+std::vector<T> rsqrt_bm_inputs(std::int64_t count)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(count, 1e-3, 1e3);
+	return std::vector<T>(randomDoubles.begin(), randomDoubles.end());
+}
+
+// 1/std::sqrt, the baseline.
+template <class T>
+static void BM_power_rsqrt_std(benchmark::State & state)
+{
+	const auto in = rsqrt_bm_inputs<T>(state.range(0));
+	std::vector<T> out(in.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < in.size(); ++i) { out[i] = T{1} / std::sqrt(in[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+// ccm::ext::rsqrt one value at a time.
+template <class T, rsqrt_precision Precision>
+static void BM_power_rsqrt_ccm(benchmark::State & state)
+{
+	const auto in = rsqrt_bm_inputs<T>(state.range(0));
+	std::vector<T> out(in.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < in.size(); ++i) { out[i] = ccm::ext::rsqrt<Precision>(in[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+// ccm::ext::rsqrt on whole native vectors. The sizes are multiples of every native width.
+template <class T, rsqrt_precision Precision>
+static void BM_power_rsqrt_ccm_simd(benchmark::State & state)
+{
+	using simd_t  = ccm::intrin::simd<T, ccm::intrin::abi::native>;
+	const auto in = rsqrt_bm_inputs<T>(state.range(0));
+	std::vector<T> out(in.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < in.size(); i += simd_t::size())
+		{
+			ccm::ext::rsqrt<Precision>(simd_t(in.data() + i, ccm::intrin::element_aligned_tag())).copy_to(out.data() + i, ccm::intrin::element_aligned_tag());
+		}
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+// NOLINTEND
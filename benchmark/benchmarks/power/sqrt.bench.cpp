@@ -45,6 +45,12 @@ BENCHMARK(BM_power_sqrt_rand_double_ccm_rt)->RangeMultiplier(2)->Range(8, 8 << 1
 	#endif
 #endif
 
+#ifndef CCM_BM_CONFIG_NO_RT
+BENCHMARK(BM_power_sqrt_array_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_power_sqrt_array_ccm_batch)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+#endif
+
 BENCHMARK_MAIN();
 
 // NOLINTEND
\ No newline at end of file
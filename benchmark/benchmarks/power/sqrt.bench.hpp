@@ -11,6 +11,8 @@
 #include <benchmark/benchmark.h>
 #include <ccmath/ccmath.hpp>
 #include <cmath>
+#include <cstddef>
+#include <vector>
 
 namespace bm = benchmark;
 
@@ -144,6 +146,36 @@ static void BM_power_sqrt_rand_double_ccm_rt(benchmark::State & state)
 }
 
 	#endif
+
+// Arrays
+
+static void BM_power_sqrt_array_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0));
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i) { out[i] = std::sqrt(randomDoubles[i]); }
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_power_sqrt_array_ccm_batch(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0));
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::sqrt(randomDoubles.data(), out.data(), randomDoubles.size());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
 #endif
 
 // NOLINTEND
\ No newline at end of file
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "dispatch.bench.hpp"
+
+// NOLINTBEGIN
+
+using ccm::rt::simd_level;
+
+BENCHMARK_CAPTURE(BM_simd_dispatch_exp, scalar, simd_level::scalar)->Arg(4096);
+BENCHMARK_CAPTURE(BM_simd_dispatch_exp, native, ccm::rt::simd_impl::compiled_simd_level())->Arg(4096);
+BENCHMARK_CAPTURE(BM_simd_dispatch_exp, avx2, simd_level::avx2)->Arg(4096);
+BENCHMARK_CAPTURE(BM_simd_dispatch_exp, avx512, simd_level::avx512)->Arg(4096);
+
+BENCHMARK_CAPTURE(BM_simd_dispatch_log, scalar, simd_level::scalar)->Arg(4096);
+BENCHMARK_CAPTURE(BM_simd_dispatch_log, native, ccm::rt::simd_impl::compiled_simd_level())->Arg(4096);
+BENCHMARK_CAPTURE(BM_simd_dispatch_log, avx2, simd_level::avx2)->Arg(4096);
+BENCHMARK_CAPTURE(BM_simd_dispatch_log, avx512, simd_level::avx512)->Arg(4096);
+
+BENCHMARK_CAPTURE(BM_simd_dispatch_sin, scalar, simd_level::scalar)->Arg(4096);
+BENCHMARK_CAPTURE(BM_simd_dispatch_sin, native, ccm::rt::simd_impl::compiled_simd_level())->Arg(4096);
+BENCHMARK_CAPTURE(BM_simd_dispatch_sin, avx2, simd_level::avx2)->Arg(4096);
+BENCHMARK_CAPTURE(BM_simd_dispatch_sin, avx512, simd_level::avx512)->Arg(4096);
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/ccmath.hpp>
+#include <vector>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+// One batch kernel on every tier of the runtime dispatch: the scalar kernel, the compile time target and the target
+// attribute tiers above it. Tiers this binary or host does not have are skipped. Build with
+// CMAKE_BUILD_TYPE=RelWithDebInfo as well as Release to check that the target attribute tiers keep their speed at -O2.
+
+template <class Kernel>
+static void run_dispatch_tier(benchmark::State & state, ccm::rt::simd_level level, double min, double max)
+{
+	using namespace ccm::rt;
+
+	const simd_impl::batch_fn<double> kernel = simd_impl::batch_kernel_for<Kernel, double>(level);
+	if (kernel == nullptr || !supports_simd_level(host_cpu_features(), level))
+	{
+		state.SkipWithError("tier not available");
+		return;
+	}
+
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), min, max);
+	std::vector<double> out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		kernel(randomDoubles.data(), out.data(), randomDoubles.size());
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_simd_dispatch_exp(benchmark::State & state, ccm::rt::simd_level level)
+{
+	run_dispatch_tier<ccm::rt::simd_impl::exp_batch_kernel>(state, level, -700.0, 700.0);
+}
+
+static void BM_simd_dispatch_log(benchmark::State & state, ccm::rt::simd_level level)
+{
+	run_dispatch_tier<ccm::rt::simd_impl::log_batch_kernel>(state, level, 1e-6, 1e6);
+}
+
+static void BM_simd_dispatch_sin(benchmark::State & state, ccm::rt::simd_level level)
+{
+	run_dispatch_tier<ccm::rt::simd_impl::sin_batch_kernel>(state, level, -100.0, 100.0);
+}
+
+// NOLINTEND
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "operations.bench.hpp"
+
+// NOLINTBEGIN
+
+BENCHMARK_TEMPLATE(BM_simd_fma, ccm::intrin::abi::scalar)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_min_max, ccm::intrin::abi::scalar)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_abs_copysign, ccm::intrin::abi::scalar)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rsqrt, ccm::intrin::abi::scalar)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rcp, ccm::intrin::abi::scalar)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_floor_round, ccm::intrin::abi::scalar)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_compare, ccm::intrin::abi::scalar)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_where_add, ccm::intrin::abi::scalar)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_choose_add, ccm::intrin::abi::scalar)->Arg(4096);
+
+BENCHMARK_TEMPLATE(BM_simd_fma, ccm::intrin::abi::pack<4>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_min_max, ccm::intrin::abi::pack<4>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_abs_copysign, ccm::intrin::abi::pack<4>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rsqrt, ccm::intrin::abi::pack<4>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rcp, ccm::intrin::abi::pack<4>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_floor_round, ccm::intrin::abi::pack<4>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_compare, ccm::intrin::abi::pack<4>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_where_add, ccm::intrin::abi::pack<4>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_choose_add, ccm::intrin::abi::pack<4>)->Arg(4096);
+
+#ifdef CCMATH_HAS_SIMD_SSE2
+BENCHMARK_TEMPLATE(BM_simd_fma, ccm::intrin::abi::sse2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_min_max, ccm::intrin::abi::sse2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_abs_copysign, ccm::intrin::abi::sse2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rsqrt, ccm::intrin::abi::sse2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rcp, ccm::intrin::abi::sse2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_floor_round, ccm::intrin::abi::sse2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_compare, ccm::intrin::abi::sse2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_where_add, ccm::intrin::abi::sse2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_choose_add, ccm::intrin::abi::sse2)->Arg(4096);
+#endif
+
+#ifdef CCMATH_HAS_SIMD_SSE4
+BENCHMARK_TEMPLATE(BM_simd_fma, ccm::intrin::abi::sse4)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_min_max, ccm::intrin::abi::sse4)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_abs_copysign, ccm::intrin::abi::sse4)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rsqrt, ccm::intrin::abi::sse4)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rcp, ccm::intrin::abi::sse4)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_floor_round, ccm::intrin::abi::sse4)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_compare, ccm::intrin::abi::sse4)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_where_add, ccm::intrin::abi::sse4)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_choose_add, ccm::intrin::abi::sse4)->Arg(4096);
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX
+BENCHMARK_TEMPLATE(BM_simd_fma, ccm::intrin::abi::avx)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_min_max, ccm::intrin::abi::avx)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_abs_copysign, ccm::intrin::abi::avx)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rsqrt, ccm::intrin::abi::avx)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rcp, ccm::intrin::abi::avx)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_floor_round, ccm::intrin::abi::avx)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_compare, ccm::intrin::abi::avx)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_where_add, ccm::intrin::abi::avx)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_choose_add, ccm::intrin::abi::avx)->Arg(4096);
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX2
+BENCHMARK_TEMPLATE(BM_simd_fma, ccm::intrin::abi::avx2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_min_max, ccm::intrin::abi::avx2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_abs_copysign, ccm::intrin::abi::avx2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rsqrt, ccm::intrin::abi::avx2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rcp, ccm::intrin::abi::avx2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_floor_round, ccm::intrin::abi::avx2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_compare, ccm::intrin::abi::avx2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_where_add, ccm::intrin::abi::avx2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_choose_add, ccm::intrin::abi::avx2)->Arg(4096);
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX512F
+BENCHMARK_TEMPLATE(BM_simd_fma, ccm::intrin::abi::avx512)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_min_max, ccm::intrin::abi::avx512)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_abs_copysign, ccm::intrin::abi::avx512)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rsqrt, ccm::intrin::abi::avx512)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rcp, ccm::intrin::abi::avx512)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_floor_round, ccm::intrin::abi::avx512)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_compare, ccm::intrin::abi::avx512)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_where_add, ccm::intrin::abi::avx512)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_choose_add, ccm::intrin::abi::avx512)->Arg(4096);
+#endif
+
+#ifdef CCMATH_HAS_SIMD_NEON
+BENCHMARK_TEMPLATE(BM_simd_fma, ccm::intrin::abi::neon)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_min_max, ccm::intrin::abi::neon)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_abs_copysign, ccm::intrin::abi::neon)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rsqrt, ccm::intrin::abi::neon)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_rcp, ccm::intrin::abi::neon)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_floor_round, ccm::intrin::abi::neon)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_compare, ccm::intrin::abi::neon)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_where_add, ccm::intrin::abi::neon)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_choose_add, ccm::intrin::abi::neon)->Arg(4096);
+#endif
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/internal/math/runtime/simd/simd.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+// Throughput of the simd operation set on one ABI over an array of doubles in [0.5, 1000), the range where the
+// estimates and the rounding functions do real work. The lanes counter is the simd width. Comparing the same operation
+// across ABIs shows what each instruction set gains over the scalar and pack fallbacks.
+
+template <class Abi, class Op>
+static void run_simd_operation(benchmark::State & state, Op op)
+{
+	using V						= ccm::intrin::simd<double, Abi>;
+	constexpr std::size_t width = static_cast<std::size_t>(V::size());
+
+	ccm::bench::Randomizer ran;
+	auto a = ran.generateRandomDoubles(state.range(0), 0.5, 1000.0);
+	auto b = ran.generateRandomDoubles(state.range(0), 0.5, 1000.0);
+	std::vector<double> out(a.size());
+
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i + width <= a.size(); i += width)
+		{
+			const V x(&a[i], ccm::intrin::element_aligned_tag());
+			const V y(&b[i], ccm::intrin::element_aligned_tag());
+			op(x, y).copy_to(&out[i], ccm::intrin::element_aligned_tag());
+		}
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.counters["lanes"] = static_cast<double>(width);
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+template <class Abi>
+static void BM_simd_fma(benchmark::State & state)
+{
+	run_simd_operation<Abi>(state, [](auto const & x, auto const & y) { return fma(x, y, fnma(y, x, x)); });
+}
+
+template <class Abi>
+static void BM_simd_min_max(benchmark::State & state)
+{
+	run_simd_operation<Abi>(state, [](auto const & x, auto const & y) { return max(min(x, y), y * 0.75); });
+}
+
+template <class Abi>
+static void BM_simd_abs_copysign(benchmark::State & state)
+{
+	run_simd_operation<Abi>(state, [](auto const & x, auto const & y) { return abs(copysign(x, -y)); });
+}
+
+template <class Abi>
+static void BM_simd_rsqrt(benchmark::State & state)
+{
+	run_simd_operation<Abi>(state, [](auto const & x, auto const & /*y*/) { return rsqrt(x); });
+}
+
+template <class Abi>
+static void BM_simd_rcp(benchmark::State & state)
+{
+	run_simd_operation<Abi>(state, [](auto const & x, auto const & /*y*/) { return rcp(x); });
+}
+
+template <class Abi>
+static void BM_simd_floor_round(benchmark::State & state)
+{
+	run_simd_operation<Abi>(state, [](auto const & x, auto const & y) { return floor(x) + round(y); });
+}
+
+template <class Abi>
+static void BM_simd_compare(benchmark::State & state)
+{
+	run_simd_operation<Abi>(state, [](auto const & x, auto const & y) { return choose((x <= y) && (x != y * 0.5), x, y); });
+}
+
+// Adding to the lanes below a threshold, by a masked add and by a full add and a blend. The two match on ABIs without
+// mask registers.
+template <class Abi>
+static void BM_simd_where_add(benchmark::State & state)
+{
+	run_simd_operation<Abi>(state,
+							[](auto const & x, auto const & y)
+							{
+								auto result = x;
+								where(x < y, result) += y;
+								return result;
+							});
+}
+
+template <class Abi>
+static void BM_simd_choose_add(benchmark::State & state)
+{
+	run_simd_operation<Abi>(state, [](auto const & x, auto const & y) { return choose(x < y, x + y, x); });
+}
+
+// NOLINTEND
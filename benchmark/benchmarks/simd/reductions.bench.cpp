@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "reductions.bench.hpp"
+
+// NOLINTBEGIN
+
+BENCHMARK_TEMPLATE(BM_simd_reduce_add, ccm::intrin::abi::scalar)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_add_spill, ccm::intrin::abi::scalar)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_max, ccm::intrin::abi::scalar)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_prefix_sum, ccm::intrin::abi::scalar)->Arg(4096);
+
+BENCHMARK_TEMPLATE(BM_simd_reduce_add, ccm::intrin::abi::pack<4>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_add_spill, ccm::intrin::abi::pack<4>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_max, ccm::intrin::abi::pack<4>)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_prefix_sum, ccm::intrin::abi::pack<4>)->Arg(4096);
+
+#ifdef CCMATH_HAS_SIMD_SSE2
+BENCHMARK_TEMPLATE(BM_simd_reduce_add, ccm::intrin::abi::sse2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_add_spill, ccm::intrin::abi::sse2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_max, ccm::intrin::abi::sse2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_prefix_sum, ccm::intrin::abi::sse2)->Arg(4096);
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX
+BENCHMARK_TEMPLATE(BM_simd_reduce_add, ccm::intrin::abi::avx)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_add_spill, ccm::intrin::abi::avx)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_max, ccm::intrin::abi::avx)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_prefix_sum, ccm::intrin::abi::avx)->Arg(4096);
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX2
+BENCHMARK_TEMPLATE(BM_simd_reduce_add, ccm::intrin::abi::avx2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_add_spill, ccm::intrin::abi::avx2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_max, ccm::intrin::abi::avx2)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_prefix_sum, ccm::intrin::abi::avx2)->Arg(4096);
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX512F
+BENCHMARK_TEMPLATE(BM_simd_reduce_add, ccm::intrin::abi::avx512)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_add_spill, ccm::intrin::abi::avx512)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_max, ccm::intrin::abi::avx512)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_prefix_sum, ccm::intrin::abi::avx512)->Arg(4096);
+#endif
+
+#ifdef CCMATH_HAS_SIMD_NEON
+BENCHMARK_TEMPLATE(BM_simd_reduce_add, ccm::intrin::abi::neon)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_add_spill, ccm::intrin::abi::neon)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_reduce_max, ccm::intrin::abi::neon)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_simd_prefix_sum, ccm::intrin::abi::neon)->Arg(4096);
+#endif
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/internal/math/runtime/simd/simd.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+// Reductions over an array of doubles on one ABI. Every vector is reduced on its own, which is what a caller summing
+// the outputs of a vector kernel does. BM_simd_reduce_add_spill reduces by storing the vector and adding its lanes, the
+// pattern the reductions replace. The lanes counter is the simd width.
+
+template <class Abi>
+static void BM_simd_reduce_add(benchmark::State & state)
+{
+	using V						= ccm::intrin::simd<double, Abi>;
+	constexpr std::size_t width = static_cast<std::size_t>(V::size());
+
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1000.0, 1000.0);
+
+	for ([[maybe_unused]] auto _ : state)
+	{
+		double sum = 0.0;
+		for (std::size_t i = 0; i + width <= randomDoubles.size(); i += width)
+		{
+			sum += reduce_add(V(&randomDoubles[i], ccm::intrin::element_aligned_tag()));
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.counters["lanes"] = static_cast<double>(width);
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+template <class Abi>
+static void BM_simd_reduce_add_spill(benchmark::State & state)
+{
+	using V						= ccm::intrin::simd<double, Abi>;
+	constexpr std::size_t width = static_cast<std::size_t>(V::size());
+
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1000.0, 1000.0);
+
+	for ([[maybe_unused]] auto _ : state)
+	{
+		double sum = 0.0;
+		for (std::size_t i = 0; i + width <= randomDoubles.size(); i += width)
+		{
+			std::array<double, width> lanes;
+			V(&randomDoubles[i], ccm::intrin::element_aligned_tag()).copy_to(lanes.data(), ccm::intrin::element_aligned_tag());
+			for (const double lane : lanes) { sum += lane; }
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.counters["lanes"] = static_cast<double>(width);
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+template <class Abi>
+static void BM_simd_reduce_max(benchmark::State & state)
+{
+	using V						= ccm::intrin::simd<double, Abi>;
+	constexpr std::size_t width = static_cast<std::size_t>(V::size());
+
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1000.0, 1000.0);
+
+	for ([[maybe_unused]] auto _ : state)
+	{
+		double maximum = -1e300;
+		for (std::size_t i = 0; i + width <= randomDoubles.size(); i += width)
+		{
+			const double lane_max = reduce_max(V(&randomDoubles[i], ccm::intrin::element_aligned_tag()));
+			maximum				  = maximum < lane_max ? lane_max : maximum;
+		}
+		benchmark::DoNotOptimize(maximum);
+	}
+	state.counters["lanes"] = static_cast<double>(width);
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+// Running sum of the whole array: the prefix sums of each vector plus the total of everything before it.
+template <class Abi>
+static void BM_simd_prefix_sum(benchmark::State & state)
+{
+	using V						= ccm::intrin::simd<double, Abi>;
+	constexpr std::size_t width = static_cast<std::size_t>(V::size());
+
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -1000.0, 1000.0);
+	std::vector<double> out(randomDoubles.size());
+
+	for ([[maybe_unused]] auto _ : state)
+	{
+		double carry = 0.0;
+		for (std::size_t i = 0; i + width <= randomDoubles.size(); i += width)
+		{
+			const V x(&randomDoubles[i], ccm::intrin::element_aligned_tag());
+			(prefix_sum(x) + V(carry)).copy_to(&out[i], ccm::intrin::element_aligned_tag());
+			carry = out[i + width - 1];
+		}
+		benchmark::DoNotOptimize(out.data());
+		benchmark::ClobberMemory();
+	}
+	state.counters["lanes"] = static_cast<double>(width);
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+// NOLINTEND
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "trig.bench.hpp"
+
+// NOLINTBEGIN
+
+BENCHMARK(BM_trig_sin_cos_loop_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_trig_sin_cos_loop_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_trig_sincos_loop_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_trig_sin_cos_batch_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_trig_sincos_batch_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_trig_atan2_loop_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_trig_atan2_loop_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_trig_atan2_batch_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_trig_polar_loop_std)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK(BM_trig_polar_batch_ccm)->RangeMultiplier(2)->Range(8, 8 << 10)->Complexity();
+
+BENCHMARK_MAIN();
+
+// NOLINTEND
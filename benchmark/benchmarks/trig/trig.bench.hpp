@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024-Present Ian Pike
+ * Copyright (c) 2024-Present ccmath contributors
+ *
+ * This library is provided under the MIT License.
+ * See LICENSE for more information.
+ */
+
+#include "../../helpers/randomizers.hpp"
+
+#include <benchmark/benchmark.h>
+#include <ccmath/ccmath.hpp>
+#include <cmath>
+#include <vector>
+
+namespace bm = benchmark;
+
+// NOLINTBEGIN
+
+// Sine and cosine of the same angles, computed separately and with sincos, which reduces each argument once.
+
+static void BM_trig_sin_cos_loop_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	std::vector<double> sin_out(randomDoubles.size());
+	std::vector<double> cos_out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i)
+		{
+			sin_out[i] = std::sin(randomDoubles[i]);
+			cos_out[i] = std::cos(randomDoubles[i]);
+		}
+		benchmark::DoNotOptimize(sin_out.data());
+		benchmark::DoNotOptimize(cos_out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_trig_sin_cos_loop_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	std::vector<double> sin_out(randomDoubles.size());
+	std::vector<double> cos_out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i)
+		{
+			sin_out[i] = ccm::sin(randomDoubles[i]);
+			cos_out[i] = ccm::cos(randomDoubles[i]);
+		}
+		benchmark::DoNotOptimize(sin_out.data());
+		benchmark::DoNotOptimize(cos_out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_trig_sincos_loop_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	std::vector<double> sin_out(randomDoubles.size());
+	std::vector<double> cos_out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < randomDoubles.size(); ++i) { ccm::sincos(randomDoubles[i], &sin_out[i], &cos_out[i]); }
+		benchmark::DoNotOptimize(sin_out.data());
+		benchmark::DoNotOptimize(cos_out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_trig_sin_cos_batch_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	std::vector<double> sin_out(randomDoubles.size());
+	std::vector<double> cos_out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::sin(randomDoubles.data(), sin_out.data(), randomDoubles.size());
+		ccm::batch::cos(randomDoubles.data(), cos_out.data(), randomDoubles.size());
+		benchmark::DoNotOptimize(sin_out.data());
+		benchmark::DoNotOptimize(cos_out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_trig_sincos_batch_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto randomDoubles = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	std::vector<double> sin_out(randomDoubles.size());
+	std::vector<double> cos_out(randomDoubles.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::sincos(randomDoubles.data(), sin_out.data(), cos_out.data(), randomDoubles.size());
+		benchmark::DoNotOptimize(sin_out.data());
+		benchmark::DoNotOptimize(cos_out.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+// Cartesian to polar conversion: atan2 alone and together with the radius, per element and batched.
+
+static void BM_trig_atan2_loop_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto x = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	auto y = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	std::vector<double> theta(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < x.size(); ++i) { theta[i] = std::atan2(y[i], x[i]); }
+		benchmark::DoNotOptimize(theta.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_trig_atan2_loop_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto x = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	auto y = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	std::vector<double> theta(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < x.size(); ++i) { theta[i] = ccm::atan2(y[i], x[i]); }
+		benchmark::DoNotOptimize(theta.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_trig_atan2_batch_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto x = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	auto y = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	std::vector<double> theta(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::atan2(y.data(), x.data(), theta.data(), x.size());
+		benchmark::DoNotOptimize(theta.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_trig_polar_loop_std(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto x = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	auto y = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	std::vector<double> r(x.size());
+	std::vector<double> theta(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		for (std::size_t i = 0; i < x.size(); ++i)
+		{
+			r[i]	 = std::hypot(x[i], y[i]);
+			theta[i] = std::atan2(y[i], x[i]);
+		}
+		benchmark::DoNotOptimize(r.data());
+		benchmark::DoNotOptimize(theta.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+static void BM_trig_polar_batch_ccm(benchmark::State & state)
+{
+	ccm::bench::Randomizer ran;
+	auto x = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	auto y = ran.generateRandomDoubles(state.range(0), -100.0, 100.0);
+	std::vector<double> r(x.size());
+	std::vector<double> theta(x.size());
+	for ([[maybe_unused]] auto _ : state)
+	{
+		ccm::batch::polar(x.data(), y.data(), r.data(), theta.data(), x.size());
+		benchmark::DoNotOptimize(r.data());
+		benchmark::DoNotOptimize(theta.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetComplexityN(state.range(0));
+}
+
+// NOLINTEND
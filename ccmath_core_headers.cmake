@@ -38,6 +38,20 @@ set(ccmath_math_basic_headers
 
 
 
+#######################################
+## Batch headers
+#######################################
+
+set(ccmath_math_batch_headers
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/batch/basic.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/batch/exponential.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/batch/hyperbolic.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/batch/power.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/batch/trig.hpp
+)
+
+
+
 #######################################
 ## Compare headers
 #######################################
@@ -67,12 +81,19 @@ set(ccmath_math_exponential_impl_headers
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/exp2_float_impl.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/exp2_double_impl.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/exp2_data.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/expm1_float_impl.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/expm1_double_impl.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/log_float_impl.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/log_double_impl.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/log_data.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/log1p_float_impl.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/log1p_double_impl.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/log10_float_impl.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/log10_double_impl.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/log2_float_impl.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/log2_double_impl.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/log2_data.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential/impl/table_gen.hpp
 )
 
 
@@ -134,6 +155,7 @@ set(ccmath_math_hyperbolic_headers
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/hyperbolic/atanh.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/hyperbolic/cosh.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/hyperbolic/sinh.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/hyperbolic/sinhcosh.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/hyperbolic/tanh.hpp
 )
 
@@ -215,6 +237,7 @@ set(ccmath_math_trig_headers
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/trig/atan2.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/trig/cos.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/trig/sin.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/trig/sincos.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/trig/tan.hpp
 )
 
@@ -232,6 +255,7 @@ set(ccmath_math_misc_headers
 
 set(ccmath_math_headers
         ${ccmath_math_basic_headers}
+        ${ccmath_math_batch_headers}
         ${ccmath_math_compare_headers}
         ${ccmath_math_exponential_headers}
         ${ccmath_math_fmanip_headers}
@@ -257,6 +281,7 @@ set(ccmath_math_headers
 
 set(ccmath_monolithic_headers
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/basic.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/batch.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/compare.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/exponential.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/math/fmanip.hpp
@@ -9,10 +9,13 @@ set(ccmath_extensions_headers
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/ext/is_power_of_two.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/ext/lerp_smooth.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/ext/mix.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/ext/norm.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/ext/normalize.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/ext/ping_pong.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/ext/radians.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/ext/rcp.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/ext/rsqrt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/ext/sincos_sequence.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/ext/smoothstep.hpp
 
 
@@ -102,7 +102,9 @@ set(ccmath_internal_math_generic_func_hyperbolic_headers
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/hyperbolic/asinh_gen.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/hyperbolic/atanh_gen.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/hyperbolic/cosh_gen.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/hyperbolic/hyperbolic_kernels_gen.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/hyperbolic/sinh_gen.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/hyperbolic/sinhcosh_gen.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/hyperbolic/tanh_gen.hpp
 )
 
@@ -129,9 +131,11 @@ set(ccmath_internal_math_generic_func_nearest_headers
 ### Math/Generic/Func/Power headers
 ##########################################
 set(ccmath_internal_math_generic_func_power_headers
-        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/nearest/cbrt_gen.hpp
-        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/nearest/hypot_gen.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/power/cbrt_gen.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/power/hypot_gen.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/nearest/pow_gen.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/power/pow_int_gen.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/power/rsqrt_gen.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/nearest/sqrt_gen.hpp
 )
 
@@ -169,9 +173,14 @@ set(ccmath_internal_math_generic_func_trig_headers
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/trig/acos_gen.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/trig/asin_gen.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/trig/atan2_gen.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/trig/atan_gen.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/trig/cos_gen.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/trig/inverse_trig_kernels_gen.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/trig/rem_pio2_gen.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/trig/sin_gen.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/trig/sincos_gen.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/trig/tan_gen.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/generic/func/trig/trig_kernels_gen.hpp
 )
 
 
@@ -198,10 +207,72 @@ set(ccmath_internal_math_generic_headers
 
 
 
+### Math/Runtime/func/Basic headers
+##########################################
+set(ccmath_internal_math_runtime_func_basic_headers
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/basic/fma_rt.hpp
+)
+
+
+### Math/Runtime/func/Exponential headers
+##########################################
+set(ccmath_internal_math_runtime_func_exponential_headers
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/exponential/exp_rt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/exponential/exp2_rt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/exponential/log_rt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/exponential/log2_rt.hpp
+)
+
+
+### Math/Runtime/func/Hyperbolic headers
+##########################################
+set(ccmath_internal_math_runtime_func_hyperbolic_headers
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/hyperbolic/hyperbolic_rt.hpp
+)
+
+
+### Math/Runtime/func/Nearest headers
+##########################################
+set(ccmath_internal_math_runtime_func_nearest_headers
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/nearest/ceil_rt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/nearest/floor_rt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/nearest/nearbyint_rt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/nearest/rint_rt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/nearest/round_rt.hpp
+)
+
+
+### Math/Runtime/func/Power headers
+##########################################
+set(ccmath_internal_math_runtime_func_power_headers
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/power/cbrt_rt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/power/hypot_rt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/power/pow_rt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/power/rsqrt_rt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/power/sqrt_rt.hpp
+)
+
+
+### Math/Runtime/func/Trig headers
+##########################################
+set(ccmath_internal_math_runtime_func_trig_headers
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/trig/atan2_rt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/trig/sincos_rt.hpp
+)
+
+
 ### Math/Runtime/func headers
 ##########################################
 set(ccmath_internal_math_runtime_func_headers
+        ${ccmath_internal_math_runtime_func_basic_headers}
+        ${ccmath_internal_math_runtime_func_exponential_headers}
+        ${ccmath_internal_math_runtime_func_hyperbolic_headers}
+        ${ccmath_internal_math_runtime_func_nearest_headers}
         ${ccmath_internal_math_runtime_func_power_headers}
+        ${ccmath_internal_math_runtime_func_trig_headers}
+
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/batch_rt.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/func/dispatch_rt.hpp
 )
 
 
@@ -275,6 +346,13 @@ set(ccmath_internal_math_runtime_simd_func_impl_ssse3_headers
 )
 
 
+### math/runtime/Simd/Func/Impl/Sve headers
+##########################################
+set(ccmath_internal_math_runtime_simd_func_impl_sve_headers
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/func/impl/sve/sqrt.hpp
+)
+
+
 ### math/runtime/Simd/Func/Impl/Vector_Size headers
 ##########################################
 set(ccmath_internal_math_runtime_simd_func_impl_vector_size_headers
@@ -294,6 +372,7 @@ set(ccmath_internal_math_runtime_simd_func_headers
         ${ccmath_internal_math_runtime_simd_func_impl_sse3_headers}
         ${ccmath_internal_math_runtime_simd_func_impl_ssse3_headers}
         ${ccmath_internal_math_runtime_simd_func_impl_sse4_headers}
+        ${ccmath_internal_math_runtime_simd_func_impl_sve_headers}
         ${ccmath_internal_math_runtime_simd_func_impl_vector_size_headers}
 
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/func/sqrt.hpp
@@ -304,14 +383,17 @@ set(ccmath_internal_math_runtime_simd_func_headers
 ##########################################
 set(ccmath_internal_math_runtime_simd_instructions_headers
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/instructions/scalar.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/instructions/sse_int.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/instructions/sse2.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/instructions/sse3.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/instructions/ssse3.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/instructions/sse4.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/instructions/avx_int.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/instructions/avx.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/instructions/avx2.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/instructions/avx512.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/instructions/neon.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/math/runtime/simd/instructions/sve.hpp
 )
 
 
@@ -352,6 +434,7 @@ set(ccmath_internal_predef_attributes_headers
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/predef/attributes/never_inline.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/predef/attributes/no_debug.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/predef/attributes/optnone.hpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/predef/attributes/target.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/predef/attributes/gsl_suppress.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/predef/attributes/gpu_device.hpp
         ${CMAKE_CURRENT_SOURCE_DIR}/include/ccmath/internal/predef/attributes/gpu_host_device.hpp
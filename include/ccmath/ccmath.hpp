@@ -13,6 +13,9 @@
 /// Basic math func
 #include "math/basic.hpp"
 
+/// Batched array func
+#include "math/batch.hpp"
+
 /// Comparison func
 #include "math/compare.hpp"
 
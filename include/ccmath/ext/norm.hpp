@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+namespace ccm::ext
+{
+	namespace internal
+	{
+		/// 2^exponent, evaluated at compile time for the constants of norm_blue_constants.
+		template <typename T>
+		constexpr T norm_pow2(int exponent) noexcept
+		{
+			T result = 1;
+			for (; exponent > 0; --exponent) { result *= 2; }
+			for (; exponent < 0; ++exponent) { result /= 2; }
+			return result;
+		}
+
+		/**
+		 * @brief Thresholds and scale factors of Blue's algorithm, as chosen by Anderson for the LAPACK 3.10 nrm2.
+		 *
+		 * Magnitudes in [small_threshold, big_threshold] can be squared and summed any number of times a program can
+		 * hold in memory without overflow or harmful underflow. Smaller magnitudes are scaled up by small_scale and bigger
+		 * ones down by big_scale before squaring, which is exact since all four are powers of two. For double these are
+		 * 2^-511, 2^486, 2^537 and 2^-538.
+		 */
+		template <typename T>
+		struct norm_blue_constants
+		{
+			static constexpr int min_exponent = std::numeric_limits<T>::min_exponent;
+			static constexpr int max_exponent = std::numeric_limits<T>::max_exponent;
+			static constexpr int digits		  = std::numeric_limits<T>::digits;
+
+			static constexpr T small_threshold = norm_pow2<T>(-((1 - min_exponent) / 2));
+			static constexpr T big_threshold   = norm_pow2<T>((max_exponent - digits + 1) / 2);
+			static constexpr T small_scale	   = norm_pow2<T>((digits - min_exponent + 1) / 2);
+			static constexpr T big_scale	   = norm_pow2<T>(-((max_exponent + digits) / 2));
+		};
+
+		/// Sums of the scaled squares of the small, medium and big magnitudes.
+		template <typename T>
+		struct norm_sums
+		{
+			T small{0};
+			T medium{0};
+			T big{0};
+		};
+
+		/// Add the square of |value| to the accumulator its magnitude belongs to. NaN goes to the medium one.
+		template <typename T>
+		constexpr void norm_accumulate(norm_sums<T> & sums, T value) noexcept
+		{
+			using constants = norm_blue_constants<T>;
+			const T magnitude = value < 0 ? -value : value;
+			if (magnitude > constants::big_threshold)
+			{
+				const T scaled = magnitude * constants::big_scale;
+				sums.big += scaled * scaled;
+			}
+			else if (magnitude < constants::small_threshold)
+			{
+				const T scaled = magnitude * constants::small_scale;
+				sums.small += scaled * scaled;
+			}
+			else { sums.medium += magnitude * magnitude; }
+		}
+
+		/// Combine the three sums into the norm. Only the two adjacent accumulators that matter are combined.
+		template <typename T>
+		constexpr T norm_finish(const norm_sums<T> & sums) noexcept
+		{
+			using constants = norm_blue_constants<T>;
+			if (sums.big > 0)
+			{
+				// An infinite element wins over any NaN that went to the medium sum.
+				if (sums.big == std::numeric_limits<T>::infinity()) { return sums.big; }
+				const T big = sums.big + (sums.medium * constants::big_scale) * constants::big_scale;
+				return ccm::sqrt(big) / constants::big_scale;
+			}
+			if (sums.small > 0 && !(sums.medium > 0))
+			{
+				// Also taken for a NaN medium sum, which the small one must not hide.
+				if (sums.medium != sums.medium) { return sums.medium; }
+				return ccm::sqrt(sums.small) / constants::small_scale;
+			}
+			if (sums.small > 0)
+			{
+				// The small sum only matters when the medium one is small itself, so both are combined as norms.
+				const T medium = ccm::sqrt(sums.medium);
+				const T small  = ccm::sqrt(sums.small) / constants::small_scale;
+				const T larger = medium > small ? medium : small;
+				const T ratio  = (medium > small ? small : medium) / larger;
+				return larger * ccm::sqrt(1 + ratio * ratio);
+			}
+			return ccm::sqrt(sums.medium);
+		}
+
+#ifdef CCMATH_HAS_SIMD
+		/// Blue's accumulation with one accumulator triple per lane. Every lane computes all three squares and keeps one by masks.
+		template <typename T>
+		inline norm_sums<T> norm_accumulate_simd(const T * values, std::size_t count) noexcept
+		{
+			using constants		 = norm_blue_constants<T>;
+			using simd_t		 = intrin::simd<T, intrin::abi::native>;
+			constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+			simd_t small(T{0});
+			simd_t medium(T{0});
+			simd_t big(T{0});
+			const simd_t big_threshold(constants::big_threshold);
+			const simd_t small_threshold(constants::small_threshold);
+			const simd_t big_scale(constants::big_scale);
+			const simd_t small_scale(constants::small_scale);
+
+			std::size_t i = 0;
+			for (; i + width <= count; i += width)
+			{
+				const simd_t magnitude = intrin::abs(simd_t(values + i, intrin::element_aligned_tag()));
+				const auto is_big	   = magnitude > big_threshold;
+				const auto is_small	   = magnitude < small_threshold;
+
+				// The lanes a side sum does not take square a threshold instead, so that they cannot underflow: subnormal
+				// results of the discarded products would cost a microcode assist on every element.
+				simd_t big_part					 = big_threshold;
+				simd_t small_part				 = small_threshold;
+				intrin::where(is_big, big_part)	 = magnitude;
+				intrin::where(is_small, small_part) = magnitude;
+				big_part *= big_scale;
+				small_part *= small_scale;
+				intrin::where(is_big, big) += big_part * big_part;
+				intrin::where(is_small, small) += small_part * small_part;
+				intrin::where(!(is_big || is_small), medium) += magnitude * magnitude;
+			}
+
+			norm_sums<T> sums{intrin::reduce_add(small), intrin::reduce_add(medium), intrin::reduce_add(big)};
+			for (; i < count; ++i) { norm_accumulate(sums, values[i]); }
+			return sums;
+		}
+#endif
+	} // namespace internal
+
+	/**
+	 * @brief Computes the Euclidean norm sqrt(x_0^2 + x_1^2 + ...) of an array without undue overflow or underflow.
+	 *
+	 * Uses Blue's algorithm in a single pass: magnitudes in the wide middle range are squared and summed as they are, and
+	 * only magnitudes close to overflow or underflow are scaled by a fixed power of two into one of two side sums. There
+	 * is no per element division or rescaling as in the LAPACK 3.9 nrm2, and at runtime float and double arrays are
+	 * summed in SIMD lanes. The result is within a few ulps for well scaled data; the relative error of the sums grows at
+	 * most linearly with count.
+	 * @tparam T The floating-point type.
+	 * @param values Pointer to count values.
+	 * @param count Number of values.
+	 * @return The Euclidean norm. +inf if any value is infinite, even if another is NaN, else NaN if any value is NaN. Zero for an empty array.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T norm(const T * values, std::size_t count) noexcept
+	{
+#ifdef CCMATH_HAS_SIMD
+		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+		{
+			if (!support::is_constant_evaluated()) { return internal::norm_finish(internal::norm_accumulate_simd(values, count)); }
+		}
+#endif
+		internal::norm_sums<T> sums;
+		for (std::size_t i = 0; i < count; ++i) { internal::norm_accumulate(sums, values[i]); }
+		return internal::norm_finish(sums);
+	}
+
+	/**
+	 * @brief Computes the Euclidean norm of the elements of a contiguous container without undue overflow or underflow.
+	 * @tparam Container A contiguous container of floating-point values, such as std::array, std::vector or a C array.
+	 * @param values The values.
+	 * @return ccm::ext::norm(std::data(values), std::size(values)).
+	 */
+	template <typename Container, typename T = std::remove_cv_t<std::remove_pointer_t<decltype(std::data(std::declval<const Container &>()))>>,
+			  std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T norm(const Container & values) noexcept
+	{
+		return ccm::ext::norm<T>(std::data(values), std::size(values));
+	}
+} // namespace ccm::ext
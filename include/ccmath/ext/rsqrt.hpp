@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/rsqrt_gen.hpp"
+#include "ccmath/internal/math/runtime/func/power/rsqrt_rt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace ccm::ext
+{
+	/**
+	 * @brief Accuracy of ccm::ext::rsqrt. Bounds are relative errors of the runtime result; ulp counts are for float unless noted.
+	 *
+	 * - estimate: the bare hardware estimate. 1.5 * 2^-12 with rsqrtps (float on SSE and AVX), 2^-14 with the AVX-512
+	 *   rsqrt14 forms (float and double) and about 2^-8 with frsqrte (NEON and SVE). Double on x86 without AVX-512 has no
+	 *   estimate instruction and computes 1/sqrt(x), within one ulp.
+	 * - newton: the estimate refined with one Newton step. 2^-22 (4 ulp) from rsqrtps, 2^-23.5 (1 ulp) from rsqrt14,
+	 *   2^-27 for double from rsqrt14 and about 2^-15 from frsqrte. Double without an estimate instruction stays within one ulp.
+	 * - exact: correctly rounded, half an ulp, on every target.
+	 *
+	 * The estimate instructions may flush subnormal inputs to zero, so the first two tiers can return infinity for them.
+	 */
+	enum class rsqrt_precision
+	{
+		estimate,
+		newton,
+		exact
+	};
+
+	/**
+	 * @brief Calculates 1/sqrt(x) with the selected accuracy.
+	 *
+	 * The estimate and newton tiers replace the square root and the divide with one estimate instruction and a few
+	 * multiplies. The exact tier costs about twice 1/std::sqrt for float and six times for double. In constant expressions
+	 * every tier returns the correctly rounded value from the generic implementation.
+	 * @tparam Precision How accurate the result has to be, see rsqrt_precision.
+	 * @tparam T float or double.
+	 * @param x Value to get the reciprocal square root of.
+	 * @return 1/sqrt(x). +inf for +0, -inf for -0, +0 for +inf and NaN for negative inputs.
+	 */
+	template <rsqrt_precision Precision = rsqrt_precision::exact, typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	constexpr T rsqrt(T x) noexcept
+	{
+		if constexpr (Precision == rsqrt_precision::exact) { return gen::rsqrt_gen(x); }
+		else
+		{
+			if (support::is_constant_evaluated()) { return gen::rsqrt_gen(x); }
+			if constexpr (Precision == rsqrt_precision::estimate) { return rt::rsqrt_estimate_rt(x); }
+			else { return rt::rsqrt_newton_rt(x); }
+		}
+	}
+
+	/**
+	 * @brief Calculates 1/sqrt(x) in every lane with the selected accuracy.
+	 *
+	 * The estimate and newton tiers have the bounds of rsqrt_precision for the instructions of Abi. The exact tier runs
+	 * the scalar algorithm lane by lane, which compilers widen for float.
+	 * @tparam Precision How accurate the result has to be, see rsqrt_precision.
+	 * @param x Values to get the reciprocal square root of.
+	 * @return 1/sqrt(x) per lane.
+	 */
+	template <rsqrt_precision Precision = rsqrt_precision::exact, typename T, typename Abi,
+			  std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	CCM_ALWAYS_INLINE intrin::simd<T, Abi> rsqrt(intrin::simd<T, Abi> const & x)
+	{
+		if constexpr (Precision == rsqrt_precision::estimate) { return intrin::rsqrt_estimate(x); }
+		else if constexpr (Precision == rsqrt_precision::newton) { return intrin::internal::rsqrt_newton(x, intrin::rsqrt_estimate(x)); }
+		else
+		{
+			std::array<T, intrin::simd<T, Abi>::size()> lanes;
+			x.copy_to(lanes.data(), intrin::element_aligned_tag());
+			for (std::size_t i = 0; i < lanes.size(); ++i) { lanes[i] = gen::rsqrt_gen(lanes[i]); }
+			return intrin::simd<T, Abi>(lanes.data(), intrin::element_aligned_tag());
+		}
+	}
+} // namespace ccm::ext
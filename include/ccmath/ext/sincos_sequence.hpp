@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/math/generic/func/basic/fma_gen.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+#include "ccmath/internal/support/multiply_add.hpp"
+#include "ccmath/internal/types/number_pair.hpp"
+#include "ccmath/math/trig/sin.hpp"
+#include "ccmath/math/trig/sincos.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ccm::ext
+{
+	/**
+	 * @brief Generates sin(start + k * step) and cos(start + k * step) for k = 0, 1, 2, ...
+	 *
+	 * The first point is evaluated with ccm::sincos and every following one by rotating the previous point by step,
+	 * which costs a few multiply-adds instead of a full argument reduction and two polynomials. The rotation uses the
+	 * form c -= a * c + b * s, s -= a * s - b * c with a = 2 sin^2(step / 2) and b = sin(step), which keeps the
+	 * increments small for small steps, and the additions are Kahan compensated. The state is re-seeded from
+	 * ccm::sincos every reseed_interval points, so the error never exceeds that of reseed_interval rotations.
+	 *
+	 * Every rotation adds an absolute error of about (a + |b|) * 2^-53, so double sequences stay within an absolute error of
+	 * about reseed_interval * (a + |b|) * 2^-53 of the exact values, which is about 2^-46.6 for a step of 1 with the default
+	 * interval. The bound is absolute, not relative: near the zeros of sin and cos it can be many ulps of the result. Float
+	 * sequences are computed in double and rounded once, which adds half an ulp of the float result to the same absolute error.
+	 * @tparam T float or double
+	 *
+	 * @code
+	 * ccm::ext::sincos_sequence<double> twiddle(0.0, -2.0 * pi / n);
+	 * for (std::size_t k = 0; k < n / 2; ++k, ++twiddle) { w[k] = {twiddle.cos(), twiddle.sin()}; }
+	 * @endcode
+	 */
+	template <typename T>
+	class sincos_sequence
+	{
+		static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "sincos_sequence only supports float and double.");
+
+	public:
+		/// Points between two re-seeds when none is given. Float sequences are evaluated in double and can go longer.
+		static constexpr std::size_t default_reseed_interval = std::is_same_v<T, float> ? 256 : 64;
+
+		/**
+		 * @brief Start a sequence at sin(start) and cos(start).
+		 * @param start The phase of the first point in radians.
+		 * @param step The phase increment between two points in radians.
+		 * @param reseed_interval Number of points between two evaluations with ccm::sincos. Zero is treated as one.
+		 */
+		constexpr sincos_sequence(T start, T step, std::size_t reseed_interval = default_reseed_interval) noexcept
+			: m_start(static_cast<double>(start)), m_step(static_cast<double>(step)), m_reseed_interval(reseed_interval == 0 ? 1 : reseed_interval)
+		{
+			const double half_sin = ccm::sin(m_step * 0.5);
+			m_alpha				  = 2.0 * half_sin * half_sin;
+			m_beta				  = ccm::sin(m_step);
+			reseed();
+		}
+
+		/// The sine of the current point.
+		[[nodiscard]] constexpr T sin() const noexcept { return static_cast<T>(m_sin); }
+
+		/// The cosine of the current point.
+		[[nodiscard]] constexpr T cos() const noexcept { return static_cast<T>(m_cos); }
+
+		/// The index k of the current point.
+		[[nodiscard]] constexpr std::size_t index() const noexcept { return m_index; }
+
+		/// Advance to the next point.
+		constexpr sincos_sequence & operator++() noexcept
+		{
+			++m_index;
+			if (++m_since_reseed >= m_reseed_interval)
+			{
+				reseed();
+				return *this;
+			}
+
+			// Both increments use the old point.
+			double cos_inc = -(m_alpha * m_cos + m_beta * m_sin);
+			double sin_inc = m_beta * m_cos - m_alpha * m_sin;
+			if constexpr (gen::internal::fma_has_fast_fma<double>())
+			{
+				// Fuse the products with beta explicitly, so contraction cannot change which product is rounded.
+				if (!support::is_constant_evaluated())
+				{
+					cos_inc = -support::multiply_add(m_beta, m_sin, m_alpha * m_cos);
+					sin_inc = support::multiply_add(m_beta, m_cos, -(m_alpha * m_sin));
+				}
+			}
+			m_cos				 = compensated_add(m_cos, cos_inc, m_cos_comp);
+			m_sin				 = compensated_add(m_sin, sin_inc, m_sin_comp);
+			return *this;
+		}
+
+		/**
+		 * @brief Write count consecutive points starting at the current one and advance past them.
+		 *
+		 * Several phases are advanced per step in SIMD lanes: lane j starts at point index() + j and every lane is rotated
+		 * by width * step. Lanes are re-seeded as often as the scalar sequence is.
+		 * @param sin_out Pointer to count sine values.
+		 * @param cos_out Pointer to count cosine values.
+		 * @param count Number of points to write.
+		 */
+		void generate(T * sin_out, T * cos_out, std::size_t count) noexcept
+		{
+#ifdef CCMATH_HAS_SIMD
+			using simd_t		 = intrin::simd<double, intrin::abi::native>;
+			constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+			if (count >= width)
+			{
+				// Rotation by width * step, and the number of vector steps that matches the scalar re-seed interval.
+				const double half_sin	 = ccm::sin(m_step * static_cast<double>(width) * 0.5);
+				const simd_t alpha		 = simd_t(2.0 * half_sin * half_sin);
+				const simd_t beta		 = simd_t(ccm::sin(m_step * static_cast<double>(width)));
+				const std::size_t period = m_reseed_interval / width == 0 ? 1 : m_reseed_interval / width;
+
+				double sin_lanes[width]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+				double cos_lanes[width]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+				simd_t s(0.0);
+				simd_t c(0.0);
+				simd_t s_comp(0.0);
+				simd_t c_comp(0.0);
+
+				std::size_t i = 0;
+				for (std::size_t steps = 0; i + width <= count; i += width, ++steps)
+				{
+					if (steps % period == 0)
+					{
+						for (std::size_t j = 0; j < width; ++j) { evaluate(m_index + i + j, sin_lanes[j], cos_lanes[j]); }
+						s	   = simd_t(sin_lanes, intrin::element_aligned_tag());
+						c	   = simd_t(cos_lanes, intrin::element_aligned_tag());
+						s_comp = simd_t(0.0);
+						c_comp = simd_t(0.0);
+					}
+					else
+					{
+#if defined(CCMATH_HAS_SIMD_FMA) || defined(CCMATH_HAS_SIMD_NEON) || defined(CCMATH_HAS_SIMD_SVE)
+						// Same rounding as the scalar rotation: the products with beta are fused, the ones with alpha rounded.
+						const simd_t cos_inc = intrin::fnma(beta, s, simd_t(0.0) - alpha * c);
+						const simd_t sin_inc = intrin::fms(beta, c, alpha * s);
+#else
+						const simd_t cos_inc = simd_t(0.0) - (alpha * c + beta * s);
+						const simd_t sin_inc = beta * c - alpha * s;
+#endif
+						c					 = compensated_add(c, cos_inc, c_comp);
+						s					 = compensated_add(s, sin_inc, s_comp);
+					}
+
+					s.copy_to(sin_lanes, intrin::element_aligned_tag());
+					c.copy_to(cos_lanes, intrin::element_aligned_tag());
+					for (std::size_t j = 0; j < width; ++j)
+					{
+						sin_out[i + j] = static_cast<T>(sin_lanes[j]);
+						cos_out[i + j] = static_cast<T>(cos_lanes[j]);
+					}
+				}
+
+				// Continue the scalar sequence from a fresh seed after the vector part.
+				m_index += i;
+				reseed();
+				sin_out += i;
+				cos_out += i;
+				count -= i;
+			}
+#endif
+			for (std::size_t i = 0; i < count; ++i, ++*this)
+			{
+				sin_out[i] = sin();
+				cos_out[i] = cos();
+			}
+		}
+
+	private:
+		/// Evaluate point k with ccm::sincos. start + k * step is formed exactly as hi + lo and lo is applied to first order.
+		constexpr void evaluate(std::size_t k, double & s, double & c) const noexcept
+		{
+			const type::NumberPair<double> offset = gen::internal::fma_two_product(static_cast<double>(k), m_step);
+			const type::NumberPair<double> phase  = gen::internal::fma_two_sum(m_start, offset.hi);
+			const double lo						   = phase.lo + offset.lo;
+			double sin_hi						   = 0.0;
+			double cos_hi						   = 0.0;
+			ccm::sincos(phase.hi, &sin_hi, &cos_hi);
+			s = sin_hi + cos_hi * lo;
+			c = cos_hi - sin_hi * lo;
+		}
+
+		constexpr void reseed() noexcept
+		{
+			evaluate(m_index, m_sin, m_cos);
+			m_sin_comp	   = 0.0;
+			m_cos_comp	   = 0.0;
+			m_since_reseed = 0;
+		}
+
+		/// Kahan summation step. comp carries the low order bits lost by earlier additions.
+		template <typename V>
+		static constexpr V compensated_add(V sum, V increment, V & comp) noexcept
+		{
+			const V corrected = increment - comp;
+			const V result	  = sum + corrected;
+			comp			  = (result - sum) - corrected;
+			return result;
+		}
+
+		double m_start;
+		double m_step;
+		std::size_t m_reseed_interval;
+		double m_alpha{};
+		double m_beta{};
+		double m_sin{};
+		double m_cos{};
+		double m_sin_comp{};
+		double m_cos_comp{};
+		std::size_t m_index{};
+		std::size_t m_since_reseed{};
+	};
+} // namespace ccm::ext
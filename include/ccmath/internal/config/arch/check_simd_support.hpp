@@ -19,6 +19,7 @@
  * 			- SSE4.2
  * 			- AVX
  * 			- AVX2
+ * 			- FMA3
  * 			- AVX512
  *
  * 		ARM:
@@ -101,6 +102,11 @@
 		#define CCMATH_HAS_SIMD_AVX2 1
 	#endif
 
+	// Fused Multiply-Add (FMA3)
+	#if defined(__FMA__)
+		#define CCMATH_HAS_SIMD_FMA 1
+	#endif
+
 	// Processors that support Intel Advanced Vector Extensions 512 (Intel AVX-512) Byte and Word instructions.
 	#if defined(__AVX512BW__)
 		#ifndef CCMATH_HAS_SIMD
@@ -174,12 +180,11 @@
 	#endif
 
 // ARM Scalable Vector Extension (SVE)
-/* TODO: At some point add proper SVE support.
-	#if defined(__ARM_FEATURE_SVE)
+	// The simd types hold one register each, which needs a vector length fixed at compile time with -msve-vector-bits.
+	#if defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS) && __ARM_FEATURE_SVE_BITS > 0
 		#ifndef CCMATH_HAS_SIMD
 			#define CCMATH_HAS_SIMD
 		#endif
 		#define CCMATH_HAS_SIMD_SVE 1
 	#endif
- */
 #endif // CCM_CONFIG_USE_RT_SIMD
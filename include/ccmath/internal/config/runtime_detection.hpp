@@ -8,5 +8,303 @@
  * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
  */
 
+/*
+ * Runtime detection of the SIMD instruction sets supported by the host CPU.
+ *
+ * check_simd_support.hpp only knows what the compiler was told to target. A binary built for baseline x86-64
+ * can still run on a host with AVX2 or AVX-512, so the runtime dispatch layer asks this header what the CPU
+ * and the operating system actually support and picks the fastest kernel it has compiled for that level.
+ *
+ * The selected level can be lowered for benchmarking by setting the environment variable CCM_FORCE_SIMD_ABI
+ * to one of: scalar, sse2, sse4, avx, avx2, avx512, neon, sve.
+ * Requests for a level the host does not support are ignored.
+ */
+
 #pragma once
 
+#include "ccmath/internal/config/arch/check_arch_support.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(CCMATH_TARGET_ARCH_IS_X86_BASED)
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h>
+		#define CCM_RUNTIME_DETECTION_MSVC_CPUID 1
+	#elif defined(__GNUC__) || defined(__clang__)
+		#include <cpuid.h>
+		#define CCM_RUNTIME_DETECTION_GNU_CPUID 1
+	#endif
+#endif
+
+#if defined(CCM_TARGET_ARCH_AARCH64) && (defined(__linux) || defined(__linux__))
+	#include <sys/auxv.h>
+	#define CCM_RUNTIME_DETECTION_AUXV 1
+#endif
+
+namespace ccm::rt
+{
+	/// SIMD instruction set levels known to the runtime dispatcher. x86 levels are ordered from least to most capable, followed by the ARM levels.
+	enum class simd_level : std::uint8_t
+	{
+		scalar = 0,
+		sse2,
+		sse4,
+		avx,
+		avx2,
+		avx512,
+		neon,
+		sve,
+	};
+
+	/// True when detect_cpu_features has a detection routine for the target architecture.
+#if defined(CCM_RUNTIME_DETECTION_GNU_CPUID) || defined(CCM_RUNTIME_DETECTION_MSVC_CPUID) || defined(CCM_TARGET_ARCH_AARCH64)
+	constexpr bool has_runtime_detection = true;
+#else
+	constexpr bool has_runtime_detection = false;
+#endif
+
+	/// Total number of entries in simd_level.
+	constexpr std::size_t simd_level_count = static_cast<std::size_t>(simd_level::sve) + 1;
+
+	/// Instruction set extensions reported as usable by both the CPU and the operating system.
+	struct cpu_features
+	{
+		bool sse2{false};
+		bool sse3{false};
+		bool ssse3{false};
+		bool sse4_1{false};
+		bool sse4_2{false};
+		bool avx{false};
+		bool avx2{false};
+		bool fma{false};
+		bool avx512f{false};
+		bool avx512dq{false};
+		bool avx512vl{false};
+		bool avx512bw{false};
+		bool neon{false};
+		bool sve{false};
+	};
+
+	namespace detail
+	{
+#if defined(CCM_RUNTIME_DETECTION_GNU_CPUID) || defined(CCM_RUNTIME_DETECTION_MSVC_CPUID)
+		struct cpuid_registers
+		{
+			std::uint32_t eax{0};
+			std::uint32_t ebx{0};
+			std::uint32_t ecx{0};
+			std::uint32_t edx{0};
+		};
+
+		inline cpuid_registers cpuid(std::uint32_t leaf, std::uint32_t subleaf) noexcept
+		{
+			cpuid_registers regs{};
+	#if defined(CCM_RUNTIME_DETECTION_MSVC_CPUID)
+			int info[4] = {0, 0, 0, 0};
+			__cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+			regs.eax = static_cast<std::uint32_t>(info[0]);
+			regs.ebx = static_cast<std::uint32_t>(info[1]);
+			regs.ecx = static_cast<std::uint32_t>(info[2]);
+			regs.edx = static_cast<std::uint32_t>(info[3]);
+	#else
+			unsigned int eax = 0;
+			unsigned int ebx = 0;
+			unsigned int ecx = 0;
+			unsigned int edx = 0;
+			if (__get_cpuid_count(leaf, subleaf, &eax, &ebx, &ecx, &edx) != 0)
+			{
+				regs.eax = eax;
+				regs.ebx = ebx;
+				regs.ecx = ecx;
+				regs.edx = edx;
+			}
+	#endif
+			return regs;
+		}
+
+		// Only call this after confirming OSXSAVE is set, otherwise xgetbv raises #UD.
+		inline std::uint64_t xgetbv_xcr0() noexcept
+		{
+	#if defined(CCM_RUNTIME_DETECTION_MSVC_CPUID)
+			return static_cast<std::uint64_t>(_xgetbv(0));
+	#else
+			std::uint32_t eax = 0;
+			std::uint32_t edx = 0;
+			__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return (static_cast<std::uint64_t>(edx) << 32) | eax;
+	#endif
+		}
+
+		constexpr bool has_bit(std::uint32_t reg, unsigned bit) noexcept
+		{
+			return ((reg >> bit) & 1U) != 0;
+		}
+#endif
+
+		/// Parse the name of an abi (as used by CCM_FORCE_SIMD_ABI) into a simd_level. Returns false if the name is unknown.
+		inline bool parse_simd_level(const char * name, simd_level & level) noexcept
+		{
+			if (name == nullptr) { return false; }
+
+			struct named_level
+			{
+				const char * name;
+				simd_level level;
+			};
+
+			constexpr named_level levels[] = {
+				{"scalar", simd_level::scalar}, {"sse2", simd_level::sse2}, {"sse4", simd_level::sse4},	 {"avx", simd_level::avx},
+				{"avx2", simd_level::avx2},		{"avx512", simd_level::avx512}, {"neon", simd_level::neon}, {"sve", simd_level::sve},
+			};
+
+			for (const auto & entry : levels)
+			{
+				if (std::strcmp(name, entry.name) == 0)
+				{
+					level = entry.level;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/// Read the level requested through CCM_FORCE_SIMD_ABI. Returns false if the variable is unset or unknown.
+		inline bool forced_simd_level(simd_level & level) noexcept
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			char * value	= nullptr;
+			std::size_t len = 0;
+			if (_dupenv_s(&value, &len, "CCM_FORCE_SIMD_ABI") != 0 || value == nullptr) { return false; }
+			const bool parsed = parse_simd_level(value, level);
+			std::free(value); // NOLINT(cppcoreguidelines-no-malloc)
+			return parsed;
+#else
+			return parse_simd_level(std::getenv("CCM_FORCE_SIMD_ABI"), level); // NOLINT(concurrency-mt-unsafe)
+#endif
+		}
+	} // namespace detail
+
+	/**
+	 * @brief Query the host CPU and operating system for the instruction sets it can execute.
+	 * @return The usable extensions. Every field is false on architectures without a detection routine.
+	 *
+	 * AVX and AVX-512 additionally require the operating system to save the wider register state (XCR0),
+	 * which matters on virtual machines that hide those registers even though cpuid reports them.
+	 */
+	inline cpu_features detect_cpu_features() noexcept
+	{
+		cpu_features features{};
+
+#if defined(CCM_RUNTIME_DETECTION_GNU_CPUID) || defined(CCM_RUNTIME_DETECTION_MSVC_CPUID)
+		const std::uint32_t max_leaf = detail::cpuid(0, 0).eax;
+		if (max_leaf < 1) { return features; }
+
+		const auto leaf1 = detail::cpuid(1, 0);
+		features.sse2	 = detail::has_bit(leaf1.edx, 26);
+		features.sse3	 = detail::has_bit(leaf1.ecx, 0);
+		features.ssse3	 = detail::has_bit(leaf1.ecx, 9);
+		features.sse4_1	 = detail::has_bit(leaf1.ecx, 19);
+		features.sse4_2	 = detail::has_bit(leaf1.ecx, 20);
+
+		const bool osxsave		 = detail::has_bit(leaf1.ecx, 27);
+		const std::uint64_t xcr0 = osxsave ? detail::xgetbv_xcr0() : 0;
+		const bool os_saves_ymm	 = (xcr0 & 0x6) == 0x6;	  // SSE and AVX state.
+		const bool os_saves_zmm	 = (xcr0 & 0xe6) == 0xe6; // SSE, AVX, opmask and both ZMM halves.
+
+		features.avx = os_saves_ymm && detail::has_bit(leaf1.ecx, 28);
+		features.fma = features.avx && detail::has_bit(leaf1.ecx, 12);
+
+		if (max_leaf >= 7)
+		{
+			const auto leaf7  = detail::cpuid(7, 0);
+			features.avx2	  = features.avx && detail::has_bit(leaf7.ebx, 5);
+			features.avx512f  = os_saves_zmm && detail::has_bit(leaf7.ebx, 16);
+			features.avx512dq = features.avx512f && detail::has_bit(leaf7.ebx, 17);
+			features.avx512bw = features.avx512f && detail::has_bit(leaf7.ebx, 30);
+			features.avx512vl = features.avx512f && detail::has_bit(leaf7.ebx, 31);
+		}
+#elif defined(CCM_RUNTIME_DETECTION_AUXV)
+		// Values from the Linux uapi asm/hwcap.h for arm64.
+		constexpr unsigned long hwcap_asimd = 1UL << 1;
+		constexpr unsigned long hwcap_sve	= 1UL << 22;
+		const unsigned long hwcap			= getauxval(AT_HWCAP);
+		features.neon						= (hwcap & hwcap_asimd) != 0;
+		features.sve						= (hwcap & hwcap_sve) != 0;
+#elif defined(CCM_TARGET_ARCH_AARCH64)
+		// Advanced SIMD is mandatory on AArch64, SVE is only trusted when the compiler was told about it.
+		features.neon = true;
+	#if defined(__ARM_FEATURE_SVE)
+		features.sve = true;
+	#endif
+#endif
+
+		return features;
+	}
+
+	/**
+	 * @brief Check whether a host with the given features can execute code compiled for a SIMD level.
+	 * @param features The features of the host, as returned by detect_cpu_features.
+	 * @param level The level to test.
+	 * @return True if every instruction the level may use is available.
+	 */
+	constexpr bool supports_simd_level(cpu_features const & features, simd_level level) noexcept
+	{
+		switch (level)
+		{
+		case simd_level::scalar: return true;
+		case simd_level::sse2: return features.sse2;
+		case simd_level::sse4: return features.sse2 && features.sse3 && features.ssse3 && features.sse4_1 && features.sse4_2;
+		case simd_level::avx: return supports_simd_level(features, simd_level::sse4) && features.avx;
+		case simd_level::avx2: return supports_simd_level(features, simd_level::avx) && features.avx2 && features.fma;
+		case simd_level::avx512:
+			return supports_simd_level(features, simd_level::avx2) && features.avx512f && features.avx512dq && features.avx512vl && features.avx512bw;
+		case simd_level::neon: return features.neon;
+		case simd_level::sve: return features.neon && features.sve;
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Find the most capable SIMD level a host can execute.
+	 * @param features The features of the host, as returned by detect_cpu_features.
+	 * @return The highest supported level, or simd_level::scalar if none are supported.
+	 */
+	constexpr simd_level highest_simd_level(cpu_features const & features) noexcept
+	{
+		constexpr simd_level preferred[] = {simd_level::sve, simd_level::neon, simd_level::avx512, simd_level::avx2,
+											simd_level::avx, simd_level::sse4, simd_level::sse2};
+		for (const auto level : preferred)
+		{
+			if (supports_simd_level(features, level)) { return level; }
+		}
+		return simd_level::scalar;
+	}
+
+	/**
+	 * @brief Get the features of the host CPU. The query runs once per process.
+	 */
+	inline cpu_features const & host_cpu_features() noexcept
+	{
+		static const cpu_features features = detect_cpu_features();
+		return features;
+	}
+
+	/**
+	 * @brief Get the SIMD level the runtime dispatcher should target on this host. Resolved once per process.
+	 *
+	 * This is the highest level the host supports unless CCM_FORCE_SIMD_ABI names a different level the host also supports.
+	 */
+	inline simd_level active_simd_level() noexcept
+	{
+		static const simd_level level = []() noexcept
+		{
+			simd_level forced = simd_level::scalar;
+			if (detail::forced_simd_level(forced) && supports_simd_level(host_cpu_features(), forced)) { return forced; }
+			return highest_simd_level(host_cpu_features());
+		}();
+		return level;
+	}
+} // namespace ccm::rt
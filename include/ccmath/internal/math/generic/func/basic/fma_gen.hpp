@@ -10,149 +10,299 @@
 
 #pragma once
 
+#include "ccmath/internal/config/type_support.hpp"
+#include "ccmath/internal/predef/likely.hpp"
 #include "ccmath/internal/predef/unlikely.hpp"
-#include "ccmath/math/compare/isinf.hpp"
-#include "ccmath/math/compare/isnan.hpp"
-#include "ccmath/math/compare/signbit.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+#include "ccmath/internal/support/multiply_add.hpp"
+#include "ccmath/internal/types/int128_types.hpp"
+#include "ccmath/internal/types/number_pair.hpp"
 
+#include <cstdint>
 #include <limits>
 #include <type_traits>
 
-namespace ccm
+namespace ccm::gen
 {
-	/**
-	 * @brief Fused multiply-add operation.
-	 * @tparam T Numeric type.
-	 * @param x Floating-point or integer value.
-	 * @param y Floating-point or integer value.
-	 * @param z Floating-point or integer value.
-	 * @return If successful, returns the value of x * y + z as if calculated to infinite precision and rounded once to fit the result type (or, alternatively,
-	 * calculated as a single ternary floating-point operation).
-	 */
-	template <typename T, std::enable_if_t<!std::is_integral_v<T>, bool> = true>
-	constexpr T fma(T x, T y, T z) noexcept
+	namespace internal
 	{
-		// Check for GCC 6.1 or later
-		#if defined(__GNUC__) && (__GNUC__ > 6 || (__GNUC__ == 6 && __GNUC_MINOR__ >= 1)) && !defined(__clang__)
-		if constexpr (std::is_same_v<T, float>) { return __builtin_fmaf(x, y, z); }
-		if constexpr (std::is_same_v<T, double>) { return __builtin_fma(x, y, z); }
-		if constexpr (std::is_same_v<T, long double>) { return __builtin_fmal(x, y, z); }
-		return static_cast<T>(__builtin_fmal(x, y, z));
-		#else
-		if (CCM_UNLIKELY(x == 0 || y == 0 || z == 0)) { return x * y + z; }
-
-		// If x is zero and y is infinity, or if y is zero and x is infinity and...
-		if ((x == static_cast<T>(0) && ccm::isinf(y)) || (y == T{0} && ccm::isinf(x)))
+		/// Knuth's TwoSum. hi + lo == a + b exactly, without any assumption on the magnitudes.
+		template <typename T>
+		constexpr type::NumberPair<T> fma_two_sum(T a, T b) noexcept
+		{
+			const T hi		  = a + b;
+			const T b_virtual = hi - a;
+			const T a_virtual = hi - b_virtual;
+			return {hi, (a - a_virtual) + (b - b_virtual)};
+		}
+
+		/// Veltkamp's splitting into two halves of at most ceil(p/2) bits each.
+		template <typename T>
+		constexpr type::NumberPair<T> fma_split(T a) noexcept
 		{
-			// ...z is NaN, return +NaN...
-			if (ccm::isnan(z))
+			constexpr T splitter = static_cast<T>(std::uint64_t{1} << ((std::numeric_limits<T>::digits + 1) / 2)) + static_cast<T>(1);
+			const T scaled		 = splitter * a;
+			const T hi			 = scaled + (a - scaled);
+			return {hi, a - hi};
+		}
+
+		/// True when the target has a hardware fma for T, which is also when -ffp-contract may fuse the splitting arithmetic below.
+		template <typename T>
+		constexpr bool fma_has_fast_fma() noexcept
+		{
+#if defined(__FP_FAST_FMAF) || defined(__FMA__) || defined(__ARM_FEATURE_FMA)
+			if constexpr (std::is_same_v<T, float>) { return true; }
+#endif
+#if defined(__FP_FAST_FMA) || defined(__FMA__) || defined(__ARM_FEATURE_FMA)
+			if constexpr (std::is_same_v<T, double>) { return true; }
+#endif
+#if defined(__FP_FAST_FMAL)
+			if constexpr (std::is_same_v<T, long double>) { return true; }
+#endif
+			return false;
+		}
+
+		/**
+		 * @brief Dekker's product. hi + lo == a * b exactly as long as nothing overflows or underflows.
+		 *
+		 * Contracting any of Dekker's products and differences into an fma breaks the exactness, so at run time a target with
+		 * a hardware fma computes the error with it instead. Constant evaluation never contracts.
+		 */
+		template <typename T>
+		constexpr type::NumberPair<T> fma_two_product(T a, T b) noexcept
+		{
+			if constexpr (fma_has_fast_fma<T>())
 			{
-				return std::numeric_limits<T>::quiet_NaN();
+				if (!support::is_constant_evaluated())
+				{
+					const T hi = a * b;
+					return {hi, support::multiply_add(a, b, -hi)};
+				}
 			}
 
-			// ...else return -NaN if Z is not NaN.
-			return -std::numeric_limits<T>::quiet_NaN();
+			const type::NumberPair<T> as = fma_split(a);
+			const type::NumberPair<T> bs = fma_split(b);
+			const T hi					 = a * b;
+			const T lo					 = as.lo * bs.lo - (((hi - as.hi * bs.hi) - as.lo * bs.hi) - as.hi * bs.lo);
+			return {hi, lo};
 		}
 
-		// If x is a zero and y is an infinity, or if y is zero and x is an infinity and Z is NaN, then the result is -NaN.
-		if (ccm::isinf(x * y) && ccm::isinf(z) && ccm::signbit(x * y) != ccm::signbit(z))
+		/**
+		 * @brief Computes a + b rounded to odd: an inexact sum is truncated and its last bit forced to one.
+		 *
+		 * Rounding to odd with at least two extra bits of precision followed by a round to nearest never suffers from double rounding.
+		 */
+		template <typename T>
+		constexpr T fma_add_round_to_odd(T a, T b) noexcept
 		{
-			return -std::numeric_limits<T>::quiet_NaN();
+			using FPBits_t = support::fp::FPBits<T>;
+
+			const type::NumberPair<T> sum = fma_two_sum(a, b);
+			FPBits_t bits(sum.hi);
+			if (sum.lo == static_cast<T>(0) || (bits.uintval() & 1U) != 0) { return sum.hi; }
+
+			// sum.hi is even, so its neighbour in the direction of the error is the odd truncation.
+			if ((sum.lo > static_cast<T>(0)) == (sum.hi > static_cast<T>(0))) { bits.set_uintval(bits.uintval() + 1U); }
+			else
+			{
+				bits.set_uintval(bits.uintval() - 1U);
+				// Formats with an explicit integer bit borrow from it when stepping below a power of two.
+				if constexpr (FPBits_t::fraction_length != FPBits_t::significand_length)
+				{
+					if (!bits.get_implicit_bit() && bits.get_biased_exponent() != 0)
+					{
+						bits.set_implicit_bit(true);
+						bits.set_biased_exponent(bits.get_biased_exponent() - 1U);
+					}
+				}
+			}
+			return bits.get_val();
 		}
 
-		// If x or y are NaN, NaN is returned.
-		if (ccm::isnan(x) || ccm::isnan(y)) { return std::numeric_limits<T>::quiet_NaN(); }
+		/**
+		 * @brief True when the error free transformations used by fma_eft are exact for these operands.
+		 *
+		 * The product and its rounding error must stay clear of overflow and of the subnormal range, and the addend must not overflow when added.
+		 */
+		template <typename T>
+		constexpr bool fma_in_eft_range(T x, T y, T z) noexcept
+		{
+			constexpr int max_exp	 = std::numeric_limits<T>::max_exponent - 1;
+			constexpr int digits	 = std::numeric_limits<T>::digits;
+			constexpr int factor_max = (max_exp - 2 * digits) / 2;
 
-		// If z is NaN, and x * y is not 0 * Inf or Inf * 0, then +NaN is returned
-		if (ccm::isnan(z) && (x * y != 0 * std::numeric_limits<T>::infinity() || x * y != std::numeric_limits<T>::infinity() * 0))
+			using FPBits_t = support::fp::FPBits<T>;
+			const int x_exp = FPBits_t(x).get_exponent();
+			const int y_exp = FPBits_t(y).get_exponent();
+			return x_exp <= factor_max && -factor_max <= x_exp && y_exp <= factor_max && -factor_max <= y_exp &&
+				   FPBits_t(z).get_exponent() <= max_exp - digits;
+		}
+
+		/// Boldo and Melquiond's emulated fma. Only exact under fma_in_eft_range and round to nearest.
+		template <typename T>
+		constexpr T fma_eft(T x, T y, T z) noexcept
 		{
-			return std::numeric_limits<T>::quiet_NaN();
+			const type::NumberPair<T> product = fma_two_product(x, y);
+			const type::NumberPair<T> sum	  = fma_two_sum(z, product.hi);
+			return sum.hi + fma_add_round_to_odd(sum.lo, product.lo);
 		}
 
-		// Hope the compiler optimizes this.
-		return (x * y) + z;
-#endif
-	}
+		constexpr int fma_countl_zero(types::uint128_t value) noexcept
+		{
+			const auto high = static_cast<std::uint64_t>(value >> 64);
+			if (high != 0) { return support::countl_zero(high); }
+			return 64 + support::countl_zero(static_cast<std::uint64_t>(value));
+		}
 
-	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
-	constexpr Integer fma(Integer x, Integer y, Integer z) noexcept
-	{
-		return (x * y) + z;
-	}
+		/// Splits a finite non-zero double into a significand with bit 52 set and the exponent of its last bit.
+		constexpr std::uint64_t fma_decompose(double value, int & exponent) noexcept
+		{
+			using FPBits_t = support::fp::FPBits<double>;
 
-	/**
-	 * @brief Fused multiply-add operation.
-	 * @tparam T Floating-point or integer type converted to a common type.
-	 * @tparam U Floating-point or integer type converted to a common type.
-	 * @tparam V Floating-point or integer type converted to a common type.
-	 * @param x Floating-point or integer value converted to a common type.
-	 * @param y Floating-point or integer value converted to a common type.
-	 * @param z Floating-point or integer value converted to a common type.
-	 * @return If successful, returns the value of x * y + z as if calculated to infinite precision and rounded once to fit the result type (or, alternatively,
-	 * calculated as a single ternary floating-point operation).
-	 */
-	template <typename T, typename U, typename V>
-	constexpr auto fma(T x, U y, V z) noexcept
-	{
-		// If our type is an integer epsilon will be set to 0 by default.
-		// Instead, set epsilon to 1 so that our type is always at least the widest floating point type.
-		constexpr auto TCommon = std::numeric_limits<T>::epsilon() > 0 ? std::numeric_limits<T>::epsilon() : 1;
-		constexpr auto UCommon = std::numeric_limits<U>::epsilon() > 0 ? std::numeric_limits<U>::epsilon() : 1;
-		constexpr auto VCommon = std::numeric_limits<V>::epsilon() > 0 ? std::numeric_limits<V>::epsilon() : 1;
+			const FPBits_t bits(value);
+			std::uint64_t mantissa = bits.get_mantissa();
+			const int biased	   = bits.get_biased_exponent();
+			if (biased == 0)
+			{
+				const int shift = support::countl_zero(mantissa) - (64 - FPBits_t::fraction_length - 1);
+				mantissa <<= shift;
+				exponent = 1 - FPBits_t::exponent_bias - FPBits_t::fraction_length - shift;
+			}
+			else
+			{
+				mantissa |= std::uint64_t{1} << FPBits_t::fraction_length;
+				exponent = biased - FPBits_t::exponent_bias - FPBits_t::fraction_length;
+			}
+			return mantissa;
+		}
 
-		using epsilon_type = std::common_type_t<decltype(TCommon), decltype(UCommon), decltype(VCommon)>;
+		/**
+		 * @brief Exact double fma on integers, used for operands outside the range of the error free transformations.
+		 *
+		 * Both terms are normalized so their leading bit sits at bit 125 of a 128-bit integer, the smaller one is aligned
+		 * with a sticky bit, and the sum is rounded to nearest even once.
+		 */
+		constexpr double fma_double_exact(double x, double y, double z) noexcept
+		{
+			using FPBits_t = support::fp::FPBits<double>;
+			using types::uint128_t;
 
-		using shared_type = std::conditional_t<
-			TCommon <= std::numeric_limits<epsilon_type>::epsilon() && TCommon <= UCommon, T,
-			std::conditional_t<UCommon <= std::numeric_limits<epsilon_type>::epsilon() && UCommon <= TCommon, U,
-							   std::conditional_t<VCommon <= std::numeric_limits<epsilon_type>::epsilon() && VCommon <= UCommon, V, epsilon_type>>>;
+			int x_exp					= 0;
+			int y_exp					= 0;
+			int z_exp					= 0;
+			const std::uint64_t x_mant = fma_decompose(x, x_exp);
+			const std::uint64_t y_mant = fma_decompose(y, y_exp);
+			const std::uint64_t z_mant = fma_decompose(z, z_exp);
 
-		return ccm::fma<shared_type>(static_cast<shared_type>(x), static_cast<shared_type>(y), static_cast<shared_type>(z));
-	}
+			uint128_t big	 = static_cast<uint128_t>(x_mant) * static_cast<uint128_t>(y_mant);
+			int big_exp		 = x_exp + y_exp;
+			bool big_neg	 = FPBits_t(x).is_neg() != FPBits_t(y).is_neg();
+			const int p_norm = fma_countl_zero(big) - 2;
+			big <<= static_cast<std::size_t>(p_norm);
+			big_exp -= p_norm;
 
-	/**
-	 * @brief Fused multiply-add operation.
-	 * @tparam T Integer type converted to a common type.
-	 * @tparam U Integer type converted to a common type.
-	 * @tparam V Integer type converted to a common type.
-	 * @param x Integer value converted to a common type.
-	 * @param y Integer value converted to a common type.
-	 * @param z Integer value converted to a common type.
-	 * @return If successful, returns the value of x * y + z as if calculated to infinite precision and rounded once to fit the result type (or, alternatively,
-	 * calculated as a single ternary floating-point operation).
-	 */
-	template <typename T, typename U, typename V, std::enable_if_t<std::is_integral_v<T> && std::is_integral_v<U> && std::is_integral_v<V>, bool> = true>
-	constexpr auto fma(T x, U y, V z) noexcept // Special case for if all types are integers.
-	{
-		using shared_type = std::common_type_t<T, U, V>;
-		return ccm::fma<shared_type>(static_cast<shared_type>(x), static_cast<shared_type>(y), static_cast<shared_type>(z));
-	}
+			uint128_t small = static_cast<uint128_t>(z_mant) << 73;
+			int small_exp	= z_exp - 73;
+			bool small_neg	= FPBits_t(z).is_neg();
 
-	/**
-	 * @brief Fused multiply-add operation.
-	 * @param x Floating-point value.
-	 * @param y Floating-point value.
-	 * @param z Floating-point value.
-	 * @return If successful, returns the value of x * y + z as if calculated to infinite precision and rounded once to fit the result type (or, alternatively,
-	 * calculated as a single ternary floating-point operation).
-	 */
-	constexpr float fmaf(float x, float y, float z) noexcept
-	{
-		return ccm::fma<float>(x, y, z);
-	}
+			if (small_exp > big_exp || (small_exp == big_exp && small > big))
+			{
+				const uint128_t tmp_val = big;
+				big						= small;
+				small					= tmp_val;
+				const int tmp_exp		= big_exp;
+				big_exp					= small_exp;
+				small_exp				= tmp_exp;
+				const bool tmp_neg		= big_neg;
+				big_neg					= small_neg;
+				small_neg				= tmp_neg;
+			}
+
+			// Bits shifted out only matter as a sticky bit: when they exist the sum keeps at least 124 significant bits.
+			const int distance = big_exp - small_exp;
+			if (distance >= 128) { small = 1; }
+			else if (distance > 0)
+			{
+				const bool sticky = (small & ((static_cast<uint128_t>(1) << static_cast<std::size_t>(distance)) - 1)) != 0;
+				small >>= static_cast<std::size_t>(distance);
+				if (sticky) { small |= 1; }
+			}
+
+			const uint128_t sum = (big_neg == small_neg) ? big + small : big - small;
+			if (sum == 0) { return 0.0; }
+
+			const int msb	   = 127 - fma_countl_zero(sum);
+			const int biased   = big_exp + msb + FPBits_t::exponent_bias;
+			const auto sign_bit = big_neg ? FPBits_t::sign_mask : std::uint64_t{0};
+			if (biased >= FPBits_t::MAX_BIASED_EXPONENT) { return support::bit_cast<double>(FPBits_t::exponent_mask | sign_bit); }
+
+			// Subnormal results keep the last bit at 2^-1074 instead of 53 significant bits.
+			int shift = msb - FPBits_t::fraction_length;
+			if (biased <= 0) { shift += 1 - biased; }
+
+			std::uint64_t mantissa = 0;
+			if (shift <= 0) { mantissa = static_cast<std::uint64_t>(sum << static_cast<std::size_t>(-shift)); }
+			else if (shift < 128)
+			{
+				const uint128_t remainder = sum & ((static_cast<uint128_t>(1) << static_cast<std::size_t>(shift)) - 1);
+				const uint128_t half	  = static_cast<uint128_t>(1) << static_cast<std::size_t>(shift - 1);
+				mantissa				  = static_cast<std::uint64_t>(sum >> static_cast<std::size_t>(shift));
+				if (remainder > half || (remainder == half && (mantissa & 1U) != 0)) { ++mantissa; }
+			}
+
+			// A carry out of the significand moves into the exponent field, which also covers rounding up to infinity.
+			std::uint64_t result = biased <= 0 ? mantissa : (static_cast<std::uint64_t>(biased - 1) << FPBits_t::fraction_length) + mantissa;
+			if (result > FPBits_t::exponent_mask) { result = FPBits_t::exponent_mask; }
+			return support::bit_cast<double>(result | sign_bit);
+		}
+	} // namespace internal
 
 	/**
-	 * @brief Fused multiply-add operation.
-	 * @param x Floating-point value.
-	 * @param y Floating-point value.
-	 * @param z Floating-point value.
-	 * @return If successful, returns the value of x * y + z as if calculated to infinite precision and rounded once to fit the result type (or, alternatively,
-	 * calculated as a single ternary floating-point operation).
+	 * @brief Software fused multiply-add: x * y + z rounded once.
+	 * @tparam T The floating-point type.
+	 * @param x The first factor.
+	 * @param y The second factor.
+	 * @param z The addend.
+	 * @return x * y + z as if calculated to infinite precision and rounded to nearest once.
+	 * @note float is computed in double with a round to odd sum. double uses error free transformations and falls back to
+	 * an exact integer algorithm near the ends of the exponent range. Other long double formats fall back to an unfused
+	 * x * y + z when an operand is outside the range of the error free transformations.
 	 */
-	constexpr long double fmal(long double x, long double y, long double z) noexcept
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T fma_gen(T x, T y, T z) noexcept
 	{
-		return ccm::fma<long double>(x, y, z);
-	}
-} // namespace ccm
+		using FPBits_t = support::fp::FPBits<T>;
+
+		// Infinite or NaN factors follow the rules of the separate operations, and a zero factor makes the sum exact.
+		if (CCM_UNLIKELY(FPBits_t(x).is_inf_or_nan() || FPBits_t(y).is_inf_or_nan() || x == static_cast<T>(0) || y == static_cast<T>(0)))
+		{
+			return x * y + z;
+		}
+
+		// The exact product of finite factors is finite, even when rounding it alone would overflow. Adding z to itself quiets a signaling NaN.
+		if (CCM_UNLIKELY(FPBits_t(z).is_inf_or_nan())) { return z + z; }
 
-/// @ingroup basic
+		// Rounding the product alone also keeps the sign of a product that underflows to zero.
+		if (z == static_cast<T>(0)) { return x * y; }
+
+		if constexpr (std::is_same_v<T, float>)
+		{
+			// The product of two floats is exact in double.
+			return static_cast<float>(internal::fma_add_round_to_odd(static_cast<double>(x) * static_cast<double>(y), static_cast<double>(z)));
+		}
+#if defined(CCM_TYPES_LONG_DOUBLE_IS_FLOAT64)
+		else if constexpr (std::is_same_v<T, long double>)
+		{
+			return static_cast<long double>(fma_gen<double>(static_cast<double>(x), static_cast<double>(y), static_cast<double>(z)));
+		}
+#endif
+		else
+		{
+			if (CCM_LIKELY(internal::fma_in_eft_range(x, y, z))) { return internal::fma_eft(x, y, z); }
+			if constexpr (std::is_same_v<T, double>) { return internal::fma_double_exact(x, y, z); }
+			else { return x * y + z; }
+		}
+	}
+} // namespace ccm::gen
@@ -10,7 +10,65 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/config/compiler.hpp"
+#include "ccmath/internal/math/generic/func/basic/fma_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyperbolic/hyperbolic_kernels_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/math/exponential/impl/log1p_double_impl.hpp"
+#include "ccmath/math/exponential/impl/log_double_impl.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace ccm::gen
 {
+	/**
+	 * @brief Generic constexpr inverse hyperbolic cosine.
+	 *
+	 * acosh(x) = log(x + sqrt(x^2 - 1)) is evaluated as log1p of x - 1 plus a square root below 2, which keeps the
+	 * relative precision of results near zero, as log of a sum of positive terms up to 2^28 and as log(x) + log(2) beyond.
+	 * The square root is formed in double-double, as next to 1 its rounding error alone would cost an ULP of the result.
+	 * @tparam T The floating-point type. float and long double are evaluated in double.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T acosh_gen(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			if (x < 2.0)
+			{
+				if (CCM_UNLIKELY(!(x >= 1.0)))
+				{
+					if (x != x) { return x + x; }
+					// The argument is below 1. Apple clang returns +qNaN, all other major compilers -qNaN.
+#ifdef CCMATH_COMPILER_APPLE_CLANG
+					return std::numeric_limits<double>::quiet_NaN();
+#else
+					return -std::numeric_limits<double>::quiet_NaN();
+#endif
+				}
+
+				// x - 1 is exact.
+				const double t = x - 1.0;
+				if (t == 0.0) { return 0.0; }
 
-} // namespace ccm
+				// Next to 1 the result is about sqrt(2t), so the square root is formed as s + s_lo from w + w_lo = 2t + t^2.
+				// Both sums are fast two-sums: 2t >= t^2 as t < 1, and s >= t.
+				const type::NumberPair<double> t_sqr = internal::fma_two_product(t, t);
+				const double w						 = 2.0 * t + t_sqr.hi;
+				const double w_lo					 = ((2.0 * t - w) + t_sqr.hi) + t_sqr.lo;
+				const double s						 = ccm::sqrt(w);
+				const type::NumberPair<double> s_sqr = internal::fma_two_product(s, s);
+				const double s_lo					 = (((w - s_sqr.hi) - s_sqr.lo) + w_lo) / (2.0 * s);
+				const double u						 = s + t;
+				const double u_lo					 = ((s - u) + t) + s_lo;
+				return ccm::internal::impl::log1p_double_impl(u, u_lo);
+			}
+			if (x < internal::inverse_hyperbolic_large) { return ccm::internal::impl::log_double_impl(2.0 * x - 1.0 / (x + ccm::sqrt(x * x - 1.0))); }
+			if (CCM_UNLIKELY(x == std::numeric_limits<double>::infinity() || x != x)) { return x + x; }
+			return ccm::internal::impl::log_double_impl(x) + internal::inverse_hyperbolic_ln2;
+		}
+		else { return static_cast<T>(acosh_gen<double>(static_cast<double>(x))); }
+	}
+} // namespace ccm::gen
@@ -10,7 +10,58 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/basic/fma_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyperbolic/hyperbolic_kernels_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/math/exponential/impl/log1p_double_impl.hpp"
+#include "ccmath/math/exponential/impl/log_double_impl.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace ccm::gen
 {
+	/**
+	 * @brief Generic constexpr inverse hyperbolic sine.
+	 *
+	 * asinh(a) = log(a + sqrt(a^2 + 1)) is rearranged per range so nothing cancels: log1p near zero, log of a sum of
+	 * positive terms up to 2^28 and log(a) + log(2) beyond. Below 2 the argument of log1p is formed in double-double,
+	 * as its rounding error alone would cost up to half an ULP of the result.
+	 * @tparam T The floating-point type. float and long double are evaluated in double.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T asinh_gen(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const double a = x < 0.0 ? -x : x;
+
+			// asinh(x) rounds to x. This also keeps the sign of zero.
+			if (a < internal::hyperbolic_tiny) { return x; }
 
-} // namespace ccm
+			double result{};
+			if (a < 2.0)
+			{
+				// sqrt(a^2 + 1) = s + s_lo from w + w_lo = a^2 + 1. s - 1 is exact as 1 <= s < 3, so the argument of log1p,
+				// a + s - 1, is u + u_lo to twice the precision and its rounding error is added back to first order.
+				const type::NumberPair<double> a_sqr = internal::fma_two_product(a, a);
+				const type::NumberPair<double> w	 = internal::fma_two_sum(1.0, a_sqr.hi);
+				const double w_lo					 = w.lo + a_sqr.lo;
+				const double s						 = ccm::sqrt(w.hi);
+				const type::NumberPair<double> s_sqr = internal::fma_two_product(s, s);
+				const double s_lo					 = (((w.hi - s_sqr.hi) - s_sqr.lo) + w_lo) / (2.0 * s);
+				const type::NumberPair<double> u	 = internal::fma_two_sum(a, s - 1.0);
+				result								 = ccm::internal::impl::log1p_double_impl(u.hi, u.lo + s_lo);
+			}
+			else if (a < internal::inverse_hyperbolic_large) { result = ccm::internal::impl::log_double_impl(2.0 * a + 1.0 / (ccm::sqrt(a * a + 1.0) + a)); }
+			else
+			{
+				if (CCM_UNLIKELY(a == std::numeric_limits<double>::infinity() || x != x)) { return x + x; }
+				result = ccm::internal::impl::log_double_impl(a) + internal::inverse_hyperbolic_ln2;
+			}
+			return x < 0.0 ? -result : result;
+		}
+		else { return static_cast<T>(asinh_gen<double>(static_cast<double>(x))); }
+	}
+} // namespace ccm::gen
@@ -10,7 +10,61 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/config/compiler.hpp"
+#include "ccmath/internal/math/generic/func/basic/fma_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyperbolic/hyperbolic_kernels_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/math/exponential/impl/log1p_double_impl.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace ccm::gen
 {
+	/**
+	 * @brief Generic constexpr inverse hyperbolic tangent.
+	 *
+	 * atanh(a) = log1p(2a / (1 - a)) / 2. The rounding error of the quotient is recovered exactly and passed to log1p as
+	 * the low part of its argument, which keeps the result within 0.6 ULP.
+	 * @tparam T The floating-point type. float and long double are evaluated in double.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T atanh_gen(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const double a = x < 0.0 ? -x : x;
+			double result{};
+			if (a < 1.0)
+			{
+				// atanh(x) rounds to x. This also keeps the sign of zero.
+				if (a < internal::hyperbolic_tiny) { return x; }
 
-} // namespace ccm
+				// 1 - a = d + d_lo and 2a - u d are exact, which gives the rounding error of u = 2a / (1 - a). It is added
+				// back to first order after log1p.
+				const double d						   = 1.0 - a;
+				const double d_lo					   = (1.0 - d) - a;
+				const double u						   = 2.0 * a / d;
+				const type::NumberPair<double> product = internal::fma_two_product(u, d);
+				const double u_lo					   = (((2.0 * a - product.hi) - product.lo) - u * d_lo) / d;
+				result								   = 0.5 * ccm::internal::impl::log1p_double_impl(u, u_lo);
+			}
+			else
+			{
+				if (CCM_UNLIKELY(x != x)) { return x + x; }
+				if (a == 1.0) { result = std::numeric_limits<double>::infinity(); }
+				else
+				{
+					// |x| > 1. Apple clang returns +qNaN, all other major compilers -qNaN.
+#ifdef CCMATH_COMPILER_APPLE_CLANG
+					return std::numeric_limits<double>::quiet_NaN();
+#else
+					return -std::numeric_limits<double>::quiet_NaN();
+#endif
+				}
+			}
+			return x < 0.0 ? -result : result;
+		}
+		else { return static_cast<T>(atanh_gen<double>(static_cast<double>(x))); }
+	}
+} // namespace ccm::gen
@@ -10,7 +10,35 @@
 
 #pragma once
 
-namespace ccm
-{
+#include "ccmath/internal/math/generic/func/hyperbolic/hyperbolic_kernels_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+
+#include <type_traits>
 
-} // namespace ccm
+namespace ccm::gen
+{
+	/**
+	 * @brief Generic constexpr hyperbolic cosine.
+	 *
+	 * Below |x| = 0.55 the result is a Taylor polynomial, below 22 it is (e^|x| + e^-|x|) / 2 with e^|x| split in two
+	 * parts, and beyond that it is e^|x| / 2.
+	 * @tparam T The floating-point type. float and long double are evaluated in double.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T cosh_gen(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const double a = x < 0.0 ? -x : x;
+			if (a < internal::hyperbolic_large)
+			{
+				if (a < internal::hyperbolic_tiny) { return 1.0; }
+				if (a < internal::cosh_poly_max) { return 1.0 + internal::cosh_poly_tail(a * a); }
+				return internal::cosh_exp_kernel(internal::exp_split_kernel(a));
+			}
+			if (CCM_UNLIKELY(x != x)) { return x + x; }
+			return internal::half_exp_kernel(a);
+		}
+		else { return static_cast<T>(cosh_gen<double>(static_cast<double>(x))); }
+	}
+} // namespace ccm::gen
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/basic/fma_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/helpers/exp_helpers.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
+#include "ccmath/math/exponential/impl/exp_data.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+// Constants and kernels shared by the hyperbolic functions. Each kernel takes a = |x| and leaves the sign to the caller.
+namespace ccm::gen::internal
+{
+	/// Below this |x|, sinh, tanh, asinh and atanh round to x and cosh rounds to 1.
+	constexpr double hyperbolic_tiny = 0x1p-27;
+
+	/// Below this |x|, sinh uses its Taylor polynomial.
+	constexpr double sinh_poly_max = 1.0;
+
+	/// Below this |x|, cosh and tanh use Taylor polynomials.
+	constexpr double cosh_poly_max = 0.55;
+
+	/// From this |x| on, e^-|x| is below 2^-63 of e^|x|, so sinh and cosh are e^|x| / 2 and tanh rounds to 1.
+	constexpr double hyperbolic_large = 22.0;
+
+	/// The largest |x| for which e^|x| / 2 does not overflow, just below log(2 DBL_MAX).
+	constexpr double hyperbolic_overflow = 0x1.633ce8fb9f87dp+9;
+
+	/// From this |x| on, asinh(x) and acosh(x) round to log(2|x|) and squaring x would overflow.
+	constexpr double inverse_hyperbolic_large = 0x1p28;
+
+	/// log(2) rounded to double.
+	constexpr double inverse_hyperbolic_ln2 = 0x1.62e42fefa39efp-1;
+
+	/// 1/3!, 1/5!, ..., 1/19!. sinh(a) = a + a^3 p(a^2) is within 2^-60 relative for a < 1.
+	constexpr std::array<double, 9> sinh_taylor{
+		0x1.5555555555555p-3,  0x1.1111111111111p-7,  0x1.a01a01a01a01ap-13, 0x1.71de3a556c734p-19, 0x1.ae64567f544e4p-26,
+		0x1.6124613a86d09p-33, 0x1.ae7f3e733b81fp-41, 0x1.952c77030ad4ap-49, 0x1.2f49b46814157p-57,
+	};
+
+	/// 1/2!, 1/4!, ..., 1/16!. cosh(a) = 1 + a^2 q(a^2) is within 2^-58 relative for a < 0.55.
+	constexpr std::array<double, 8> cosh_taylor{
+		0x1.0000000000000p-1,  0x1.5555555555555p-5,  0x1.6c16c16c16c17p-10, 0x1.a01a01a01a01ap-16,
+		0x1.27e4fb7789f5cp-22, 0x1.1eed8eff8d898p-29, 0x1.93974a8c07c9dp-37, 0x1.ae7f3e733b81fp-45,
+	};
+
+	/// sinh(a) - a for a < sinh_poly_max. Adding a last keeps the rounding error of the polynomial well below an ULP.
+	constexpr double sinh_poly_tail(double a, double a_sqr) noexcept
+	{
+		return a * a_sqr * support::polyeval_pairs<2>(sinh_taylor[0] + a_sqr * sinh_taylor[1], a_sqr, a_sqr * a_sqr, sinh_taylor);
+	}
+
+	/// cosh(a) - 1 for a < cosh_poly_max.
+	constexpr double cosh_poly_tail(double a_sqr) noexcept
+	{
+		return a_sqr * support::polyeval_pairs<2>(cosh_taylor[0] + a_sqr * cosh_taylor[1], a_sqr, a_sqr * a_sqr, cosh_taylor);
+	}
+
+	/// (cosh(a) - 1 - a^2 / 2) / a^4 for a < cosh_poly_max.
+	constexpr double cosh_poly_rest(double a_sqr) noexcept
+	{
+		return support::polyeval_pairs<3>(cosh_taylor[1] + a_sqr * cosh_taylor[2], a_sqr, a_sqr * a_sqr, cosh_taylor);
+	}
+
+	/// e^a = hi + lo for 0 <= a < hyperbolic_large, with a relative error of about 2^-61.
+	struct exp_split
+	{
+		double hi;
+		double lo;
+	};
+
+	/**
+	 * @brief 2^Log2Factor e^a split into a head and a tail.
+	 *
+	 * The reduction, table and polynomial of exp_double_impl give e^a = scale * (1 + tmp). scale is exact and tmp is
+	 * small, so scale + scale * tmp is split with a fast two-sum instead of being rounded. The power of two goes into
+	 * the exponent of scale, which must stay a normal double.
+	 */
+	template <std::int64_t Log2Factor = 0>
+	constexpr exp_split exp_split_kernel(double a) noexcept
+	{
+		using data = ccm::internal::exp_data<double>;
+
+		double expo					   = support::helpers::narrow_eval(data::invln2N * a + data::shift);
+		const std::uint64_t expo_int64 = support::double_to_uint64(expo);
+		expo -= data::shift;
+		const double rem = a + expo * data::negln2hiN + expo * data::negln2loN;
+
+		const std::uint64_t index = 2 * (expo_int64 % data::table_size);
+		const std::uint64_t top	  = (expo_int64 + static_cast<std::uint64_t>(Log2Factor) * data::table_size) << (52 - data::table_bits);
+		const double tail		  = support::uint64_to_double(data::tab[index]);
+		const double scale		  = support::uint64_to_double(data::tab[index + 1] + top);
+
+		const double rem_sqr = rem * rem;
+		const double product = scale * support::polyeval_pairs<0>(tail + rem, rem, rem_sqr, data::poly);
+		const double hi		 = scale + product;
+		return {hi, (scale - hi) + product};
+	}
+
+	/// sinh(a) for sinh_poly_max <= a < hyperbolic_large. e^-a is at most 0.37 e^a, so it needs no tail.
+	constexpr double sinh_exp_kernel(const exp_split & e) noexcept
+	{
+		return 0.5 * (e.hi + (e.lo - 1.0 / e.hi));
+	}
+
+	/// cosh(a) for cosh_poly_max <= a < hyperbolic_large.
+	constexpr double cosh_exp_kernel(const exp_split & e) noexcept
+	{
+		return 0.5 * (e.hi + (e.lo + 1.0 / e.hi));
+	}
+
+	/**
+	 * @brief e^a / 2 for hyperbolic_large <= a, rounded once.
+	 *
+	 * The table scale holds e^a / 4 and the sum is doubled, which is exact. Near the overflow threshold the reduction
+	 * rounds a / ln2 up to 1025, where e^a / 2 would need a scale of 2^1024.
+	 */
+	constexpr double half_exp_kernel(double a) noexcept
+	{
+		if (CCM_UNLIKELY(a > hyperbolic_overflow)) { return std::numeric_limits<double>::infinity(); }
+		const exp_split e = exp_split_kernel<-2>(a);
+		return 2.0 * (e.hi + e.lo);
+	}
+
+	/**
+	 * @brief tanh(a) for hyperbolic_tiny <= a < hyperbolic_large.
+	 *
+	 * Below 0.55 the quotient of the sinh and cosh polynomials is taken with one correction step, above it
+	 * tanh(a) = 1 - 2 / (e^2a + 1) with e^2a split into head and tail. Neither form cancels, and both carry the rounding
+	 * error of their quotient to the last addition.
+	 */
+	constexpr double tanh_kernel(double a) noexcept
+	{
+		if (a < cosh_poly_max)
+		{
+			// cosh(a) - 1 = cosh_head + cosh_low with the exact a^2 / 2 as head. The residual is only as accurate as this
+			// sum, and rounding the whole tail to one double costs up to 2 ULP of it.
+			const type::NumberPair<double> a_sqr = fma_two_product(a, a);
+			const double sinh_tail				 = sinh_poly_tail(a, a_sqr.hi);
+			const double cosh_head				 = 0.5 * a_sqr.hi;
+			const double cosh_low				 = 0.5 * a_sqr.lo + a_sqr.hi * a_sqr.hi * cosh_poly_rest(a_sqr.hi);
+			const double cosh_val				 = 1.0 + (cosh_head + cosh_low);
+
+			// q = (a + sinh_tail) / cosh_val. a - q is exact, as q lies within a factor of 2 of a.
+			const double q		  = (a + sinh_tail) / cosh_val;
+			const double residual = (((a - q) + sinh_tail) - q * cosh_head) - q * cosh_low;
+			return q + residual / cosh_val;
+		}
+
+		// e^2a + 1 = sum + sum_lo, where the fast two-sum is exact as e^2a > 1.
+		const exp_split e	= exp_split_kernel(2.0 * a);
+		const double sum	= e.hi + 1.0;
+		const double sum_lo = ((e.hi - sum) + 1.0) + e.lo;
+		const double q		= 2.0 / sum;
+
+		// 2 - q * sum is exact with the product split, so q_lo is the rounding error of the quotient.
+		const type::NumberPair<double> product = fma_two_product(q, sum);
+		const double q_lo					   = (((2.0 - product.hi) - product.lo) - q * sum_lo) / sum;
+
+		// q <= 1/2, so a fast two-sum splits 1 - q exactly.
+		const double head	 = 1.0 - q;
+		const double head_lo = (1.0 - head) - q;
+		return head + (head_lo - q_lo);
+	}
+} // namespace ccm::gen::internal
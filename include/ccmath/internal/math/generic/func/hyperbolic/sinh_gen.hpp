@@ -10,7 +10,40 @@
 
 #pragma once
 
-namespace ccm
-{
+#include "ccmath/internal/math/generic/func/hyperbolic/hyperbolic_kernels_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+
+#include <type_traits>
 
-} // namespace ccm
+namespace ccm::gen
+{
+	/**
+	 * @brief Generic constexpr hyperbolic sine.
+	 *
+	 * Below |x| = 1 the result is a Taylor polynomial, below 22 it is (e^|x| - e^-|x|) / 2 with e^|x| split in two
+	 * parts, and beyond that it is e^|x| / 2.
+	 * @tparam T The floating-point type. float and long double are evaluated in double.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T sinh_gen(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const double a = x < 0.0 ? -x : x;
+			double result{};
+			if (a < internal::hyperbolic_large)
+			{
+				// sinh(x) rounds to x. This also keeps the sign of zero.
+				if (a < internal::hyperbolic_tiny) { return x; }
+				result = a < internal::sinh_poly_max ? a + internal::sinh_poly_tail(a, a * a) : internal::sinh_exp_kernel(internal::exp_split_kernel(a));
+			}
+			else
+			{
+				if (CCM_UNLIKELY(x != x)) { return x + x; }
+				result = internal::half_exp_kernel(a);
+			}
+			return x < 0.0 ? -result : result;
+		}
+		else { return static_cast<T>(sinh_gen<double>(static_cast<double>(x))); }
+	}
+} // namespace ccm::gen
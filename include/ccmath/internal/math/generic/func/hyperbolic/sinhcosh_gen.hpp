@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/hyperbolic/hyperbolic_kernels_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+
+#include <type_traits>
+
+namespace ccm::gen
+{
+	/**
+	 * @brief Generic constexpr hyperbolic sine and cosine of the same argument.
+	 *
+	 * Both results share a² below |x| = 0.55 and a single e^|x| above it, which costs little more than one of sinh_gen
+	 * or cosh_gen. The results match those two functions exactly.
+	 * @tparam T The floating-point type. float and long double are evaluated in double.
+	 * @param x The argument.
+	 * @param sinh_out Pointer to store the hyperbolic sine of x.
+	 * @param cosh_out Pointer to store the hyperbolic cosine of x.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void sinhcosh_gen(T x, T * sinh_out, T * cosh_out) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const double a = x < 0.0 ? -x : x;
+			if (a < internal::hyperbolic_large)
+			{
+				if (a < internal::hyperbolic_tiny)
+				{
+					*sinh_out = x;
+					*cosh_out = 1.0;
+					return;
+				}
+				double s{};
+				if (a < internal::cosh_poly_max)
+				{
+					const double a_sqr = a * a;
+					s				   = a + internal::sinh_poly_tail(a, a_sqr);
+					*cosh_out		   = 1.0 + internal::cosh_poly_tail(a_sqr);
+				}
+				else
+				{
+					const internal::exp_split e = internal::exp_split_kernel(a);
+					s							= a < internal::sinh_poly_max ? a + internal::sinh_poly_tail(a, a * a) : internal::sinh_exp_kernel(e);
+					*cosh_out					= internal::cosh_exp_kernel(e);
+				}
+				*sinh_out = x < 0.0 ? -s : s;
+				return;
+			}
+			if (CCM_UNLIKELY(x != x))
+			{
+				*sinh_out = x + x;
+				*cosh_out = x + x;
+				return;
+			}
+			const double half_exp = internal::half_exp_kernel(a);
+			*sinh_out			  = x < 0.0 ? -half_exp : half_exp;
+			*cosh_out			  = half_exp;
+		}
+		else
+		{
+			double s = 0.0;
+			double c = 0.0;
+			sinhcosh_gen<double>(static_cast<double>(x), &s, &c);
+			*sinh_out = static_cast<T>(s);
+			*cosh_out = static_cast<T>(c);
+		}
+	}
+} // namespace ccm::gen
@@ -10,7 +10,39 @@
 
 #pragma once
 
-namespace ccm
-{
+#include "ccmath/internal/math/generic/func/hyperbolic/hyperbolic_kernels_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+
+#include <type_traits>
 
-} // namespace ccm
+namespace ccm::gen
+{
+	/**
+	 * @brief Generic constexpr hyperbolic tangent.
+	 *
+	 * Below |x| = 22 the result comes from internal::tanh_kernel, elsewhere it rounds to ±1.
+	 * @tparam T The floating-point type. float and long double are evaluated in double.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T tanh_gen(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const double a = x < 0.0 ? -x : x;
+			double result{};
+			if (a < internal::hyperbolic_large)
+			{
+				// tanh(x) rounds to x. This also keeps the sign of zero.
+				if (a < internal::hyperbolic_tiny) { return x; }
+				result = internal::tanh_kernel(a);
+			}
+			else
+			{
+				if (CCM_UNLIKELY(x != x)) { return x + x; }
+				result = 1.0;
+			}
+			return x < 0.0 ? -result : result;
+		}
+		else { return static_cast<T>(tanh_gen<double>(static_cast<double>(x))); }
+	}
+} // namespace ccm::gen
@@ -10,7 +10,43 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <type_traits>
+
+namespace ccm::gen
 {
+	/**
+	 * @brief Generic constexpr ceil. Clears the fractional bits of the mantissa and steps positive values up by one.
+	 * @tparam T The floating-point type.
+	 * @param num The value to round upward.
+	 * @return The smallest integral value not less than num.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T ceil_gen(T num) noexcept
+	{
+		using FPBits_t	= support::fp::FPBits<T>;
+		using Storage_t = typename FPBits_t::storage_type;
+
+		FPBits_t bits(num);
+		const int exponent = bits.get_exponent();
+
+		// If x == ±∞ or ±NaN, or all the fraction bits are integral bits, then return num
+		if (exponent >= FPBits_t::fraction_length) { return num; }
+
+		// abs(x) < 1, negative values round to -0
+		if (exponent < 0)
+		{
+			// If x == ±0 then return num
+			if (CCM_UNLIKELY(bits.is_zero())) { return num; }
+			return bits.is_neg() ? T(-0.0) : T(1.0);
+		}
+
+		const Storage_t fractional_bits = (Storage_t(1) << (FPBits_t::fraction_length - exponent)) - 1;
+		const bool has_fraction			= (bits.uintval() & fractional_bits) != 0;
+		bits.set_uintval(bits.uintval() & ~fractional_bits);
 
-} // namespace ccm
+		return bits.get_val() + static_cast<T>(!bits.is_neg() && has_fraction);
+	}
+} // namespace ccm::gen
@@ -10,118 +10,45 @@
 
 #pragma once
 
-#include "ccmath/math/compare/isinf.hpp"
-#include "ccmath/math/compare/isnan.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
 
-#include <limits>
 #include <type_traits>
 
-namespace ccm
+namespace ccm::gen
 {
-	namespace internal::impl
+	/**
+	 * @brief Generic constexpr floor. Clears the fractional bits of the mantissa and steps negative values down by one.
+	 * @tparam T The floating-point type.
+	 * @param num The value to round downward.
+	 * @return The largest integral value not greater than num.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T floor_gen(T num) noexcept
 	{
-		template <typename T>
-		constexpr T floor_pos_impl(T num) noexcept
-		{
-			// Calculate the maximum value that can be compared with 'num' for equality.
-			constexpr auto max_comparable_val = T(1) / std::numeric_limits<T>::epsilon();
-
-			// If 'num' is greater than or equal to the maximum comparable value,
-			// it is already an integer or very close to one, return 'num'.
-			if (num >= max_comparable_val) { return num; }
+		using FPBits_t	= support::fp::FPBits<T>;
+		using Storage_t = typename FPBits_t::storage_type;
 
-			// Initialize the result to 1, as it represents the smallest positive integer
-			// that is not less than 'num'.
-			T result = 1;
+		FPBits_t bits(num);
+		const int exponent = bits.get_exponent();
 
-			// Check if 'num' is equal to the initial result (1).
-			// If true, return 'num' as it is already an integer.
-			if (result == num) { return num; }
-
-			// If 'num' is greater than 1, loop until 'result' becomes greater than or equal to 'num'.
-			// This loop doubles the 'result' in each iteration until it surpasses 'num'.
-			while (result < num) { result *= 2; }
-
-			// After the previous loop, 'result' might have become greater than 'num'.
-			// To get the largest integer not greater than 'num', decrement 'result' until it becomes less than or equal to 'num'.
-			while (result > num) { --result; }
-
-			return result;
-		}
+		// If x == ±∞ or ±NaN, or all the fraction bits are integral bits, then return num
+		if (exponent >= FPBits_t::fraction_length) { return num; }
 
-		template <typename T>
-		constexpr T floor_neg_impl(T num) noexcept
+		// abs(x) < 1
+		if (exponent < 0)
 		{
-			// Initialize the result to -1, as it represents the largest integer not greater than 'num'.
-			T result = -1;
-
-			// If 'num' is less than -1, loop until 'result' becomes less than or equal to 'num'.
-			// This loop doubles the 'result' in each iteration until it becomes less than or equal to 'num'.
-			if (result > num)
-			{
-				while (result > num) { result *= 2; }
-				// After the previous loop, 'result' might have become less than 'num'.
-				// To get the largest integer not greater than 'num' for negative numbers,
-				// increment 'result' until it becomes greater than or equal to 'num'.
-				while (result < num) { ++result; }
-				// If 'result' is not equal to 'num', decrement it to ensure it represents the largest integer not greater than 'num'.
-				if (result != num) { --result; }
-			}
-
-			return result;
+			// If x == ±0 then return num
+			if (CCM_UNLIKELY(bits.is_zero())) { return num; }
+			return bits.is_neg() ? T(-1.0) : T(0.0);
 		}
-	} // namespace internal::impl
-
-
-	/**
-	 * @brief Computes the largest integer value not greater than num.
-	 * @tparam T The type of the number.
-	 * @param num A floating-point or integer value.
-	 * @return If no errors occur, the largest integer value not greater than num, that is ⌊num⌋, is returned.
-	 */
-	template <typename T, std::enable_if_t<!std::is_integral_v<T>, bool> = true>
-	constexpr T floor(T num) noexcept
-	{
-		// If num is NaN, NaN is returned.
-		// If num is ±∞ or ±0, num is returned, unmodified.
-		if (ccm::isinf(num) || num == static_cast<T>(0) || ccm::isnan(num)) { return num; }
 
-		// TODO: This approach should work with long double perfectly, but is slow.
-		//		 at some consider adding a faster approach that is just as consistent.
-		if (num > 0) { return internal::impl::floor_pos_impl(num); }
-		return internal::impl::floor_neg_impl(num);
-	}
+		// The adjustment is computed without branching as whether x is already integral is hard to predict.
+		const Storage_t fractional_bits = (Storage_t(1) << (FPBits_t::fraction_length - exponent)) - 1;
+		const bool has_fraction			= (bits.uintval() & fractional_bits) != 0;
+		bits.set_uintval(bits.uintval() & ~fractional_bits);
 
-	/**
-	 * @brief Computes the largest integer value not greater than num.
-	 * @param num A integer value.
-	 * @return If no errors occur, the largest integer value not greater than num, that is ⌊num⌋, is returned.
-	 */
-	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
-	constexpr double floor(Integer num) noexcept
-	{
-		return static_cast<double>(num); // All integers already have a floor value. Just cast to double and return.
+		// The truncated value has at most fraction_length significant bits, so subtracting one is exact.
+		return bits.get_val() - static_cast<T>(bits.is_neg() && has_fraction);
 	}
-
-	/**
-	 * @brief Computes the largest integer value not greater than num.
-	 * @param num A floating-point value.
-	 * @return If no errors occur, the largest integer value not greater than num, that is ⌊num⌋, is returned.
-	 */
-	constexpr float floorf(float num) noexcept
-	{
-		return ccm::floor<float>(num);
-	}
-
-	/**
-	 * @brief Computes the largest integer value not greater than num.
-	 * @param num A floating-point value.
-	 * @return If no errors occur, the largest integer value not greater than num, that is ⌊num⌋, is returned.
-	 */
-	constexpr double floorl(double num) noexcept
-	{
-		return ccm::floor<double>(num);
-	}
-} // namespace ccm
-
-/// @ingroup nearest
+} // namespace ccm::gen
@@ -10,7 +10,23 @@
 
 #pragma once
 
-namespace ccm
-{
+#include "ccmath/internal/support/fenv/rounding_mode.hpp"
+#include "ccmath/internal/support/fp/directional_rounding_utils.hpp"
+
+#include <type_traits>
 
-} // namespace ccm
+namespace ccm::gen
+{
+	/**
+	 * @brief Generic constexpr rint. Rounds to an integral value using the current rounding mode.
+	 * @tparam T The floating-point type.
+	 * @param num The value to round.
+	 * @return The rounded value.
+	 * @note During constant evaluation the rounding mode is always FE_TONEAREST.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T rint_gen(T num) noexcept
+	{
+		return support::fp::directional_round(num, support::fenv::get_rounding_mode());
+	}
+} // namespace ccm::gen
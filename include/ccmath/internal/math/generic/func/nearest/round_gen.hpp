@@ -10,7 +10,58 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <type_traits>
+
+namespace ccm::gen
 {
+	/**
+	 * @brief Generic constexpr round. Rounds halfway cases away from zero regardless of the current rounding mode.
+	 * @tparam T The floating-point type.
+	 * @param num The value to round.
+	 * @return The integral value nearest to num.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T round_gen(T num) noexcept
+	{
+		using FPBits_t	= support::fp::FPBits<T>;
+		using Storage_t = typename FPBits_t::storage_type;
+
+		FPBits_t bits(num);
+		const int exponent = bits.get_exponent();
+
+		// If x == ±∞ or ±NaN, or all the fraction bits are integral bits, then return num
+		if (exponent >= FPBits_t::fraction_length) { return num; }
+
+		if (exponent < 0)
+		{
+			// If x == ±0 then return num
+			if (CCM_UNLIKELY(bits.is_zero())) { return num; }
+
+			// abs(x) < 0.5 rounds to ±0 and 0.5 <= abs(x) < 1 rounds to ±1
+			if (exponent < -1) { return bits.is_neg() ? T(-0.0) : T(0.0); }
+			return bits.is_neg() ? T(-1.0) : T(1.0);
+		}
+
+		const int trimming_size			= FPBits_t::fraction_length - exponent;
+		const Storage_t fractional_bits = (Storage_t(1) << trimming_size) - 1;
+		const Storage_t half			= Storage_t(1) << (trimming_size - 1);
 
-} // namespace ccm
+		if constexpr (FPBits_t::fraction_length == FPBits_t::significand_length)
+		{
+			// With an implicit leading bit, adding one half to the magnitude bits rounds halfway cases away from zero.
+			// A carry out of the mantissa bumps the exponent, which is exactly the next power of two.
+			bits.set_uintval((bits.uintval() + half) & ~fractional_bits);
+			return bits.get_val();
+		}
+		else
+		{
+			// The explicit leading bit of x87 extended precision would be cleared by a carry, so step by one instead.
+			const T step = static_cast<T>((bits.uintval() & half) != 0);
+			bits.set_uintval(bits.uintval() & ~fractional_bits);
+			return bits.is_neg() ? bits.get_val() - step : bits.get_val() + step;
+		}
+	}
+} // namespace ccm::gen
@@ -10,7 +10,130 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace ccm::gen
 {
+	namespace internal
+	{
+		/// Added to a third of the high word of |x|, so that the seed is within 3.3% of cbrt(x) (B1 of fdlibm's cbrt).
+		constexpr std::uint32_t cbrt_seed_bias = 715094163U;
+
+		/// P(r) ~ 1/cbrt(r) to within 2^-23.5 for |r - 1| < 1/10 (fdlibm's cbrt). t * P(t^3 / x) refines a seed t to 23 bits.
+		constexpr double cbrt_poly_values[5] = {1.87595182427177009643, -1.88497979543377169875, 1.621429720105354466140, -0.758397934778766047437,
+												0.145996192886612446982};
+
+		/// The kernels take |x| in [2^-900, 2^900), where y^3 and the low parts of its exact square and cube stay normal.
+		constexpr double cbrt_min_unscaled = 0x1p-900;
+		constexpr double cbrt_max_unscaled = 0x1p900;
+
+		/// Powers of 2^3 |x| is scaled by outside that range, and the powers of two the result is scaled back by.
+		constexpr double cbrt_scale_up			 = 0x1p300;
+		constexpr double cbrt_scale_down		 = 0x1p-300;
+		constexpr double cbrt_result_scale_up	 = 0x1p100;
+		constexpr double cbrt_result_scale_down = 0x1p-100;
+
+		/**
+		 * @brief cbrt(ax) to about 23 bits for a positive normal ax, given inverse = 1 / ax.
+		 *
+		 * Dividing the high word of ax by 3 divides its biased exponent by 3, and the bias restores the exponent bias and
+		 * makes the carried significand bits a piecewise linear fit of the cube root. The polynomial then corrects the seed
+		 * t by 1/cbrt(t^3 / ax).
+		 */
+		constexpr double cbrt_estimate(double ax, double inverse) noexcept
+		{
+			const auto high	  = static_cast<std::uint32_t>(support::fp::FPBits<double>(ax).uintval() >> 32);
+			const double seed = support::fp::FPBits<double>(static_cast<std::uint64_t>(high / 3 + cbrt_seed_bias) << 32).get_val();
+
+			const auto & poly = cbrt_poly_values;
+			const double r	  = (seed * seed) * (seed * inverse);
+			return seed * ((poly[0] + r * (poly[1] + r * poly[2])) + ((r * r) * r) * (poly[3] + r * poly[4]));
+		}
+
+		/**
+		 * @brief One Halley step t - t (t^3 - ax) / (2 t^3 + ax) on the estimate, which triples its 23 bits.
+		 *
+		 * With q = (t^3 - ax) / ax the step is t - t (q/3) / (1 + 2q/3), and since |q| < 2^-21 the division is replaced
+		 * by three terms of its series, which leaves 1 / ax as the only division of cbrt. The residual is rounded, so the
+		 * result is within about 2^-52.
+		 */
+		constexpr double cbrt_halley(double ax, double t, double inverse) noexcept
+		{
+			const double q = (t * t * t - ax) * inverse;
+			return t - t * (q * (1.0 / 3.0 - q * (2.0 / 9.0 - q * (4.0 / 27.0))));
+		}
+
+		/**
+		 * @brief Newton step on the exact residual y^3 - ax, which rounds y correctly.
+		 *
+		 * y^3 is formed as a double-double from two exact products, and the residual of y, which is within an ulp, is
+		 * scaled by y / (3 ax) ~ 1 / (3 y^2).
+		 */
+		constexpr double cbrt_correct(double ax, double y, double inverse) noexcept
+		{
+			const type::DoubleDouble square = type::exact_mult(y, y);
+			const type::DoubleDouble cube	= type::exact_mult(y, square.hi);
+			const double residual			= (cube.hi - ax) + (cube.lo + y * square.lo);
+			return y - residual * (y * inverse * (1.0 / 3.0));
+		}
+
+		/// Correctly rounded cbrt(ax) for ax in [2^-900, 2^900).
+		constexpr double cbrt_kernel(double ax) noexcept
+		{
+			const double inverse = 1.0 / ax;
+			const double y		 = cbrt_halley(ax, cbrt_estimate(ax, inverse), inverse);
+			return cbrt_correct(ax, y, inverse);
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Generic constexpr cube root.
+	 *
+	 * An exponent-division seed from the bits of |x| is refined by the fdlibm polynomial to 23 bits and by a Halley step
+	 * to about 2^-52, and a final Newton step on the exact double-double residual rounds the double result correctly.
+	 * Float is evaluated in double, where the Halley step is enough to round it correctly. Long double is evaluated in
+	 * double.
+	 * @tparam T The floating-point type.
+	 * @param x The argument.
+	 * @return The cube root of x. Zeros, infinities and NaN are returned as they are.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T cbrt_gen(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const support::fp::FPBits<double> bits(x);
+			if (CCM_UNLIKELY(bits.is_zero() || !bits.is_finite())) { return x + x; }
+
+			const double ax = bits.abs().get_val();
+			double result	= 0.0;
+			if (CCM_UNLIKELY(ax < internal::cbrt_min_unscaled))
+			{
+				result = internal::cbrt_kernel(ax * internal::cbrt_scale_up) * internal::cbrt_result_scale_down;
+			}
+			else if (CCM_UNLIKELY(ax >= internal::cbrt_max_unscaled))
+			{
+				result = internal::cbrt_kernel(ax * internal::cbrt_scale_down) * internal::cbrt_result_scale_up;
+			}
+			else { result = internal::cbrt_kernel(ax); }
+			return bits.is_neg() ? -result : result;
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			const support::fp::FPBits<float> bits(x);
+			if (CCM_UNLIKELY(bits.is_zero() || !bits.is_finite())) { return x + x; }
 
-} // namespace ccm
+			// Every float magnitude, subnormals included, is a double in [2^-149, 2^128).
+			const double ax		 = static_cast<double>(bits.abs().get_val());
+			const double inverse = 1.0 / ax;
+			const auto result	 = static_cast<float>(internal::cbrt_halley(ax, internal::cbrt_estimate(ax, inverse), inverse));
+			return bits.is_neg() ? -result : result;
+		}
+		else { return static_cast<T>(cbrt_gen<double>(static_cast<double>(x))); }
+	}
+} // namespace ccm::gen
@@ -10,7 +10,155 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace ccm::gen
 {
+	namespace internal
+	{
+		/// Largest exponent of the biggest operand for which the exact squares of all operands neither overflow nor lose the result to underflow.
+		constexpr int hypot_max_exponent = 500;
+
+		/// Powers of two the operands are scaled by when the biggest one is outside [2^-500, 2^501).
+		constexpr double hypot_scale_down = 0x1p-600;
+		constexpr double hypot_scale_up	  = 0x1p600;
+
+		/// Add the exact square of v to the double-double sum hi + lo.
+		constexpr void hypot_add_square(double v, double & hi, double & lo) noexcept
+		{
+			const type::DoubleDouble square = type::exact_mult(v, v);
+			const double sum				= hi + square.hi;
+			const double virtual_square		= sum - hi;
+			lo += ((hi - (sum - virtual_square)) + (square.hi - virtual_square)) + square.lo;
+			hi = sum;
+		}
+
+		/// sqrt(hi + lo) with the rounding error of the square root of hi corrected by one Newton step on the exact remainder.
+		constexpr double hypot_sqrt(double hi, double lo) noexcept
+		{
+			const double root				  = ccm::sqrt(hi);
+			const type::DoubleDouble root_sqr = type::exact_mult(root, root);
+			const double remainder			  = ((hi - root_sqr.hi) - root_sqr.lo) + lo;
+			return root + remainder * 0.5 / root;
+		}
+
+		/// sqrt(a^2 + b^2) for a biggest operand in [2^-500, 2^501).
+		constexpr double hypot_kernel(double a, double b) noexcept
+		{
+			double hi = 0.0;
+			double lo = 0.0;
+			hypot_add_square(a, hi, lo);
+			hypot_add_square(b, hi, lo);
+			return hypot_sqrt(hi, lo);
+		}
+
+		/// sqrt(a^2 + b^2 + c^2) for a biggest operand in [2^-500, 2^501).
+		constexpr double hypot_kernel(double a, double b, double c) noexcept
+		{
+			double hi = 0.0;
+			double lo = 0.0;
+			hypot_add_square(a, hi, lo);
+			hypot_add_square(b, hi, lo);
+			hypot_add_square(c, hi, lo);
+			return hypot_sqrt(hi, lo);
+		}
+
+		/**
+		 * @brief Power of two that brings big into [2^-500, 2^501), or 1 when it is there already.
+		 *
+		 * Smaller operands that underflow on the way, or whose squares do, change the result by far less than an ulp.
+		 */
+		constexpr double hypot_scale(double big) noexcept
+		{
+			const int exponent = support::fp::FPBits<double>(big).get_exponent();
+			if (exponent > hypot_max_exponent) { return hypot_scale_down; }
+			if (exponent < -hypot_max_exponent) { return hypot_scale_up; }
+			return 1.0;
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Generic constexpr hypotenuse sqrt(x^2 + y^2) without undue overflow or underflow.
+	 *
+	 * For double the exact squares are summed as a double-double, with a fused multiply-add where the target has one,
+	 * and the square root is corrected with the remainder, which keeps normal results within 0.51 ulp. Operands are scaled by
+	 * a power of two only when the biggest one is outside [2^-500, 2^501). Float is evaluated in double, where the squares
+	 * are exact and cannot overflow. Long double is evaluated in double.
+	 * @tparam T The floating-point type.
+	 * @param x The first operand.
+	 * @param y The second operand.
+	 * @return sqrt(x^2 + y^2). +inf if either operand is infinite, even if the other is NaN, else NaN if either is NaN.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T hypot_gen(T x, T y) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const support::fp::FPBits<double> x_bits(x);
+			const support::fp::FPBits<double> y_bits(y);
+			if (x_bits.is_inf() || y_bits.is_inf()) { return std::numeric_limits<double>::infinity(); }
+			if (x_bits.is_nan() || y_bits.is_nan()) { return std::numeric_limits<double>::quiet_NaN(); }
+
+			const double ax	 = x_bits.abs().get_val();
+			const double ay	 = y_bits.abs().get_val();
+			const double big = ax > ay ? ax : ay;
+			if (big == 0.0) { return 0.0; }
+
+			const double scale = internal::hypot_scale(big);
+			if (CCM_UNLIKELY(scale != 1.0)) { return internal::hypot_kernel(ax * scale, ay * scale) / scale; }
+			return internal::hypot_kernel(ax, ay);
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			const support::fp::FPBits<float> x_bits(x);
+			const support::fp::FPBits<float> y_bits(y);
+			if (x_bits.is_inf() || y_bits.is_inf()) { return std::numeric_limits<float>::infinity(); }
+
+			const auto xd = static_cast<double>(x);
+			const auto yd = static_cast<double>(y);
+			return static_cast<float>(ccm::sqrt(xd * xd + yd * yd));
+		}
+		else { return static_cast<T>(hypot_gen<double>(static_cast<double>(x), static_cast<double>(y))); }
+	}
+
+	/**
+	 * @brief Generic constexpr hypotenuse sqrt(x^2 + y^2 + z^2) without undue overflow or underflow.
+	 *
+	 * Follows the two operand form with a third exact square in the double-double sum, for float as well.
+	 * @tparam T The floating-point type.
+	 * @param x The first operand.
+	 * @param y The second operand.
+	 * @param z The third operand.
+	 * @return sqrt(x^2 + y^2 + z^2). +inf if any operand is infinite, even if another is NaN, else NaN if any is NaN.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T hypot_gen(T x, T y, T z) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const support::fp::FPBits<double> x_bits(x);
+			const support::fp::FPBits<double> y_bits(y);
+			const support::fp::FPBits<double> z_bits(z);
+			if (x_bits.is_inf() || y_bits.is_inf() || z_bits.is_inf()) { return std::numeric_limits<double>::infinity(); }
+			if (x_bits.is_nan() || y_bits.is_nan() || z_bits.is_nan()) { return std::numeric_limits<double>::quiet_NaN(); }
+
+			const double ax	 = x_bits.abs().get_val();
+			const double ay	 = y_bits.abs().get_val();
+			const double az	 = z_bits.abs().get_val();
+			const double xy	 = ax > ay ? ax : ay;
+			const double big = xy > az ? xy : az;
+			if (big == 0.0) { return 0.0; }
 
-} // namespace ccm
+			const double scale = internal::hypot_scale(big);
+			if (CCM_UNLIKELY(scale != 1.0)) { return internal::hypot_kernel(ax * scale, ay * scale, az * scale) / scale; }
+			return internal::hypot_kernel(ax, ay, az);
+		}
+		else { return static_cast<T>(hypot_gen<double>(static_cast<double>(x), static_cast<double>(y), static_cast<double>(z))); }
+	}
+} // namespace ccm::gen
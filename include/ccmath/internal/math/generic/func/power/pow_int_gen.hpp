@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/types/double_double.hpp"
+
+#include <array>
+#include <type_traits>
+
+namespace ccm::gen
+{
+	namespace internal::impl
+	{
+		/// Exponents up to this search every factorization for the shortest chain; larger ones use the binary chain.
+		constexpr unsigned pow_chain_search_limit = 256;
+
+		/**
+		 * @brief The last step of the addition chain used for x^n.
+		 *
+		 * Returns a factor p when x^n is computed as (x^p)^(n/p), or 0 when it is x^(n-1) * x. Up to
+		 * pow_chain_search_limit this is the cheapest combination of the two rules (the factor method), which never uses
+		 * more multiplications than binary exponentiation and saves one for exponents such as 15 = 3 * 5 or 27 = 3 * 9.
+		 */
+		constexpr unsigned pow_chain_step(unsigned n) noexcept
+		{
+			if (n > pow_chain_search_limit) { return n % 2 == 0 ? 2 : 0; }
+
+			std::array<unsigned, pow_chain_search_limit + 1> cost{};
+			std::array<unsigned, pow_chain_search_limit + 1> step{};
+			for (unsigned i = 2; i <= n; ++i)
+			{
+				cost[i] = cost[i - 1] + 1;
+				for (unsigned p = 2; p * p <= i; ++p)
+				{
+					if (i % p == 0 && cost[p] + cost[i / p] < cost[i])
+					{
+						cost[i] = cost[p] + cost[i / p];
+						step[i] = p;
+					}
+				}
+			}
+			return step[n];
+		}
+
+		/// x^N, N >= 1, with the multiplications of the addition chain picked by pow_chain_step.
+		template <unsigned N, typename V, typename Mult>
+		constexpr V pow_chain(const V & x, const Mult & mult) noexcept
+		{
+			if constexpr (N == 1) { return x; }
+			else
+			{
+				constexpr unsigned step = pow_chain_step(N);
+				if constexpr (step == 0) { return mult(pow_chain<N - 1>(x, mult), x); }
+				else { return pow_chain<N / step>(pow_chain<step>(x, mult), mult); }
+			}
+		}
+
+		/// x^n, n >= 1, by right-to-left binary exponentiation.
+		template <typename V, typename Mult>
+		constexpr V pow_binary(V x, unsigned n, const Mult & mult) noexcept
+		{
+			for (; (n & 1U) == 0; n >>= 1U) { x = mult(x, x); }
+			V result = x;
+			for (n >>= 1U; n != 0; n >>= 1U)
+			{
+				x = mult(x, x);
+				if ((n & 1U) != 0) { result = mult(result, x); }
+			}
+			return result;
+		}
+
+		struct pow_plain_mult
+		{
+			template <typename V>
+			constexpr V operator()(const V & a, const V & b) const noexcept
+			{
+				return a * b;
+			}
+		};
+
+		/**
+		 * @brief The product of two double-doubles, as the rounded product of the high parts and a compensation term.
+		 *
+		 * The pair is left unnormalized: the low part stays below a few ulps of the high part over a chain, and adding it
+		 * only once at the end saves a two-sum per multiplication. The a.lo * b.lo term is below the precision kept.
+		 */
+		struct pow_dd_mult
+		{
+			constexpr type::DoubleDouble operator()(const type::DoubleDouble & a, const type::DoubleDouble & b) const noexcept
+			{
+				const type::DoubleDouble p = type::exact_mult(a.hi, b.hi);
+				return {p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi)};
+			}
+		};
+
+		/// 1/x as a double-double. The residual 1 - x * r is exact, so the low part carries the rounding error of r.
+		constexpr type::DoubleDouble pow_dd_recip(double x) noexcept
+		{
+			const double r			   = 1.0 / x;
+			const type::DoubleDouble e = type::exact_mult(x, r);
+			return {r, ((1.0 - e.hi) - e.lo) * r};
+		}
+
+		/// Whether a double-double power is usable: zero and non-finite high parts lose the IEEE sign and infinity rules.
+		constexpr bool pow_dd_is_usable(double hi) noexcept
+		{
+			return hi != 0.0 && hi - hi == 0.0;
+		}
+
+		/**
+		 * @brief x^n for a compile-time integer n.
+		 *
+		 * Float is raised in double and double in double-double, so the few roundings of the chain stay below the final
+		 * one and the result is correctly rounded except for rare inputs. Zero, infinite and NaN inputs, and results that
+		 * overflow or underflow, go through the plain chain, whose IEEE arithmetic gives the signed zeros and infinities.
+		 */
+		template <int N, typename T>
+		constexpr T pow_n(T x) noexcept
+		{
+			constexpr unsigned magnitude = N < 0 ? 0U - static_cast<unsigned>(N) : static_cast<unsigned>(N);
+			if constexpr (N == 0) { return static_cast<T>(1); }
+			else if constexpr (std::is_same_v<T, float>)
+			{
+				const double p = pow_chain<magnitude>(static_cast<double>(x), pow_plain_mult{});
+				return static_cast<float>(N < 0 ? 1.0 / p : p);
+			}
+			else if constexpr (std::is_same_v<T, double> && magnitude > 1)
+			{
+				if (pow_dd_is_usable(x))
+				{
+					const type::DoubleDouble base = N < 0 ? pow_dd_recip(x) : type::DoubleDouble{x, 0.0};
+					const type::DoubleDouble p	  = pow_chain<magnitude>(base, pow_dd_mult{});
+					if (pow_dd_is_usable(p.hi)) { return p.hi + p.lo; }
+				}
+				const double p = pow_chain<magnitude>(x, pow_plain_mult{});
+				return N < 0 ? 1.0 / p : p;
+			}
+			else
+			{
+				const T p = pow_chain<magnitude>(x, pow_plain_mult{});
+				return N < 0 ? static_cast<T>(1) / p : p;
+			}
+		}
+
+		/// x^n for a runtime integer n, with the same precision as pow_n.
+		template <typename T>
+		constexpr T pow_int(T x, int n) noexcept
+		{
+			const unsigned magnitude = n < 0 ? 0U - static_cast<unsigned>(n) : static_cast<unsigned>(n);
+			if (magnitude == 0) { return static_cast<T>(1); }
+			if constexpr (std::is_same_v<T, float>)
+			{
+				const double p = pow_binary(static_cast<double>(x), magnitude, pow_plain_mult{});
+				return static_cast<float>(n < 0 ? 1.0 / p : p);
+			}
+			else
+			{
+				if constexpr (std::is_same_v<T, double>)
+				{
+					if (magnitude > 1 && pow_dd_is_usable(x))
+					{
+						const type::DoubleDouble base = n < 0 ? pow_dd_recip(x) : type::DoubleDouble{x, 0.0};
+						const type::DoubleDouble p	  = pow_binary(base, magnitude, pow_dd_mult{});
+						if (pow_dd_is_usable(p.hi)) { return p.hi + p.lo; }
+					}
+				}
+				const T p = pow_binary(x, magnitude, pow_plain_mult{});
+				return n < 0 ? static_cast<T>(1) / p : p;
+			}
+		}
+	} // namespace internal::impl
+
+	/**
+	 * @brief x^N for an exponent known at compile time, usable in constant expressions.
+	 * @tparam N The exponent.
+	 * @tparam T float, double or long double.
+	 * @param x The base.
+	 * @return x raised to N, with the special values of std::pow for integer exponents.
+	 */
+	template <int N, typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T pow_n_gen(T x) noexcept
+	{
+		return internal::impl::pow_n<N>(x);
+	}
+
+	/**
+	 * @brief x^n for an integer exponent, usable in constant expressions.
+	 * @tparam T float, double or long double.
+	 * @param x The base.
+	 * @param n The exponent.
+	 * @return x raised to n, with the special values of std::pow for integer exponents.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T pow_int_gen(T x, int n) noexcept
+	{
+		return internal::impl::pow_int(x, n);
+	}
+} // namespace ccm::gen
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ccm::gen
+{
+	namespace internal::impl
+	{
+		/// The sign (-1, 0 or 1) of the exact sum of terms, from a nonoverlapping expansion built with Knuth's two-sum.
+		template <std::size_t N>
+		constexpr int exact_sum_sign(const std::array<double, N> & terms) noexcept
+		{
+			std::array<double, N> expansion{};
+			std::size_t length = 0;
+			for (const double term : terms)
+			{
+				double q = term;
+				for (std::size_t i = 0; i < length; ++i)
+				{
+					const double sum	 = q + expansion[i];
+					const double virtual_b = sum - q;
+					const double virtual_a = sum - virtual_b;
+					expansion[i]		   = (q - virtual_a) + (expansion[i] - virtual_b);
+					q					   = sum;
+				}
+				expansion[length++] = q;
+			}
+
+			// The components grow in magnitude and do not overlap, so the largest nonzero one decides the sign.
+			for (std::size_t i = length; i > 0; --i)
+			{
+				if (expansion[i - 1] > 0.0) { return 1; }
+				if (expansion[i - 1] < 0.0) { return -1; }
+			}
+			return 0;
+		}
+
+		/**
+		 * @brief 1/sqrt(f) correctly rounded for f in [1, 4).
+		 *
+		 * 1/ccm::sqrt(f) is within about one ulp. One Newton step on the exact residual 1 - f * y^2 gives the result to
+		 * within 2^-100, which decides the rounding unless it lies within 2^-98 of the midpoint between two doubles. Those
+		 * inputs settle the sign of 1 - f * m^2 at the midpoint m exactly.
+		 */
+		constexpr double rsqrt_reduced_dbl(double f) noexcept
+		{
+			const double y0 = 1.0 / ccm::sqrt(f);
+
+			const type::DoubleDouble y0_sq = type::exact_mult(y0, y0);
+			const type::DoubleDouble fh	   = type::exact_mult(f, y0_sq.hi);
+			const double residual		   = ((1.0 - fh.hi) - fh.lo) - f * y0_sq.lo;
+			const double delta			   = y0 * residual * 0.5;
+
+			// y1 + d equals y0 + delta exactly, and the true value is within 2^-100 of it.
+			const double y1 = y0 + delta;
+			const double d	= (y0 - y1) + delta;
+
+			// The midpoint next to y1 is half an ulp away: 2^-54 in [0.5, 1), but 2^-53 above 1 and 2^-55 below 0.5. Testing
+			// |d| against all three keeps the sign of d, which is random, out of the branches on the common path.
+			const double magnitude = d < 0.0 ? -d : d;
+			const auto far_from	   = [magnitude](double half_gap) { return (magnitude < half_gap ? half_gap - magnitude : magnitude - half_gap) >= 0x1p-98; };
+			if (far_from(0x1p-54) && far_from(0x1p-53) && far_from(0x1p-55)) { return y1; }
+
+			double half_gap = 0x1p-54;
+			if (y1 == 1.0 && d > 0.0) { half_gap = 0x1p-53; }
+			else if (y1 == 0.5 && d < 0.0) { half_gap = 0x1p-55; }
+
+			// m = y1 + g is not a double, so 1 - f * m^2 = 1 - f * y1^2 - 2 * f * y1 * g - f * g^2 is summed term by term.
+			const double g				   = d > 0.0 ? half_gap : -half_gap;
+			const type::DoubleDouble y1_sq = type::exact_mult(y1, y1);
+			const type::DoubleDouble p0	   = type::exact_mult(f, y1_sq.hi);
+			const type::DoubleDouble p1	   = type::exact_mult(f, y1_sq.lo);
+			const type::DoubleDouble p2	   = type::exact_mult(f, 2.0 * y1 * g);
+			const int sign = exact_sum_sign(std::array<double, 8>{1.0, -p0.hi, -p0.lo, -p1.hi, -p1.lo, -p2.hi, -p2.lo, -(f * (g * g))});
+
+			// 1/sqrt(f) never equals a midpoint, so the sign is never zero.
+			if (d > 0.0 && sign > 0) { return y1 + 2.0 * half_gap; }
+			if (d < 0.0 && sign < 0) { return y1 - 2.0 * half_gap; }
+			return y1;
+		}
+
+		constexpr double rsqrt_dbl(double x) noexcept
+		{
+			if (x != x) { return x; }
+			if (x == 0.0) { return (support::bit_cast<std::uint64_t>(x) >> 63) != 0 ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity(); }
+			if (x < 0.0) { return std::numeric_limits<double>::quiet_NaN(); }
+			if (x == std::numeric_limits<double>::infinity()) { return 0.0; }
+
+			// Subnormals are scaled by 4^27 first and the result by 2^27 at the end.
+			int extra = 0;
+			if (x < std::numeric_limits<double>::min())
+			{
+				x *= 0x1p54;
+				extra = 27;
+			}
+
+			// x = f * 4^k with f in [1, 4). The result 2^-k / sqrt(f) is a normal double for every input, so the final scaling is exact.
+			const std::uint64_t bits = support::bit_cast<std::uint64_t>(x);
+			const int exponent		 = static_cast<int>(bits >> 52) - 1023;
+			const int k				 = (exponent - (exponent & 1)) / 2;
+			const double f			 = support::bit_cast<double>((bits & 0x000FFFFFFFFFFFFFULL) | (static_cast<std::uint64_t>(1023 + exponent - 2 * k) << 52));
+			const double scale		 = support::bit_cast<double>(static_cast<std::uint64_t>(1023 - k + extra) << 52);
+			return rsqrt_reduced_dbl(f) * scale;
+		}
+
+		constexpr float rsqrt_flt(float x) noexcept
+		{
+			if (x != x) { return x; }
+			if (x == 0.0F) { return (support::bit_cast<std::uint32_t>(x) >> 31) != 0 ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::infinity(); }
+			if (x < 0.0F) { return std::numeric_limits<float>::quiet_NaN(); }
+			if (x == std::numeric_limits<float>::infinity()) { return 0.0F; }
+
+			// Double has enough guard bits that rounding 1/sqrt(x) twice, once to double and once to float, is correct
+			// for every float (checked exhaustively over [1, 4), which covers every other binade by scaling with 4^k).
+			return static_cast<float>(1.0 / ccm::sqrt(static_cast<double>(x)));
+		}
+	} // namespace internal::impl
+
+	/**
+	 * @brief Correctly rounded 1/sqrt(x) for float and double, usable in constant expressions.
+	 *
+	 * Returns +inf for +0, -inf for -0, +0 for +inf and NaN for negative inputs and NaN.
+	 * @tparam T float or double.
+	 * @param x The input.
+	 * @return 1/sqrt(x) rounded to nearest.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	constexpr T rsqrt_gen(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return internal::impl::rsqrt_flt(x); }
+		else { return internal::impl::rsqrt_dbl(x); }
+	}
+} // namespace ccm::gen
@@ -10,7 +10,57 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/trig/inverse_trig_kernels_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace ccm::gen
 {
+	/**
+	 * @brief Generic constexpr arc cosine.
+	 *
+	 * Below 1/2 in magnitude acos(x) = pi/2 - asin(x). Beyond, acos(x) = 2 asin(sqrt((1 - x) / 2)) for positive x and
+	 * pi - 2 asin(sqrt((1 + x) / 2)) for negative x, which keeps full relative precision next to x = 1.
+	 * @tparam T The floating-point type. float and long double are evaluated in double.
+	 * @param x The argument.
+	 * @return The arc cosine of x in [0, pi]. NaN is returned for |x| > 1.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T acos_gen(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const support::fp::FPBits<double> bits(x);
+			const double a = bits.abs().get_val();
+			if (a < 0.5)
+			{
+				// |x| < 2^-57, acos(x) rounds to pi/2.
+				if (bits.get_exponent() < -57) { return internal::inverse_trig_pio2_hi + internal::inverse_trig_pio2_lo; }
+				return internal::inverse_trig_pio2_hi - (x - (internal::inverse_trig_pio2_lo - x * internal::asin_rational(x * x)));
+			}
+			if (CCM_UNLIKELY(!(a < 1.0)))
+			{
+				if (x == 1.0) { return 0.0; }
+				if (x == -1.0) { return internal::inverse_trig_pi_hi + 2.0 * internal::inverse_trig_pio2_lo; }
+				if (bits.is_nan()) { return x + x; }
+				return std::numeric_limits<double>::quiet_NaN();
+			}
+
+			const double z = (1.0 - a) * 0.5;
+			const double s = ccm::sqrt(z);
+			const double r = internal::asin_rational(z);
+			if (bits.is_neg()) { return internal::inverse_trig_pi_hi - 2.0 * (s + (r * s - internal::inverse_trig_pio2_lo)); }
 
-} // namespace ccm
+			// s = head + c with a 32 bit head, so 2 * head is exact.
+			const double head = support::uint64_to_double(support::double_to_uint64(s) & 0xffffffff00000000ULL);
+			const double c	  = (z - head * head) / (s + head);
+			return 2.0 * (head + (r * s + c));
+		}
+		else { return static_cast<T>(acos_gen<double>(static_cast<double>(x))); }
+	}
+} // namespace ccm::gen
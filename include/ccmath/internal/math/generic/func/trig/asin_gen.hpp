@@ -10,7 +10,62 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/trig/inverse_trig_kernels_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/math/power/sqrt.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace ccm::gen
 {
+	/**
+	 * @brief Generic constexpr arc sine.
+	 *
+	 * Below 1/2 the rational approximation is applied to x directly. Above it asin(x) = pi/2 - 2 asin(sqrt((1 - x) / 2)),
+	 * where the square root is split into a head with 32 bits and a tail so the doubling does not lose precision.
+	 * @tparam T The floating-point type. float and long double are evaluated in double.
+	 * @param x The argument.
+	 * @return The arc sine of x in [-pi/2, pi/2]. NaN is returned for |x| > 1.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T asin_gen(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const support::fp::FPBits<double> bits(x);
+			const double a = bits.abs().get_val();
+			double result  = 0.0;
+			if (a < 0.5)
+			{
+				// |x| < 2^-26, asin(x) rounds to x. This also keeps the sign of zero.
+				if (bits.get_exponent() < -26) { return x; }
+				return x + x * internal::asin_rational(x * x);
+			}
+			if (CCM_UNLIKELY(!(a < 1.0)))
+			{
+				if (a == 1.0) { return x * internal::inverse_trig_pio2_hi + x * internal::inverse_trig_pio2_lo; }
+				if (bits.is_nan()) { return x + x; }
+				return std::numeric_limits<double>::quiet_NaN();
+			}
 
-} // namespace ccm
+			const double z = (1.0 - a) * 0.5;
+			const double s = ccm::sqrt(z);
+			const double r = internal::asin_rational(z);
+			if (a >= 0.975) { result = internal::inverse_trig_pio2_hi - (2.0 * (s + s * r) - internal::inverse_trig_pio2_lo); }
+			else
+			{
+				// s = head + c with a 32 bit head, so 2 * head is exact and pi/4 - head loses nothing.
+				const double head = support::uint64_to_double(support::double_to_uint64(s) & 0xffffffff00000000ULL);
+				const double c	  = (z - head * head) / (s + head);
+				const double p	  = 2.0 * s * r - (internal::inverse_trig_pio2_lo - 2.0 * c);
+				const double q	  = internal::inverse_trig_pio4_hi - 2.0 * head;
+				result			  = internal::inverse_trig_pio4_hi - (p - q);
+			}
+			return bits.is_neg() ? -result : result;
+		}
+		else { return static_cast<T>(asin_gen<double>(static_cast<double>(x))); }
+	}
+} // namespace ccm::gen
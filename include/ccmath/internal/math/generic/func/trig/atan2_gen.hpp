@@ -10,7 +10,97 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/trig/inverse_trig_kernels_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+
+#include <type_traits>
+
+namespace ccm::gen
 {
+	namespace internal
+	{
+		/// Operands inside this range have an exact product t * |x| that neither overflows nor underflows.
+		constexpr double atan2_exact_min = 0x1p-500;
+		constexpr double atan2_exact_max = 0x1p500;
+
+		/// Brings operands within 2^atan2_exponent_gap of each other from outside the exact range back into it.
+		constexpr double atan2_scale_up	  = 0x1p600;
+		constexpr double atan2_scale_down = 0x1p-600;
+
+		/// Quotients beyond 2^60 are pi/2 and those below 2^-60 are zero to double precision.
+		constexpr int atan2_exponent_gap = 60;
+
+		/**
+		 * @brief atan2(y, x) for finite x and y that are both non-zero, before the sign of y is applied.
+		 *
+		 * The rounding error of the quotient t = |y| / |x| is recovered from the exact product t * |x| and handed to the
+		 * kernel as a tail, so the result carries only the error of the kernel itself. Operands outside the exact range are
+		 * first scaled by the same power of two, which changes neither t nor its tail. The left half plane follows from pi - r.
+		 */
+		constexpr double atan2_finite_kernel(double ay, double ax, bool x_neg) noexcept
+		{
+			const int gap = support::fp::FPBits<double>(ay).get_exponent() - support::fp::FPBits<double>(ax).get_exponent();
+			if (gap > atan2_exponent_gap) { return inverse_trig_pio2_hi + inverse_trig_pio2_lo; }
+			if (gap < -atan2_exponent_gap) { return x_neg ? inverse_trig_pi_hi + inverse_trig_pi_lo : ay / ax; }
+
+			// The exponent check above leaves both operands within one scaling step of the exact range.
+			if (ax > atan2_exact_max || ay > atan2_exact_max)
+			{
+				ax *= atan2_scale_down;
+				ay *= atan2_scale_down;
+			}
+			else if (ax < atan2_exact_min || ay < atan2_exact_min)
+			{
+				ax *= atan2_scale_up;
+				ay *= atan2_scale_up;
+			}
+
+			const double t					 = ay / ax;
+			const type::DoubleDouble product = type::exact_mult(t, ax);
+			const double tail				 = ((ay - product.hi) - product.lo) / ax;
+
+			const atan_parts parts = atan_kernel_parts(t, tail);
+			if (!x_neg) { return parts.head - parts.rest; }
+
+			// pi - head is formed with its rounding error, which keeps the rounding of the head out of the result.
+			const double sum = inverse_trig_pi_hi - parts.head;
+			const double err = (inverse_trig_pi_hi - sum) - parts.head;
+			return sum + ((err + parts.rest) + inverse_trig_pi_lo);
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Generic constexpr arc tangent of y/x using the signs of both arguments to determine the quadrant.
+	 * @tparam T The floating-point type. float and long double are evaluated in double.
+	 * @param y The numerator.
+	 * @param x The denominator.
+	 * @return The angle of the point (x, y) in [-pi, pi].
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T atan2_gen(T y, T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const support::fp::FPBits<double> y_bits(y);
+			const support::fp::FPBits<double> x_bits(x);
+			if (CCM_UNLIKELY(y_bits.is_nan() || x_bits.is_nan())) { return x + y; }
 
-} // namespace ccm
+			const double ay	  = y_bits.abs().get_val();
+			const double ax	  = x_bits.abs().get_val();
+			const bool x_neg  = x_bits.is_neg();
+			double result	  = 0.0;
+			if (CCM_UNLIKELY(ay == 0.0 || ax == 0.0 || y_bits.is_inf() || x_bits.is_inf()))
+			{
+				if (ay == 0.0) { result = x_neg ? internal::inverse_trig_pi_hi + internal::inverse_trig_pi_lo : 0.0; }
+				else if (ax == 0.0 || ay > ax) { result = internal::inverse_trig_pio2_hi + internal::inverse_trig_pio2_lo; }
+				else if (ay == ax) { result = x_neg ? 3.0 * internal::inverse_trig_pio4_hi : internal::inverse_trig_pio4_hi; } // Both infinite.
+				else { result = x_neg ? internal::inverse_trig_pi_hi + internal::inverse_trig_pi_lo : 0.0; }
+			}
+			else { result = internal::atan2_finite_kernel(ay, ax, x_neg); }
+			return y_bits.is_neg() ? -result : result;
+		}
+		else { return static_cast<T>(atan2_gen<double>(static_cast<double>(y), static_cast<double>(x))); }
+	}
+} // namespace ccm::gen
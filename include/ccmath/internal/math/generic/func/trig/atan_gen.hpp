@@ -10,7 +10,34 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/trig/inverse_trig_kernels_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <type_traits>
+
+namespace ccm::gen
 {
+	/**
+	 * @brief Generic constexpr arc tangent.
+	 * @tparam T The floating-point type. float and long double are evaluated in double.
+	 * @param x The argument.
+	 * @return The arc tangent of x in [-pi/2, pi/2].
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T atan_gen(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const support::fp::FPBits<double> bits(x);
+			if (CCM_UNLIKELY(bits.is_nan())) { return x + x; }
+
+			// |x| < 2^-27, atan(x) rounds to x. This also keeps the sign of zero.
+			if (bits.get_exponent() < -27) { return x; }
 
-} // namespace ccm
+			const double result = internal::atan_kernel(bits.abs().get_val(), 0.0);
+			return bits.is_neg() ? -result : result;
+		}
+		else { return static_cast<T>(atan_gen<double>(static_cast<double>(x))); }
+	}
+} // namespace ccm::gen
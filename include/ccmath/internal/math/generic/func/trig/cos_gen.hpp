@@ -10,7 +10,68 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/trig/rem_pio2_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/trig_kernels_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <type_traits>
+
+namespace ccm::gen
 {
+	/**
+	 * @brief Generic constexpr cosine.
+	 * @tparam T The floating-point type. long double is evaluated in double.
+	 * @param x The angle in radians.
+	 * @return The cosine of x. NaN is returned for infinite x.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T cos_gen(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>)
+		{
+			const support::fp::FPBits<float> bits(x);
+			if (CCM_UNLIKELY(bits.is_inf_or_nan())) { return x - x; }
+
+			// |x| < pi/4
+			if (bits.uintval() << 1 < 0x3f490fdbU << 1)
+			{
+				// |x| < 2^-12, cos(x) rounds to 1.
+				if (bits.get_exponent() < -12) { return 1.0F; }
+				return static_cast<float>(internal::cosf_kernel(static_cast<double>(x)));
+			}
+
+			const internal::rem_pio2_result reduced = rem_pio2f_gen(x);
+			switch (reduced.quadrant & 3)
+			{
+			case 0: return static_cast<float>(internal::cosf_kernel(reduced.hi));
+			case 1: return static_cast<float>(-internal::sinf_kernel(reduced.hi));
+			case 2: return static_cast<float>(-internal::cosf_kernel(reduced.hi));
+			default: return static_cast<float>(internal::sinf_kernel(reduced.hi));
+			}
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			const support::fp::FPBits<double> bits(x);
+			if (CCM_UNLIKELY(bits.is_inf_or_nan())) { return x - x; }
+
+			// |x| <= pi/4
+			if (bits.uintval() << 1 <= 0x3fe921fb54442d18ULL << 1)
+			{
+				// |x| < 2^-27, cos(x) rounds to 1.
+				if (bits.get_exponent() < -27) { return 1.0; }
+				return internal::cos_kernel(x, 0.0);
+			}
 
-} // namespace ccm
+			const internal::rem_pio2_result reduced = rem_pio2_gen(x);
+			switch (reduced.quadrant & 3)
+			{
+			case 0: return internal::cos_kernel(reduced.hi, reduced.lo);
+			case 1: return -internal::sin_kernel(reduced.hi, reduced.lo, true);
+			case 2: return -internal::cos_kernel(reduced.hi, reduced.lo);
+			default: return internal::sin_kernel(reduced.hi, reduced.lo, true);
+			}
+		}
+		else { return static_cast<T>(cos_gen<double>(static_cast<double>(x))); }
+	}
+} // namespace ccm::gen
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+// Kernels shared by atan, atan2, asin and acos. The constants are those of fdlibm.
+namespace ccm::gen::internal
+{
+	/// pi/2 = pio2_hi + pio2_lo.
+	constexpr double inverse_trig_pio2_hi = 1.57079632679489655800e+00;
+	constexpr double inverse_trig_pio2_lo = 6.12323399573676603587e-17;
+
+	/// pi/4 rounded to double.
+	constexpr double inverse_trig_pio4_hi = 7.85398163397448278999e-01;
+
+	/// pi = pi_hi + pi_lo.
+	constexpr double inverse_trig_pi_hi = 3.14159265358979311600e+00;
+	constexpr double inverse_trig_pi_lo = 1.2246467991473531772e-16;
+
+	/// Upper ends of the atan reduction intervals: 7/16, 11/16, 19/16 and 39/16.
+	constexpr std::array<double, 4> atan_breakpoints{0.4375, 0.6875, 1.1875, 2.4375};
+
+	/// atan(1/2), atan(1), atan(3/2) and atan(inf) as head and tail, the centres the intervals above are reduced to.
+	constexpr std::array<double, 4> atan_centre_hi{
+		4.63647609000806093515e-01,
+		7.85398163397448278999e-01,
+		9.82793723247329054082e-01,
+		1.57079632679489655800e+00,
+	};
+	constexpr std::array<double, 4> atan_centre_lo{
+		2.26987774529616870924e-17,
+		3.06161699786838301793e-17,
+		1.39033110312309984516e-17,
+		6.12323399573676603587e-17,
+	};
+
+	/// Minimax coefficients of (x - atan(x)) / x^3 in x^2 on [-7/16, 7/16].
+	constexpr std::array<double, 11> atan_poly{
+		3.33333333333329318027e-01,	 -1.99999999998764832476e-01, 1.42857142725034663711e-01,  -1.11111104054623557880e-01,
+		9.09088713343650656196e-02,	 -7.69187620504482999495e-02, 6.66107313738753120669e-02,  -5.83357013379057348645e-02,
+		4.97687799461593236017e-02,	 -3.65315727442169155270e-02, 1.62858201153657823623e-02,
+	};
+
+	/// x * (x - atan(x)) / x^3 for |x| <= 7/16. The even and odd coefficients run as two independent chains in x^4.
+	constexpr double atan_poly_tail(double x) noexcept
+	{
+		const double z	= x * x;
+		const double w	= z * z;
+		const auto & a	= atan_poly;
+		const double s1 = z * (a[0] + w * (a[2] + w * (a[4] + w * (a[6] + w * (a[8] + w * a[10])))));
+		const double s2 = w * (a[1] + w * (a[3] + w * (a[5] + w * (a[7] + w * a[9]))));
+		return x * (s1 + s2);
+	}
+
+	/// atan as head - rest, with head either the argument or a table centre and rest far smaller than head.
+	struct atan_parts
+	{
+		double head;
+		double rest;
+	};
+
+	/**
+	 * @brief atan(a + tail) for a finite a >= 0 and a tail far below the last bit of a, before the final subtraction.
+	 *
+	 * Arguments above 7/16 are moved next to zero with atan(a) = atan(c) + atan((a - c) / (1 + a c)) for the nearest
+	 * centre c of the table, below 39/16 exactly, and with atan(a) = pi/2 - atan(1/a) beyond. The tail enters the result
+	 * scaled by the derivative 1/(1 + a^2), which atan2 uses to correct the rounding of its quotient.
+	 */
+	constexpr atan_parts atan_kernel_parts(double a, double tail) noexcept
+	{
+		const double correction = tail / (1.0 + a * a);
+		if (a < atan_breakpoints[0]) { return {a, atan_poly_tail(a) - correction}; }
+
+		int id{};
+		double reduced{};
+		if (a < atan_breakpoints[2])
+		{
+			if (a < atan_breakpoints[1])
+			{
+				id		= 0;
+				reduced = (2.0 * a - 1.0) / (2.0 + a);
+			}
+			else
+			{
+				id		= 1;
+				reduced = (a - 1.0) / (a + 1.0);
+			}
+		}
+		else if (a < atan_breakpoints[3])
+		{
+			id		= 2;
+			reduced = (a - 1.5) / (1.0 + 1.5 * a);
+		}
+		else
+		{
+			id		= 3;
+			reduced = -1.0 / a;
+		}
+		const auto index = static_cast<std::size_t>(id);
+		return {atan_centre_hi[index], ((atan_poly_tail(reduced) - atan_centre_lo[index]) - correction) - reduced};
+	}
+
+	/// atan(a + tail) for a finite a >= 0, see atan_kernel_parts.
+	constexpr double atan_kernel(double a, double tail) noexcept
+	{
+		const atan_parts parts = atan_kernel_parts(a, tail);
+		return parts.head - parts.rest;
+	}
+
+	// Coefficients of the rational approximation asin(x) = x + x * x^2 * p(x^2) / q(x^2) on [-0.5, 0.5].
+	constexpr double asin_p0 = 1.66666666666666657415e-01;
+	constexpr double asin_p1 = -3.25565818622400915405e-01;
+	constexpr double asin_p2 = 2.01212532134862925881e-01;
+	constexpr double asin_p3 = -4.00555345006794114027e-02;
+	constexpr double asin_p4 = 7.91534994289814532176e-04;
+	constexpr double asin_p5 = 3.47933107596021167570e-05;
+	constexpr double asin_q1 = -2.40339491173441421878e+00;
+	constexpr double asin_q2 = 2.02094576023350569471e+00;
+	constexpr double asin_q3 = -6.88283971605453293030e-01;
+	constexpr double asin_q4 = 7.70381505559019352791e-02;
+
+	/// (asin(sqrt(z)) - sqrt(z)) / sqrt(z) for 0 <= z <= 1/4.
+	constexpr double asin_rational(double z) noexcept
+	{
+		const double p = z * (asin_p0 + z * (asin_p1 + z * (asin_p2 + z * (asin_p3 + z * (asin_p4 + z * asin_p5)))));
+		const double q = 1.0 + z * (asin_q1 + z * (asin_q2 + z * (asin_q3 + z * asin_q4)));
+		return p / q;
+	}
+} // namespace ccm::gen::internal
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/predef/likely.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+#include "ccmath/internal/types/big_int.hpp"
+#include "ccmath/internal/types/dyadic_float.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ccm::gen
+{
+	namespace internal
+	{
+		/// Result of reducing x by multiples of pi/2. x - quadrant * pi/2 = hi + lo, where |hi + lo| <= pi/4 and quadrant is taken modulo 4.
+		struct rem_pio2_result
+		{
+			int quadrant;
+			double hi;
+			double lo;
+		};
+
+		// Below this magnitude the three step Cody-Waite reduction is accurate. Above it the Payne-Hanek reduction is used.
+		constexpr int rem_pio2_cody_waite_max_exponent = 20;
+
+		// Cody-Waite constants. Each pio2_N is 33 bits wide so k * pio2_N is exact for |k| < 2^20.
+		constexpr double rem_pio2_toint	 = 0x1.8p52;
+		constexpr double rem_pio2_invpio2 = 6.36619772367581382433e-01;
+		constexpr double rem_pio2_pio2_1	 = 1.57079632673412561417e+00;
+		constexpr double rem_pio2_pio2_1t = 6.07710050650619224932e-11;
+		constexpr double rem_pio2_pio2_2	 = 6.07710050630396597660e-11;
+		constexpr double rem_pio2_pio2_2t = 2.02226624879595063154e-21;
+		constexpr double rem_pio2_pio2_3	 = 2.02226624871116645580e-21;
+		constexpr double rem_pio2_pio2_3t = 8.47842766036889956997e-32;
+
+		// Float inputs are reduced in double, where a 25 bit pio2_1 keeps k * pio2_1 exact for |k| < 2^28.
+		constexpr int rem_pio2f_cody_waite_max_exponent = 28;
+		constexpr double rem_pio2f_pio2_1				= 1.57079631090164184570e+00;
+		constexpr double rem_pio2f_pio2_1t				= 1.58932547735281966916e-08;
+
+		/// Bits of 2/pi, most significant word first. Word i holds the bits of weight 2^-(64i+1) to 2^-(64i+64).
+		constexpr std::array<std::uint64_t, 20> rem_pio2_two_over_pi = {
+			0xA2F9836E4E441529, 0xFC2757D1F534DDC0, 0xDB6295993C439041, 0xFE5163ABDEBBC561, 0xB7246E3A424DD2E0,
+			0x06492EEA09D1921C, 0xFE1DEB1CB129A73E, 0xE88235F52EBB4484, 0xE99C7026B45F7E41, 0x3991D639835339F4,
+			0x9C845F8BBDF9283B, 0x1FF897FFDE05980F, 0xEF2F118B5A0A6D1F, 0x6D367ECF27CB09B7, 0x4F463F669E5FEA2D,
+			0x7527BAC7EBE5F17B, 0x3D0739F78A5292EA, 0x6BFB5FB11F8D5D08, 0x56033046FC7B6BAB, 0xF0CFBC209AF4361D,
+		};
+
+		/// pi/2 as a 128 bit dyadic float.
+		constexpr types::DyadicFloat<128> rem_pio2_pio2_dyadic = {
+			types::Sign::POS, -127, types::UInt<128>({0xC4C6628B80DC1CD1, 0xC90FDAA22168C234})};
+
+		/**
+		 * @brief Cody-Waite reduction for |x| < 2^20. Subtracts k * pi/2 in up to three steps, only taking the later steps
+		 * when cancellation has removed enough bits of the result to need them.
+		 */
+		constexpr rem_pio2_result rem_pio2_cody_waite(double x) noexcept
+		{
+			const double k	 = (x * rem_pio2_invpio2 + rem_pio2_toint) - rem_pio2_toint;
+			const int x_expo = support::fp::FPBits<double>(x).get_exponent();
+
+			double r  = x - k * rem_pio2_pio2_1;
+			double w  = k * rem_pio2_pio2_1t;
+			double hi = r - w;
+			if (x_expo - support::fp::FPBits<double>(hi).get_exponent() > 16)
+			{
+				// Two more steps are enough unless x is very close to a multiple of pi/2.
+				double t = r;
+				w		 = k * rem_pio2_pio2_2;
+				r		 = t - w;
+				w		 = k * rem_pio2_pio2_2t - ((t - r) - w);
+				hi		 = r - w;
+				if (x_expo - support::fp::FPBits<double>(hi).get_exponent() > 49)
+				{
+					t  = r;
+					w  = k * rem_pio2_pio2_3;
+					r  = t - w;
+					w  = k * rem_pio2_pio2_3t - ((t - r) - w);
+					hi = r - w;
+				}
+			}
+			return {static_cast<int>(k), hi, (r - hi) - w};
+		}
+
+		/**
+		 * @brief Payne-Hanek reduction for finite |x| >= 2^20.
+		 *
+		 * With x = m * 2^e, only a 192 bit window of 2/pi starting just above the bits that make m * 2^e * 2/pi a multiple of 4
+		 * contributes to the quadrant and the fraction, so the reduction is one 192 x 64 bit integer product.
+		 */
+		constexpr rem_pio2_result rem_pio2_payne_hanek(double x) noexcept
+		{
+			const support::fp::FPBits<double> bits(x);
+			const int e			  = bits.get_exponent() - support::fp::FPBits<double>::fraction_length;
+			const std::uint64_t m = bits.get_explicit_mantissa();
+
+			// The window starts at the bit of weight 2^-start. Bits above it multiply x to a multiple of 4.
+			const int start		   = e - 1 > 1 ? e - 1 : 1;
+			const auto word		   = static_cast<std::size_t>((start - 1) / 64);
+			const auto offset	   = static_cast<std::size_t>((start - 1) % 64);
+			const auto & table	   = rem_pio2_two_over_pi;
+			const types::UInt<256> words({table[word + 3], table[word + 2], table[word + 1], table[word]});
+			const types::UInt<192> window((words << offset) >> 64);
+
+			// x * 2/pi mod 4 = product * 2^-shift.
+			const types::UInt<256> product = window.ful_mul(types::UInt<64>(m));
+			const auto shift			   = static_cast<std::size_t>(start + 191 - e);
+			int quadrant				   = static_cast<int>(static_cast<std::uint64_t>(product >> shift) & 3);
+			types::UInt<128> fraction((product << (256 - shift)) >> 128);
+
+			// Round to the nearest quadrant so the remainder lies in [-pi/4, pi/4].
+			types::Sign sign = types::Sign::POS;
+			if (fraction.val[1] >> 63 != 0)
+			{
+				++quadrant;
+				fraction = -fraction;
+				sign	 = types::Sign::NEG;
+			}
+
+			const types::DyadicFloat<128> r = types::quick_mul(types::DyadicFloat<128>(sign, -128, fraction), rem_pio2_pio2_dyadic);
+			const auto hi					= static_cast<double>(r);
+			const auto lo					= static_cast<double>(types::quick_add(r, types::DyadicFloat<128>(-hi)));
+			if (bits.is_neg()) { return {-quadrant, -hi, -lo}; }
+			return {quadrant, hi, lo};
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Reduce a finite double by multiples of pi/2.
+	 * @param x The finite value to reduce. Values with |x| <= pi/4 should not be reduced by the caller.
+	 * @return The quadrant and the remainder as a double-double.
+	 */
+	constexpr internal::rem_pio2_result rem_pio2_gen(double x) noexcept
+	{
+		if (CCM_LIKELY(support::fp::FPBits<double>(x).get_exponent() < internal::rem_pio2_cody_waite_max_exponent))
+		{
+			return internal::rem_pio2_cody_waite(x);
+		}
+		return internal::rem_pio2_payne_hanek(x);
+	}
+
+	/**
+	 * @brief Reduce a finite float by multiples of pi/2. The remainder is computed in double, so only hi is used.
+	 * @param x The finite value to reduce.
+	 * @return The quadrant and the remainder in hi. lo is zero for the Cody-Waite path.
+	 */
+	constexpr internal::rem_pio2_result rem_pio2f_gen(float x) noexcept
+	{
+		if (CCM_LIKELY(support::fp::FPBits<float>(x).get_exponent() < internal::rem_pio2f_cody_waite_max_exponent))
+		{
+			const auto xd  = static_cast<double>(x);
+			const double k = (xd * internal::rem_pio2_invpio2 + internal::rem_pio2_toint) - internal::rem_pio2_toint;
+			return {static_cast<int>(k), (xd - k * internal::rem_pio2f_pio2_1) - k * internal::rem_pio2f_pio2_1t, 0.0};
+		}
+		return internal::rem_pio2_payne_hanek(static_cast<double>(x));
+	}
+} // namespace ccm::gen
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/trig/rem_pio2_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/trig_kernels_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <type_traits>
+
+namespace ccm::gen
+{
+	/**
+	 * @brief Generic constexpr sine and cosine of the same angle.
+	 *
+	 * The argument is reduced once and both kernels are evaluated on the result, which costs little more than one of
+	 * sin_gen or cos_gen. The results match those two functions exactly.
+	 * @tparam T The floating-point type. long double is evaluated in double.
+	 * @param x The angle in radians.
+	 * @param sin_out Pointer to store the sine of x.
+	 * @param cos_out Pointer to store the cosine of x.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void sincos_gen(T x, T * sin_out, T * cos_out) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>)
+		{
+			const support::fp::FPBits<float> bits(x);
+			if (CCM_UNLIKELY(bits.is_inf_or_nan()))
+			{
+				*sin_out = x - x;
+				*cos_out = x - x;
+				return;
+			}
+
+			// |x| < pi/4
+			if (bits.uintval() << 1 < 0x3f490fdbU << 1)
+			{
+				// |x| < 2^-12, sin(x) rounds to x and cos(x) rounds to 1.
+				if (bits.get_exponent() < -12)
+				{
+					*sin_out = x;
+					*cos_out = 1.0F;
+					return;
+				}
+				*sin_out = static_cast<float>(internal::sinf_kernel(static_cast<double>(x)));
+				*cos_out = static_cast<float>(internal::cosf_kernel(static_cast<double>(x)));
+				return;
+			}
+
+			const internal::rem_pio2_result reduced = rem_pio2f_gen(x);
+			const auto s							= static_cast<float>(internal::sinf_kernel(reduced.hi));
+			const auto c							= static_cast<float>(internal::cosf_kernel(reduced.hi));
+			switch (reduced.quadrant & 3)
+			{
+			case 0:
+				*sin_out = s;
+				*cos_out = c;
+				break;
+			case 1:
+				*sin_out = c;
+				*cos_out = -s;
+				break;
+			case 2:
+				*sin_out = -s;
+				*cos_out = -c;
+				break;
+			default:
+				*sin_out = -c;
+				*cos_out = s;
+				break;
+			}
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			const support::fp::FPBits<double> bits(x);
+			if (CCM_UNLIKELY(bits.is_inf_or_nan()))
+			{
+				*sin_out = x - x;
+				*cos_out = x - x;
+				return;
+			}
+
+			// |x| <= pi/4
+			if (bits.uintval() << 1 <= 0x3fe921fb54442d18ULL << 1)
+			{
+				// |x| < 2^-27, sin(x) rounds to x and cos(x) rounds to 1.
+				if (bits.get_exponent() < -27)
+				{
+					*sin_out = x;
+					*cos_out = 1.0;
+					return;
+				}
+				*sin_out = internal::sin_kernel(x, 0.0, false);
+				*cos_out = internal::cos_kernel(x, 0.0);
+				return;
+			}
+
+			const internal::rem_pio2_result reduced = rem_pio2_gen(x);
+			const double s							= internal::sin_kernel(reduced.hi, reduced.lo, true);
+			const double c							= internal::cos_kernel(reduced.hi, reduced.lo);
+			switch (reduced.quadrant & 3)
+			{
+			case 0:
+				*sin_out = s;
+				*cos_out = c;
+				break;
+			case 1:
+				*sin_out = c;
+				*cos_out = -s;
+				break;
+			case 2:
+				*sin_out = -s;
+				*cos_out = -c;
+				break;
+			default:
+				*sin_out = -c;
+				*cos_out = s;
+				break;
+			}
+		}
+		else
+		{
+			double s = 0.0;
+			double c = 0.0;
+			sincos_gen<double>(static_cast<double>(x), &s, &c);
+			*sin_out = static_cast<T>(s);
+			*cos_out = static_cast<T>(c);
+		}
+	}
+} // namespace ccm::gen
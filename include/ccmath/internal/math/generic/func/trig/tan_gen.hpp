@@ -10,7 +10,146 @@
 
 #pragma once
 
-namespace ccm
+#include "ccmath/internal/math/generic/func/trig/rem_pio2_gen.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace ccm::gen
 {
+	namespace internal
+	{
+		// Coefficients of tan(x) = x + T[0] x^3 + T[1] x^5 + ... on [-0.67434, 0.67434] from fdlibm.
+		constexpr std::array<double, 13> tan_kernel_coeffs = {
+			3.33333333333334091986e-01, 1.33333333333201242699e-01, 5.39682539762260521377e-02, 2.18694882948595424599e-02, 8.86323982359930005737e-03,
+			3.59207910759131235356e-03, 1.45620945432529025516e-03, 5.88041240820264096874e-04, 2.46463134818469906812e-04, 7.81794442939557092300e-05,
+			7.14072491382608190305e-05, -1.85586374855275456654e-05, 2.59073051863633712884e-05,
+		};
+		constexpr double tan_kernel_pio4	 = 7.85398163397448278999e-01;
+		constexpr double tan_kernel_pio4lo = 3.06161699786838301793e-17;
+
+		// Coefficients of tan(x) for float results evaluated in double, accurate to 2^-34 on [-pi/4, pi/4].
+		constexpr std::array<double, 6> tanf_kernel_coeffs = {
+			0x15554d3418c99f.0p-54, 0x1112fd38999f72.0p-55, 0x1b54c91d865afe.0p-57, 0x191df3908c33ce.0p-58, 0x185dadfcecf44e.0p-61, 0x1362b9bf971bcd.0p-59,
+		};
+
+		/// Clear the low 32 bits of a double, leaving a value whose products with another such value are exact.
+		constexpr double tan_kernel_head(double x) noexcept
+		{
+			support::fp::FPBits<double> bits(x);
+			bits.set_uintval(bits.uintval() & 0xffffffff00000000ULL);
+			return bits.get_val();
+		}
+
+		/**
+		 * @brief tan(x + y) or -1/tan(x + y) for |x + y| <= pi/4, where y is the tail of a reduced argument.
+		 * @param x The head of the argument.
+		 * @param y The tail of the argument.
+		 * @param odd Whether the reduced quadrant is odd, in which case -1/tan(x + y) is returned.
+		 *
+		 * Above 0.6744 the argument is rewritten as pi/4 - x so the polynomial stays accurate.
+		 */
+		constexpr double tan_kernel(double x, double y, bool odd) noexcept
+		{
+			const auto & t = tan_kernel_coeffs;
+			const bool big = support::fp::FPBits<double>(x).uintval() << 1 >= 0x3FE5942800000000ULL << 1;
+			const bool neg = x < 0;
+			if (big)
+			{
+				if (neg)
+				{
+					x = -x;
+					y = -y;
+				}
+				x = (tan_kernel_pio4 - x) + (tan_kernel_pio4lo - y);
+				y = 0.0;
+			}
+
+			double z = x * x;
+			double w = z * z;
+			// Split into odd and even terms so the two halves can be evaluated in parallel.
+			double r	   = t[1] + w * (t[3] + w * (t[5] + w * (t[7] + w * (t[9] + w * t[11]))));
+			double v	   = z * (t[2] + w * (t[4] + w * (t[6] + w * (t[8] + w * (t[10] + w * t[12])))));
+			const double s = z * x;
+			r			   = y + z * (s * (r + v) + y);
+			r += t[0] * s;
+			w = x + r;
+
+			if (big)
+			{
+				v					 = odd ? -1.0 : 1.0;
+				const double result = v - 2.0 * (x - (w * w / (w + v) - r));
+				return neg ? -result : result;
+			}
+			if (!odd) { return w; }
+
+			// -1/(x + r) has to be computed accurately as (x + r) carries more precision than w.
+			z			   = tan_kernel_head(w);
+			v			   = r - (z - x);
+			const double a = -1.0 / w;
+			const double h = tan_kernel_head(a);
+			return h + a * ((1.0 + h * z) + h * v);
+		}
+
+		/// tan(x) or -1/tan(x) for |x| <= pi/4 with enough accuracy to round correctly to float in nearly all cases.
+		constexpr double tanf_kernel(double x, bool odd) noexcept
+		{
+			const auto & t = tanf_kernel_coeffs;
+			const double z = x * x;
+			const double r = t[4] + z * t[5];
+			const double u = t[2] + z * t[3];
+			const double w = z * z;
+			const double s = z * x;
+			const double p = t[0] + z * t[1];
+			const double y = (x + s * p) + (s * w) * (u + w * r);
+			return odd ? -1.0 / y : y;
+		}
+	} // namespace internal
+
+	/**
+	 * @brief Generic constexpr tangent.
+	 * @tparam T The floating-point type. long double is evaluated in double.
+	 * @param x The angle in radians.
+	 * @return The tangent of x. NaN is returned for infinite x.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T tan_gen(T x) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>)
+		{
+			const support::fp::FPBits<float> bits(x);
+			if (CCM_UNLIKELY(bits.is_inf_or_nan())) { return x - x; }
+
+			// |x| < pi/4
+			if (bits.uintval() << 1 < 0x3f490fdbU << 1)
+			{
+				// |x| < 2^-12, tan(x) rounds to x.
+				if (bits.get_exponent() < -12) { return x; }
+				return static_cast<float>(internal::tanf_kernel(static_cast<double>(x), false));
+			}
+
+			const internal::rem_pio2_result reduced = rem_pio2f_gen(x);
+			return static_cast<float>(internal::tanf_kernel(reduced.hi, (reduced.quadrant & 1) != 0));
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			const support::fp::FPBits<double> bits(x);
+			if (CCM_UNLIKELY(bits.is_inf_or_nan())) { return x - x; }
+
+			// |x| <= pi/4
+			if (bits.uintval() << 1 <= 0x3fe921fb54442d18ULL << 1)
+			{
+				// |x| < 2^-27, tan(x) rounds to x.
+				if (bits.get_exponent() < -27) { return x; }
+				return internal::tan_kernel(x, 0.0, false);
+			}
 
-} // namespace ccm
+			const internal::rem_pio2_result reduced = rem_pio2_gen(x);
+			return internal::tan_kernel(reduced.hi, reduced.lo, (reduced.quadrant & 1) != 0);
+		}
+		else { return static_cast<T>(tan_gen<double>(static_cast<double>(x))); }
+	}
+} // namespace ccm::gen
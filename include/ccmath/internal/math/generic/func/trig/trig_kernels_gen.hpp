@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+// Polynomial kernels shared by sin, cos and sincos. Every kernel expects an argument already reduced to [-pi/4, pi/4].
+namespace ccm::gen::internal
+{
+	// Minimax coefficients of sin(x) on [-pi/4, pi/4] from fdlibm.
+	constexpr double sin_kernel_s1 = -1.66666666666666324348e-01;
+	constexpr double sin_kernel_s2 = 8.33333333332248946124e-03;
+	constexpr double sin_kernel_s3 = -1.98412698298579493134e-04;
+	constexpr double sin_kernel_s4 = 2.75573137070700676789e-06;
+	constexpr double sin_kernel_s5 = -2.50507602534068634195e-08;
+	constexpr double sin_kernel_s6 = 1.58969099521155010221e-10;
+
+	// Coefficients of sin(x) for float results evaluated in double, accurate to 2^-58 on [-pi/4, pi/4].
+	constexpr double sinf_kernel_s1 = -0x15555554cbac77.0p-55;
+	constexpr double sinf_kernel_s2 = 0x111110896efbb2.0p-59;
+	constexpr double sinf_kernel_s3 = -0x1a00f9e2cae774.0p-65;
+	constexpr double sinf_kernel_s4 = 0x16cd878c3b46a7.0p-71;
+
+	/**
+	 * @brief sin(x + y) for |x + y| <= pi/4, where y is the tail of a reduced argument.
+	 * @param x The head of the argument.
+	 * @param y The tail of the argument. Ignored when has_tail is false.
+	 * @param has_tail Whether y is known to be non-zero.
+	 */
+	constexpr double sin_kernel(double x, double y, bool has_tail) noexcept
+	{
+		const double z = x * x;
+		const double w = z * z;
+		const double r = sin_kernel_s2 + z * (sin_kernel_s3 + z * sin_kernel_s4) + z * w * (sin_kernel_s5 + z * sin_kernel_s6);
+		const double v = z * x;
+		if (!has_tail) { return x + v * (sin_kernel_s1 + z * r); }
+		return x - ((z * (0.5 * y - v * r) - y) - v * sin_kernel_s1);
+	}
+
+	/// sin(x) for |x| <= pi/4, accurate enough to round correctly to float in nearly all cases.
+	constexpr double sinf_kernel(double x) noexcept
+	{
+		const double z = x * x;
+		const double w = z * z;
+		const double r = sinf_kernel_s3 + z * sinf_kernel_s4;
+		const double s = z * x;
+		return (x + s * (sinf_kernel_s1 + z * sinf_kernel_s2)) + s * w * r;
+	}
+
+	// Minimax coefficients of cos(x) on [-pi/4, pi/4] from fdlibm.
+	constexpr double cos_kernel_c1 = 4.16666666666666019037e-02;
+	constexpr double cos_kernel_c2 = -1.38888888888741095749e-03;
+	constexpr double cos_kernel_c3 = 2.48015872894767294178e-05;
+	constexpr double cos_kernel_c4 = -2.75573143513906633035e-07;
+	constexpr double cos_kernel_c5 = 2.08757232129817482790e-09;
+	constexpr double cos_kernel_c6 = -1.13596475577881948265e-11;
+
+	// Coefficients of cos(x) for float results evaluated in double, accurate to 2^-58 on [-pi/4, pi/4].
+	constexpr double cosf_kernel_c0 = -0x1ffffffd0c5e81.0p-54;
+	constexpr double cosf_kernel_c1 = 0x155553e1053a42.0p-57;
+	constexpr double cosf_kernel_c2 = -0x16c087e80f1e27.0p-62;
+	constexpr double cosf_kernel_c3 = 0x199342e0ee5069.0p-68;
+
+	/**
+	 * @brief cos(x + y) for |x + y| <= pi/4, where y is the tail of a reduced argument.
+	 * @param x The head of the argument.
+	 * @param y The tail of the argument.
+	 */
+	constexpr double cos_kernel(double x, double y) noexcept
+	{
+		const double z	= x * x;
+		const double w	= z * z;
+		const double r	= z * (cos_kernel_c1 + z * (cos_kernel_c2 + z * cos_kernel_c3)) + w * w * (cos_kernel_c4 + z * (cos_kernel_c5 + z * cos_kernel_c6));
+		const double hz = 0.5 * z;
+		const double v	= 1.0 - hz;
+		// 1 - hz is computed with its rounding error so the result stays accurate near the edge of the interval.
+		return v + (((1.0 - v) - hz) + (z * r - x * y));
+	}
+
+	/// cos(x) for |x| <= pi/4, accurate enough to round correctly to float in nearly all cases.
+	constexpr double cosf_kernel(double x) noexcept
+	{
+		const double z = x * x;
+		const double w = z * z;
+		const double r = cosf_kernel_c2 + z * cosf_kernel_c3;
+		return ((1.0 + z * cosf_kernel_c0) + w * cosf_kernel_c1) + (w * z) * r;
+	}
+} // namespace ccm::gen::internal
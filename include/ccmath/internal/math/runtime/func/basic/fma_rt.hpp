@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_arch_support.hpp"
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/config/runtime_detection.hpp"
+#include "ccmath/internal/math/generic/func/basic/fma_gen.hpp"
+#include "ccmath/internal/predef/attributes/target.hpp"
+#include "ccmath/internal/predef/has_builtin.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+// The FMA3 and AVX-512 kernels are compiled with the target attribute and only called after the host has been checked.
+#if defined(CCM_HAS_TARGET_ATTRIBUTE) && defined(CCMATH_TARGET_ARCH_IS_X86_BASED)
+	#define CCM_FMA_HAS_X86_TIERS 1
+	#include <immintrin.h>
+#elif defined(CCMATH_HAS_SIMD_FMA)
+	#include <immintrin.h>
+#endif
+
+#if defined(CCMATH_HAS_SIMD_NEON) && defined(__aarch64__)
+	#define CCM_FMA_HAS_NEON_TIER 1
+	#include <arm_neon.h>
+#endif
+
+namespace ccm::rt
+{
+	namespace simd_impl
+	{
+		/// Signature of a resolved array fma kernel.
+		template <typename T>
+		using fma_batch_fn = void (*)(const T *, const T *, const T *, T *, std::size_t) noexcept;
+
+#ifdef CCM_FMA_HAS_X86_TIERS
+		CCM_TARGET("fma") inline double fma_fma3(double x, double y, double z) noexcept
+		{
+			return _mm_cvtsd_f64(_mm_fmadd_sd(_mm_set_sd(x), _mm_set_sd(y), _mm_set_sd(z)));
+		}
+
+		CCM_TARGET("fma") inline float fma_fma3(float x, float y, float z) noexcept
+		{
+			return _mm_cvtss_f32(_mm_fmadd_ss(_mm_set_ss(x), _mm_set_ss(y), _mm_set_ss(z)));
+		}
+
+		/// True when the scalar FMA3 instruction may be used. Forcing a SIMD level below AVX2 selects the software fallback.
+		inline bool use_fma3() noexcept
+		{
+			static const bool enabled = has_runtime_detection && host_cpu_features().fma && !(active_simd_level() < simd_level::avx2);
+			return enabled;
+		}
+#endif
+
+		template <typename T>
+		void fma_batch_scalar(const T * x, const T * y, const T * z, T * out, std::size_t count) noexcept
+		{
+			for (std::size_t i = 0; i < count; ++i) { out[i] = gen::fma_gen(x[i], y[i], z[i]); }
+		}
+
+#ifdef CCM_FMA_HAS_X86_TIERS
+		template <typename T>
+		CCM_TARGET("avx2,fma") void fma_batch_avx2(const T * x, const T * y, const T * z, T * out, std::size_t count) noexcept
+		{
+			std::size_t i = 0;
+			if constexpr (std::is_same_v<T, double>)
+			{
+				for (; i + 4 <= count; i += 4)
+				{
+					_mm256_storeu_pd(out + i, _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), _mm256_loadu_pd(z + i)));
+				}
+				for (; i < count; ++i) { out[i] = _mm_cvtsd_f64(_mm_fmadd_sd(_mm_set_sd(x[i]), _mm_set_sd(y[i]), _mm_set_sd(z[i]))); }
+			}
+			else
+			{
+				for (; i + 8 <= count; i += 8)
+				{
+					_mm256_storeu_ps(out + i, _mm256_fmadd_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), _mm256_loadu_ps(z + i)));
+				}
+				for (; i < count; ++i) { out[i] = _mm_cvtss_f32(_mm_fmadd_ss(_mm_set_ss(x[i]), _mm_set_ss(y[i]), _mm_set_ss(z[i]))); }
+			}
+		}
+
+		template <typename T>
+		CCM_TARGET("avx512f") void fma_batch_avx512(const T * x, const T * y, const T * z, T * out, std::size_t count) noexcept
+		{
+			std::size_t i = 0;
+			if constexpr (std::is_same_v<T, double>)
+			{
+				for (; i + 8 <= count; i += 8)
+				{
+					_mm512_storeu_pd(out + i, _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i), _mm512_loadu_pd(z + i)));
+				}
+				if (i < count)
+				{
+					// The tail is handled with masked loads and stores instead of a scalar loop.
+					const auto mask = static_cast<__mmask8>((1U << (count - i)) - 1U);
+					_mm512_mask_storeu_pd(out + i, mask,
+										  _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, x + i), _mm512_maskz_loadu_pd(mask, y + i), _mm512_maskz_loadu_pd(mask, z + i)));
+				}
+			}
+			else
+			{
+				for (; i + 16 <= count; i += 16)
+				{
+					_mm512_storeu_ps(out + i, _mm512_fmadd_ps(_mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i), _mm512_loadu_ps(z + i)));
+				}
+				if (i < count)
+				{
+					const auto mask = static_cast<__mmask16>((1U << (count - i)) - 1U);
+					_mm512_mask_storeu_ps(out + i, mask,
+										  _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, x + i), _mm512_maskz_loadu_ps(mask, y + i), _mm512_maskz_loadu_ps(mask, z + i)));
+				}
+			}
+		}
+#endif
+
+#ifdef CCM_FMA_HAS_NEON_TIER
+		template <typename T>
+		void fma_batch_neon(const T * x, const T * y, const T * z, T * out, std::size_t count) noexcept
+		{
+			std::size_t i = 0;
+			if constexpr (std::is_same_v<T, double>)
+			{
+				for (; i + 2 <= count; i += 2) { vst1q_f64(out + i, vfmaq_f64(vld1q_f64(z + i), vld1q_f64(x + i), vld1q_f64(y + i))); }
+				for (; i < count; ++i) { out[i] = vget_lane_f64(vfma_f64(vdup_n_f64(z[i]), vdup_n_f64(x[i]), vdup_n_f64(y[i])), 0); }
+			}
+			else
+			{
+				for (; i + 4 <= count; i += 4) { vst1q_f32(out + i, vfmaq_f32(vld1q_f32(z + i), vld1q_f32(x + i), vld1q_f32(y + i))); }
+				for (; i < count; ++i) { out[i] = vget_lane_f32(vfma_f32(vdup_n_f32(z[i]), vdup_n_f32(x[i]), vdup_n_f32(y[i])), 0); }
+			}
+		}
+#endif
+
+		/**
+		 * @brief Get the array fma kernel for exactly the given SIMD level.
+		 * @return The kernel, or nullptr if this binary has no fma kernel for that level.
+		 * @note The returned kernel may use instructions the host does not support. Check supports_simd_level before calling it.
+		 */
+		template <typename T>
+		fma_batch_fn<T> fma_batch_kernel_for(simd_level level) noexcept
+		{
+			if (level == simd_level::scalar) { return &fma_batch_scalar<T>; }
+#ifdef CCM_FMA_HAS_X86_TIERS
+			if (level == simd_level::avx2) { return &fma_batch_avx2<T>; }
+			if (level == simd_level::avx512) { return &fma_batch_avx512<T>; }
+#endif
+#ifdef CCM_FMA_HAS_NEON_TIER
+			if (level == simd_level::neon) { return &fma_batch_neon<T>; }
+#endif
+			return nullptr;
+		}
+
+		/**
+		 * @brief Resolve the fastest array fma kernel for the host. The choice is made once per process.
+		 *
+		 * Follows the same rules as resolve_batch_kernel. Hosts without a fused instruction use the exact software fma.
+		 */
+		template <typename T>
+		fma_batch_fn<T> resolve_fma_batch_kernel() noexcept
+		{
+			static const fma_batch_fn<T> kernel = []() noexcept
+			{
+				if constexpr (!has_runtime_detection)
+				{
+#ifdef CCM_FMA_HAS_NEON_TIER
+					return fma_batch_kernel_for<T>(simd_level::neon);
+#else
+					return fma_batch_kernel_for<T>(simd_level::scalar);
+#endif
+				}
+				else
+				{
+					constexpr simd_level candidates[] = {simd_level::avx512, simd_level::avx2, simd_level::neon};
+					const simd_level active			  = active_simd_level();
+					for (const auto level : candidates)
+					{
+						const fma_batch_fn<T> candidate = fma_batch_kernel_for<T>(level);
+						if (candidate != nullptr && !(active < level) && supports_simd_level(host_cpu_features(), level)) { return candidate; }
+					}
+					return fma_batch_kernel_for<T>(simd_level::scalar);
+				}
+			}();
+			return kernel;
+		}
+	} // namespace simd_impl
+
+	/**
+	 * @brief Runtime fused multiply-add.
+	 *
+	 * Uses vfmadd when the translation unit targets FMA3 and vfma on AArch64. Other x86 builds check the host once and call a
+	 * function compiled for FMA3 when available. Everything else uses the exact software fma.
+	 * @tparam T The floating-point type.
+	 * @param x The first factor.
+	 * @param y The second factor.
+	 * @param z The addend.
+	 * @return x * y + z rounded once.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	T fma_rt(T x, T y, T z) noexcept
+	{
+		if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>)
+		{
+#if defined(CCMATH_HAS_SIMD_FMA)
+			if constexpr (std::is_same_v<T, double>) { return _mm_cvtsd_f64(_mm_fmadd_sd(_mm_set_sd(x), _mm_set_sd(y), _mm_set_sd(z))); }
+			else { return _mm_cvtss_f32(_mm_fmadd_ss(_mm_set_ss(x), _mm_set_ss(y), _mm_set_ss(z))); }
+#elif defined(CCM_FMA_HAS_NEON_TIER)
+			if constexpr (std::is_same_v<T, double>) { return vget_lane_f64(vfma_f64(vdup_n_f64(z), vdup_n_f64(x), vdup_n_f64(y)), 0); }
+			else { return vget_lane_f32(vfma_f32(vdup_n_f32(z), vdup_n_f32(x), vdup_n_f32(y)), 0); }
+#elif defined(CCM_FMA_HAS_X86_TIERS)
+			if (simd_impl::use_fma3()) { return simd_impl::fma_fma3(x, y, z); }
+			return gen::fma_gen<T>(x, y, z);
+#else
+			return gen::fma_gen<T>(x, y, z);
+#endif
+		}
+		else
+		{
+#if CCM_HAS_BUILTIN(__builtin_fmal)
+			return __builtin_fmal(x, y, z);
+#else
+			return gen::fma_gen<T>(x, y, z);
+#endif
+		}
+	}
+} // namespace ccm::rt
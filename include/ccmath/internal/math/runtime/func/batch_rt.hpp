@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/internal/predef/attributes/always_inline.hpp"
+#include "ccmath/internal/support/bits.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace ccm::rt::simd_impl
+{
+	/// Number of elements a batch kernel processes per block. Must be a multiple of every SIMD width for double.
+	constexpr std::size_t batch_block_size = 64;
+
+	/// Scratch storage for one block of lanes. Aligned so that every vector of a block can use aligned moves.
+	struct alignas(64) batch_block : std::array<double, batch_block_size>
+	{
+	};
+
+	template <class Abi>
+	CCM_ALWAYS_INLINE intrin::simd<double, Abi> batch_load(const double * ptr) noexcept
+	{
+		return intrin::simd<double, Abi>(ptr, intrin::vector_aligned_tag());
+	}
+
+	template <class Abi>
+	CCM_ALWAYS_INLINE void batch_store(intrin::simd<double, Abi> const & value, double * ptr) noexcept
+	{
+		value.copy_to(ptr, intrin::vector_aligned_tag());
+	}
+
+	/// Store a mask as 1.0 (lane handled by the vector path) or 0.0 (lane needs the scalar kernel).
+	template <class Abi>
+	CCM_ALWAYS_INLINE void batch_store(intrin::simd_mask<double, Abi> const & mask, double * ptr) noexcept
+	{
+		intrin::choose(mask, intrin::simd<double, Abi>(1.0), intrin::simd<double, Abi>(0.0)).copy_to(ptr, intrin::vector_aligned_tag());
+	}
+
+	/// True for the pack ABIs, which only the target attribute tiers instantiate.
+	template <class Abi>
+	struct batch_is_pack_abi : std::false_type
+	{
+	};
+
+	template <int N>
+	struct batch_is_pack_abi<intrin::abi::pack<N>> : std::true_type
+	{
+	};
+
+	/// True for the ABIs with a gather instruction. The others gather one lane at a time.
+	template <class Abi>
+	struct batch_has_gather : std::false_type
+	{
+	};
+
+#ifdef CCMATH_HAS_SIMD_AVX2
+	template <>
+	struct batch_has_gather<intrin::abi::avx2> : std::true_type
+	{
+	};
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX512F
+	template <>
+	struct batch_has_gather<intrin::abi::avx512> : std::true_type
+	{
+	};
+#endif
+
+#ifdef CCMATH_HAS_SIMD_SVE
+	template <>
+	struct batch_has_gather<intrin::abi::sve> : std::true_type
+	{
+	};
+#endif
+
+	/**
+	 * @brief hi + lo = a * b exactly. Uses the fused multiply-subtract where the target has one and Dekker's product otherwise.
+	 * @note A fused multiply-add contracted into the split form breaks it. The target attribute tiers all have FMA and run on
+	 * the pack ABIs, so those take std::fma per lane, which the tier lowers to its FMA instruction.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void batch_exact_mult(intrin::simd<double, Abi> const & a, intrin::simd<double, Abi> const & b, intrin::simd<double, Abi> & hi,
+											intrin::simd<double, Abi> & lo) noexcept
+	{
+		hi = a * b;
+#if defined(CCMATH_HAS_SIMD_FMA) || defined(CCMATH_HAS_SIMD_NEON) || defined(CCMATH_HAS_SIMD_SVE)
+		lo = intrin::fms(a, b, hi);
+#else
+		if constexpr (batch_is_pack_abi<Abi>::value)
+		{
+			for (int i = 0; i < lo.size(); ++i) { lo[i] = std::fma(a[i], b[i], -hi[i]); }
+		}
+		else
+		{
+			using simd_t = intrin::simd<double, Abi>;
+			const simd_t splitter(134217729.0); // 2^27 + 1
+			const simd_t a_scaled = splitter * a;
+			const simd_t a_hi	  = a_scaled - (a_scaled - a);
+			const simd_t a_lo	  = a - a_hi;
+			const simd_t b_scaled = splitter * b;
+			const simd_t b_hi	  = b_scaled - (b_scaled - b);
+			const simd_t b_lo	  = b - b_hi;
+			lo					  = ((a_hi * b_hi - hi) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+		}
+#endif
+	}
+
+	/**
+	 * @brief 2^(k/N) = scale * (1 + tail) for N = 2^TableBits over a block, from a table laid out as exp_data<double>::tab.
+	 * @param shifted The reduced arguments plus the rounding shift, whose low mantissa bits hold k. Indices are masked to
+	 * the table, so lanes whose result is discarded may hold anything.
+	 *
+	 * ABIs with a gather instruction compute the indices in integer lanes and gather. The others take a scalar pass over
+	 * the block, which is faster than assembling every vector from single lane loads.
+	 */
+	template <class Abi, int TableBits>
+	CCM_ALWAYS_INLINE void batch_exp_table(const double * shifted, const std::uint64_t * tab, double * tail, double * scale, std::size_t n) noexcept
+	{
+		constexpr std::uint64_t mask = (std::uint64_t{1} << TableBits) - 1;
+		if constexpr (batch_has_gather<Abi>::value)
+		{
+			using simd_t		 = intrin::simd<double, Abi>;
+			using bits_t		 = intrin::simd<std::uint64_t, Abi>;
+			constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+			for (std::size_t i = 0; i < n; i += width)
+			{
+				const bits_t k	   = intrin::bit_cast<bits_t>(batch_load<Abi>(shifted + i));
+				const bits_t index = (k & bits_t(mask)) << 1;
+				batch_store<Abi>(intrin::bit_cast<simd_t>(intrin::gather(tab, index)), tail + i);
+				batch_store<Abi>(intrin::bit_cast<simd_t>(intrin::gather(tab, index + bits_t(1)) + (k << (52 - TableBits))), scale + i);
+			}
+		}
+		else
+		{
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				const std::uint64_t k	  = support::double_to_uint64(shifted[i]);
+				const std::uint64_t index = (k & mask) << 1;
+				tail[i]					  = support::uint64_to_double(tab[index]);
+				scale[i]				  = support::uint64_to_double(tab[index + 1] + (k << (52 - TableBits)));
+			}
+		}
+	}
+
+	/// 2^(k/N) for N = 2^TableBits over a block, from a table of scales alone such as the one of exp_data<float>. See batch_exp_table.
+	template <class Abi, int TableBits>
+	CCM_ALWAYS_INLINE void batch_exp_scale(const double * shifted, const std::uint64_t * tab, double * scale, std::size_t n) noexcept
+	{
+		constexpr std::uint64_t mask = (std::uint64_t{1} << TableBits) - 1;
+		if constexpr (batch_has_gather<Abi>::value)
+		{
+			using simd_t		 = intrin::simd<double, Abi>;
+			using bits_t		 = intrin::simd<std::uint64_t, Abi>;
+			constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+			for (std::size_t i = 0; i < n; i += width)
+			{
+				const bits_t k = intrin::bit_cast<bits_t>(batch_load<Abi>(shifted + i));
+				batch_store<Abi>(intrin::bit_cast<simd_t>(intrin::gather(tab, k & bits_t(mask)) + (k << (52 - TableBits))), scale + i);
+			}
+		}
+		else
+		{
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				const std::uint64_t k = support::double_to_uint64(shifted[i]);
+				scale[i]			  = support::uint64_to_double(tab[k & mask] + (k << (52 - TableBits)));
+			}
+		}
+	}
+
+	/// Pad a block of n elements to whole vectors by repeating its last element. Returns the padded length.
+	template <class Abi>
+	CCM_ALWAYS_INLINE std::size_t batch_pad(batch_block & x, std::size_t n) noexcept
+	{
+		constexpr auto width	 = static_cast<std::size_t>(intrin::simd<double, Abi>::size());
+		const std::size_t padded = (n + width - 1) / width * width;
+		for (std::size_t j = n; j < padded; ++j) { x[j] = x[n - 1]; }
+		return padded;
+	}
+
+	/**
+	 * @brief Apply a block kernel over a contiguous array.
+	 * @tparam Abi The SIMD ABI the kernel is instantiated for.
+	 * @tparam Kernel Type providing the kernels as static members:
+	 * - block<Abi, T>(const double * x, double * y, double * valid, std::size_t n) where n is a multiple of the SIMD width
+	 * no larger than batch_block_size and all pointers are batch_block storage. It writes n results to y and sets valid[i]
+	 * to 0.0 for every lane the vector path could not handle.
+	 * - scalar(T x) used for every lane the block kernel marks as invalid.
+	 * @tparam T The element type of the arrays. Float inputs are widened to double lanes to match the scalar float kernels.
+	 * @param in Pointer to the input array.
+	 * @param out Pointer to the output array. May alias in.
+	 * @param count Number of elements to process.
+	 *
+	 * The last block is padded to whole vectors, so a tail shorter than the SIMD width costs one vector iteration
+	 * instead of a scalar call per element.
+	 */
+	template <class Abi, class Kernel, typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	CCM_ALWAYS_INLINE void batch_apply(const T * in, T * out, std::size_t count) noexcept
+	{
+		constexpr auto width = static_cast<std::size_t>(intrin::simd<double, Abi>::size());
+		static_assert(batch_block_size % width == 0, "The batch block size must be a multiple of the SIMD width.");
+
+		batch_block x{};
+		batch_block y{};
+		batch_block valid{};
+
+		std::size_t i = 0;
+		while (i < count)
+		{
+			const std::size_t n = (count - i) < batch_block_size ? (count - i) : batch_block_size;
+			for (std::size_t j = 0; j < n; ++j) { x[j] = static_cast<double>(in[i + j]); }
+
+			Kernel::template block<Abi, T>(x.data(), y.data(), valid.data(), batch_pad<Abi>(x, n));
+
+			for (std::size_t j = 0; j < n; ++j) { out[i + j] = valid[j] != 0.0 ? static_cast<T>(y[j]) : Kernel::scalar(in[i + j]); }
+			i += n;
+		}
+	}
+
+	/**
+	 * @brief Apply a block kernel with two outputs over a contiguous array.
+	 * @tparam Abi The SIMD ABI the kernel is instantiated for.
+	 * @tparam Kernel Type providing the kernels as static members:
+	 * - block<Abi, T>(const double * x, double * y0, double * y1, double * valid, std::size_t n) with the same contract as for batch_apply.
+	 * - scalar(T x, T * y0, T * y1) used for every lane the block kernel marks as invalid.
+	 * @tparam T The element type of the arrays.
+	 * @param in Pointer to the input array.
+	 * @param out0 Pointer to the first output array. May alias in.
+	 * @param out1 Pointer to the second output array. May alias in.
+	 * @param count Number of elements to process.
+	 */
+	template <class Abi, class Kernel, typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	CCM_ALWAYS_INLINE void batch_apply_pair(const T * in, T * out0, T * out1, std::size_t count) noexcept
+	{
+		constexpr auto width = static_cast<std::size_t>(intrin::simd<double, Abi>::size());
+		static_assert(batch_block_size % width == 0, "The batch block size must be a multiple of the SIMD width.");
+
+		batch_block x{};
+		batch_block y0{};
+		batch_block y1{};
+		batch_block valid{};
+
+		std::size_t i = 0;
+		while (i < count)
+		{
+			const std::size_t n = (count - i) < batch_block_size ? (count - i) : batch_block_size;
+			for (std::size_t j = 0; j < n; ++j) { x[j] = static_cast<double>(in[i + j]); }
+
+			Kernel::template block<Abi, T>(x.data(), y0.data(), y1.data(), valid.data(), batch_pad<Abi>(x, n));
+
+			for (std::size_t j = 0; j < n; ++j)
+			{
+				if (valid[j] != 0.0)
+				{
+					out0[i + j] = static_cast<T>(y0[j]);
+					out1[i + j] = static_cast<T>(y1[j]);
+				}
+				else
+				{
+					T r0{};
+					T r1{};
+					Kernel::scalar(in[i + j], &r0, &r1);
+					out0[i + j] = r0;
+					out1[i + j] = r1;
+				}
+			}
+			i += n;
+		}
+	}
+
+	/**
+	 * @brief Apply a block kernel with two inputs over a pair of contiguous arrays.
+	 * @tparam Abi The SIMD ABI the kernel is instantiated for.
+	 * @tparam Kernel Type providing the kernels as static members:
+	 * - block<Abi, T>(const double * x0, const double * x1, double * y, double * valid, std::size_t n) with the same contract as for batch_apply.
+	 * - scalar(T x0, T x1) used for every lane the block kernel marks as invalid.
+	 * @tparam T The element type of the arrays.
+	 * @param in0 Pointer to the first input array.
+	 * @param in1 Pointer to the second input array.
+	 * @param out Pointer to the output array. May alias in0 or in1.
+	 * @param count Number of elements to process.
+	 */
+	template <class Abi, class Kernel, typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	CCM_ALWAYS_INLINE void batch_apply_binary(const T * in0, const T * in1, T * out, std::size_t count) noexcept
+	{
+		constexpr auto width = static_cast<std::size_t>(intrin::simd<double, Abi>::size());
+		static_assert(batch_block_size % width == 0, "The batch block size must be a multiple of the SIMD width.");
+
+		batch_block x0{};
+		batch_block x1{};
+		batch_block y{};
+		batch_block valid{};
+
+		std::size_t i = 0;
+		while (i < count)
+		{
+			const std::size_t n = (count - i) < batch_block_size ? (count - i) : batch_block_size;
+			for (std::size_t j = 0; j < n; ++j)
+			{
+				x0[j] = static_cast<double>(in0[i + j]);
+				x1[j] = static_cast<double>(in1[i + j]);
+			}
+			batch_pad<Abi>(x1, n);
+
+			Kernel::template block<Abi, T>(x0.data(), x1.data(), y.data(), valid.data(), batch_pad<Abi>(x0, n));
+
+			for (std::size_t j = 0; j < n; ++j) { out[i + j] = valid[j] != 0.0 ? static_cast<T>(y[j]) : Kernel::scalar(in0[i + j], in1[i + j]); }
+			i += n;
+		}
+	}
+
+	/**
+	 * @brief Apply a block kernel with two inputs and two outputs over contiguous arrays.
+	 * @tparam Abi The SIMD ABI the kernel is instantiated for.
+	 * @tparam Kernel Type providing the kernels as static members:
+	 * - block<Abi, T>(const double * x0, const double * x1, double * y0, double * y1, double * valid, std::size_t n) with the same contract as for
+	 * batch_apply.
+	 * - scalar(T x0, T x1, T * y0, T * y1) used for every lane the block kernel marks as invalid.
+	 * @tparam T The element type of the arrays.
+	 * @param in0 Pointer to the first input array.
+	 * @param in1 Pointer to the second input array.
+	 * @param out0 Pointer to the first output array. May alias in0 or in1.
+	 * @param out1 Pointer to the second output array. May alias in0 or in1.
+	 * @param count Number of elements to process.
+	 */
+	template <class Abi, class Kernel, typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	CCM_ALWAYS_INLINE void batch_apply_binary_pair(const T * in0, const T * in1, T * out0, T * out1, std::size_t count) noexcept
+	{
+		constexpr auto width = static_cast<std::size_t>(intrin::simd<double, Abi>::size());
+		static_assert(batch_block_size % width == 0, "The batch block size must be a multiple of the SIMD width.");
+
+		batch_block x0{};
+		batch_block x1{};
+		batch_block y0{};
+		batch_block y1{};
+		batch_block valid{};
+
+		std::size_t i = 0;
+		while (i < count)
+		{
+			const std::size_t n = (count - i) < batch_block_size ? (count - i) : batch_block_size;
+			for (std::size_t j = 0; j < n; ++j)
+			{
+				x0[j] = static_cast<double>(in0[i + j]);
+				x1[j] = static_cast<double>(in1[i + j]);
+			}
+			batch_pad<Abi>(x1, n);
+
+			Kernel::template block<Abi, T>(x0.data(), x1.data(), y0.data(), y1.data(), valid.data(), batch_pad<Abi>(x0, n));
+
+			for (std::size_t j = 0; j < n; ++j)
+			{
+				if (valid[j] != 0.0)
+				{
+					out0[i + j] = static_cast<T>(y0[j]);
+					out1[i + j] = static_cast<T>(y1[j]);
+				}
+				else
+				{
+					T r0{};
+					T r1{};
+					Kernel::scalar(in0[i + j], in1[i + j], &r0, &r1);
+					out0[i + j] = r0;
+					out1[i + j] = r1;
+				}
+			}
+			i += n;
+		}
+	}
+} // namespace ccm::rt::simd_impl
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_arch_support.hpp"
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/config/runtime_detection.hpp"
+#include "ccmath/internal/math/runtime/func/batch_rt.hpp"
+#include "ccmath/internal/predef/attributes/target.hpp"
+
+#include <cstddef>
+
+// Extra tiers compiled with the target attribute for hosts that are more capable than the compile time target.
+// The intrinsic based ABIs can only be used by functions compiled for them, so the tiers are built on pack<N>, which GCC and Clang
+// lower to full width vectors: pack<4> fills a ymm register for the AVX2 tier and pack<8> a zmm register for the AVX-512 tier.
+// Float inputs are widened to double lanes by batch_apply, so the same widths serve both element types.
+#if defined(CCM_HAS_TARGET_ATTRIBUTE) && defined(CCMATH_TARGET_ARCH_IS_X86_BASED)
+	#if !defined(CCMATH_HAS_SIMD_AVX2)
+		#define CCM_DISPATCH_HAS_AVX2_TIER 1
+	#endif
+	#if !defined(CCMATH_HAS_SIMD_AVX512F)
+		#define CCM_DISPATCH_HAS_AVX512_TIER 1
+	#endif
+#endif
+
+namespace ccm::rt::simd_impl
+{
+	/// Signature of a resolved batch kernel.
+	template <typename T>
+	using batch_fn = void (*)(const T *, T *, std::size_t) noexcept;
+
+	/// Signature of a resolved batch kernel with two outputs.
+	template <typename T>
+	using batch_pair_fn = void (*)(const T *, T *, T *, std::size_t) noexcept;
+
+	/// Signature of a resolved batch kernel with two inputs.
+	template <typename T>
+	using batch_binary_fn = void (*)(const T *, const T *, T *, std::size_t) noexcept;
+
+	/// Signature of a resolved batch kernel with two inputs and two outputs.
+	template <typename T>
+	using batch_binary_pair_fn = void (*)(const T *, const T *, T *, T *, std::size_t) noexcept;
+
+	/// The SIMD level the translation unit was compiled for, which is the level of intrin::abi::native.
+	constexpr simd_level compiled_simd_level() noexcept
+	{
+#if defined(CCMATH_HAS_SIMD_AVX512F)
+		return simd_level::avx512;
+#elif defined(CCMATH_HAS_SIMD_AVX2)
+		return simd_level::avx2;
+#elif defined(CCMATH_HAS_SIMD_AVX)
+		return simd_level::avx;
+#elif defined(CCMATH_HAS_SIMD_SSE4)
+		return simd_level::sse4;
+#elif defined(CCMATH_HAS_SIMD_SSE2)
+		return simd_level::sse2;
+#elif defined(CCMATH_HAS_SIMD_SVE)
+		return simd_level::sve;
+#elif defined(CCMATH_HAS_SIMD_NEON)
+		return simd_level::neon;
+#else
+		return simd_level::scalar;
+#endif
+	}
+
+	template <class Kernel, typename T>
+	CCM_ALWAYS_INLINE void batch_scalar_loop(const T * in, T * out, std::size_t count) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i) { out[i] = Kernel::scalar(in[i]); }
+	}
+
+	template <class Kernel, typename T>
+	CCM_ALWAYS_INLINE void batch_native_loop(const T * in, T * out, std::size_t count) noexcept
+	{
+#ifdef CCMATH_HAS_SIMD
+		batch_apply<intrin::abi::native, Kernel>(in, out, count);
+#else
+		// Without hardware SIMD the emulated pack ABI is slower than calling the scalar kernel directly.
+		batch_scalar_loop<Kernel>(in, out, count);
+#endif
+	}
+
+	template <class Kernel, typename T>
+	void batch_scalar(const T * in, T * out, std::size_t count) noexcept
+	{
+		batch_scalar_loop<Kernel>(in, out, count);
+	}
+
+	template <class Kernel, typename T>
+	void batch_native(const T * in, T * out, std::size_t count) noexcept
+	{
+		batch_native_loop<Kernel>(in, out, count);
+	}
+
+#ifdef CCM_DISPATCH_HAS_AVX2_TIER
+	template <class Kernel, typename T>
+	CCM_TARGET("avx2,fma") void batch_avx2(const T * in, T * out, std::size_t count) noexcept
+	{
+		batch_apply<intrin::abi::pack<4>, Kernel>(in, out, count);
+	}
+#endif
+
+#ifdef CCM_DISPATCH_HAS_AVX512_TIER
+	template <class Kernel, typename T>
+	CCM_TARGET("avx512f,avx512dq,avx512vl,avx512bw,avx2,fma") void batch_avx512(const T * in, T * out, std::size_t count) noexcept
+	{
+		batch_apply<intrin::abi::pack<8>, Kernel>(in, out, count);
+	}
+#endif
+
+	template <class Kernel, typename T>
+	CCM_ALWAYS_INLINE void batch_pair_scalar_loop(const T * in, T * out0, T * out1, std::size_t count) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i) { Kernel::scalar(in[i], out0 + i, out1 + i); }
+	}
+
+	template <class Kernel, typename T>
+	CCM_ALWAYS_INLINE void batch_pair_native_loop(const T * in, T * out0, T * out1, std::size_t count) noexcept
+	{
+#ifdef CCMATH_HAS_SIMD
+		batch_apply_pair<intrin::abi::native, Kernel>(in, out0, out1, count);
+#else
+		batch_pair_scalar_loop<Kernel>(in, out0, out1, count);
+#endif
+	}
+
+	template <class Kernel, typename T>
+	void batch_pair_scalar(const T * in, T * out0, T * out1, std::size_t count) noexcept
+	{
+		batch_pair_scalar_loop<Kernel>(in, out0, out1, count);
+	}
+
+	template <class Kernel, typename T>
+	void batch_pair_native(const T * in, T * out0, T * out1, std::size_t count) noexcept
+	{
+		batch_pair_native_loop<Kernel>(in, out0, out1, count);
+	}
+
+#ifdef CCM_DISPATCH_HAS_AVX2_TIER
+	template <class Kernel, typename T>
+	CCM_TARGET("avx2,fma") void batch_pair_avx2(const T * in, T * out0, T * out1, std::size_t count) noexcept
+	{
+		batch_apply_pair<intrin::abi::pack<4>, Kernel>(in, out0, out1, count);
+	}
+#endif
+
+#ifdef CCM_DISPATCH_HAS_AVX512_TIER
+	template <class Kernel, typename T>
+	CCM_TARGET("avx512f,avx512dq,avx512vl,avx512bw,avx2,fma") void batch_pair_avx512(const T * in, T * out0, T * out1, std::size_t count) noexcept
+	{
+		batch_apply_pair<intrin::abi::pack<8>, Kernel>(in, out0, out1, count);
+	}
+#endif
+
+	template <class Kernel, typename T>
+	void batch_binary_scalar(const T * in0, const T * in1, T * out, std::size_t count) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i) { out[i] = Kernel::scalar(in0[i], in1[i]); }
+	}
+
+	template <class Kernel, typename T>
+	void batch_binary_native(const T * in0, const T * in1, T * out, std::size_t count) noexcept
+	{
+#ifdef CCMATH_HAS_SIMD
+		batch_apply_binary<intrin::abi::native, Kernel>(in0, in1, out, count);
+#else
+		batch_binary_scalar<Kernel>(in0, in1, out, count);
+#endif
+	}
+
+	template <class Kernel, typename T>
+	void batch_binary_pair_scalar(const T * in0, const T * in1, T * out0, T * out1, std::size_t count) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i) { Kernel::scalar(in0[i], in1[i], out0 + i, out1 + i); }
+	}
+
+	template <class Kernel, typename T>
+	void batch_binary_pair_native(const T * in0, const T * in1, T * out0, T * out1, std::size_t count) noexcept
+	{
+#ifdef CCMATH_HAS_SIMD
+		batch_apply_binary_pair<intrin::abi::native, Kernel>(in0, in1, out0, out1, count);
+#else
+		batch_binary_pair_scalar<Kernel>(in0, in1, out0, out1, count);
+#endif
+	}
+
+	/**
+	 * @brief Get the batch kernel compiled for exactly the given SIMD level.
+	 * @return The kernel, or nullptr if this binary has no kernel for that level.
+	 * @note The returned kernel may use instructions the host does not support. Check supports_simd_level before calling it.
+	 */
+	template <class Kernel, typename T>
+	batch_fn<T> batch_kernel_for(simd_level level) noexcept
+	{
+		if (level == simd_level::scalar) { return &batch_scalar<Kernel, T>; }
+		if (level == compiled_simd_level()) { return &batch_native<Kernel, T>; }
+#ifdef CCM_DISPATCH_HAS_AVX2_TIER
+		if (level == simd_level::avx2) { return &batch_avx2<Kernel, T>; }
+#endif
+#ifdef CCM_DISPATCH_HAS_AVX512_TIER
+		if (level == simd_level::avx512) { return &batch_avx512<Kernel, T>; }
+#endif
+		return nullptr;
+	}
+
+	/**
+	 * @brief Get the batch kernel with two outputs compiled for exactly the given SIMD level.
+	 * @return The kernel, or nullptr if this binary has no kernel for that level.
+	 * @note The returned kernel may use instructions the host does not support. Check supports_simd_level before calling it.
+	 */
+	template <class Kernel, typename T>
+	batch_pair_fn<T> batch_pair_kernel_for(simd_level level) noexcept
+	{
+		if (level == simd_level::scalar) { return &batch_pair_scalar<Kernel, T>; }
+		if (level == compiled_simd_level()) { return &batch_pair_native<Kernel, T>; }
+#ifdef CCM_DISPATCH_HAS_AVX2_TIER
+		if (level == simd_level::avx2) { return &batch_pair_avx2<Kernel, T>; }
+#endif
+#ifdef CCM_DISPATCH_HAS_AVX512_TIER
+		if (level == simd_level::avx512) { return &batch_pair_avx512<Kernel, T>; }
+#endif
+		return nullptr;
+	}
+
+	/**
+	 * @brief Get the batch kernel with two inputs compiled for exactly the given SIMD level.
+	 * @return The kernel, or nullptr if this binary has no kernel for that level.
+	 * @note The kernels with two inputs rely on batch_exact_mult, which must not be contracted, so like pow they have no
+	 * target attribute tiers above the compile time target.
+	 */
+	template <class Kernel, typename T>
+	batch_binary_fn<T> batch_binary_kernel_for(simd_level level) noexcept
+	{
+		if (level == simd_level::scalar) { return &batch_binary_scalar<Kernel, T>; }
+		if (level == compiled_simd_level()) { return &batch_binary_native<Kernel, T>; }
+		return nullptr;
+	}
+
+	/**
+	 * @brief Get the batch kernel with two inputs and two outputs compiled for exactly the given SIMD level.
+	 * @return The kernel, or nullptr if this binary has no kernel for that level.
+	 * @note See batch_binary_kernel_for for why there are no target attribute tiers.
+	 */
+	template <class Kernel, typename T>
+	batch_binary_pair_fn<T> batch_binary_pair_kernel_for(simd_level level) noexcept
+	{
+		if (level == simd_level::scalar) { return &batch_binary_pair_scalar<Kernel, T>; }
+		if (level == compiled_simd_level()) { return &batch_binary_pair_native<Kernel, T>; }
+		return nullptr;
+	}
+
+	/**
+	 * @brief Pick the fastest kernel for the host from a kernel_for lookup.
+	 *
+	 * Tiers are tried from the most to the least capable and the first one the host supports that does not exceed
+	 * active_simd_level() is used. Forcing a level below the compile time target falls back to the scalar kernel.
+	 */
+	template <typename Fn>
+	Fn select_batch_kernel(Fn (*kernel_for)(simd_level) noexcept) noexcept
+	{
+		// Without a detection routine only the compile time target is known to be safe.
+		if constexpr (!has_runtime_detection) { return kernel_for(compiled_simd_level()); }
+		else
+		{
+			constexpr simd_level candidates[] = {simd_level::avx512, simd_level::avx2, compiled_simd_level()};
+			const simd_level active			  = active_simd_level();
+			for (const auto level : candidates)
+			{
+				const Fn candidate = kernel_for(level);
+				if (candidate != nullptr && !(active < level) && supports_simd_level(host_cpu_features(), level)) { return candidate; }
+			}
+			return kernel_for(simd_level::scalar);
+		}
+	}
+
+	/// Resolve the fastest batch kernel for the host. The choice is made once per process and kernel, see select_batch_kernel.
+	template <class Kernel, typename T>
+	batch_fn<T> resolve_batch_kernel() noexcept
+	{
+		static const batch_fn<T> kernel = select_batch_kernel(&batch_kernel_for<Kernel, T>);
+		return kernel;
+	}
+
+	/// Resolve the fastest batch kernel with two outputs for the host. The choice is made once per process and kernel.
+	template <class Kernel, typename T>
+	batch_pair_fn<T> resolve_batch_pair_kernel() noexcept
+	{
+		static const batch_pair_fn<T> kernel = select_batch_kernel(&batch_pair_kernel_for<Kernel, T>);
+		return kernel;
+	}
+
+	/// Resolve the fastest batch kernel with two inputs for the host. The choice is made once per process and kernel.
+	template <class Kernel, typename T>
+	batch_binary_fn<T> resolve_batch_binary_kernel() noexcept
+	{
+		static const batch_binary_fn<T> kernel = select_batch_kernel(&batch_binary_kernel_for<Kernel, T>);
+		return kernel;
+	}
+
+	/// Resolve the fastest batch kernel with two inputs and two outputs for the host. The choice is made once per process and kernel.
+	template <class Kernel, typename T>
+	batch_binary_pair_fn<T> resolve_batch_binary_pair_kernel() noexcept
+	{
+		static const batch_binary_pair_fn<T> kernel = select_batch_kernel(&batch_binary_pair_kernel_for<Kernel, T>);
+		return kernel;
+	}
+} // namespace ccm::rt::simd_impl
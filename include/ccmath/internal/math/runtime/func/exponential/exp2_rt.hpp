@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/func/batch_rt.hpp"
+#include "ccmath/math/exponential/impl/exp2_data.hpp"
+#include "ccmath/math/exponential/exp2.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ccm::rt::simd_impl
+{
+	/**
+	 * @brief Block version of internal::impl::exp2_double_impl.
+	 *
+	 * Lanes with |x| >= 512 or NaN are flagged invalid and left to the scalar kernel.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void exp2_double_simd(const double * x, double * y, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		constexpr auto data		  = internal::exp2_data<double>();
+		constexpr auto table_bits = internal::exp2_data<double>::table_bits;
+
+		batch_block expo_block;
+		batch_block rem_block;
+		batch_block tail_block;
+		batch_block scale_block;
+
+		// exp2(x) = 2^(k/N) * 2^r, with 2^r in [2^(-1/2N),2^(1/2N)].
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t xv = batch_load<Abi>(x + i);
+			batch_store<Abi>((simd_t(-512.0) < xv) && (xv < simd_t(512.0)), valid + i);
+
+			simd_t expo = xv + simd_t(data.shift);
+			batch_store<Abi>(expo, expo_block.data() + i);
+			expo = expo - simd_t(data.shift);
+			batch_store<Abi>(xv - expo, rem_block.data() + i);
+		}
+
+		// 2^(k/N) ~= scale * (1 + tail).
+		batch_exp_table<Abi, table_bits>(expo_block.data(), data.tab.data(), tail_block.data(), scale_block.data(), n);
+
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t rem	 = batch_load<Abi>(rem_block.data() + i);
+			const simd_t tail	 = batch_load<Abi>(tail_block.data() + i);
+			const simd_t scale	 = batch_load<Abi>(scale_block.data() + i);
+			const simd_t rem_sqr = rem * rem;
+			const simd_t tmp	 = tail + rem * simd_t(data.poly[0]) + rem_sqr * (simd_t(data.poly[1]) + rem * simd_t(data.poly[2])) +
+							   rem_sqr * rem_sqr * (simd_t(data.poly[3]) + rem * simd_t(data.poly[4]));
+			batch_store<Abi>(scale + scale * tmp, y + i);
+		}
+	}
+
+	/**
+	 * @brief Block version of internal::impl::exp2_float_impl evaluated in double lanes.
+	 *
+	 * Lanes with |x| >= 128 or NaN are flagged invalid and left to the scalar kernel.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void exp2_float_simd(const double * x, double * y, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		// Static, as the table is read through a pointer into it.
+		static constexpr auto data = internal::exp2_data<float>();
+		constexpr auto table_bits  = internal::exp2_data<float>::table_bits;
+
+		batch_block expo_block;
+		batch_block rem_block;
+		batch_block scale_block;
+
+		// x = k/N + r with r in [-1/(2N), 1/(2N)] and int k.
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t xv = batch_load<Abi>(x + i);
+			batch_store<Abi>((simd_t(-128.0) < xv) && (xv < simd_t(128.0)), valid + i);
+
+			simd_t expo = xv + simd_t(data.shift_scaled);
+			batch_store<Abi>(expo, expo_block.data() + i);
+			expo = expo - simd_t(data.shift_scaled);
+			batch_store<Abi>(xv - expo, rem_block.data() + i);
+		}
+
+		batch_exp_scale<Abi, table_bits>(expo_block.data(), data.tab.data(), scale_block.data(), n);
+
+		// exp2(x) = 2^(k/N) * 2^r ~= scale * (C0*r^3 + C1*r^2 + C2*r + 1)
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t rem	 = batch_load<Abi>(rem_block.data() + i);
+			const simd_t scale	 = batch_load<Abi>(scale_block.data() + i);
+			const simd_t poly_hi = simd_t(data.poly[0]) * rem + simd_t(data.poly[1]);
+			const simd_t rem_sqr = rem * rem;
+			simd_t result		 = simd_t(data.poly[2]) * rem + simd_t(1.0);
+			result				 = poly_hi * rem_sqr + result;
+			batch_store<Abi>(result * scale, y + i);
+		}
+	}
+
+	/// Kernels used by ccm::batch::exp2.
+	struct exp2_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, double * y, double * valid, std::size_t n) noexcept
+		{
+			if constexpr (std::is_same_v<T, float>) { exp2_float_simd<Abi>(x, y, valid, n); }
+			else { exp2_double_simd<Abi>(x, y, valid, n); }
+		}
+
+		template <typename T>
+		static T scalar(T x) noexcept
+		{
+			return ccm::exp2(x);
+		}
+	};
+} // namespace ccm::rt::simd_impl
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/func/batch_rt.hpp"
+#include "ccmath/math/exponential/impl/exp_double_impl.hpp"
+#include "ccmath/math/exponential/impl/exp_float_impl.hpp"
+#include "ccmath/math/exponential/exp.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ccm::rt::simd_impl
+{
+	/**
+	 * @brief Block version of internal::impl::exp_double_impl.
+	 *
+	 * Lanes with |x| >= 512 or NaN are flagged invalid so the scalar kernel can handle overflow,
+	 * underflow and the subnormal range. Every other lane follows the exact same steps as the scalar kernel.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void exp_double_simd(const double * x, double * y, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		batch_block expo_block;
+		batch_block rem_block;
+		batch_block tail_block;
+		batch_block scale_block;
+
+		// x = ln2/N*expo + rem, with int expo and rem in [-ln2/2N, ln2/2N].
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t xv = batch_load<Abi>(x + i);
+			batch_store<Abi>((simd_t(-512.0) < xv) && (xv < simd_t(512.0)), valid + i);
+
+			simd_t expo = xv * simd_t(internal::impl::exp_invLn2N_dbl) + simd_t(internal::impl::exp_shift_dbl);
+			batch_store<Abi>(expo, expo_block.data() + i);
+			expo = expo - simd_t(internal::impl::exp_shift_dbl);
+			batch_store<Abi>(xv + expo * simd_t(internal::impl::exp_negLn2HiN_dbl) + expo * simd_t(internal::impl::exp_negLn2LoN_dbl), rem_block.data() + i);
+		}
+
+		// 2^(expo/N) ~= scale * (1 + tail).
+		batch_exp_table<Abi, internal::k_exp_table_bits_dbl>(expo_block.data(), internal::impl::exp_tab_dbl.data(), tail_block.data(), scale_block.data(), n);
+
+		// exp(x) = 2^(expo/N) * exp(rem) ~= scale + scale * (tail + exp(rem) - 1).
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t rem	 = batch_load<Abi>(rem_block.data() + i);
+			const simd_t tail	 = batch_load<Abi>(tail_block.data() + i);
+			const simd_t scale	 = batch_load<Abi>(scale_block.data() + i);
+			const simd_t rem_sqr = rem * rem;
+			const simd_t tmp =
+				tail + rem + rem_sqr * (simd_t(internal::impl::exp_poly_coeff_one_dbl) + rem * simd_t(internal::impl::exp_poly_coeff_two_dbl)) +
+				rem_sqr * rem_sqr * (simd_t(internal::impl::exp_poly_coeff_three_dbl) + rem * simd_t(internal::impl::exp_poly_coeff_four_dbl));
+			batch_store<Abi>(scale + scale * tmp, y + i);
+		}
+	}
+
+	/**
+	 * @brief Block version of internal::impl::exp_float_impl evaluated in double lanes.
+	 *
+	 * Lanes with |x| >= 88 or NaN are flagged invalid and left to the scalar kernel.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void exp_float_simd(const double * x, double * y, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		batch_block expo_block;
+		batch_block rem_block;
+		batch_block scale_block;
+
+		// x*N/Ln2 = expo + rem with rem in [-1/2, 1/2] and int expo.
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t xv = batch_load<Abi>(x + i);
+			batch_store<Abi>((simd_t(-88.0) < xv) && (xv < simd_t(88.0)), valid + i);
+
+			const simd_t scaled = xv * simd_t(internal::impl::exp_inv_ln2_N_flt);
+			simd_t expo			= scaled + simd_t(internal::impl::exp_shift_flt);
+			batch_store<Abi>(expo, expo_block.data() + i);
+			expo = expo - simd_t(internal::impl::exp_shift_flt);
+			batch_store<Abi>(scaled - expo, rem_block.data() + i);
+		}
+
+		batch_exp_scale<Abi, internal::k_exp_table_bits_flt>(expo_block.data(), internal::impl::exp_tab_flt.data(), scale_block.data(), n);
+
+		// exp(x) = 2^(expo/N) * 2^(rem/N) ~= scale * (C0*rem^3 + C1*rem^2 + C2*rem + 1)
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t rem	 = batch_load<Abi>(rem_block.data() + i);
+			const simd_t scale	 = batch_load<Abi>(scale_block.data() + i);
+			const simd_t poly_hi = simd_t(internal::impl::exp_poly_scaled_flt[0]) * rem + simd_t(internal::impl::exp_poly_scaled_flt[1]);
+			const simd_t rem_sqr = rem * rem;
+			simd_t result		 = simd_t(internal::impl::exp_poly_scaled_flt[2]) * rem + simd_t(1.0);
+			result				 = poly_hi * rem_sqr + result;
+			batch_store<Abi>(scale * result, y + i);
+		}
+	}
+
+	/// Kernels used by ccm::batch::exp.
+	struct exp_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, double * y, double * valid, std::size_t n) noexcept
+		{
+			if constexpr (std::is_same_v<T, float>) { exp_float_simd<Abi>(x, y, valid, n); }
+			else { exp_double_simd<Abi>(x, y, valid, n); }
+		}
+
+		template <typename T>
+		static T scalar(T x) noexcept
+		{
+			return ccm::exp(x);
+		}
+	};
+} // namespace ccm::rt::simd_impl
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/func/batch_rt.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/math/exponential/impl/log2_double_impl.hpp"
+#include "ccmath/math/exponential/impl/log2_float_impl.hpp"
+#include "ccmath/math/exponential/log2.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ccm::rt::simd_impl
+{
+	/**
+	 * @brief Block version of internal::impl::log2_double_impl.
+	 *
+	 * Lanes that are not positive normal finite values, or that lie in the interval around 1.0
+	 * where the scalar kernel switches to its high precision polynomial, are flagged invalid.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void log2_double_simd(const double * x, double * y, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		batch_block norm_block;
+		batch_block expo_block;
+		batch_block inverse_block;
+		batch_block logc_block;
+		batch_block logclo_block;
+		batch_block chi_block;
+		batch_block clo_block;
+		batch_block rem_block;
+
+		// x = 2^expo normVal; where normVal is in range [k_log2TableOff_dbl, 2 * k_log2TableOff_dbl) and exact.
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const std::uint64_t int_x = support::double_to_uint64(x[i]);
+			const std::uint64_t tmp	  = int_x - internal::impl::k_log2TableOff_dbl;
+			// NOLINTBEGIN
+			const auto index = static_cast<std::size_t>((tmp >> (52 - internal::k_log2TableBitsDbl)) % internal::impl::k_log2TableN_dbl);
+			const auto expo	 = static_cast<std::int64_t>(tmp) >> 52;
+			// NOLINTEND
+			norm_block[i]	   = support::uint64_to_double(int_x - (tmp & 0xfffULL << 52));
+			expo_block[i]	   = static_cast<double>(expo);
+			const auto & entry = internal::impl::log2_tab_values_dbl[index];
+			inverse_block[i]   = entry.invc;
+			logc_block[i]	   = entry.logc;
+			logclo_block[i]	   = static_cast<double>(entry.logclo);
+			chi_block[i]	   = entry.chi;
+			clo_block[i]	   = static_cast<double>(entry.clo);
+		}
+
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			batch_store<Abi>((batch_load<Abi>(norm_block.data() + i) - batch_load<Abi>(chi_block.data() + i) - batch_load<Abi>(clo_block.data() + i)) *
+								 batch_load<Abi>(inverse_block.data() + i),
+							 rem_block.data() + i);
+		}
+
+		// Split rem so that its high part times invln2hi is exact. Reuse the chi block for the high part.
+		for (std::size_t i = 0; i < n; ++i) { chi_block[i] = support::uint64_to_double(support::double_to_uint64(rem_block[i]) & -1ULL << 32); }
+
+		const auto & poly = internal::impl::log2_poly_values_dbl;
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t xv		   = batch_load<Abi>(x + i);
+			const auto is_normal   = (simd_t(std::numeric_limits<double>::min() * (1.0 - 0x1p-53)) < xv) &&
+									 (xv < simd_t(std::numeric_limits<double>::infinity()));
+			const auto is_near_one = !(xv < simd_t(1.0 - 0x1.5b51p-5)) && (xv < simd_t(1.0 + 0x1.6ab2p-5));
+			batch_store<Abi>(is_normal && !is_near_one, valid + i);
+
+			const simd_t rem		   = batch_load<Abi>(rem_block.data() + i);
+			const simd_t rem_hi		   = batch_load<Abi>(chi_block.data() + i);
+			const simd_t rem_lo		   = rem - rem_hi;
+			const simd_t rem_high_part = rem_hi * simd_t(internal::impl::log2_inverse_ln2_high_value_dbl);
+			const simd_t rem_low_part =
+				rem_lo * simd_t(internal::impl::log2_inverse_ln2_high_value_dbl) + rem * simd_t(internal::impl::log2_inverse_ln2_low_value_dbl);
+
+			// hi + lo = rem/ln2 + log2(c) + expo
+			const simd_t log_expo_sum = batch_load<Abi>(expo_block.data() + i) + batch_load<Abi>(logc_block.data() + i);
+			const simd_t high_part	  = log_expo_sum + rem_high_part;
+			const simd_t low_part	  = log_expo_sum - high_part + rem_high_part + rem_low_part + batch_load<Abi>(logclo_block.data() + i);
+
+			// log2(rem+1) = rem/ln2 + rem^2*poly(rem)
+			const simd_t rem_sqr		 = rem * rem;
+			const simd_t rem_quad		 = rem_sqr * rem_sqr;
+			const simd_t polynomial_term = simd_t(poly[0]) + rem * simd_t(poly[1]) + rem_sqr * (simd_t(poly[2]) + rem * simd_t(poly[3])) +
+										   rem_quad * (simd_t(poly[4]) + rem * simd_t(poly[5]));
+			batch_store<Abi>(low_part + rem_sqr * polynomial_term + high_part, y + i);
+		}
+	}
+
+	/**
+	 * @brief Block version of internal::impl::log2_float_impl evaluated in double lanes.
+	 *
+	 * Lanes that are not positive normal finite floats, or that are exactly 1.0, are flagged invalid.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void log2_float_simd(const double * x, double * y, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		batch_block norm_block;
+		batch_block expo_block;
+		batch_block inverse_block;
+		batch_block logc_block;
+
+		// x = 2^expo * normVal; where normVal is in range [k_log2TableOff_flt, 2 * k_log2TableOff_flt] and exact.
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const std::uint32_t int_x = support::float_to_uint32(static_cast<float>(x[i]));
+			const std::uint32_t tmp	  = int_x - internal::impl::k_log2TableOff_flt;
+			const auto index		  = static_cast<std::size_t>((tmp >> (23 - internal::k_log2TableBitsFlt)) % internal::impl::k_log2TableN_flt);
+			const auto expo			  = static_cast<std::int32_t>(tmp) >> 23; // NOLINT
+			norm_block[i]			  = static_cast<double>(support::uint32_to_float(int_x - (tmp & 0xff800000)));
+			expo_block[i]			  = static_cast<double>(expo);
+			inverse_block[i]		  = internal::impl::log2_tab_values_flt[index].invc;
+			logc_block[i]			  = internal::impl::log2_tab_values_flt[index].logc;
+		}
+
+		const auto & poly = internal::impl::log2_poly_values_flt;
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t xv		 = batch_load<Abi>(x + i);
+			const auto is_normal = (simd_t(static_cast<double>(std::numeric_limits<float>::min()) * (1.0 - 0x1p-53)) < xv) &&
+								   (xv < simd_t(static_cast<double>(std::numeric_limits<float>::infinity())));
+			batch_store<Abi>(is_normal && !(xv == simd_t(1.0)), valid + i);
+
+			// log2(x) = log1p(normVal/c-1)/ln2 + log2(c) + expo
+			const simd_t rem	 = batch_load<Abi>(norm_block.data() + i) * batch_load<Abi>(inverse_block.data() + i) - simd_t(1.0);
+			const simd_t result0 = batch_load<Abi>(logc_block.data() + i) + batch_load<Abi>(expo_block.data() + i);
+
+			const simd_t rem_sqr		 = rem * rem;
+			simd_t result				 = simd_t(poly[1]) * rem + simd_t(poly[2]);
+			result						 = simd_t(poly[0]) * rem_sqr + result;
+			const simd_t polynomial_term = simd_t(poly[3]) * rem + result0;
+			batch_store<Abi>(result * rem_sqr + polynomial_term, y + i);
+		}
+	}
+
+	/// Kernels used by ccm::batch::log2.
+	struct log2_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, double * y, double * valid, std::size_t n) noexcept
+		{
+			if constexpr (std::is_same_v<T, float>) { log2_float_simd<Abi>(x, y, valid, n); }
+			else { log2_double_simd<Abi>(x, y, valid, n); }
+		}
+
+		template <typename T>
+		static T scalar(T x) noexcept
+		{
+			return ccm::log2(x);
+		}
+	};
+} // namespace ccm::rt::simd_impl
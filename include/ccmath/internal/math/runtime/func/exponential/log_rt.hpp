@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/func/batch_rt.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/math/exponential/impl/log_double_impl.hpp"
+#include "ccmath/math/exponential/impl/log_float_impl.hpp"
+#include "ccmath/math/exponential/log.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ccm::rt::simd_impl
+{
+	/**
+	 * @brief Block version of internal::impl::log_double_impl.
+	 *
+	 * Lanes that are not positive normal finite values, or that lie in the interval around 1.0
+	 * where the scalar kernel switches to its high precision polynomial, are flagged invalid.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void log_double_simd(const double * x, double * y, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		batch_block norm_block;
+		batch_block expo_block;
+		batch_block inverse_block;
+		batch_block logc_block;
+		batch_block logclo_block;
+		batch_block chi_block;
+		batch_block clo_block;
+
+		// x = 2^expo normVal; where normVal is in range [k_logTableOff_dbl, 2 * k_logTableOff_dbl) and exact.
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const std::uint64_t int_x = support::double_to_uint64(x[i]);
+			const std::uint64_t tmp	  = int_x - internal::impl::k_logTableOff_dbl;
+			// NOLINTBEGIN
+			const auto index = static_cast<std::size_t>((tmp >> (52 - internal::k_logTableBitsDbl)) % internal::impl::k_logTableN_dbl);
+			const auto expo	 = static_cast<std::int64_t>(tmp) >> 52;
+			// NOLINTEND
+			norm_block[i]	   = support::uint64_to_double(int_x - (tmp & 0xfffULL << 52));
+			expo_block[i]	   = static_cast<double>(expo);
+			const auto & entry = internal::impl::log_tab_values_dbl[index];
+			inverse_block[i]   = entry.invc;
+			logc_block[i]	   = entry.logc;
+			logclo_block[i]	   = static_cast<double>(entry.logclo);
+			chi_block[i]	   = entry.chi;
+			clo_block[i]	   = static_cast<double>(entry.clo);
+		}
+
+		const auto & poly = internal::impl::log_poly_values_dbl;
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t xv		   = batch_load<Abi>(x + i);
+			const auto is_normal   = (simd_t(std::numeric_limits<double>::min() * (1.0 - 0x1p-53)) < xv) &&
+									 (xv < simd_t(std::numeric_limits<double>::infinity()));
+			const auto is_near_one = !(xv < simd_t(1.0 - 0x1p-4)) && (xv < simd_t(1.0 + 0x1p-4));
+			batch_store<Abi>(is_normal && !is_near_one, valid + i);
+
+			const simd_t scale_factor = batch_load<Abi>(expo_block.data() + i);
+			const simd_t logc		  = batch_load<Abi>(logc_block.data() + i);
+
+			// log(x) = log1p(normVal/c-1) + log(c) + expo*Ln2.
+			const simd_t rem = (batch_load<Abi>(norm_block.data() + i) - batch_load<Abi>(chi_block.data() + i) - batch_load<Abi>(clo_block.data() + i)) *
+							   batch_load<Abi>(inverse_block.data() + i);
+
+			// hi + lo = r + log(c) + expo*Ln2.
+			const simd_t workspace = scale_factor * simd_t(internal::impl::log_ln2hi_value_dbl) + logc;
+			const simd_t high_part = workspace + rem;
+			const simd_t low_part =
+				workspace - high_part + rem + scale_factor * simd_t(internal::impl::log_ln2lo_value_dbl) + batch_load<Abi>(logclo_block.data() + i);
+
+			// log(x) = lo + (log1p(rem) - rem) + hi.
+			const simd_t rem_sqr = rem * rem;
+			batch_store<Abi>(low_part + rem_sqr * simd_t(poly[0]) +
+								 rem * rem_sqr * (simd_t(poly[1]) + rem * simd_t(poly[2]) + rem_sqr * (simd_t(poly[3]) + rem * simd_t(poly[4]))) + high_part,
+							 y + i);
+		}
+	}
+
+	/**
+	 * @brief Block version of internal::impl::log_float_impl evaluated in double lanes.
+	 *
+	 * Lanes that are not positive normal finite floats, or that are exactly 1.0, are flagged invalid.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void log_float_simd(const double * x, double * y, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		batch_block norm_block;
+		batch_block expo_block;
+		batch_block inverse_block;
+		batch_block logc_block;
+
+		// x = 2^exp normVal; where normVal is in range [k_logTableOff_flt, 2 * k_logTableOff_flt] and exact
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const std::uint32_t int_x = support::float_to_uint32(static_cast<float>(x[i]));
+			const std::uint32_t tmp	  = int_x - internal::impl::k_logTableOff_flt;
+			const auto index		  = static_cast<std::size_t>((tmp >> (23 - internal::k_logTableBitsFlt)) % internal::impl::k_logTableN_flt);
+			const auto expo			  = static_cast<std::int32_t>(tmp) >> 23; // NOLINT
+			norm_block[i]			  = static_cast<double>(support::uint32_to_float(int_x - (tmp & static_cast<std::uint32_t>(0x1ff << 23))));
+			expo_block[i]			  = static_cast<double>(expo);
+			inverse_block[i]		  = internal::impl::log_tab_values_flt[index].invc;
+			logc_block[i]			  = internal::impl::log_tab_values_flt[index].logc;
+		}
+
+		const auto & poly = internal::impl::log_poly_values_flt;
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t xv		 = batch_load<Abi>(x + i);
+			const auto is_normal = (simd_t(static_cast<double>(std::numeric_limits<float>::min()) * (1.0 - 0x1p-53)) < xv) &&
+								   (xv < simd_t(static_cast<double>(std::numeric_limits<float>::infinity())));
+			batch_store<Abi>(is_normal && !(xv == simd_t(1.0)), valid + i);
+
+			// log(x) = log1p(normVal / c - 1) + log(c) + expo * Ln2
+			const simd_t rem	 = batch_load<Abi>(norm_block.data() + i) * batch_load<Abi>(inverse_block.data() + i) - simd_t(1.0);
+			const simd_t result0 = batch_load<Abi>(logc_block.data() + i) + batch_load<Abi>(expo_block.data() + i) * simd_t(internal::impl::log_ln2_value_flt);
+
+			const simd_t rem_sqr = rem * rem;
+			simd_t result		 = simd_t(poly[1]) * rem + simd_t(poly[2]);
+			result				 = simd_t(poly[0]) * rem_sqr + result;
+			batch_store<Abi>(result * rem_sqr + (result0 + rem), y + i);
+		}
+	}
+
+	/// Kernels used by ccm::batch::log.
+	struct log_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, double * y, double * valid, std::size_t n) noexcept
+		{
+			if constexpr (std::is_same_v<T, float>) { log_float_simd<Abi>(x, y, valid, n); }
+			else { log_double_simd<Abi>(x, y, valid, n); }
+		}
+
+		template <typename T>
+		static T scalar(T x) noexcept
+		{
+			return ccm::log(x);
+		}
+	};
+} // namespace ccm::rt::simd_impl
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/hyperbolic/cosh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyperbolic/hyperbolic_kernels_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyperbolic/sinh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyperbolic/sinhcosh_gen.hpp"
+#include "ccmath/internal/math/generic/func/hyperbolic/tanh_gen.hpp"
+#include "ccmath/internal/math/runtime/func/batch_rt.hpp"
+#include "ccmath/math/exponential/impl/exp_data.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace ccm::rt::simd_impl
+{
+	/// support::polyeval_pairs for simd lanes and double coefficients.
+	template <std::size_t First, class V, std::size_t N>
+	CCM_ALWAYS_INLINE V hyperbolic_pairs_simd(V acc, V const & x, V const & x2, const std::array<double, N> & a) noexcept
+	{
+		V power = x2;
+		for (std::size_t i = First; i < N; i += 2)
+		{
+			if (i + 1 < N) { acc = acc + power * (V(a[i]) + x * V(a[i + 1])); }
+			else { acc = acc + power * V(a[i]); }
+			power = power * x2;
+		}
+		return acc;
+	}
+
+	/**
+	 * @brief Block version of gen::internal::exp_split_kernel for the lanes of a = |x|.
+	 *
+	 * Scaling a by Factor before the reduction gives e^(Factor a), which tanh uses for e^2a.
+	 */
+	template <class Abi, int Factor>
+	CCM_ALWAYS_INLINE void exp_split_simd(const double * a, double * hi, double * lo, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		using data			 = internal::exp_data<double>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		batch_block expo_block;
+		batch_block rem_block;
+		batch_block tail_block;
+		batch_block scale_block;
+
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t av = simd_t(static_cast<double>(Factor)) * batch_load<Abi>(a + i);
+			simd_t expo		= av * simd_t(data::invln2N) + simd_t(data::shift);
+			batch_store<Abi>(expo, expo_block.data() + i);
+			expo = expo - simd_t(data::shift);
+			batch_store<Abi>(av + expo * simd_t(data::negln2hiN) + expo * simd_t(data::negln2loN), rem_block.data() + i);
+		}
+
+		batch_exp_table<Abi, data::table_bits>(expo_block.data(), data::tab.data(), tail_block.data(), scale_block.data(), n);
+
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t rem	 = batch_load<Abi>(rem_block.data() + i);
+			const simd_t scale	 = batch_load<Abi>(scale_block.data() + i);
+			const simd_t product = scale * hyperbolic_pairs_simd<0>(batch_load<Abi>(tail_block.data() + i) + rem, rem, rem * rem, data::poly);
+			const simd_t head	 = scale + product;
+			batch_store<Abi>(head, hi + i);
+			batch_store<Abi>((scale - head) + product, lo + i);
+		}
+	}
+
+	/**
+	 * @brief Absolute values of a block, and whether each lane lies in [2^-27, 22).
+	 *
+	 * Tiny, large, infinite and NaN lanes are flagged invalid and left to the scalar kernels.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void hyperbolic_abs_simd(const double * x, double * a, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t av = intrin::abs(batch_load<Abi>(x + i));
+			batch_store<Abi>(av, a + i);
+			batch_store<Abi>((simd_t(gen::internal::hyperbolic_tiny) <= av) && (av < simd_t(gen::internal::hyperbolic_large)), valid + i);
+		}
+	}
+
+	/**
+	 * @brief Block hyperbolic sine and cosine. Follows gen::sinhcosh_gen with its polynomial and exponential branches
+	 * evaluated and merged per lane with masked moves.
+	 *
+	 * Either output may be null, in which case that function is skipped.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void sinhcosh_simd(const double * x, double * sinh_y, double * cosh_y, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		batch_block a_block;
+		batch_block hi_block;
+		batch_block lo_block;
+
+		hyperbolic_abs_simd<Abi>(x, a_block.data(), valid, n);
+		exp_split_simd<Abi, 1>(a_block.data(), hi_block.data(), lo_block.data(), n);
+
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t xv		 = batch_load<Abi>(x + i);
+			const simd_t av		 = batch_load<Abi>(a_block.data() + i);
+			const simd_t hi		 = batch_load<Abi>(hi_block.data() + i);
+			const simd_t lo		 = batch_load<Abi>(lo_block.data() + i);
+			const simd_t a_sqr	 = av * av;
+			const simd_t a_quart = a_sqr * a_sqr;
+			const simd_t inverse = simd_t(1.0) / hi;
+
+			if (sinh_y != nullptr)
+			{
+				const auto & s	 = gen::internal::sinh_taylor;
+				const simd_t tail = av * a_sqr * hyperbolic_pairs_simd<2>(simd_t(s[0]) + a_sqr * simd_t(s[1]), a_sqr, a_quart, s);
+				const simd_t result = intrin::choose(av < simd_t(gen::internal::sinh_poly_max), av + tail, simd_t(0.5) * (hi + (lo - inverse)));
+				batch_store<Abi>(intrin::copysign(result, xv), sinh_y + i);
+			}
+			if (cosh_y != nullptr)
+			{
+				const auto & c	 = gen::internal::cosh_taylor;
+				const simd_t tail = a_sqr * hyperbolic_pairs_simd<2>(simd_t(c[0]) + a_sqr * simd_t(c[1]), a_sqr, a_quart, c);
+				batch_store<Abi>(intrin::choose(av < simd_t(gen::internal::cosh_poly_max), simd_t(1.0) + tail, simd_t(0.5) * (hi + (lo + inverse))),
+								 cosh_y + i);
+			}
+		}
+	}
+
+	/// Block hyperbolic tangent. Follows gen::internal::tanh_kernel with both of its branches evaluated and merged per lane.
+	template <class Abi>
+	CCM_ALWAYS_INLINE void tanh_simd(const double * x, double * y, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		batch_block a_block;
+		batch_block hi_block;
+		batch_block lo_block;
+
+		hyperbolic_abs_simd<Abi>(x, a_block.data(), valid, n);
+		exp_split_simd<Abi, 2>(a_block.data(), hi_block.data(), lo_block.data(), n);
+
+		const auto & s = gen::internal::sinh_taylor;
+		const auto & c = gen::internal::cosh_taylor;
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t av	   = batch_load<Abi>(a_block.data() + i);
+			const simd_t a_sqr = av * av;
+
+			// (a + sinh_tail) / (1 + cosh_tail) with one correction step.
+			const simd_t a_quart   = a_sqr * a_sqr;
+			const simd_t sinh_tail = av * a_sqr * hyperbolic_pairs_simd<2>(simd_t(s[0]) + a_sqr * simd_t(s[1]), a_sqr, a_quart, s);
+			const simd_t cosh_tail = a_sqr * hyperbolic_pairs_simd<2>(simd_t(c[0]) + a_sqr * simd_t(c[1]), a_sqr, a_quart, c);
+			const simd_t cosh_val  = simd_t(1.0) + cosh_tail;
+			const simd_t q_poly	   = (av + sinh_tail) / cosh_val;
+			const simd_t residual  = ((av - q_poly) + sinh_tail) - q_poly * cosh_tail;
+			const simd_t poly	   = q_poly + residual / cosh_val;
+
+			// 1 - 2 / (e^2a + 1).
+			const simd_t hi		= batch_load<Abi>(hi_block.data() + i);
+			const simd_t sum	= hi + simd_t(1.0);
+			const simd_t sum_lo = ((hi - sum) + simd_t(1.0)) + batch_load<Abi>(lo_block.data() + i);
+			const simd_t q_exp	= simd_t(2.0) / sum;
+			const simd_t expo	= simd_t(1.0) - (q_exp - q_exp * (sum_lo / sum));
+
+			batch_store<Abi>(intrin::copysign(intrin::choose(av < simd_t(gen::internal::cosh_poly_max), poly, expo), batch_load<Abi>(x + i)), y + i);
+		}
+	}
+
+	/// Kernels used by ccm::batch::sinh.
+	struct sinh_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, double * y, double * valid, std::size_t n) noexcept
+		{
+			sinhcosh_simd<Abi>(x, y, nullptr, valid, n);
+		}
+
+		template <typename T>
+		static T scalar(T x) noexcept
+		{
+			return gen::sinh_gen<T>(x);
+		}
+	};
+
+	/// Kernels used by ccm::batch::cosh.
+	struct cosh_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, double * y, double * valid, std::size_t n) noexcept
+		{
+			sinhcosh_simd<Abi>(x, nullptr, y, valid, n);
+		}
+
+		template <typename T>
+		static T scalar(T x) noexcept
+		{
+			return gen::cosh_gen<T>(x);
+		}
+	};
+
+	/// Kernels used by ccm::batch::sinhcosh.
+	struct sinhcosh_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, double * sinh_y, double * cosh_y, double * valid, std::size_t n) noexcept
+		{
+			sinhcosh_simd<Abi>(x, sinh_y, cosh_y, valid, n);
+		}
+
+		template <typename T>
+		static void scalar(T x, T * sinh_y, T * cosh_y) noexcept
+		{
+			gen::sinhcosh_gen<T>(x, sinh_y, cosh_y);
+		}
+	};
+
+	/// Kernels used by ccm::batch::tanh.
+	struct tanh_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, double * y, double * valid, std::size_t n) noexcept
+		{
+			tanh_simd<Abi>(x, y, valid, n);
+		}
+
+		template <typename T>
+		static T scalar(T x) noexcept
+		{
+			return gen::tanh_gen<T>(x);
+		}
+	};
+} // namespace ccm::rt::simd_impl
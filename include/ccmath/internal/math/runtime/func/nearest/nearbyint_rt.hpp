@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/math/generic/func/nearest/nearbyint_gen.hpp"
+
+#include <type_traits>
+
+#if defined(CCMATH_HAS_SIMD_SSE4_1)
+	#include <smmintrin.h>
+#elif defined(CCMATH_HAS_SIMD_NEON) && defined(__ARM_FEATURE_DIRECTED_ROUNDING) && defined(__aarch64__)
+	#include <arm_neon.h>
+#endif
+
+namespace ccm::rt
+{
+	/**
+	 * @brief Runtime nearbyint. Uses roundsd/roundss on SSE4.1 and frinti on AArch64, both of which honour the current rounding mode.
+	 * @tparam T The floating-point type.
+	 * @param num The value to round.
+	 * @return The rounded value.
+	 * @note FE_INEXACT is never raised.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	T nearbyint_rt(T num) noexcept
+	{
+#if defined(CCMATH_HAS_SIMD_SSE4_1)
+		if constexpr (std::is_same_v<T, double>) { return _mm_cvtsd_f64(_mm_round_sd(_mm_setzero_pd(), _mm_set_sd(num), _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC)); }
+		else if constexpr (std::is_same_v<T, float>) { return _mm_cvtss_f32(_mm_round_ss(_mm_setzero_ps(), _mm_set_ss(num), _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC)); }
+		else { return gen::nearbyint_gen<T>(num); }
+#elif defined(CCMATH_HAS_SIMD_NEON) && defined(__ARM_FEATURE_DIRECTED_ROUNDING) && defined(__aarch64__)
+		if constexpr (std::is_same_v<T, double>) { return vget_lane_f64(vrndi_f64(vdup_n_f64(num)), 0); }
+		else if constexpr (std::is_same_v<T, float>) { return vget_lane_f32(vrndi_f32(vdup_n_f32(num)), 0); }
+		else { return gen::nearbyint_gen<T>(num); }
+#else
+		return gen::nearbyint_gen<T>(num);
+#endif
+	}
+} // namespace ccm::rt
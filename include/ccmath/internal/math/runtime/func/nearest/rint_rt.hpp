@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/math/generic/func/nearest/rint_gen.hpp"
+#include "ccmath/internal/support/fp/fp_bits.hpp"
+
+#include <cfloat>
+#include <type_traits>
+
+#if defined(CCMATH_HAS_SIMD_SSE4_1)
+	#include <smmintrin.h>
+#elif defined(CCMATH_HAS_SIMD_NEON) && defined(__ARM_FEATURE_DIRECTED_ROUNDING) && defined(__aarch64__)
+	#include <arm_neon.h>
+#endif
+
+namespace ccm::rt
+{
+	/**
+	 * @brief Runtime rint. Uses roundsd/roundss on SSE4.1 and frintx on AArch64, both of which honour the current rounding mode.
+	 * @tparam T The floating-point type.
+	 * @param num The value to round.
+	 * @return The rounded value.
+	 * @note Unlike nearbyint, FE_INEXACT is raised when the result differs from num.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	T rint_rt(T num) noexcept
+	{
+#if defined(CCMATH_HAS_SIMD_SSE4_1)
+		if constexpr (std::is_same_v<T, double>) { return _mm_cvtsd_f64(_mm_round_sd(_mm_setzero_pd(), _mm_set_sd(num), _MM_FROUND_CUR_DIRECTION)); }
+		else if constexpr (std::is_same_v<T, float>) { return _mm_cvtss_f32(_mm_round_ss(_mm_setzero_ps(), _mm_set_ss(num), _MM_FROUND_CUR_DIRECTION)); }
+		else { return gen::rint_gen<T>(num); }
+#elif defined(CCMATH_HAS_SIMD_NEON) && defined(__ARM_FEATURE_DIRECTED_ROUNDING) && defined(__aarch64__)
+		if constexpr (std::is_same_v<T, double>) { return vget_lane_f64(vrndx_f64(vdup_n_f64(num)), 0); }
+		else if constexpr (std::is_same_v<T, float>) { return vget_lane_f32(vrndx_f32(vdup_n_f32(num)), 0); }
+		else { return gen::rint_gen<T>(num); }
+#elif defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+		// Float and double are evaluated in their own precision, so adding and subtracting 2^fraction_length rounds
+		// away the fraction using the current rounding mode without having to query it.
+		if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>)
+		{
+			using FPBits_t	= support::fp::FPBits<T>;
+			using Storage_t = typename FPBits_t::storage_type;
+
+			FPBits_t bits(num);
+
+			// If x == ±∞ or ±NaN, or all the fraction bits are integral bits, then return num
+			if (bits.get_exponent() >= FPBits_t::fraction_length) { return num; }
+
+			// The signs are copied with bit operations as the sign of x is as hard to predict as x itself.
+			const Storage_t sign_bit = bits.uintval() & FPBits_t::sign_mask;
+			FPBits_t shift(static_cast<T>(Storage_t(1) << FPBits_t::fraction_length));
+			shift.set_uintval(shift.uintval() | sign_bit);
+
+			// Keep the sign of x when the result is zero.
+			FPBits_t result((num + shift.get_val()) - shift.get_val());
+			result.set_uintval((result.uintval() & ~FPBits_t::sign_mask) | sign_bit);
+			return result.get_val();
+		}
+		else { return gen::rint_gen<T>(num); }
+#else
+		return gen::rint_gen<T>(num);
+#endif
+	}
+} // namespace ccm::rt
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/math/generic/func/nearest/round_gen.hpp"
+
+#include <type_traits>
+
+#if defined(CCMATH_HAS_SIMD_NEON) && defined(__ARM_FEATURE_DIRECTED_ROUNDING) && defined(__aarch64__)
+	#include <arm_neon.h>
+#endif
+
+namespace ccm::rt
+{
+	/**
+	 * @brief Runtime round. Uses frinta on AArch64.
+	 * @tparam T The floating-point type.
+	 * @param num The value to round.
+	 * @return The integral value nearest to num, with halfway cases rounded away from zero.
+	 * @note SSE4.1 has no ties away from zero mode and emulating it with roundsd is slower than the branchless generic
+	 * implementation, so x86 always uses the generic implementation.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	T round_rt(T num) noexcept
+	{
+#if defined(CCMATH_HAS_SIMD_NEON) && defined(__ARM_FEATURE_DIRECTED_ROUNDING) && defined(__aarch64__)
+		if constexpr (std::is_same_v<T, double>) { return vget_lane_f64(vrnda_f64(vdup_n_f64(num)), 0); }
+		else if constexpr (std::is_same_v<T, float>) { return vget_lane_f32(vrnda_f32(vdup_n_f32(num)), 0); }
+		else { return gen::round_gen<T>(num); }
+#else
+		return gen::round_gen<T>(num);
+#endif
+	}
+} // namespace ccm::rt
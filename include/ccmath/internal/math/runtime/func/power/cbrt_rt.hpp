@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/cbrt_gen.hpp"
+#include "ccmath/internal/math/runtime/func/batch_rt.hpp"
+#include "ccmath/internal/math/runtime/func/dispatch_rt.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ccm::rt::simd_impl
+{
+	/**
+	 * @brief Vector form of gen::internal::cbrt_estimate for positive normal lanes.
+	 *
+	 * The integer lanes cannot divide, so the high word is divided by 3 in double lanes: it is converted exactly through
+	 * the bit pattern of 2^52, and the rounded quotient plus the bias is read back the same way. The seed may differ from
+	 * the scalar one in its last bit, which the refinement does not depend on.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE intrin::simd<double, Abi> cbrt_estimate_simd(intrin::simd<double, Abi> const & ax, intrin::simd<double, Abi> const & inverse) noexcept
+	{
+		using simd_t = intrin::simd<double, Abi>;
+		using bits_t = intrin::simd<std::uint64_t, Abi>;
+
+		const bits_t two_52_bits(0x4330000000000000ULL);
+		const simd_t high	   = intrin::bit_cast<simd_t>((intrin::bit_cast<bits_t>(ax) >> 32) | two_52_bits) - simd_t(0x1p52);
+		const simd_t seed_word = high * simd_t(1.0 / 3.0) + simd_t(0x1p52 + gen::internal::cbrt_seed_bias);
+		const simd_t seed	   = intrin::bit_cast<simd_t>(intrin::bit_cast<bits_t>(seed_word) << 32);
+
+		const auto & poly = gen::internal::cbrt_poly_values;
+		const simd_t r	  = (seed * seed) * (seed * inverse);
+		return seed * ((simd_t(poly[0]) + r * (simd_t(poly[1]) + r * simd_t(poly[2]))) + ((r * r) * r) * (simd_t(poly[3]) + r * simd_t(poly[4])));
+	}
+
+	/// Vector form of gen::internal::cbrt_halley.
+	template <class Abi>
+	CCM_ALWAYS_INLINE intrin::simd<double, Abi> cbrt_halley_simd(intrin::simd<double, Abi> const & ax, intrin::simd<double, Abi> const & t,
+																 intrin::simd<double, Abi> const & inverse) noexcept
+	{
+		using simd_t = intrin::simd<double, Abi>;
+
+		const simd_t q = (t * t * t - ax) * inverse;
+		return t - t * (q * (simd_t(1.0 / 3.0) - q * (simd_t(2.0 / 9.0) - q * simd_t(4.0 / 27.0))));
+	}
+
+	/// Vector form of gen::internal::cbrt_kernel, correctly rounded for lanes in [2^-900, 2^900).
+	template <class Abi>
+	CCM_ALWAYS_INLINE intrin::simd<double, Abi> cbrt_kernel_simd(intrin::simd<double, Abi> const & ax) noexcept
+	{
+		using simd_t = intrin::simd<double, Abi>;
+
+		const simd_t inverse = simd_t(1.0) / ax;
+		const simd_t y		 = cbrt_halley_simd<Abi>(ax, cbrt_estimate_simd<Abi>(ax, inverse), inverse);
+
+		simd_t square_hi;
+		simd_t square_lo;
+		simd_t cube_hi;
+		simd_t cube_lo;
+		batch_exact_mult<Abi>(y, y, square_hi, square_lo);
+		batch_exact_mult<Abi>(y, square_hi, cube_hi, cube_lo);
+		const simd_t residual = (cube_hi - ax) + (cube_lo + y * square_lo);
+		return y - residual * (y * inverse * simd_t(1.0 / 3.0));
+	}
+
+	/**
+	 * @brief Vector form of gen::cbrt_gen for double, valid for every input.
+	 *
+	 * Lanes outside [2^-900, 2^900) are scaled by a power of 2^3 chosen with masked moves. Zero, infinite and NaN lanes
+	 * run the kernel on 1.0, which keeps their intermediates normal, and return x + x.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE intrin::simd<double, Abi> cbrt_simd(intrin::simd<double, Abi> const & x) noexcept
+	{
+		using simd_t = intrin::simd<double, Abi>;
+
+		simd_t ax			  = intrin::abs(x);
+		const auto is_special = !((ax > simd_t(0.0)) && (ax < simd_t(std::numeric_limits<double>::infinity())));
+		const auto too_small  = ax < simd_t(gen::internal::cbrt_min_unscaled);
+		const auto too_big	  = ax >= simd_t(gen::internal::cbrt_max_unscaled);
+
+		simd_t result_scale(1.0);
+		intrin::where(too_small, ax)		   = ax * simd_t(gen::internal::cbrt_scale_up);
+		intrin::where(too_small, result_scale) = simd_t(gen::internal::cbrt_result_scale_down);
+		intrin::where(too_big, ax)			   = ax * simd_t(gen::internal::cbrt_scale_down);
+		intrin::where(too_big, result_scale)   = simd_t(gen::internal::cbrt_result_scale_up);
+		intrin::where(is_special, ax)		   = simd_t(1.0);
+
+		simd_t result = cbrt_kernel_simd<Abi>(ax) * result_scale;
+		intrin::where(x < simd_t(0.0), result) = -result;
+		intrin::where(is_special, result)	   = x + x;
+		return result;
+	}
+
+	/// Block kernel for float arrays. Float magnitudes need no scaling in double lanes and the Halley step rounds them correctly, so every lane is valid.
+	struct cbrt_float_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, double * y, double * valid, std::size_t n) noexcept
+		{
+			using simd_t		 = intrin::simd<double, Abi>;
+			constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+			for (std::size_t i = 0; i < n; i += width)
+			{
+				const simd_t xv		  = batch_load<Abi>(x + i);
+				simd_t ax			  = intrin::abs(xv);
+				const auto is_special = !((ax > simd_t(0.0)) && (ax < simd_t(std::numeric_limits<double>::infinity())));
+				intrin::where(is_special, ax) = simd_t(1.0);
+
+				const simd_t inverse = simd_t(1.0) / ax;
+				simd_t result		 = cbrt_halley_simd<Abi>(ax, cbrt_estimate_simd<Abi>(ax, inverse), inverse);
+				intrin::where(xv < simd_t(0.0), result) = -result;
+				intrin::where(is_special, result)		= xv + xv;
+				batch_store<Abi>(result, y + i);
+				batch_store<Abi>(simd_t(1.0), valid + i);
+			}
+		}
+
+		template <typename T>
+		static T scalar(T x) noexcept
+		{
+			return gen::cbrt_gen<T>(x);
+		}
+	};
+
+	/// Stream whole vectors of Abi through cbrt_simd. The tail shorter than a vector is one masked or zero filled vector.
+	template <class Abi>
+	CCM_ALWAYS_INLINE void cbrt_batch_loop(const double * in, double * out, std::size_t count) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		std::size_t i = 0;
+		for (; i + width <= count; i += width)
+		{
+			cbrt_simd<Abi>(simd_t(in + i, intrin::element_aligned_tag())).copy_to(out + i, intrin::element_aligned_tag());
+		}
+		if (i < count)
+		{
+			const auto tail = static_cast<int>(count - i);
+			intrin::store_partial(cbrt_simd<Abi>(intrin::load_partial<simd_t>(in + i, tail)), out + i, tail);
+		}
+	}
+
+	/// Double arrays without SIMD, one scalar call per element.
+	inline void cbrt_batch_scalar(const double * in, double * out, std::size_t count) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i) { out[i] = gen::cbrt_gen<double>(in[i]); }
+	}
+
+	/// Double arrays, read in place by cbrt_batch_loop.
+	inline void cbrt_batch_native(const double * in, double * out, std::size_t count) noexcept
+	{
+#ifdef CCMATH_HAS_SIMD
+		cbrt_batch_loop<intrin::abi::native>(in, out, count);
+#else
+		cbrt_batch_scalar(in, out, count);
+#endif
+	}
+
+	/**
+	 * @brief Get the array cbrt kernel compiled for exactly the given SIMD level.
+	 * @return The kernel, or nullptr if this binary has no kernel for that level.
+	 * @note The float kernel has no exact products and gets the target attribute tiers of batch_kernel_for. The double
+	 * kernel relies on batch_exact_mult, see batch_binary_kernel_for.
+	 */
+	template <typename T>
+	batch_fn<T> cbrt_batch_kernel_for(simd_level level) noexcept
+	{
+		if constexpr (std::is_same_v<T, float>) { return batch_kernel_for<cbrt_float_batch_kernel, T>(level); }
+		else
+		{
+			if (level == simd_level::scalar) { return &cbrt_batch_scalar; }
+			if (level == compiled_simd_level()) { return &cbrt_batch_native; }
+			return nullptr;
+		}
+	}
+
+	/// Resolve the fastest array cbrt kernel for the host. The choice is made once per process, see select_batch_kernel.
+	template <typename T>
+	batch_fn<T> resolve_cbrt_batch_kernel() noexcept
+	{
+		static const batch_fn<T> kernel = select_batch_kernel(&cbrt_batch_kernel_for<T>);
+		return kernel;
+	}
+} // namespace ccm::rt::simd_impl
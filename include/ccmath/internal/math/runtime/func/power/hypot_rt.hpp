@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/hypot_gen.hpp"
+#include "ccmath/internal/math/runtime/func/batch_rt.hpp"
+#include "ccmath/internal/math/runtime/func/dispatch_rt.hpp"
+#include "ccmath/internal/math/runtime/simd/func/sqrt.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace ccm::rt::simd_impl
+{
+	/**
+	 * @brief Vector form of gen::internal::hypot_kernel for lanes whose larger operand is in [2^-500, 2^501).
+	 *
+	 * The exact squares are summed as a double-double and the square root of the head is corrected with one Newton step
+	 * on the remainder.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE intrin::simd<double, Abi> hypot_kernel_simd(intrin::simd<double, Abi> const & x, intrin::simd<double, Abi> const & y) noexcept
+	{
+		using simd_t = intrin::simd<double, Abi>;
+
+		simd_t xx_hi;
+		simd_t xx_lo;
+		simd_t yy_hi;
+		simd_t yy_lo;
+		batch_exact_mult<Abi>(x, x, xx_hi, xx_lo);
+		batch_exact_mult<Abi>(y, y, yy_hi, yy_lo);
+		const simd_t sqr_sum   = xx_hi + yy_hi;
+		const simd_t virtual_y = sqr_sum - xx_hi;
+		const simd_t sqr_lo	   = ((xx_hi - (sqr_sum - virtual_y)) + (yy_hi - virtual_y)) + (xx_lo + yy_lo);
+
+		const simd_t root = intrin::sqrt(sqr_sum);
+		simd_t root_sqr_hi;
+		simd_t root_sqr_lo;
+		batch_exact_mult<Abi>(root, root, root_sqr_hi, root_sqr_lo);
+		const simd_t remainder = ((sqr_sum - root_sqr_hi) - root_sqr_lo) + sqr_lo;
+		return root + remainder * simd_t(0.5) / root;
+	}
+
+	/**
+	 * @brief Vector form of gen::hypot_gen for double, valid for every input.
+	 *
+	 * Lanes whose larger operand is outside [2^-500, 2^501) are scaled by a power of two chosen with masked moves, so
+	 * the common range pays two compares and no extra rounding. Zero lanes give zero, and infinite lanes give +inf even
+	 * when the other operand is NaN.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE intrin::simd<double, Abi> hypot_simd(intrin::simd<double, Abi> const & x, intrin::simd<double, Abi> const & y) noexcept
+	{
+		using simd_t = intrin::simd<double, Abi>;
+
+		const simd_t ax = intrin::abs(x);
+		const simd_t ay = intrin::abs(y);
+		simd_t big		= ax;
+
+		intrin::where(ay > ax, big) = ay;
+
+		// Powers of two, so multiplying by the inverse scale is exact and saves a division.
+		const auto too_big	 = big >= simd_t(0x1p501);
+		const auto too_small = big < simd_t(0x1p-500);
+		simd_t scale(1.0);
+		simd_t inverse_scale(1.0);
+		intrin::where(too_big, scale)			= simd_t(gen::internal::hypot_scale_down);
+		intrin::where(too_big, inverse_scale)	= simd_t(gen::internal::hypot_scale_up);
+		intrin::where(too_small, scale)			= simd_t(gen::internal::hypot_scale_up);
+		intrin::where(too_small, inverse_scale) = simd_t(gen::internal::hypot_scale_down);
+
+		simd_t result = hypot_kernel_simd<Abi>(ax * scale, ay * scale) * inverse_scale;
+
+		const simd_t inf(std::numeric_limits<double>::infinity());
+		intrin::where(big == simd_t(0.0), result)		   = simd_t(0.0);
+		intrin::where((ax == inf) || (ay == inf), result) = inf;
+		return result;
+	}
+
+	/// Block kernel for float arrays. The squares of float operands are exact in double and cannot overflow, so every lane is valid.
+	struct hypot_float_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, const double * y, double * out, double * valid, std::size_t n) noexcept
+		{
+			using simd_t		 = intrin::simd<double, Abi>;
+			constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+			const simd_t inf(std::numeric_limits<double>::infinity());
+			for (std::size_t i = 0; i < n; i += width)
+			{
+				const simd_t xv = batch_load<Abi>(x + i);
+				const simd_t yv = batch_load<Abi>(y + i);
+				simd_t result	= intrin::sqrt(xv * xv + yv * yv);
+				intrin::where((intrin::abs(xv) == inf) || (intrin::abs(yv) == inf), result) = inf;
+				batch_store<Abi>(result, out + i);
+				batch_store<Abi>(simd_t(1.0), valid + i);
+			}
+		}
+
+		template <typename T>
+		static T scalar(T x, T y) noexcept
+		{
+			return gen::hypot_gen<T>(x, y);
+		}
+	};
+
+	/// Stream whole vectors of Abi through hypot_simd. The tail shorter than a vector is one masked or zero filled vector.
+	template <class Abi>
+	CCM_ALWAYS_INLINE void hypot_batch_loop(const double * x, const double * y, double * out, std::size_t count) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		std::size_t i = 0;
+		for (; i + width <= count; i += width)
+		{
+			const simd_t xv(x + i, intrin::element_aligned_tag());
+			const simd_t yv(y + i, intrin::element_aligned_tag());
+			hypot_simd<Abi>(xv, yv).copy_to(out + i, intrin::element_aligned_tag());
+		}
+		if (i < count)
+		{
+			const auto tail = static_cast<int>(count - i);
+			intrin::store_partial(hypot_simd<Abi>(intrin::load_partial<simd_t>(x + i, tail), intrin::load_partial<simd_t>(y + i, tail)), out + i, tail);
+		}
+	}
+
+	template <typename T>
+	void hypot_batch_scalar(const T * x, const T * y, T * out, std::size_t count) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i) { out[i] = gen::hypot_gen<T>(x[i], y[i]); }
+	}
+
+	template <typename T>
+	void hypot_batch_native(const T * x, const T * y, T * out, std::size_t count) noexcept
+	{
+#ifdef CCMATH_HAS_SIMD
+		// Double arrays are read in place. Float arrays go through double blocks, where the plain sum of squares is enough.
+		if constexpr (std::is_same_v<T, double>) { hypot_batch_loop<intrin::abi::native>(x, y, out, count); }
+		else { batch_apply_binary<intrin::abi::native, hypot_float_batch_kernel>(x, y, out, count); }
+#else
+		hypot_batch_scalar<T>(x, y, out, count);
+#endif
+	}
+
+	/**
+	 * @brief Get the array hypot kernel compiled for exactly the given SIMD level.
+	 * @return The kernel, or nullptr if this binary has no kernel for that level.
+	 * @note See batch_binary_kernel_for for why there are no target attribute tiers.
+	 */
+	template <typename T>
+	batch_binary_fn<T> hypot_batch_kernel_for(simd_level level) noexcept
+	{
+		if (level == simd_level::scalar) { return &hypot_batch_scalar<T>; }
+		if (level == compiled_simd_level()) { return &hypot_batch_native<T>; }
+		return nullptr;
+	}
+
+	/// Resolve the fastest array hypot kernel for the host. The choice is made once per process, see select_batch_kernel.
+	template <typename T>
+	batch_binary_fn<T> resolve_hypot_batch_kernel() noexcept
+	{
+		static const batch_binary_fn<T> kernel = select_batch_kernel(&hypot_batch_kernel_for<T>);
+		return kernel;
+	}
+} // namespace ccm::rt::simd_impl
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/math/runtime/func/dispatch_rt.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+#include "ccmath/math/power/impl/pow_impl.hpp"
+#include "ccmath/math/power/pow.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace ccm::rt::simd_impl
+{
+	/// Which operands of a batch pow are arrays. A scalar operand is passed as a pointer to one value.
+	enum class pow_operands
+	{
+		array_array,
+		array_scalar,
+		scalar_array
+	};
+
+	/// hi + lo = a + b exactly, for |a| >= |b| or a = 0.
+	template <class Abi>
+	CCM_ALWAYS_INLINE void pow_exact_add(intrin::simd<double, Abi> const & a, intrin::simd<double, Abi> const & b, intrin::simd<double, Abi> & hi,
+										 intrin::simd<double, Abi> & lo) noexcept
+	{
+		hi = a + b;
+		lo = b - (hi - a);
+	}
+
+	/**
+	 * @brief Block version of internal::impl::pow_log_helper: log(x) as a double-double per lane.
+	 *
+	 * Lanes that are not positive normal finite numbers are flagged invalid. The reduction and the table lookups stay a
+	 * scalar pass over the block: logclo is a float packed with clo into the last word of each log_double_tab_entry, and
+	 * the simd layer has no conversion from float to double lanes to widen it after a gather. The arithmetic follows the
+	 * same steps as the scalar helper.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void pow_log_simd(const double * x, double * log_hi, double * log_lo, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		using data			 = internal::log_double_generated_data<internal::k_logTableBitsDbl>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		batch_block z_block;
+		batch_block k_block;
+		batch_block invc_block;
+		batch_block logc_block;
+		batch_block logclo_block;
+		batch_block logctail_block;
+
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const bool is_normal = x[i] >= std::numeric_limits<double>::min() && x[i] <= std::numeric_limits<double>::max();
+			valid[i]			 = is_normal ? 1.0 : 0.0;
+
+			const internal::impl::pow_log_reduction reduced = internal::impl::pow_reduce_log_argument(is_normal ? x[i] : 1.0);
+			const internal::log_double_tab_entry & entry = data::tab[reduced.index];
+			z_block[i]										   = reduced.z;
+			k_block[i]										   = reduced.k;
+			invc_block[i]									   = entry.invc;
+			logc_block[i]									   = entry.logc;
+			logclo_block[i]									   = static_cast<double>(entry.logclo);
+			logctail_block[i]								   = data::logctail[reduced.index];
+		}
+
+		const auto & poly = internal::impl::pow_log_poly_dbl;
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t k = batch_load<Abi>(k_block.data() + i);
+
+			simd_t product_hi;
+			simd_t product_lo;
+			batch_exact_mult<Abi>(batch_load<Abi>(z_block.data() + i), batch_load<Abi>(invc_block.data() + i), product_hi, product_lo);
+			simd_t rem_hi;
+			simd_t rem_lo;
+			pow_exact_add<Abi>(product_hi - simd_t(1.0), product_lo, rem_hi, rem_lo);
+
+			simd_t sum_hi;
+			simd_t sum_lo;
+			pow_exact_add<Abi>(k * simd_t(data::ln2hi) + batch_load<Abi>(logc_block.data() + i), rem_hi, sum_hi, sum_lo);
+
+			simd_t rem_sqr_hi;
+			simd_t rem_sqr_lo;
+			batch_exact_mult<Abi>(rem_hi, rem_hi, rem_sqr_hi, rem_sqr_lo);
+			simd_t cube_hi;
+			simd_t cube_lo;
+			batch_exact_mult<Abi>(rem_hi, rem_sqr_hi, cube_hi, cube_lo);
+			simd_t third_hi;
+			simd_t third_lo;
+			batch_exact_mult<Abi>(cube_hi, simd_t(internal::impl::pow_third_dd.hi), third_hi, third_lo);
+			third_lo = third_lo + cube_hi * simd_t(internal::impl::pow_third_dd.lo) + (cube_lo + rem_hi * rem_sqr_lo) * simd_t(internal::impl::pow_third_dd.hi);
+			simd_t square_hi;
+			simd_t square_lo;
+			pow_exact_add<Abi>(sum_hi, simd_t(-0.5) * rem_sqr_hi, square_hi, square_lo);
+			simd_t high_hi;
+			simd_t high_lo;
+			pow_exact_add<Abi>(square_hi, third_hi, high_hi, high_lo);
+
+			const simd_t rem_quad  = rem_sqr_hi * rem_sqr_hi;
+			const simd_t tail_poly = rem_quad * (simd_t(poly[2]) + rem_hi * simd_t(poly[3]) + rem_sqr_hi * (simd_t(poly[4]) + rem_hi * simd_t(poly[5])) +
+												 rem_quad * (simd_t(poly[6]) + rem_hi * simd_t(poly[7]) + rem_sqr_hi * simd_t(poly[8])));
+
+			const simd_t low = k * simd_t(data::ln2lo) + batch_load<Abi>(logclo_block.data() + i) + batch_load<Abi>(logctail_block.data() + i) + sum_lo +
+							   square_lo + high_lo + third_lo + (rem_lo * (simd_t(1.0) - rem_hi + rem_sqr_hi) - simd_t(0.5) * rem_sqr_lo) + tail_poly;
+
+			simd_t result_hi;
+			simd_t result_lo;
+			pow_exact_add<Abi>(high_hi, low, result_hi, result_lo);
+			batch_store<Abi>(result_hi, log_hi + i);
+			batch_store<Abi>(result_lo, log_lo + i);
+		}
+	}
+
+	/**
+	 * @brief Block version of the fast pass of internal::impl::pow_double_core from log(x) as a double-double.
+	 *
+	 * Computes e^(y log(x)) with internal::impl::pow_exp_helper's steps and flags a lane invalid where its result
+	 * fails the same rounding test, or |y log(x)| is outside [2^-60, 690] or NaN. Lanes flagged invalid on entry stay so.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void pow_exp_simd(const double * log_hi, const double * log_lo, const double * y, double * out, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		using data			 = internal::exp_data<double>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		batch_block expo_hi_block;
+		batch_block expo_lo_block;
+		batch_block k_block;
+		batch_block tail_block;
+		batch_block scale_block;
+
+		// y log(x) = expo_hi + expo_lo, and the shifted multiple of ln2/N closest to it.
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t yv = batch_load<Abi>(y + i);
+			simd_t product_hi;
+			simd_t product_lo;
+			batch_exact_mult<Abi>(yv, batch_load<Abi>(log_hi + i), product_hi, product_lo);
+			const simd_t expo_lo  = yv * batch_load<Abi>(log_lo + i) + product_lo;
+			const simd_t abs_expo = intrin::abs(product_hi);
+
+			const simd_t in_range = batch_load<Abi>(valid + i);
+			batch_store<Abi>((in_range != simd_t(0.0)) && (simd_t(0x1p-60) <= abs_expo) && (abs_expo <= simd_t(690.0)), valid + i);
+			batch_store<Abi>(product_hi, expo_hi_block.data() + i);
+			batch_store<Abi>(expo_lo, expo_lo_block.data() + i);
+			batch_store<Abi>(product_hi * simd_t(data::invln2N) + simd_t(data::shift), k_block.data() + i);
+		}
+
+		// 2^(k/N) = scale * (1 + tail). Out of range lanes still index the table safely, their result is discarded.
+		batch_exp_table<Abi, data::table_bits>(k_block.data(), data::tab.data(), tail_block.data(), scale_block.data(), n);
+
+		const auto & poly = internal::impl::pow_exp_poly_dbl;
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t k		 = batch_load<Abi>(k_block.data() + i) - simd_t(data::shift);
+			const simd_t rem_big = batch_load<Abi>(expo_hi_block.data() + i) + k * simd_t(data::negln2hiN);
+			const simd_t rem_low = batch_load<Abi>(expo_lo_block.data() + i) + k * simd_t(data::negln2loN);
+
+			// Knuth's two-sum: expo_lo can exceed the reduced high part.
+			const simd_t rem_hi	   = rem_big + rem_low;
+			const simd_t b_virtual = rem_hi - rem_big;
+			const simd_t a_virtual = rem_hi - b_virtual;
+			const simd_t rem_lo	   = (rem_big - a_virtual) + (rem_low - b_virtual);
+
+			const simd_t tail	  = batch_load<Abi>(tail_block.data() + i);
+			const simd_t scale	  = batch_load<Abi>(scale_block.data() + i);
+			const simd_t rem_sqr  = rem_hi * rem_hi;
+			const simd_t exp_poly = rem_sqr * (simd_t(poly[0]) + rem_hi * simd_t(poly[1]) + rem_sqr * (simd_t(poly[2]) + rem_hi * simd_t(poly[3]) + rem_sqr * simd_t(poly[4])));
+			const simd_t small	  = exp_poly + rem_lo * (simd_t(1.0) + rem_hi) + tail + tail * rem_hi;
+
+			simd_t one_plus_hi;
+			simd_t one_plus_lo;
+			pow_exact_add<Abi>(simd_t(1.0), rem_hi, one_plus_hi, one_plus_lo);
+			simd_t result_hi;
+			simd_t result_lo;
+			batch_exact_mult<Abi>(scale, one_plus_hi, result_hi, result_lo);
+			result_lo = result_lo + scale * (one_plus_lo + small);
+
+			// The rounding test of pow_double_core: the result is kept when both ends of its error interval round the same way.
+			const simd_t abs_expo = intrin::abs(batch_load<Abi>(expo_hi_block.data() + i));
+			const simd_t error	  = result_hi * (simd_t(internal::impl::pow_fast_error_dbl) + abs_expo * simd_t(internal::impl::pow_fast_log_error_dbl));
+			const simd_t upper	  = result_hi + (result_lo + error);
+			const simd_t in_range = batch_load<Abi>(valid + i);
+			batch_store<Abi>((in_range != simd_t(0.0)) && (upper == result_hi + (result_lo - error)), valid + i);
+			batch_store<Abi>(upper, out + i);
+		}
+	}
+
+	/**
+	 * @brief Apply the pow block kernels over arrays.
+	 *
+	 * Positive finite bases with finite exponents run the double-double log and exp of ccm::pow in SIMD lanes. Every
+	 * other lane, integer and half exponents in an exponent array, and the rare lane whose result the fast pass cannot round
+	 * call the scalar ccm::pow. A scalar base
+	 * has its log computed once, leaving only the exp per element. Float operands are widened to double lanes, which
+	 * is how the scalar float pow evaluates them too.
+	 */
+	template <pow_operands Operands, class Abi, typename T>
+	CCM_ALWAYS_INLINE void pow_batch_apply(const T * x, const T * y, T * out, std::size_t count) noexcept
+	{
+		constexpr auto width = static_cast<std::size_t>(intrin::simd<double, Abi>::size());
+		static_assert(batch_block_size % width == 0, "The batch block size must be a multiple of the SIMD width.");
+
+		batch_block x_block{};
+		batch_block y_block{};
+		batch_block log_hi{};
+		batch_block log_lo{};
+		batch_block base_valid{};
+		batch_block result{};
+		batch_block valid{};
+
+		if constexpr (Operands == pow_operands::array_scalar) { y_block.fill(static_cast<double>(*y)); }
+		if constexpr (Operands == pow_operands::scalar_array)
+		{
+			const auto base				  = static_cast<double>(*x);
+			const bool is_normal		  = base >= std::numeric_limits<double>::min() && base <= std::numeric_limits<double>::max();
+			const type::DoubleDouble log_base = internal::impl::pow_log_helper(is_normal ? base : 1.0);
+			log_hi.fill(log_base.hi);
+			log_lo.fill(log_base.lo);
+			base_valid.fill(is_normal ? 1.0 : 0.0);
+		}
+
+		std::size_t i = 0;
+		while (i < count)
+		{
+			const std::size_t n = (count - i) < batch_block_size ? (count - i) : batch_block_size;
+			std::size_t padded	= 0;
+			if constexpr (Operands == pow_operands::scalar_array)
+			{
+				for (std::size_t j = 0; j < n; ++j) { y_block[j] = static_cast<double>(y[i + j]); }
+				padded = batch_pad<Abi>(y_block, n);
+				valid  = base_valid;
+			}
+			else
+			{
+				for (std::size_t j = 0; j < n; ++j) { x_block[j] = static_cast<double>(x[i + j]); }
+				padded = batch_pad<Abi>(x_block, n);
+				if constexpr (Operands == pow_operands::array_array)
+				{
+					for (std::size_t j = 0; j < n; ++j) { y_block[j] = static_cast<double>(y[i + j]); }
+					batch_pad<Abi>(y_block, n);
+				}
+				pow_log_simd<Abi>(x_block.data(), log_hi.data(), log_lo.data(), valid.data(), padded);
+			}
+			if constexpr (Operands != pow_operands::array_scalar)
+			{
+				// ccm::pow raises to integer exponents by repeated multiplication and to +-1/2 with the square root, keep those lanes on its path.
+				constexpr auto limit = static_cast<double>(internal::impl::pow_int_fast_path_limit);
+				for (std::size_t j = 0; j < n; ++j)
+				{
+					const double exp = y_block[j];
+					if ((exp >= -limit && exp <= limit && static_cast<double>(static_cast<int>(exp)) == exp) || exp == 0.5 || exp == -0.5) { valid[j] = 0.0; }
+				}
+			}
+			pow_exp_simd<Abi>(log_hi.data(), log_lo.data(), y_block.data(), result.data(), valid.data(), padded);
+
+			for (std::size_t j = 0; j < n; ++j)
+			{
+				const T x_j = Operands == pow_operands::scalar_array ? *x : x[i + j];
+				const T y_j = Operands == pow_operands::array_scalar ? *y : y[i + j];
+				out[i + j]	= valid[j] != 0.0 ? static_cast<T>(result[j]) : ccm::pow(x_j, y_j);
+			}
+			i += n;
+		}
+	}
+
+	/// Signature of a resolved batch pow kernel. Scalar operands are passed as a pointer to one value.
+	template <typename T>
+	using pow_batch_fn = void (*)(const T *, const T *, T *, std::size_t) noexcept;
+
+	template <pow_operands Operands, typename T>
+	void pow_batch_scalar(const T * x, const T * y, T * out, std::size_t count) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			out[i] = ccm::pow(Operands == pow_operands::scalar_array ? *x : x[i], Operands == pow_operands::array_scalar ? *y : y[i]);
+		}
+	}
+
+	template <pow_operands Operands, typename T>
+	void pow_batch_native(const T * x, const T * y, T * out, std::size_t count) noexcept
+	{
+#ifdef CCMATH_HAS_SIMD
+		pow_batch_apply<Operands, intrin::abi::native>(x, y, out, count);
+#else
+		pow_batch_scalar<Operands>(x, y, out, count);
+#endif
+	}
+
+	/**
+	 * @brief Get the batch pow kernel compiled for exactly the given SIMD level.
+	 * @return The kernel, or nullptr if this binary has no kernel for that level.
+	 * @note The exact products pick the fused or the split form at compile time, and a fused multiply-add contracted
+	 * into the split form breaks it, so pow has no target attribute tiers above the compile time target.
+	 */
+	template <pow_operands Operands, typename T>
+	pow_batch_fn<T> pow_batch_kernel_for(simd_level level) noexcept
+	{
+		if (level == simd_level::scalar) { return &pow_batch_scalar<Operands, T>; }
+		if (level == compiled_simd_level()) { return &pow_batch_native<Operands, T>; }
+		return nullptr;
+	}
+
+	/// Resolve the fastest batch pow kernel for the host. The choice is made once per process, see select_batch_kernel.
+	template <pow_operands Operands, typename T>
+	pow_batch_fn<T> resolve_pow_batch_kernel() noexcept
+	{
+		static const pow_batch_fn<T> kernel = select_batch_kernel(&pow_batch_kernel_for<Operands, T>);
+		return kernel;
+	}
+} // namespace ccm::rt::simd_impl
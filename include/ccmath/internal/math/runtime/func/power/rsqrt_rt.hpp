@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/math/runtime/func/power/sqrt_rt.hpp"
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#include <type_traits>
+
+namespace ccm::rt
+{
+	/**
+	 * @brief The hardware estimate of 1/sqrt(num) for a single value, matching intrin::rsqrt_estimate of the native ABI.
+	 *
+	 * One rsqrtss (rsqrt14 with AVX-512) or frsqrte on the scalar register instead of a broadcast to the full native width.
+	 * Double on x86 without AVX-512 has no estimate instruction and divides by the square root instead, as does every
+	 * type when runtime SIMD is disabled.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	[[nodiscard]] inline T rsqrt_estimate_rt(T num) noexcept
+	{
+#if defined(CCMATH_HAS_SIMD_AVX512F)
+		if constexpr (std::is_same_v<T, float>)
+		{
+			const __m128 num_m = _mm_set_ss(num);
+			return _mm_cvtss_f32(_mm_rsqrt14_ss(num_m, num_m));
+		}
+		else
+		{
+			const __m128d num_m = _mm_set_sd(num);
+			return _mm_cvtsd_f64(_mm_rsqrt14_sd(num_m, num_m));
+		}
+#elif defined(CCMATH_HAS_SIMD_SSE2)
+		if constexpr (std::is_same_v<T, float>) { return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(num))); }
+		else { return 1.0 / sqrt_rt(num); }
+#elif defined(CCMATH_HAS_SIMD_NEON) && defined(__aarch64__)
+		if constexpr (std::is_same_v<T, float>) { return vrsqrtes_f32(num); }
+		else { return vrsqrted_f64(num); }
+#else
+		return intrin::rsqrt_estimate(intrin::simd<T, intrin::abi::scalar>(num)).get();
+#endif
+	}
+
+	/// rsqrt_estimate_rt refined with one step of the same Newton iteration intrin::rsqrt uses.
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	[[nodiscard]] inline T rsqrt_newton_rt(T num) noexcept
+	{
+		using scalar_t = intrin::simd<T, intrin::abi::scalar>;
+		return intrin::internal::rsqrt_newton(scalar_t(num), scalar_t(rsqrt_estimate_rt(num))).get();
+	}
+} // namespace ccm::rt
@@ -12,6 +12,7 @@
 
 #include "ccmath/internal/config/type_support.hpp"
 #include "ccmath/internal/math/generic/func/power/sqrt_gen.hpp"
+#include "ccmath/internal/math/runtime/func/dispatch_rt.hpp"
 #include "ccmath/internal/math/runtime/simd/func/sqrt.hpp"
 #include "ccmath/internal/support/always_false.hpp"
 #include "ccmath/internal/support/bits.hpp"
@@ -19,8 +20,13 @@
 #include "ccmath/internal/support/fp/fp_bits.hpp"
 #include "ccmath/internal/support/is_constant_evaluated.hpp"
 
+#include <cstddef>
 #include <type_traits>
 
+#if defined(CCM_DISPATCH_HAS_AVX2_TIER) || defined(CCM_DISPATCH_HAS_AVX512_TIER)
+	#include <immintrin.h>
+#endif
+
 namespace ccm::rt::simd_impl
 {
 #if defined(CCM_TYPES_LONG_DOUBLE_IS_FLOAT64)
@@ -38,9 +44,22 @@ namespace ccm::rt::simd_impl
 	#endif
 	[[nodiscard]] inline T sqrt_simd_impl(T num) noexcept
 	{
+		// A single sqrtsd, sqrtss or fsqrt on the scalar register instead of a broadcast to the full native width.
+	#if defined(CCMATH_HAS_SIMD_SSE2)
+		if constexpr (std::is_same_v<T, float>) { return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(num))); }
+		else
+		{
+			const __m128d num_m = _mm_set_sd(static_cast<double>(num));
+			return static_cast<T>(_mm_cvtsd_f64(_mm_sqrt_sd(num_m, num_m)));
+		}
+	#elif defined(CCMATH_HAS_SIMD_NEON) && defined(__aarch64__)
+		if constexpr (std::is_same_v<T, float>) { return vget_lane_f32(vsqrt_f32(vdup_n_f32(num)), 0); }
+		else { return static_cast<T>(vget_lane_f64(vsqrt_f64(vdup_n_f64(static_cast<double>(num))), 0)); }
+	#else
 		intrin::simd<T, intrin::abi::native> const num_m(num);
 		intrin::simd<T, intrin::abi::native> const sqrt_m = intrin::sqrt(num_m);
 		return sqrt_m.convert();
+	#endif
 	}
 #endif
 } // namespace ccm::rt::simd_impl
@@ -71,3 +90,114 @@ namespace ccm::rt
 #endif
 	}
 } // namespace ccm::rt
+
+namespace ccm::rt::simd_impl
+{
+	/// Stream whole vectors of Abi through intrin::sqrt. The tail shorter than a vector is one masked or zero filled vector.
+	template <class Abi, typename T>
+	CCM_ALWAYS_INLINE void sqrt_batch_loop(const T * in, T * out, std::size_t count) noexcept
+	{
+		using simd_t		 = intrin::simd<T, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		std::size_t i = 0;
+		for (; i + width <= count; i += width) { intrin::sqrt(simd_t(in + i, intrin::element_aligned_tag())).copy_to(out + i, intrin::element_aligned_tag()); }
+		if (i < count)
+		{
+			const auto tail = static_cast<int>(count - i);
+			intrin::store_partial(intrin::sqrt(intrin::load_partial<simd_t>(in + i, tail)), out + i, tail);
+		}
+	}
+
+	template <typename T>
+	void sqrt_batch_scalar(const T * in, T * out, std::size_t count) noexcept
+	{
+		for (std::size_t i = 0; i < count; ++i) { out[i] = sqrt_rt(in[i]); }
+	}
+
+	template <typename T>
+	void sqrt_batch_native(const T * in, T * out, std::size_t count) noexcept
+	{
+#ifdef CCMATH_HAS_SIMD
+		sqrt_batch_loop<intrin::abi::native>(in, out, count);
+#else
+		sqrt_batch_scalar<T>(in, out, count);
+#endif
+	}
+
+#ifdef CCM_DISPATCH_HAS_AVX2_TIER
+	template <typename T>
+	CCM_TARGET("avx2,fma") void sqrt_batch_avx2(const T * in, T * out, std::size_t count) noexcept
+	{
+		std::size_t i = 0;
+		if constexpr (std::is_same_v<T, double>)
+		{
+			for (; i + 4 <= count; i += 4) { _mm256_storeu_pd(out + i, _mm256_sqrt_pd(_mm256_loadu_pd(in + i))); }
+			for (; i < count; ++i)
+			{
+				const __m128d x = _mm_set_sd(in[i]);
+				out[i]			= _mm_cvtsd_f64(_mm_sqrt_sd(x, x));
+			}
+		}
+		else
+		{
+			for (; i + 8 <= count; i += 8) { _mm256_storeu_ps(out + i, _mm256_sqrt_ps(_mm256_loadu_ps(in + i))); }
+			for (; i < count; ++i) { out[i] = _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(in[i]))); }
+		}
+	}
+#endif
+
+#ifdef CCM_DISPATCH_HAS_AVX512_TIER
+	/// Whole vectors take the square root under a full mask and the tail under the load mask, so no lane has an undefined source.
+	template <typename T>
+	CCM_TARGET("avx512f") void sqrt_batch_avx512(const T * in, T * out, std::size_t count) noexcept
+	{
+		std::size_t i = 0;
+		if constexpr (std::is_same_v<T, double>)
+		{
+			for (; i + 8 <= count; i += 8) { _mm512_storeu_pd(out + i, _mm512_maskz_sqrt_pd(0xFF, _mm512_loadu_pd(in + i))); }
+			if (i < count)
+			{
+				const auto mask = static_cast<__mmask8>((1U << (count - i)) - 1U);
+				_mm512_mask_storeu_pd(out + i, mask, _mm512_maskz_sqrt_pd(mask, _mm512_maskz_loadu_pd(mask, in + i)));
+			}
+		}
+		else
+		{
+			for (; i + 16 <= count; i += 16) { _mm512_storeu_ps(out + i, _mm512_maskz_sqrt_ps(0xFFFF, _mm512_loadu_ps(in + i))); }
+			if (i < count)
+			{
+				const auto mask = static_cast<__mmask16>((1U << (count - i)) - 1U);
+				_mm512_mask_storeu_ps(out + i, mask, _mm512_maskz_sqrt_ps(mask, _mm512_maskz_loadu_ps(mask, in + i)));
+			}
+		}
+	}
+#endif
+
+	/**
+	 * @brief Get the array sqrt kernel compiled for exactly the given SIMD level.
+	 * @return The kernel, or nullptr if this binary has no kernel for that level.
+	 * @note The returned kernel may use instructions the host does not support. Check supports_simd_level before calling it.
+	 */
+	template <typename T>
+	batch_fn<T> sqrt_batch_kernel_for(simd_level level) noexcept
+	{
+		if (level == simd_level::scalar) { return &sqrt_batch_scalar<T>; }
+		if (level == compiled_simd_level()) { return &sqrt_batch_native<T>; }
+#ifdef CCM_DISPATCH_HAS_AVX2_TIER
+		if (level == simd_level::avx2) { return &sqrt_batch_avx2<T>; }
+#endif
+#ifdef CCM_DISPATCH_HAS_AVX512_TIER
+		if (level == simd_level::avx512) { return &sqrt_batch_avx512<T>; }
+#endif
+		return nullptr;
+	}
+
+	/// Resolve the fastest array sqrt kernel for the host. The choice is made once per process, see select_batch_kernel.
+	template <typename T>
+	batch_fn<T> resolve_sqrt_batch_kernel() noexcept
+	{
+		static const batch_fn<T> kernel = select_batch_kernel(&sqrt_batch_kernel_for<T>);
+		return kernel;
+	}
+} // namespace ccm::rt::simd_impl
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/trig/atan2_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/inverse_trig_kernels_gen.hpp"
+#include "ccmath/internal/math/runtime/func/batch_rt.hpp"
+#include "ccmath/internal/math/runtime/func/power/hypot_rt.hpp"
+
+#include <cstddef>
+
+namespace ccm::rt::simd_impl
+{
+	/// Largest ratio between |y| and |x| the vector path accepts, see gen::internal::atan2_exponent_gap.
+	constexpr double atan2_batch_max_ratio = 0x1p60;
+
+	/// Vector form of gen::internal::atan_poly_tail.
+	template <class Abi>
+	CCM_ALWAYS_INLINE intrin::simd<double, Abi> atan_poly_tail_simd(intrin::simd<double, Abi> const & x) noexcept
+	{
+		using simd_t	= intrin::simd<double, Abi>;
+		const auto & a	= gen::internal::atan_poly;
+		const simd_t z	= x * x;
+		const simd_t w	= z * z;
+		const simd_t s1 = z * (simd_t(a[0]) + w * (simd_t(a[2]) + w * (simd_t(a[4]) + w * (simd_t(a[6]) + w * (simd_t(a[8]) + w * simd_t(a[10]))))));
+		const simd_t s2 = w * (simd_t(a[1]) + w * (simd_t(a[3]) + w * (simd_t(a[5]) + w * (simd_t(a[7]) + w * simd_t(a[9])))));
+		return x * (s1 + s2);
+	}
+
+	/**
+	 * @brief Vector form of gen::internal::atan_kernel_parts.
+	 *
+	 * Every interval reduces with (a * scale - shift) / (base + a * slope), so the interval only picks four coefficients
+	 * and the centre by masked moves. The first interval uses the identity reduction and a zero centre, which gives the
+	 * same result as the scalar kernel.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void atan_parts_simd(intrin::simd<double, Abi> const & a, intrin::simd<double, Abi> const & tail, intrin::simd<double, Abi> & head,
+										   intrin::simd<double, Abi> & rest) noexcept
+	{
+		using simd_t		   = intrin::simd<double, Abi>;
+		const auto & breaks	   = gen::internal::atan_breakpoints;
+		const auto & centre_hi = gen::internal::atan_centre_hi;
+		const auto & centre_lo = gen::internal::atan_centre_lo;
+
+		// Intervals 0 to 4 in the order of the scalar kernel: identity, 1/2, 1, 3/2 and infinity.
+		simd_t scale(1.0);
+		simd_t shift(0.0);
+		simd_t base(1.0);
+		simd_t slope(0.0);
+		simd_t hi(0.0);
+		simd_t lo(0.0);
+
+		const auto m1 = a >= simd_t(breaks[0]);
+		const auto m2 = a >= simd_t(breaks[1]);
+		const auto m3 = a >= simd_t(breaks[2]);
+		const auto m4 = a >= simd_t(breaks[3]);
+		intrin::where(m1, scale) = simd_t(2.0);
+		intrin::where(m1, shift) = simd_t(1.0);
+		intrin::where(m1, base)	 = simd_t(2.0);
+		intrin::where(m1, slope) = simd_t(1.0);
+		intrin::where(m1, hi)	 = simd_t(centre_hi[0]);
+		intrin::where(m1, lo)	 = simd_t(centre_lo[0]);
+		intrin::where(m2, scale) = simd_t(1.0);
+		intrin::where(m2, base)	 = simd_t(1.0);
+		intrin::where(m2, hi)	 = simd_t(centre_hi[1]);
+		intrin::where(m2, lo)	 = simd_t(centre_lo[1]);
+		intrin::where(m3, shift) = simd_t(1.5);
+		intrin::where(m3, slope) = simd_t(1.5);
+		intrin::where(m3, hi)	 = simd_t(centre_hi[2]);
+		intrin::where(m3, lo)	 = simd_t(centre_lo[2]);
+		intrin::where(m4, scale) = simd_t(0.0);
+		intrin::where(m4, shift) = simd_t(1.0);
+		intrin::where(m4, base)	 = simd_t(0.0);
+		intrin::where(m4, slope) = simd_t(1.0);
+		intrin::where(m4, hi)	 = simd_t(centre_hi[3]);
+		intrin::where(m4, lo)	 = simd_t(centre_lo[3]);
+
+		const simd_t reduced	= (a * scale - shift) / (base + a * slope);
+		const simd_t correction = tail / (simd_t(1.0) + a * a);
+		head					= hi;
+		rest					= ((atan_poly_tail_simd<Abi>(reduced) - lo) - correction) - reduced;
+	}
+
+	/**
+	 * @brief Block atan2 and, when r is not null, the radius sqrt(x^2 + y^2) of the same points.
+	 *
+	 * Follows gen::internal::atan2_finite_kernel. The rounding error of |y| / |x| is recovered with an exact product and
+	 * the quadrant is fixed up with masked moves: the left half plane takes pi - atan, formed with its rounding error,
+	 * and the sign of y is copied last, which also gives atan2(+-0, x) for the zero lanes. The radius is hypot_simd.
+	 * Lanes with x zero, not finite, or outside [2^-500, 2^500], with y neither zero nor inside that range, or with a
+	 * ratio beyond 2^60 are left to the scalar kernel.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void atan2_simd(const double * y, const double * x, double * r, double * theta, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		const simd_t range_min(gen::internal::atan2_exact_min);
+		const simd_t range_max(gen::internal::atan2_exact_max);
+		const simd_t zero(0.0);
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t yv = batch_load<Abi>(y + i);
+			const simd_t xv = batch_load<Abi>(x + i);
+			const simd_t ay = intrin::abs(yv);
+			const simd_t ax = intrin::abs(xv);
+
+			const auto x_in_range = (ax >= range_min) && (ax <= range_max);
+			const auto y_in_range = (ay == zero) || ((ay >= range_min) && (ay <= range_max) && (ay <= ax * simd_t(atan2_batch_max_ratio)) &&
+													 (ax <= ay * simd_t(atan2_batch_max_ratio)));
+			batch_store<Abi>(x_in_range && y_in_range, valid + i);
+
+			const simd_t t = ay / ax;
+			simd_t product_hi;
+			simd_t product_lo;
+			batch_exact_mult<Abi>(t, ax, product_hi, product_lo);
+			const simd_t tail = ((ay - product_hi) - product_lo) / ax;
+
+			simd_t head;
+			simd_t rest;
+			atan_parts_simd<Abi>(t, tail, head, rest);
+
+			const simd_t pi_hi(gen::internal::inverse_trig_pi_hi);
+			const simd_t sum = pi_hi - head;
+			const simd_t err = (pi_hi - sum) - head;
+
+			simd_t result								= head - rest;
+			intrin::where(xv < zero, result)			= sum + ((err + rest) + simd_t(gen::internal::inverse_trig_pi_lo));
+			batch_store<Abi>(intrin::copysign(result, yv), theta + i);
+
+			if (r != nullptr) { batch_store<Abi>(hypot_simd<Abi>(xv, yv), r + i); }
+		}
+	}
+
+	/// Kernels used by ccm::batch::atan2. The first input is y, the second x.
+	struct atan2_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * y, const double * x, double * theta, double * valid, std::size_t n) noexcept
+		{
+			atan2_simd<Abi>(y, x, nullptr, theta, valid, n);
+		}
+
+		template <typename T>
+		static T scalar(T y, T x) noexcept
+		{
+			return gen::atan2_gen<T>(y, x);
+		}
+	};
+
+	/// Kernels used by ccm::batch::polar. The first input is x, the second y.
+	struct polar_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, const double * y, double * r, double * theta, double * valid, std::size_t n) noexcept
+		{
+			atan2_simd<Abi>(y, x, r, theta, valid, n);
+		}
+
+		template <typename T>
+		static void scalar(T x, T y, T * r, T * theta) noexcept
+		{
+			*r	   = gen::hypot_gen<T>(x, y);
+			*theta = gen::atan2_gen<T>(y, x);
+		}
+	};
+} // namespace ccm::rt::simd_impl
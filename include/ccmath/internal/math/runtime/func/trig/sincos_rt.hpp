@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/trig/cos_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/rem_pio2_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/sin_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/sincos_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/tan_gen.hpp"
+#include "ccmath/internal/math/generic/func/trig/trig_kernels_gen.hpp"
+#include "ccmath/internal/math/runtime/func/batch_rt.hpp"
+#include "ccmath/internal/support/bits.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace ccm::rt::simd_impl
+{
+	/// Lanes above this magnitude are left to the scalar Payne-Hanek reduction.
+	constexpr double trig_batch_max_abs = 0x1p20;
+
+	/// Lanes whose reduced argument is smaller than this lose too many bits to cancellation and are left to the scalar reduction.
+	constexpr double trig_batch_min_reduced_sqr = 0x1p-54;
+
+	/**
+	 * @brief Vector Cody-Waite reduction of a block by multiples of pi/2.
+	 *
+	 * Writes the double-double remainder to hi and lo, the quadrant of every lane to quadrant, and marks lanes with
+	 * |x| >= 2^20, non-finite lanes and lanes that land too close to a multiple of pi/2 as invalid.
+	 * The quadrant is read from the bits of the rounded multiple in a scalar pass, as the ABIs have no integer lanes.
+	 */
+	template <class Abi>
+	CCM_ALWAYS_INLINE void rem_pio2_simd(const double * x, double * hi, double * lo, std::uint32_t * quadrant, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		// k + 0x1.8p52 holds k in its low mantissa bits.
+		batch_block shifted_k;
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t xv = batch_load<Abi>(x + i);
+			batch_store<Abi>(xv * simd_t(gen::internal::rem_pio2_invpio2) + simd_t(gen::internal::rem_pio2_toint), shifted_k.data() + i);
+		}
+
+		for (std::size_t i = 0; i < n; ++i) { quadrant[i] = static_cast<std::uint32_t>(support::double_to_uint64(shifted_k[i])) & 3U; }
+
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t xv = batch_load<Abi>(x + i);
+			const simd_t k	= batch_load<Abi>(shifted_k.data() + i) - simd_t(gen::internal::rem_pio2_toint);
+
+			// k * pio2_1, k * pio2_2 and k * pio2_3 are exact, and so is x - k * pio2_1.
+			const simd_t r1 = xv - k * simd_t(gen::internal::rem_pio2_pio2_1);
+			const simd_t p2 = k * simd_t(gen::internal::rem_pio2_pio2_2);
+
+			// Two-sum of r1 - p2, as r1 may be smaller than p2 near a multiple of pi/2.
+			const simd_t r2	  = r1 - p2;
+			const simd_t diff = r2 - r1;
+			const simd_t err2 = (r1 - (r2 - diff)) - (p2 + diff);
+
+			const simd_t tail = (err2 - k * simd_t(gen::internal::rem_pio2_pio2_3)) - k * simd_t(gen::internal::rem_pio2_pio2_3t);
+			const simd_t h	  = r2 + tail;
+			batch_store<Abi>(h, hi + i);
+			batch_store<Abi>((r2 - h) + tail, lo + i);
+
+			const auto in_range = (xv < simd_t(trig_batch_max_abs)) && (simd_t(-trig_batch_max_abs) < xv);
+			batch_store<Abi>(in_range && !(h * h < simd_t(trig_batch_min_reduced_sqr)), valid + i);
+		}
+	}
+
+	/// Lane signs and swaps for a block of quadrants. sin(x) = sin_sign * (swap ? cos(r) : sin(r)) and cos(x) = cos_sign * (swap ? sin(r) : cos(r)).
+	CCM_ALWAYS_INLINE void sincos_quadrant_signs(const std::uint32_t * quadrant, double * swap, double * sin_sign, double * cos_sign, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			const std::uint32_t q = quadrant[i];
+			swap[i]				  = static_cast<double>(q & 1U);
+			sin_sign[i]			  = (q & 2U) != 0 ? -1.0 : 1.0;
+			cos_sign[i]			  = ((q + 1U) & 2U) != 0 ? -1.0 : 1.0;
+		}
+	}
+
+	/**
+	 * @brief Block sine and cosine sharing one reduction. Either output may be null when it is not needed.
+	 *
+	 * Both polynomials are evaluated for every lane and the quadrant picks between them, so no lane branches.
+	 */
+	template <class Abi, typename T>
+	CCM_ALWAYS_INLINE void sincos_simd(const double * x, double * sin_y, double * cos_y, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		batch_block hi_block;
+		batch_block lo_block;
+		batch_block swap_block;
+		batch_block sin_sign_block;
+		batch_block cos_sign_block;
+		std::uint32_t quadrant[batch_block_size]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+
+		rem_pio2_simd<Abi>(x, hi_block.data(), lo_block.data(), quadrant, valid, n);
+		sincos_quadrant_signs(quadrant, swap_block.data(), sin_sign_block.data(), cos_sign_block.data(), n);
+
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t r = batch_load<Abi>(hi_block.data() + i);
+			const simd_t z = r * r;
+			const simd_t w = z * z;
+			simd_t s;
+			simd_t c;
+			if constexpr (std::is_same_v<T, float>)
+			{
+				// The float kernels ignore the tail, the head alone is accurate to far more than float precision.
+				using namespace gen::internal;
+				const simd_t sz = z * r;
+				s = (r + sz * (simd_t(sinf_kernel_s1) + z * simd_t(sinf_kernel_s2))) + sz * w * (simd_t(sinf_kernel_s3) + z * simd_t(sinf_kernel_s4));
+				c = ((simd_t(1.0) + z * simd_t(cosf_kernel_c0)) + w * simd_t(cosf_kernel_c1)) + (w * z) * (simd_t(cosf_kernel_c2) + z * simd_t(cosf_kernel_c3));
+			}
+			else
+			{
+				using namespace gen::internal;
+				const simd_t y = batch_load<Abi>(lo_block.data() + i);
+
+				// gen::internal::sin_kernel with a tail.
+				const simd_t sr = simd_t(sin_kernel_s2) + z * (simd_t(sin_kernel_s3) + z * simd_t(sin_kernel_s4)) +
+								  z * w * (simd_t(sin_kernel_s5) + z * simd_t(sin_kernel_s6));
+				const simd_t v = z * r;
+				s			   = r - ((z * (simd_t(0.5) * y - v * sr) - y) - v * simd_t(sin_kernel_s1));
+
+				// gen::internal::cos_kernel.
+				const simd_t cr = z * (simd_t(cos_kernel_c1) + z * (simd_t(cos_kernel_c2) + z * simd_t(cos_kernel_c3))) +
+								  w * w * (simd_t(cos_kernel_c4) + z * (simd_t(cos_kernel_c5) + z * simd_t(cos_kernel_c6)));
+				const simd_t hz = simd_t(0.5) * z;
+				const simd_t cw = simd_t(1.0) - hz;
+				c				= cw + (((simd_t(1.0) - cw) - hz) + (z * cr - r * y));
+			}
+
+			const auto swap = batch_load<Abi>(swap_block.data() + i) == simd_t(1.0);
+			if (sin_y != nullptr) { batch_store<Abi>(intrin::choose(swap, c, s) * batch_load<Abi>(sin_sign_block.data() + i), sin_y + i); }
+			if (cos_y != nullptr) { batch_store<Abi>(intrin::choose(swap, s, c) * batch_load<Abi>(cos_sign_block.data() + i), cos_y + i); }
+		}
+	}
+
+	/**
+	 * @brief Block tangent. Follows gen::internal::tan_kernel with both of its branches evaluated and merged per lane with masked moves.
+	 *
+	 * The accurate -1/tan for odd quadrants takes the rounding error of a * tw from batch_exact_mult instead of clearing bits.
+	 */
+	template <class Abi, typename T>
+	CCM_ALWAYS_INLINE void tan_simd(const double * x, double * y, double * valid, std::size_t n) noexcept
+	{
+		using simd_t		 = intrin::simd<double, Abi>;
+		constexpr auto width = static_cast<std::size_t>(simd_t::size());
+
+		batch_block hi_block;
+		batch_block lo_block;
+		batch_block odd_block;
+		std::uint32_t quadrant[batch_block_size]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+
+		rem_pio2_simd<Abi>(x, hi_block.data(), lo_block.data(), quadrant, valid, n);
+		for (std::size_t i = 0; i < n; ++i) { odd_block[i] = static_cast<double>(quadrant[i] & 1U); }
+
+		for (std::size_t i = 0; i < n; i += width)
+		{
+			const simd_t hi = batch_load<Abi>(hi_block.data() + i);
+			const auto odd	= batch_load<Abi>(odd_block.data() + i) == simd_t(1.0);
+
+			if constexpr (std::is_same_v<T, float>)
+			{
+				const auto & t	= gen::internal::tanf_kernel_coeffs;
+				const simd_t z	= hi * hi;
+				const simd_t w	= z * z;
+				const simd_t s	= z * hi;
+				const simd_t tv = (hi + s * (simd_t(t[0]) + z * simd_t(t[1]))) + (s * w) * ((simd_t(t[2]) + z * simd_t(t[3])) + w * (simd_t(t[4]) + z * simd_t(t[5])));
+				simd_t result	= tv;
+				intrin::where(odd, result) = simd_t(-1.0) / tv;
+				batch_store<Abi>(result, y + i);
+			}
+			else
+			{
+				const auto & t = gen::internal::tan_kernel_coeffs;
+				const simd_t lo = batch_load<Abi>(lo_block.data() + i);
+
+				// Above 0.6744 tan(x) is evaluated as tan(pi/4 - |x|).
+				const auto neg = hi < simd_t(0.0);
+				const auto big = (simd_t(0.6744) < hi) || (hi < simd_t(-0.6744));
+				simd_t sign(1.0);
+				intrin::where(neg, sign) = simd_t(-1.0);
+				simd_t xr = hi;
+				simd_t yr = lo;
+				intrin::where(big, xr) = (simd_t(gen::internal::tan_kernel_pio4) - sign * hi) + (simd_t(gen::internal::tan_kernel_pio4lo) - sign * lo);
+				intrin::where(big, yr) = simd_t(0.0);
+
+				const simd_t z = xr * xr;
+				const simd_t w = z * z;
+				simd_t r	   = simd_t(t[1]) + w * (simd_t(t[3]) + w * (simd_t(t[5]) + w * (simd_t(t[7]) + w * (simd_t(t[9]) + w * simd_t(t[11])))));
+				const simd_t v = z * (simd_t(t[2]) + w * (simd_t(t[4]) + w * (simd_t(t[6]) + w * (simd_t(t[8]) + w * (simd_t(t[10]) + w * simd_t(t[12]))))));
+				const simd_t s = z * xr;
+				r			   = yr + z * (s * (r + v) + yr) + simd_t(t[0]) * s;
+				const simd_t tw = xr + r;
+
+				simd_t one(1.0);
+				intrin::where(odd, one) = simd_t(-1.0);
+				const simd_t big_value = sign * (one - simd_t(2.0) * (xr - (tw * tw / (tw + one) - r)));
+
+				// -1/(xr + r) = a + a * (1 + a * tw) + a * a * e, where a = -1/tw and e is the rounding error of tw.
+				const simd_t e = r - (tw - xr);
+				const simd_t a = simd_t(-1.0) / tw;
+				simd_t product_hi;
+				simd_t product_lo;
+				batch_exact_mult<Abi>(a, tw, product_hi, product_lo);
+				const simd_t residual = (simd_t(1.0) + product_hi) + product_lo;
+				const simd_t inverse  = a + a * (residual + a * e);
+
+				simd_t result = tw;
+				intrin::where(odd, result) = inverse;
+				intrin::where(big, result) = big_value;
+				batch_store<Abi>(result, y + i);
+			}
+		}
+	}
+
+	/// Kernels used by ccm::batch::sin.
+	struct sin_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, double * y, double * valid, std::size_t n) noexcept
+		{
+			sincos_simd<Abi, T>(x, y, nullptr, valid, n);
+		}
+
+		template <typename T>
+		static T scalar(T x) noexcept
+		{
+			return gen::sin_gen<T>(x);
+		}
+	};
+
+	/// Kernels used by ccm::batch::cos.
+	struct cos_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, double * y, double * valid, std::size_t n) noexcept
+		{
+			sincos_simd<Abi, T>(x, nullptr, y, valid, n);
+		}
+
+		template <typename T>
+		static T scalar(T x) noexcept
+		{
+			return gen::cos_gen<T>(x);
+		}
+	};
+
+	/// Kernels used by ccm::batch::sincos.
+	struct sincos_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, double * sin_y, double * cos_y, double * valid, std::size_t n) noexcept
+		{
+			sincos_simd<Abi, T>(x, sin_y, cos_y, valid, n);
+		}
+
+		template <typename T>
+		static void scalar(T x, T * sin_y, T * cos_y) noexcept
+		{
+			gen::sincos_gen<T>(x, sin_y, cos_y);
+		}
+	};
+
+	/// Kernels used by ccm::batch::tan.
+	struct tan_batch_kernel
+	{
+		template <class Abi, typename T>
+		static CCM_ALWAYS_INLINE void block(const double * x, double * y, double * valid, std::size_t n) noexcept
+		{
+			tan_simd<Abi, T>(x, y, valid, n);
+		}
+
+		template <typename T>
+		static T scalar(T x) noexcept
+		{
+			return gen::tan_gen<T>(x);
+		}
+	};
+} // namespace ccm::rt::simd_impl
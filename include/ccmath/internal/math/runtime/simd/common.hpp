@@ -11,8 +11,12 @@
 
 #include "ccmath/internal/predef/attributes/always_inline.hpp"
 #include "ccmath/internal/predef/attributes/gpu_host_device.hpp"
+#include "ccmath/internal/support/bits.hpp"
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 namespace ccm::intrin
 {
@@ -26,6 +30,11 @@ namespace ccm::intrin
 	{
 	};
 
+	/// Loads and stores from an address aligned to the full width of the simd type. Uses aligned moves where the ABI has them.
+	struct vector_aligned_tag
+	{
+	};
+
 	template <class T>
 	CCM_GPU_HOST_DEVICE constexpr T const & choose(bool a, T const & b, T const & c)
 	{
@@ -108,6 +117,271 @@ namespace ccm::intrin
 		return a / simd<T, Abi>(b);
 	}
 
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, Abi> & operator&=(simd<T, Abi> & a, simd<T, Abi> const & b)
+	{
+		a = a & b;
+		return a;
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, Abi> & operator|=(simd<T, Abi> & a, simd<T, Abi> const & b)
+	{
+		a = a | b;
+		return a;
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, Abi> & operator^=(simd<T, Abi> & a, simd<T, Abi> const & b)
+	{
+		a = a ^ b;
+		return a;
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, Abi> & operator<<=(simd<T, Abi> & a, int count)
+	{
+		a = a << count;
+		return a;
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, Abi> & operator>>=(simd<T, Abi> & a, int count)
+	{
+		a = a >> count;
+		return a;
+	}
+
+	/// True for the lane types of the integer simd specializations.
+	template <class T>
+	inline constexpr bool is_simd_integer_v = std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::uint32_t> ||
+											  std::is_same_v<T, std::int64_t> || std::is_same_v<T, std::uint64_t>;
+
+	/**
+	 * @brief Reinterpret the bits of a simd as another simd of the same ABI and lane width, e.g. simd<double, Abi> as
+	 * simd<std::uint64_t, Abi>. Every ABI keeps one register (or one array) per simd, so this compiles to nothing.
+	 * @tparam To The target simd type.
+	 */
+	template <class To, class T, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE To bit_cast(simd<T, Abi> const & from)
+	{
+		static_assert(std::is_same_v<typename To::abi_type, Abi>, "bit_cast only converts between simd types of the same ABI.");
+		static_assert(sizeof(typename To::value_type) == sizeof(T), "bit_cast only converts between lanes of the same width.");
+		return support::bit_cast<To>(from);
+	}
+
+	/**
+	 * @brief Load base[index[i]] into lane i.
+	 *
+	 * The index lanes have the width of the loaded lanes (std::int32_t or std::uint32_t for 32 bit values,
+	 * std::int64_t or std::uint64_t for 64 bit values), so an index computed from bit_cast of the arguments stays in the
+	 * same ABI. ABIs with a gather instruction overload this; the others load one lane at a time.
+	 * @param base The table. Every index must be non-negative and address an element of it.
+	 * @param index The element index of every lane.
+	 */
+	template <class T, class Index, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, Abi> gather(T const * base, simd<Index, Abi> const & index)
+	{
+		static_assert(is_simd_integer_v<Index> && sizeof(Index) == sizeof(T), "gather indices must be integers of the width of the loaded lanes.");
+		std::array<Index, simd<Index, Abi>::size()> offsets;
+		std::array<T, simd<T, Abi>::size()> values;
+		index.copy_to(offsets.data(), element_aligned_tag());
+		for (std::size_t i = 0; i < values.size(); ++i) { values[i] = base[offsets[i]]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		return simd<T, Abi>(values.data(), element_aligned_tag());
+	}
+
+	/**
+	 * @brief Loads and stores of the first count lanes, for the tail of an array that does not fill a whole simd.
+	 *
+	 * ABIs with masked moves specialize this. The generic version goes through a zero filled array one lane at a time.
+	 */
+	template <class T, class Abi>
+	struct simd_partial
+	{
+		static CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, Abi> load(T const * ptr, int count)
+		{
+			std::array<T, simd<T, Abi>::size()> values{};
+			for (int i = 0; i < count; ++i) { values[i] = ptr[i]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return simd<T, Abi>(values.data(), element_aligned_tag());
+		}
+
+		static CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE void store(simd<T, Abi> const & value, T * ptr, int count)
+		{
+			std::array<T, simd<T, Abi>::size()> values;
+			value.copy_to(values.data(), element_aligned_tag());
+			for (int i = 0; i < count; ++i) { ptr[i] = values[i]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		}
+	};
+
+	/**
+	 * @brief Load the first count lanes of V from ptr and set the other lanes to zero.
+	 * @param ptr Start of the elements. Only ptr[0] to ptr[count - 1] are read.
+	 * @param count Number of lanes to load, from 0 to V::size().
+	 */
+	template <class V>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE V load_partial(typename V::value_type const * ptr, int count)
+	{
+		return simd_partial<typename V::value_type, typename V::abi_type>::load(ptr, count);
+	}
+
+	/**
+	 * @brief Store the first count lanes of value to ptr.
+	 * @param count Number of lanes to store, from 0 to the simd size. Nothing past ptr[count - 1] is written.
+	 */
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE void store_partial(simd<T, Abi> const & value, T * ptr, int count)
+	{
+		simd_partial<T, Abi>::store(value, ptr, count);
+	}
+
+	/**
+	 * @brief Arithmetic and stores on the lanes selected by a mask, leaving the other lanes untouched.
+	 *
+	 * ABIs with mask registers specialize this with masked instructions. The generic version computes every lane and
+	 * blends with choose, and stores one lane at a time.
+	 */
+	template <class T, class Abi>
+	struct simd_masked
+	{
+		using simd_type = simd<T, Abi>;
+		using mask_type = simd_mask<T, Abi>;
+
+		static CCM_ALWAYS_INLINE simd_type assign(mask_type const & mask, simd_type const & value, simd_type const & x) { return choose(mask, x, value); }
+		static CCM_ALWAYS_INLINE simd_type add(mask_type const & mask, simd_type const & value, simd_type const & x) { return choose(mask, value + x, value); }
+		static CCM_ALWAYS_INLINE simd_type sub(mask_type const & mask, simd_type const & value, simd_type const & x) { return choose(mask, value - x, value); }
+		static CCM_ALWAYS_INLINE simd_type mul(mask_type const & mask, simd_type const & value, simd_type const & x) { return choose(mask, value * x, value); }
+		static CCM_ALWAYS_INLINE simd_type div(mask_type const & mask, simd_type const & value, simd_type const & x) { return choose(mask, value / x, value); }
+
+		static CCM_ALWAYS_INLINE void store(mask_type const & mask, simd_type const & value, T * ptr)
+		{
+			std::array<T, simd_type::size()> values;
+			std::array<T, simd_type::size()> selected;
+			value.copy_to(values.data(), element_aligned_tag());
+			choose(mask, simd_type(T{1}), simd_type(T{0})).copy_to(selected.data(), element_aligned_tag());
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				if (selected[i] != T{0}) { ptr[i] = values[i]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			}
+		}
+	};
+
+	/// Read only view of the lanes of a simd selected by a mask. Returned by where for a const simd.
+	template <class T, class Abi>
+	class const_where_expression
+	{
+	public:
+		CCM_ALWAYS_INLINE const_where_expression(simd_mask<T, Abi> const & mask, simd<T, Abi> const & value) : m_mask(mask), m_value(value) {}
+
+		/// Store the selected lanes to ptr. Memory of the other lanes is not written. Both alignment tags are accepted.
+		template <class Flags>
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, Flags /*unused*/) const
+		{
+			simd_masked<T, Abi>::store(m_mask, m_value, ptr);
+		}
+
+	private:
+		simd_mask<T, Abi> m_mask;
+		simd<T, Abi> const & m_value;
+	};
+
+	/**
+	 * @brief The lanes of a simd selected by a mask, as returned by where.
+	 *
+	 * where(mask, v) += x adds x to the selected lanes of v only. On AVX-512 this is a single masked instruction.
+	 */
+	template <class T, class Abi>
+	class where_expression
+	{
+	public:
+		CCM_ALWAYS_INLINE where_expression(simd_mask<T, Abi> const & mask, simd<T, Abi> & value) : m_mask(mask), m_value(value) {}
+
+		CCM_ALWAYS_INLINE void operator=(simd<T, Abi> const & x) && { m_value = simd_masked<T, Abi>::assign(m_mask, m_value, x); }
+		CCM_ALWAYS_INLINE void operator+=(simd<T, Abi> const & x) && { m_value = simd_masked<T, Abi>::add(m_mask, m_value, x); }
+		CCM_ALWAYS_INLINE void operator-=(simd<T, Abi> const & x) && { m_value = simd_masked<T, Abi>::sub(m_mask, m_value, x); }
+		CCM_ALWAYS_INLINE void operator*=(simd<T, Abi> const & x) && { m_value = simd_masked<T, Abi>::mul(m_mask, m_value, x); }
+		CCM_ALWAYS_INLINE void operator/=(simd<T, Abi> const & x) && { m_value = simd_masked<T, Abi>::div(m_mask, m_value, x); }
+
+		/// Store the selected lanes to ptr. Memory of the other lanes is not written. Both alignment tags are accepted.
+		template <class Flags>
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, Flags /*unused*/) const
+		{
+			simd_masked<T, Abi>::store(m_mask, m_value, ptr);
+		}
+
+	private:
+		simd_mask<T, Abi> m_mask;
+		simd<T, Abi> & m_value;
+	};
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE where_expression<T, Abi> where(simd_mask<T, Abi> const & mask, simd<T, Abi> & value)
+	{
+		return where_expression<T, Abi>(mask, value);
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE const_where_expression<T, Abi> where(simd_mask<T, Abi> const & mask, simd<T, Abi> const & value)
+	{
+		return const_where_expression<T, Abi>(mask, value);
+	}
+
+	/*
+	 * Horizontal reductions reduce_add, reduce_mul, reduce_min and reduce_max return the sum, product, minimum and maximum
+	 * of the lanes, and prefix_sum returns the inclusive prefix sums: lane i holds the sum of lanes 0 to i. The float and
+	 * double types of the x86 and NEON ABIs implement them with shuffle trees in their instruction files, which combine the
+	 * lanes in a different order than a sequential loop and may round differently. The minimum and maximum of lanes
+	 * holding a NaN are unspecified. The versions below serve every other lane type and go through memory.
+	 */
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE T reduce_add(simd<T, Abi> const & a)
+	{
+		std::array<T, simd<T, Abi>::size()> lanes;
+		a.copy_to(lanes.data(), element_aligned_tag());
+		T result = lanes[0];
+		for (std::size_t i = 1; i < lanes.size(); ++i) { result += lanes[i]; }
+		return result;
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE T reduce_mul(simd<T, Abi> const & a)
+	{
+		std::array<T, simd<T, Abi>::size()> lanes;
+		a.copy_to(lanes.data(), element_aligned_tag());
+		T result = lanes[0];
+		for (std::size_t i = 1; i < lanes.size(); ++i) { result *= lanes[i]; }
+		return result;
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE T reduce_min(simd<T, Abi> const & a)
+	{
+		std::array<T, simd<T, Abi>::size()> lanes;
+		a.copy_to(lanes.data(), element_aligned_tag());
+		T result = lanes[0];
+		for (std::size_t i = 1; i < lanes.size(); ++i) { result = lanes[i] < result ? lanes[i] : result; }
+		return result;
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE T reduce_max(simd<T, Abi> const & a)
+	{
+		std::array<T, simd<T, Abi>::size()> lanes;
+		a.copy_to(lanes.data(), element_aligned_tag());
+		T result = lanes[0];
+		for (std::size_t i = 1; i < lanes.size(); ++i) { result = result < lanes[i] ? lanes[i] : result; }
+		return result;
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, Abi> prefix_sum(simd<T, Abi> const & a)
+	{
+		std::array<T, simd<T, Abi>::size()> lanes;
+		a.copy_to(lanes.data(), element_aligned_tag());
+		for (std::size_t i = 1; i < lanes.size(); ++i) { lanes[i] += lanes[i - 1]; }
+		return simd<T, Abi>(lanes.data(), element_aligned_tag());
+	}
+
 	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE bool all_of(bool a)
 	{
 		return a;
@@ -125,15 +399,15 @@ namespace ccm::intrin
 
 		CCM_ALWAYS_INLINE simd_storage() = default;
 		static constexpr int size() { return simd<T, Abi>::size(); }
-		CCM_ALWAYS_INLINE explicit simd_storage(simd<T, Abi> const & value) { value.copy_to(m_value, element_aligned_tag()); }
+		CCM_ALWAYS_INLINE explicit simd_storage(simd<T, Abi> const & value) { value.copy_to(m_value.data(), element_aligned_tag()); }
 		CCM_ALWAYS_INLINE explicit simd_storage(T value) : simd_storage(simd<T, Abi>(value)) {}
 		CCM_ALWAYS_INLINE simd_storage & operator=(simd<T, Abi> const & value)
 		{
-			value.copy_to(m_value, element_aligned_tag());
+			value.copy_to(m_value.data(), element_aligned_tag());
 			return *this;
 		}
 		CCM_ALWAYS_INLINE T const * data() const { return m_value.data(); }
-		CCM_ALWAYS_INLINE T * data() { return m_value; }
+		CCM_ALWAYS_INLINE T * data() { return m_value.data(); }
 		CCM_ALWAYS_INLINE T const & operator[](int i) const { return m_value[i]; }
 		CCM_ALWAYS_INLINE T & operator[](int i) { return m_value[i]; }
 
@@ -153,4 +427,87 @@ namespace ccm::intrin
 		static constexpr int value = simd<T, Abi>::size();
 	};
 
+	/*
+	 * Besides + - * / and the comparisons < <= > >= == !=, the float and double simd types of every ABI provide:
+	 * - fma(a, b, c) = a * b + c, fms(a, b, c) = a * b - c and fnma(a, b, c) = c - a * b. Fused when the target has FMA.
+	 * - min(a, b) = a < b ? a : b and max(a, b) = b < a ? a : b per lane, so a NaN in either argument gives b.
+	 * - abs(a) and copysign(magnitude, sign), which only touch the sign bit.
+	 * - rsqrt(a) and rcp(a): the hardware estimate refined with Newton steps to within a few ulp. Where there is no
+	 *   estimate instruction for the lane type they divide instead.
+	 * - rsqrt_estimate(a): the bare hardware estimate of 1/sqrt(a), within 1.5 * 2^-12 relative for rsqrtps, 2^-14 for the
+	 *   AVX-512 rsqrt14 forms and about 2^-8 for NEON and SVE frsqrte. Without an estimate instruction it is rsqrt(a).
+	 * - floor, ceil, trunc and round, where round rounds halfway cases away from zero like std::round.
+	 */
+	namespace internal
+	{
+		/// One Newton step on an estimate y of 1/sqrt(x). Lanes where the step breaks down (x zero, infinite or not a number) keep the estimate.
+		template <class V>
+		CCM_ALWAYS_INLINE V rsqrt_newton(V const & x, V const & y)
+		{
+			using T			= typename V::value_type;
+			const V half	= V(static_cast<T>(0.5));
+			const V refined = y + y * (half - half * x * y * y);
+			return choose(refined == refined, refined, y);
+		}
+
+		/// One Newton step on an estimate y of 1/x, keeping the estimate in the same lanes as rsqrt_newton.
+		template <class V>
+		CCM_ALWAYS_INLINE V rcp_newton(V const & x, V const & y)
+		{
+			using T			= typename V::value_type;
+			const V refined = y + y * (V(static_cast<T>(1)) - x * y);
+			return choose(refined == refined, refined, y);
+		}
+
+		/// Smallest magnitude from which every value of T is an integer.
+		template <class T>
+		inline constexpr T integral_threshold = static_cast<T>(sizeof(T) == 8 ? 0x1p52 : 0x1p23);
+
+		/// x rounded to an integer, ties to even, by adding and subtracting integral_threshold. For ABIs without a rounding instruction.
+		template <class V>
+		CCM_ALWAYS_INLINE V nearest_by_addition(V const & x)
+		{
+			const V threshold = V(integral_threshold<typename V::value_type>);
+			const V magnitude = abs(x);
+			return choose(magnitude < threshold, copysign((magnitude + threshold) - threshold, x), x);
+		}
+
+		template <class V>
+		CCM_ALWAYS_INLINE V floor_by_addition(V const & x)
+		{
+			const V nearest = nearest_by_addition(x);
+			return copysign(choose(x < nearest, nearest - V(static_cast<typename V::value_type>(1)), nearest), x);
+		}
+
+		template <class V>
+		CCM_ALWAYS_INLINE V ceil_by_addition(V const & x)
+		{
+			const V nearest = nearest_by_addition(x);
+			return copysign(choose(nearest < x, nearest + V(static_cast<typename V::value_type>(1)), nearest), x);
+		}
+
+		template <class V>
+		CCM_ALWAYS_INLINE V trunc_by_addition(V const & x)
+		{
+			const V magnitude = abs(x);
+			const V nearest	  = nearest_by_addition(magnitude);
+			return copysign(choose(magnitude < nearest, nearest - V(static_cast<typename V::value_type>(1)), nearest), x);
+		}
+
+		/// std::round from the truncated value t of x. x - t is exact, so halfway cases are detected exactly.
+		template <class V>
+		CCM_ALWAYS_INLINE V round_from_trunc(V const & x, V const & t)
+		{
+			using T = typename V::value_type;
+			return copysign(choose(abs(x - t) >= V(static_cast<T>(0.5)), t + copysign(V(static_cast<T>(1)), x), t), x);
+		}
+	} // namespace internal
+
+	/// rsqrt_estimate for the ABIs and lane types without an estimate instruction. The others overload it.
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, Abi> rsqrt_estimate(simd<T, Abi> const & a)
+	{
+		return rsqrt(a);
+	}
+
 } // namespace ccm::intrin
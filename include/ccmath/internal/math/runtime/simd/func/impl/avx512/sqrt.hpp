@@ -16,16 +16,17 @@
 	#ifdef CCMATH_HAS_SIMD_AVX512F
 namespace ccm::intrin
 {
+	// The maskz forms with a full mask, as GCC warns about the undefined source of _mm512_sqrt_ps and _mm512_sqrt_pd.
 	CCM_ALWAYS_INLINE simd<float, abi::avx512> sqrt(simd<float, abi::avx512> const & a)
 	{
 		// NOLINTNEXTLINE(modernize-return-braced-init-list)
-		return simd<float, abi::avx512>(_mm512_sqrt_ps(a.get()));
+		return simd<float, abi::avx512>(_mm512_maskz_sqrt_ps(0xFFFF, a.get()));
 	}
 
 	CCM_ALWAYS_INLINE simd<double, abi::avx512> sqrt(simd<double, abi::avx512> const & a)
 	{
 		// NOLINTNEXTLINE(modernize-return-braced-init-list)
-		return simd<double, abi::avx512>(_mm512_sqrt_pd(a.get()));
+		return simd<double, abi::avx512>(_mm512_maskz_sqrt_pd(0xFF, a.get()));
 	}
 
 } // namespace ccm::intrin
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SVE
+namespace ccm::intrin
+{
+	CCM_ALWAYS_INLINE simd<float, abi::sve> sqrt(simd<float, abi::sve> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<float, abi::sve>(svsqrt_x(svptrue_b32(), a.get()));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::sve> sqrt(simd<double, abi::sve> const & a)
+	{
+		// NOLINTNEXTLINE(modernize-return-braced-init-list)
+		return simd<double, abi::sve>(svsqrt_x(svptrue_b64(), a.get()));
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_SVE
+#endif	   // CCMATH_HAS_SIMD
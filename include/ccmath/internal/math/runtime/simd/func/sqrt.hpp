@@ -48,6 +48,10 @@
 		#include "impl/neon/sqrt.hpp"
 	#endif
 
+	#ifdef CCMATH_HAS_SIMD_SVE
+		#include "impl/sve/sqrt.hpp"
+	#endif
+
 	#ifdef CCMATH_HAS_SIMD_ENABLE_VECTOR_SIZE
 		#include "impl/vector_size/sqrt.hpp"
 	#endif
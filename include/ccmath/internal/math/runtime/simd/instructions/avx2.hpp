@@ -12,6 +12,9 @@
 
 #include "ccmath/internal/config/arch/check_simd_support.hpp"
 #include "ccmath/internal/math/runtime/simd/common.hpp"
+#include "ccmath/internal/math/runtime/simd/instructions/avx_int.hpp"
+
+#include <type_traits>
 
 #ifdef CCMATH_HAS_SIMD
    #ifdef CCMATH_HAS_SIMD_AVX2
@@ -28,6 +31,25 @@ namespace ccm::intrin
 
    } // namespace abi
 
+   /// 32 and 64 bit integer lanes. float and double have their own specializations below.
+   template <class T>
+   struct simd_mask<T, abi::avx2> : internal::avx_int_mask<T, abi::avx2>
+   {
+	   using internal::avx_int_mask<T, abi::avx2>::avx_int_mask;
+   };
+
+   template <class T>
+   struct simd<T, abi::avx2> : internal::avx_int_simd<T, abi::avx2>
+   {
+	   using internal::avx_int_simd<T, abi::avx2>::avx_int_simd;
+   };
+
+   /// Masked partial loads and stores for every lane type.
+   template <class T>
+   struct simd_partial<T, abi::avx2> : internal::avx_partial<T, abi::avx2>
+   {
+   };
+
    template <>
    struct simd_mask<float, abi::avx2>
    {
@@ -79,8 +101,9 @@ namespace ccm::intrin
 		   return *this;
 	   }
 	   template <class Flags>
-	   CCM_ALWAYS_INLINE simd(float const * ptr, Flags /*flags*/) : m_value(_mm256_loadu_ps(ptr))
+	   CCM_ALWAYS_INLINE simd(float const * ptr, Flags flags)
 	   {
+		   copy_from(ptr, flags);
 	   }
 	   CCM_ALWAYS_INLINE simd(float const * ptr, int stride)
 		   : simd(ptr[0], ptr[stride], ptr[2 * stride], ptr[3 * stride], ptr[4 * stride], ptr[5 * stride], ptr[6 * stride], ptr[7 * stride])
@@ -93,7 +116,9 @@ namespace ccm::intrin
 	   CCM_ALWAYS_INLINE simd operator-(simd const & other) const { return {_mm256_sub_ps(m_value, other.m_value)}; }
 	   CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator-() const { return {_mm256_sub_ps(_mm256_set1_ps(0.0F), m_value)}; }
 	   CCM_ALWAYS_INLINE void copy_from(float const * ptr, element_aligned_tag /*unused*/) { m_value = _mm256_loadu_ps(ptr); }
+	   CCM_ALWAYS_INLINE void copy_from(float const * ptr, vector_aligned_tag /*unused*/) { m_value = _mm256_load_ps(ptr); }
 	   CCM_ALWAYS_INLINE void copy_to(float * ptr, element_aligned_tag /*unused*/) const { _mm256_storeu_ps(ptr, m_value); }
+	   CCM_ALWAYS_INLINE void copy_to(float * ptr, vector_aligned_tag /*unused*/) const { _mm256_store_ps(ptr, m_value); }
 	   [[nodiscard]] constexpr __m256 get() const { return m_value; }
 	   [[nodiscard]] CCM_ALWAYS_INLINE float convert() const { return _mm256_cvtss_f32(m_value); }
 	   CCM_ALWAYS_INLINE simd_mask<float, abi::avx2> operator<(simd const & other) const
@@ -104,6 +129,22 @@ namespace ccm::intrin
 	   {
 		   return {_mm256_cmp_ps(m_value, other.m_value, _CMP_EQ_OS)};
 	   }
+	   CCM_ALWAYS_INLINE simd_mask<float, abi::avx2> operator<=(simd const & other) const
+	   {
+		   return {_mm256_cmp_ps(m_value, other.m_value, _CMP_LE_OS)};
+	   }
+	   CCM_ALWAYS_INLINE simd_mask<float, abi::avx2> operator>(simd const & other) const
+	   {
+		   return {_mm256_cmp_ps(m_value, other.m_value, _CMP_GT_OS)};
+	   }
+	   CCM_ALWAYS_INLINE simd_mask<float, abi::avx2> operator>=(simd const & other) const
+	   {
+		   return {_mm256_cmp_ps(m_value, other.m_value, _CMP_GE_OS)};
+	   }
+	   CCM_ALWAYS_INLINE simd_mask<float, abi::avx2> operator!=(simd const & other) const
+	   {
+		   return {_mm256_cmp_ps(m_value, other.m_value, _CMP_NEQ_UQ)};
+	   }
 
    private:
 	   __m256 m_value;
@@ -115,6 +156,125 @@ namespace ccm::intrin
 	   return {_mm256_blendv_ps(c.get(), b.get(), a.get())};
    }
 
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> fma(simd<float, abi::avx2> const & a, simd<float, abi::avx2> const & b, simd<float, abi::avx2> const & c)
+   {
+	#ifdef CCMATH_HAS_SIMD_FMA
+	   return {_mm256_fmadd_ps(a.get(), b.get(), c.get())};
+	#else
+	   return {_mm256_add_ps(_mm256_mul_ps(a.get(), b.get()), c.get())};
+	#endif
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> fms(simd<float, abi::avx2> const & a, simd<float, abi::avx2> const & b, simd<float, abi::avx2> const & c)
+   {
+	#ifdef CCMATH_HAS_SIMD_FMA
+	   return {_mm256_fmsub_ps(a.get(), b.get(), c.get())};
+	#else
+	   return {_mm256_sub_ps(_mm256_mul_ps(a.get(), b.get()), c.get())};
+	#endif
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> fnma(simd<float, abi::avx2> const & a, simd<float, abi::avx2> const & b, simd<float, abi::avx2> const & c)
+   {
+	#ifdef CCMATH_HAS_SIMD_FMA
+	   return {_mm256_fnmadd_ps(a.get(), b.get(), c.get())};
+	#else
+	   return {_mm256_sub_ps(c.get(), _mm256_mul_ps(a.get(), b.get()))};
+	#endif
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> min(simd<float, abi::avx2> const & a, simd<float, abi::avx2> const & b)
+   {
+	   return {_mm256_min_ps(a.get(), b.get())};
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> max(simd<float, abi::avx2> const & a, simd<float, abi::avx2> const & b)
+   {
+	   return {_mm256_max_ps(a.get(), b.get())};
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> abs(simd<float, abi::avx2> const & a)
+   {
+	   return {_mm256_andnot_ps(_mm256_set1_ps(-0.0F), a.get())};
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> copysign(simd<float, abi::avx2> const & magnitude, simd<float, abi::avx2> const & sign)
+   {
+	   return {_mm256_or_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0F), magnitude.get()), _mm256_and_ps(_mm256_set1_ps(-0.0F), sign.get()))};
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> rsqrt(simd<float, abi::avx2> const & a)
+   {
+	   return internal::rsqrt_newton(a, simd<float, abi::avx2>(_mm256_rsqrt_ps(a.get())));
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> rsqrt_estimate(simd<float, abi::avx2> const & a)
+   {
+	   return {_mm256_rsqrt_ps(a.get())};
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> rcp(simd<float, abi::avx2> const & a)
+   {
+	   return internal::rcp_newton(a, simd<float, abi::avx2>(_mm256_rcp_ps(a.get())));
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> floor(simd<float, abi::avx2> const & a)
+   {
+	   return {_mm256_round_ps(a.get(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)};
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> ceil(simd<float, abi::avx2> const & a)
+   {
+	   return {_mm256_round_ps(a.get(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC)};
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> trunc(simd<float, abi::avx2> const & a)
+   {
+	   return {_mm256_round_ps(a.get(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)};
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> round(simd<float, abi::avx2> const & a)
+   {
+	   return internal::round_from_trunc(a, trunc(a));
+   }
+
+   CCM_ALWAYS_INLINE float reduce_add(simd<float, abi::avx2> const & a)
+   {
+	   const __m128 halves = _mm_add_ps(_mm256_castps256_ps128(a.get()), _mm256_extractf128_ps(a.get(), 1));
+	   const __m128 pairs	= _mm_add_ps(halves, _mm_movehl_ps(halves, halves));
+	   return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+   }
+
+   CCM_ALWAYS_INLINE float reduce_mul(simd<float, abi::avx2> const & a)
+   {
+	   const __m128 halves = _mm_mul_ps(_mm256_castps256_ps128(a.get()), _mm256_extractf128_ps(a.get(), 1));
+	   const __m128 pairs	= _mm_mul_ps(halves, _mm_movehl_ps(halves, halves));
+	   return _mm_cvtss_f32(_mm_mul_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+   }
+
+   CCM_ALWAYS_INLINE float reduce_min(simd<float, abi::avx2> const & a)
+   {
+	   const __m128 halves = _mm_min_ps(_mm256_castps256_ps128(a.get()), _mm256_extractf128_ps(a.get(), 1));
+	   const __m128 pairs	= _mm_min_ps(halves, _mm_movehl_ps(halves, halves));
+	   return _mm_cvtss_f32(_mm_min_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+   }
+
+   CCM_ALWAYS_INLINE float reduce_max(simd<float, abi::avx2> const & a)
+   {
+	   const __m128 halves = _mm_max_ps(_mm256_castps256_ps128(a.get()), _mm256_extractf128_ps(a.get(), 1));
+	   const __m128 pairs	= _mm_max_ps(halves, _mm_movehl_ps(halves, halves));
+	   return _mm_cvtss_f32(_mm_max_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+   }
+
+   CCM_ALWAYS_INLINE simd<float, abi::avx2> prefix_sum(simd<float, abi::avx2> const & a)
+   {
+	   // Scan each 128 bit half, then add the total of the lower half to the upper one.
+	   const __m256 zero = _mm256_setzero_ps();
+	   __m256 x		   = _mm256_add_ps(a.get(), _mm256_blend_ps(_mm256_permute_ps(a.get(), _MM_SHUFFLE(2, 1, 0, 0)), zero, 0x11));
+	   x				   = _mm256_add_ps(x, _mm256_blend_ps(_mm256_permute_ps(x, _MM_SHUFFLE(1, 0, 0, 0)), zero, 0x33));
+	   return {_mm256_add_ps(x, _mm256_permute_ps(_mm256_permute2f128_ps(x, x, 0x08), _MM_SHUFFLE(3, 3, 3, 3)))};
+   }
+
    template <>
    struct simd_mask<double, abi::avx2>
    {
@@ -168,8 +328,9 @@ namespace ccm::intrin
 		   return *this;
 	   }
 	   template <class Flags>
-	   CCM_ALWAYS_INLINE simd(double const * ptr, Flags flags) : m_value(_mm256_loadu_pd(ptr))
+	   CCM_ALWAYS_INLINE simd(double const * ptr, Flags flags)
 	   {
+		   copy_from(ptr, flags);
 	   }
 	   CCM_ALWAYS_INLINE simd(double const * ptr, int stride) : simd(ptr[0], ptr[stride], ptr[2 * stride], ptr[3 * stride]) {}
 	   CCM_ALWAYS_INLINE constexpr simd(__m256d const & value_in) : m_value(value_in) {}
@@ -179,7 +340,9 @@ namespace ccm::intrin
 	   CCM_ALWAYS_INLINE simd operator-(simd const & other) const { return {_mm256_sub_pd(m_value, other.m_value)}; }
 	   CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator-() const { return {_mm256_sub_pd(_mm256_set1_pd(0.0), m_value)}; }
 	   CCM_ALWAYS_INLINE void copy_from(double const * ptr, element_aligned_tag /*unused*/) { m_value = _mm256_loadu_pd(ptr); }
+	   CCM_ALWAYS_INLINE void copy_from(double const * ptr, vector_aligned_tag /*unused*/) { m_value = _mm256_load_pd(ptr); }
 	   CCM_ALWAYS_INLINE void copy_to(double * ptr, element_aligned_tag /*unused*/) const { _mm256_storeu_pd(ptr, m_value); }
+	   CCM_ALWAYS_INLINE void copy_to(double * ptr, vector_aligned_tag /*unused*/) const { _mm256_store_pd(ptr, m_value); }
 	   [[nodiscard]] CCM_ALWAYS_INLINE constexpr __m256d get() const { return m_value; }
 	   [[nodiscard]] CCM_ALWAYS_INLINE double convert() const { return _mm256_cvtsd_f64(m_value); }
 	   CCM_ALWAYS_INLINE simd_mask<double, abi::avx2> operator<(simd const & other) const
@@ -190,6 +353,22 @@ namespace ccm::intrin
 	   {
 		   return {_mm256_cmp_pd(m_value, other.m_value, _CMP_EQ_OS)};
 	   }
+	   CCM_ALWAYS_INLINE simd_mask<double, abi::avx2> operator<=(simd const & other) const
+	   {
+		   return {_mm256_cmp_pd(m_value, other.m_value, _CMP_LE_OS)};
+	   }
+	   CCM_ALWAYS_INLINE simd_mask<double, abi::avx2> operator>(simd const & other) const
+	   {
+		   return {_mm256_cmp_pd(m_value, other.m_value, _CMP_GT_OS)};
+	   }
+	   CCM_ALWAYS_INLINE simd_mask<double, abi::avx2> operator>=(simd const & other) const
+	   {
+		   return {_mm256_cmp_pd(m_value, other.m_value, _CMP_GE_OS)};
+	   }
+	   CCM_ALWAYS_INLINE simd_mask<double, abi::avx2> operator!=(simd const & other) const
+	   {
+		   return {_mm256_cmp_pd(m_value, other.m_value, _CMP_NEQ_UQ)};
+	   }
 
    private:
 	   __m256d m_value;
@@ -200,6 +379,131 @@ namespace ccm::intrin
    {
 	   return {_mm256_blendv_pd(c.get(), b.get(), a.get())};
    }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> fma(simd<double, abi::avx2> const & a, simd<double, abi::avx2> const & b, simd<double, abi::avx2> const & c)
+   {
+	#ifdef CCMATH_HAS_SIMD_FMA
+	   return {_mm256_fmadd_pd(a.get(), b.get(), c.get())};
+	#else
+	   return {_mm256_add_pd(_mm256_mul_pd(a.get(), b.get()), c.get())};
+	#endif
+   }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> fms(simd<double, abi::avx2> const & a, simd<double, abi::avx2> const & b, simd<double, abi::avx2> const & c)
+   {
+	#ifdef CCMATH_HAS_SIMD_FMA
+	   return {_mm256_fmsub_pd(a.get(), b.get(), c.get())};
+	#else
+	   return {_mm256_sub_pd(_mm256_mul_pd(a.get(), b.get()), c.get())};
+	#endif
+   }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> fnma(simd<double, abi::avx2> const & a, simd<double, abi::avx2> const & b, simd<double, abi::avx2> const & c)
+   {
+	#ifdef CCMATH_HAS_SIMD_FMA
+	   return {_mm256_fnmadd_pd(a.get(), b.get(), c.get())};
+	#else
+	   return {_mm256_sub_pd(c.get(), _mm256_mul_pd(a.get(), b.get()))};
+	#endif
+   }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> min(simd<double, abi::avx2> const & a, simd<double, abi::avx2> const & b)
+   {
+	   return {_mm256_min_pd(a.get(), b.get())};
+   }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> max(simd<double, abi::avx2> const & a, simd<double, abi::avx2> const & b)
+   {
+	   return {_mm256_max_pd(a.get(), b.get())};
+   }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> abs(simd<double, abi::avx2> const & a)
+   {
+	   return {_mm256_andnot_pd(_mm256_set1_pd(-0.0), a.get())};
+   }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> copysign(simd<double, abi::avx2> const & magnitude, simd<double, abi::avx2> const & sign)
+   {
+	   return {_mm256_or_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), magnitude.get()), _mm256_and_pd(_mm256_set1_pd(-0.0), sign.get()))};
+   }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> rsqrt(simd<double, abi::avx2> const & a)
+   {
+	   return {_mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(a.get()))};
+   }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> rcp(simd<double, abi::avx2> const & a)
+   {
+	   return {_mm256_div_pd(_mm256_set1_pd(1.0), a.get())};
+   }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> floor(simd<double, abi::avx2> const & a)
+   {
+	   return {_mm256_round_pd(a.get(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)};
+   }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> ceil(simd<double, abi::avx2> const & a)
+   {
+	   return {_mm256_round_pd(a.get(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC)};
+   }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> trunc(simd<double, abi::avx2> const & a)
+   {
+	   return {_mm256_round_pd(a.get(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)};
+   }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> round(simd<double, abi::avx2> const & a)
+   {
+	   return internal::round_from_trunc(a, trunc(a));
+   }
+
+   CCM_ALWAYS_INLINE double reduce_add(simd<double, abi::avx2> const & a)
+   {
+	   const __m128d halves = _mm_add_pd(_mm256_castpd256_pd128(a.get()), _mm256_extractf128_pd(a.get(), 1));
+	   return _mm_cvtsd_f64(_mm_add_sd(halves, _mm_unpackhi_pd(halves, halves)));
+   }
+
+   CCM_ALWAYS_INLINE double reduce_mul(simd<double, abi::avx2> const & a)
+   {
+	   const __m128d halves = _mm_mul_pd(_mm256_castpd256_pd128(a.get()), _mm256_extractf128_pd(a.get(), 1));
+	   return _mm_cvtsd_f64(_mm_mul_sd(halves, _mm_unpackhi_pd(halves, halves)));
+   }
+
+   CCM_ALWAYS_INLINE double reduce_min(simd<double, abi::avx2> const & a)
+   {
+	   const __m128d halves = _mm_min_pd(_mm256_castpd256_pd128(a.get()), _mm256_extractf128_pd(a.get(), 1));
+	   return _mm_cvtsd_f64(_mm_min_sd(halves, _mm_unpackhi_pd(halves, halves)));
+   }
+
+   CCM_ALWAYS_INLINE double reduce_max(simd<double, abi::avx2> const & a)
+   {
+	   const __m128d halves = _mm_max_pd(_mm256_castpd256_pd128(a.get()), _mm256_extractf128_pd(a.get(), 1));
+	   return _mm_cvtsd_f64(_mm_max_sd(halves, _mm_unpackhi_pd(halves, halves)));
+   }
+
+   CCM_ALWAYS_INLINE simd<double, abi::avx2> prefix_sum(simd<double, abi::avx2> const & a)
+   {
+	   // Scan each 128 bit half, then add the total of the lower half to the upper one.
+	   const __m256d zero = _mm256_setzero_pd();
+	   const __m256d x	= _mm256_add_pd(a.get(), _mm256_unpacklo_pd(zero, a.get()));
+	   return {_mm256_add_pd(x, _mm256_permute_pd(_mm256_permute2f128_pd(x, x, 0x08), 0xF))};
+   }
+
+   /// Gather with vgatherqpd, vgatherdps, vpgatherqq or vpgatherdd. See the generic gather for the index requirements.
+   /// A zero source and an all-ones mask make the masked gathers behave like the plain ones, which start from an undefined register.
+   template <class T, class Index>
+   CCM_ALWAYS_INLINE simd<T, abi::avx2> gather(T const * base, simd<Index, abi::avx2> const & index)
+   {
+	   static_assert(is_simd_integer_v<Index> && sizeof(Index) == sizeof(T), "gather indices must be integers of the width of the loaded lanes.");
+	   const __m256i all_lanes = _mm256_set1_epi32(-1);
+	   if constexpr (std::is_same_v<T, double>) { return {_mm256_mask_i64gather_pd(_mm256_setzero_pd(), base, index.get(), _mm256_castsi256_pd(all_lanes), 8)}; }
+	   else if constexpr (std::is_same_v<T, float>) { return {_mm256_mask_i32gather_ps(_mm256_setzero_ps(), base, index.get(), _mm256_castsi256_ps(all_lanes), 4)}; }
+	   else if constexpr (sizeof(T) == 8)
+	   {
+		   return {_mm256_mask_i64gather_epi64(_mm256_setzero_si256(), reinterpret_cast<long long const *>(base), index.get(), all_lanes, 8)};
+	   }
+	   else { return {_mm256_mask_i32gather_epi32(_mm256_setzero_si256(), reinterpret_cast<int const *>(base), index.get(), all_lanes, 4)}; }
+   }
 } // namespace ccm::intrin
 
    #endif // CCMATH_HAS_SIMD_AVX2
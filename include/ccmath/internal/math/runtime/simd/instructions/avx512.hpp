@@ -13,6 +13,10 @@
 #include "ccmath/internal/config/arch/check_simd_support.hpp"
 #include "ccmath/internal/math/runtime/simd/common.hpp"
 
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
 #ifdef CCMATH_HAS_SIMD
 	#ifdef CCMATH_HAS_SIMD_AVX512F
 
@@ -27,6 +31,146 @@ namespace ccm::intrin
 		};
 	} // namespace abi
 
+	/// 32 and 64 bit integer lanes, with one mask bit per lane. float and double have their own specializations below.
+	template <class T>
+	struct simd_mask<T, abi::avx512>
+	{
+		static_assert(is_simd_integer_v<T>, "Integer simd lanes must be 32 or 64 bit integers.");
+
+		using value_type					 = bool;
+		using simd_type						 = simd<T, abi::avx512>;
+		using abi_type						 = abi::avx512;
+		using register_type					 = std::conditional_t<sizeof(T) == 8, __mmask8, __mmask16>;
+		CCM_ALWAYS_INLINE simd_mask() = default;
+		CCM_ALWAYS_INLINE explicit simd_mask(bool value) : m_value(value ? all_lanes : register_type{0}) {}
+		CCM_ALWAYS_INLINE static constexpr int size() { return static_cast<int>(64 / sizeof(T)); }
+		CCM_ALWAYS_INLINE constexpr simd_mask(register_type const & value_in) : m_value(value_in) {}
+		[[nodiscard]] CCM_ALWAYS_INLINE constexpr register_type get() const { return m_value; }
+		CCM_ALWAYS_INLINE simd_mask operator||(simd_mask const & other) const { return simd_mask(static_cast<register_type>(m_value | other.m_value)); }
+		CCM_ALWAYS_INLINE simd_mask operator&&(simd_mask const & other) const { return simd_mask(static_cast<register_type>(m_value & other.m_value)); }
+		CCM_ALWAYS_INLINE simd_mask operator!() const { return simd_mask(static_cast<register_type>(~m_value & all_lanes)); }
+
+		static constexpr register_type all_lanes = static_cast<register_type>((1U << (64 / sizeof(T))) - 1U);
+
+	private:
+		register_type m_value;
+	};
+
+	template <class T>
+	CCM_ALWAYS_INLINE bool all_of(simd_mask<T, abi::avx512> const & a)
+	{
+		return a.get() == simd_mask<T, abi::avx512>::all_lanes;
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE bool any_of(simd_mask<T, abi::avx512> const & a)
+	{
+		return a.get() != 0;
+	}
+
+	template <class T>
+	struct simd<T, abi::avx512>
+	{
+		static_assert(is_simd_integer_v<T>, "Integer simd lanes must be 32 or 64 bit integers.");
+		static constexpr bool is_64bit = sizeof(T) == 8;
+
+		using value_type				= T;
+		using abi_type					= abi::avx512;
+		using mask_type					= simd_mask<T, abi_type>;
+		using storage_type				= simd_storage<T, abi_type>;
+		CCM_ALWAYS_INLINE simd() = default;
+		CCM_ALWAYS_INLINE static constexpr int size() { return static_cast<int>(64 / sizeof(T)); }
+		CCM_ALWAYS_INLINE simd(T value)
+		{
+			if constexpr (is_64bit) { m_value = _mm512_set1_epi64(static_cast<long long>(value)); }
+			else { m_value = _mm512_set1_epi32(static_cast<int>(value)); }
+		}
+		CCM_ALWAYS_INLINE simd(storage_type const & value) { copy_from(value.data(), element_aligned_tag()); }
+		CCM_ALWAYS_INLINE simd & operator=(storage_type const & value)
+		{
+			copy_from(value.data(), element_aligned_tag());
+			return *this;
+		}
+		template <class Flags>
+		CCM_ALWAYS_INLINE simd(T const * ptr, Flags flags)
+		{
+			copy_from(ptr, flags);
+		}
+		CCM_ALWAYS_INLINE simd(T const * ptr, int stride)
+		{
+			std::array<T, size()> lanes;
+			for (int i = 0; i < size(); ++i) { lanes[i] = ptr[i * stride]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			copy_from(lanes.data(), element_aligned_tag());
+		}
+		CCM_ALWAYS_INLINE constexpr simd(__m512i const & value_in) : m_value(value_in) {}
+		CCM_ALWAYS_INLINE simd operator+(simd const & other) const
+		{
+			if constexpr (is_64bit) { return simd(_mm512_add_epi64(m_value, other.m_value)); }
+			else { return simd(_mm512_add_epi32(m_value, other.m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd operator-(simd const & other) const
+		{
+			if constexpr (is_64bit) { return simd(_mm512_sub_epi64(m_value, other.m_value)); }
+			else { return simd(_mm512_sub_epi32(m_value, other.m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd operator-() const { return simd(_mm512_setzero_si512()) - *this; }
+		CCM_ALWAYS_INLINE simd operator&(simd const & other) const { return simd(_mm512_and_si512(m_value, other.m_value)); }
+		CCM_ALWAYS_INLINE simd operator|(simd const & other) const { return simd(_mm512_or_si512(m_value, other.m_value)); }
+		CCM_ALWAYS_INLINE simd operator^(simd const & other) const { return simd(_mm512_xor_si512(m_value, other.m_value)); }
+		CCM_ALWAYS_INLINE simd operator~() const { return simd(_mm512_xor_si512(m_value, _mm512_set1_epi32(-1))); }
+		CCM_ALWAYS_INLINE simd operator<<(int count) const
+		{
+			if constexpr (is_64bit) { return simd(_mm512_sll_epi64(m_value, _mm_cvtsi32_si128(count))); }
+			else { return simd(_mm512_sll_epi32(m_value, _mm_cvtsi32_si128(count))); }
+		}
+		/// Arithmetic shift for signed lanes, logical shift for unsigned lanes.
+		CCM_ALWAYS_INLINE simd operator>>(int count) const
+		{
+			const __m128i n = _mm_cvtsi32_si128(count);
+			if constexpr (is_64bit && std::is_signed_v<T>) { return simd(_mm512_sra_epi64(m_value, n)); }
+			else if constexpr (is_64bit) { return simd(_mm512_srl_epi64(m_value, n)); }
+			else if constexpr (std::is_signed_v<T>) { return simd(_mm512_sra_epi32(m_value, n)); }
+			else { return simd(_mm512_srl_epi32(m_value, n)); }
+		}
+		CCM_ALWAYS_INLINE void copy_from(T const * ptr, element_aligned_tag /*unused*/) { m_value = _mm512_loadu_si512(ptr); }
+		CCM_ALWAYS_INLINE void copy_from(T const * ptr, vector_aligned_tag /*unused*/) { m_value = _mm512_load_si512(ptr); }
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, element_aligned_tag /*unused*/) const { _mm512_storeu_si512(ptr, m_value); }
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, vector_aligned_tag /*unused*/) const { _mm512_store_si512(ptr, m_value); }
+		[[nodiscard]] CCM_ALWAYS_INLINE constexpr __m512i get() const { return m_value; }
+		[[nodiscard]] CCM_ALWAYS_INLINE T convert() const
+		{
+			std::array<T, size()> lanes;
+			copy_to(lanes.data(), element_aligned_tag());
+			return lanes[0];
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::avx512> operator<(simd const & other) const
+		{
+			if constexpr (is_64bit && std::is_signed_v<T>) { return simd_mask<T, abi::avx512>(_mm512_cmplt_epi64_mask(m_value, other.m_value)); }
+			else if constexpr (is_64bit) { return simd_mask<T, abi::avx512>(_mm512_cmplt_epu64_mask(m_value, other.m_value)); }
+			else if constexpr (std::is_signed_v<T>) { return simd_mask<T, abi::avx512>(_mm512_cmplt_epi32_mask(m_value, other.m_value)); }
+			else { return simd_mask<T, abi::avx512>(_mm512_cmplt_epu32_mask(m_value, other.m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::avx512> operator==(simd const & other) const
+		{
+			if constexpr (is_64bit) { return simd_mask<T, abi::avx512>(_mm512_cmpeq_epi64_mask(m_value, other.m_value)); }
+			else { return simd_mask<T, abi::avx512>(_mm512_cmpeq_epi32_mask(m_value, other.m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::avx512> operator<=(simd const & other) const { return !(other < *this); }
+		CCM_ALWAYS_INLINE simd_mask<T, abi::avx512> operator>(simd const & other) const { return other < *this; }
+		CCM_ALWAYS_INLINE simd_mask<T, abi::avx512> operator>=(simd const & other) const { return !(*this < other); }
+		CCM_ALWAYS_INLINE simd_mask<T, abi::avx512> operator!=(simd const & other) const { return !(*this == other); }
+
+	private:
+		__m512i m_value;
+	};
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::avx512> choose(simd_mask<T, abi::avx512> const & a, simd<T, abi::avx512> const & b, simd<T, abi::avx512> const & c)
+	{
+		if constexpr (sizeof(T) == 8) { return simd<T, abi::avx512>(_mm512_mask_blend_epi64(a.get(), c.get(), b.get())); }
+		else { return simd<T, abi::avx512>(_mm512_mask_blend_epi32(a.get(), c.get(), b.get())); }
+	}
+
 	template <>
 	struct simd_mask<float, abi::avx512>
 	{
@@ -80,8 +224,9 @@ namespace ccm::intrin
 			return *this;
 		}
 		template <class Flags>
-		CCM_ALWAYS_INLINE simd(float const * ptr, Flags /*flags*/) : m_value(_mm512_loadu_ps(ptr))
+		CCM_ALWAYS_INLINE simd(float const * ptr, Flags flags)
 		{
+			copy_from(ptr, flags);
 		}
 		CCM_ALWAYS_INLINE simd(float const * ptr, int stride)
 			: simd(ptr[0], ptr[stride], ptr[2 * stride], ptr[3 * stride], ptr[4 * stride], ptr[5 * stride], ptr[6 * stride], ptr[7 * stride], ptr[8 * stride],
@@ -95,7 +240,9 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE simd operator-(simd const & other) const { return simd(_mm512_sub_ps(m_value, other.m_value)); }
 		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator-() const { return simd(_mm512_sub_ps(_mm512_set1_ps(0.0), m_value)); }
 		CCM_ALWAYS_INLINE void copy_from(float const * ptr, element_aligned_tag /*unused*/) { m_value = _mm512_loadu_ps(ptr); }
+		CCM_ALWAYS_INLINE void copy_from(float const * ptr, vector_aligned_tag /*unused*/) { m_value = _mm512_load_ps(ptr); }
 		CCM_ALWAYS_INLINE void copy_to(float * ptr, element_aligned_tag /*unused*/) const { _mm512_storeu_ps(ptr, m_value); }
+		CCM_ALWAYS_INLINE void copy_to(float * ptr, vector_aligned_tag /*unused*/) const { _mm512_store_ps(ptr, m_value); }
 		[[nodiscard]] CCM_ALWAYS_INLINE constexpr __m512 get() const { return m_value; }
 		[[nodiscard]] CCM_ALWAYS_INLINE float convert() const { return _mm512_cvtss_f32(m_value); }
 		CCM_ALWAYS_INLINE simd_mask<float, abi::avx512> operator<(simd const & other) const
@@ -106,6 +253,22 @@ namespace ccm::intrin
 		{
 			return simd_mask<float, abi::avx512>(_mm512_cmpeq_ps_mask(m_value, other.m_value));
 		}
+		CCM_ALWAYS_INLINE simd_mask<float, abi::avx512> operator<=(simd const & other) const
+		{
+			return simd_mask<float, abi::avx512>(_mm512_cmp_ps_mask(m_value, other.m_value, _CMP_LE_OS));
+		}
+		CCM_ALWAYS_INLINE simd_mask<float, abi::avx512> operator>(simd const & other) const
+		{
+			return simd_mask<float, abi::avx512>(_mm512_cmp_ps_mask(m_value, other.m_value, _CMP_GT_OS));
+		}
+		CCM_ALWAYS_INLINE simd_mask<float, abi::avx512> operator>=(simd const & other) const
+		{
+			return simd_mask<float, abi::avx512>(_mm512_cmp_ps_mask(m_value, other.m_value, _CMP_GE_OS));
+		}
+		CCM_ALWAYS_INLINE simd_mask<float, abi::avx512> operator!=(simd const & other) const
+		{
+			return simd_mask<float, abi::avx512>(_mm512_cmp_ps_mask(m_value, other.m_value, _CMP_NEQ_UQ));
+		}
 
 	private:
 		__m512 m_value;
@@ -114,7 +277,110 @@ namespace ccm::intrin
 	CCM_ALWAYS_INLINE simd<float, abi::avx512> choose(simd_mask<float, abi::avx512> const & a, simd<float, abi::avx512> const & b,
 															 simd<float, abi::avx512> const & c)
 	{
-		return simd<float, abi::avx512>(_mm512_mask_blend_ps(a.get(), c.get(), b.get()));
+		return {_mm512_mask_blend_ps(a.get(), c.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> fma(simd<float, abi::avx512> const & a, simd<float, abi::avx512> const & b, simd<float, abi::avx512> const & c)
+	{
+		return {_mm512_fmadd_ps(a.get(), b.get(), c.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> fms(simd<float, abi::avx512> const & a, simd<float, abi::avx512> const & b, simd<float, abi::avx512> const & c)
+	{
+		return {_mm512_fmsub_ps(a.get(), b.get(), c.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> fnma(simd<float, abi::avx512> const & a, simd<float, abi::avx512> const & b, simd<float, abi::avx512> const & c)
+	{
+		return {_mm512_fnmadd_ps(a.get(), b.get(), c.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> min(simd<float, abi::avx512> const & a, simd<float, abi::avx512> const & b)
+	{
+		return {_mm512_min_ps(a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> max(simd<float, abi::avx512> const & a, simd<float, abi::avx512> const & b)
+	{
+		return {_mm512_max_ps(a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> abs(simd<float, abi::avx512> const & a)
+	{
+		return {_mm512_abs_ps(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> copysign(simd<float, abi::avx512> const & magnitude, simd<float, abi::avx512> const & sign)
+	{
+		// Bitwise select of the sign bit from sign and the other bits from magnitude.
+		const __m512i sign_bit = _mm512_castps_si512(_mm512_set1_ps(-0.0F));
+		return {_mm512_castsi512_ps(_mm512_ternarylogic_epi32(sign_bit, _mm512_castps_si512(magnitude.get()), _mm512_castps_si512(sign.get()), 0xAC))};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> rsqrt(simd<float, abi::avx512> const & a)
+	{
+		return internal::rsqrt_newton(a, simd<float, abi::avx512>(_mm512_rsqrt14_ps(a.get())));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> rsqrt_estimate(simd<float, abi::avx512> const & a)
+	{
+		return {_mm512_rsqrt14_ps(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> rcp(simd<float, abi::avx512> const & a)
+	{
+		return internal::rcp_newton(a, simd<float, abi::avx512>(_mm512_rcp14_ps(a.get())));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> floor(simd<float, abi::avx512> const & a)
+	{
+		return {_mm512_roundscale_ps(a.get(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> ceil(simd<float, abi::avx512> const & a)
+	{
+		return {_mm512_roundscale_ps(a.get(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC)};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> trunc(simd<float, abi::avx512> const & a)
+	{
+		return {_mm512_roundscale_ps(a.get(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> round(simd<float, abi::avx512> const & a)
+	{
+		return internal::round_from_trunc(a, trunc(a));
+	}
+
+	CCM_ALWAYS_INLINE float reduce_add(simd<float, abi::avx512> const & a)
+	{
+		return _mm512_reduce_add_ps(a.get());
+	}
+
+	CCM_ALWAYS_INLINE float reduce_mul(simd<float, abi::avx512> const & a)
+	{
+		return _mm512_reduce_mul_ps(a.get());
+	}
+
+	CCM_ALWAYS_INLINE float reduce_min(simd<float, abi::avx512> const & a)
+	{
+		return _mm512_reduce_min_ps(a.get());
+	}
+
+	CCM_ALWAYS_INLINE float reduce_max(simd<float, abi::avx512> const & a)
+	{
+		return _mm512_reduce_max_ps(a.get());
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::avx512> prefix_sum(simd<float, abi::avx512> const & a)
+	{
+		// Shift the lanes up by 1, 2, 4 and 8 with zeros shifted in, adding after each shift.
+		const __m512i zero = _mm512_setzero_si512();
+		__m512i x			= _mm512_castps_si512(a.get());
+		x					= _mm512_castps_si512(_mm512_add_ps(_mm512_castsi512_ps(x), _mm512_castsi512_ps(_mm512_alignr_epi32(x, zero, 15))));
+		x					= _mm512_castps_si512(_mm512_add_ps(_mm512_castsi512_ps(x), _mm512_castsi512_ps(_mm512_alignr_epi32(x, zero, 14))));
+		x					= _mm512_castps_si512(_mm512_add_ps(_mm512_castsi512_ps(x), _mm512_castsi512_ps(_mm512_alignr_epi32(x, zero, 12))));
+		return {_mm512_add_ps(_mm512_castsi512_ps(x), _mm512_castsi512_ps(_mm512_alignr_epi32(x, zero, 8)))};
 	}
 
 	template <>
@@ -177,8 +443,9 @@ namespace ccm::intrin
 			return *this;
 		}
 		template <class Flags>
-		CCM_ALWAYS_INLINE simd(double const * ptr, Flags /*flags*/) : m_value(_mm512_loadu_pd(ptr))
+		CCM_ALWAYS_INLINE simd(double const * ptr, Flags flags)
 		{
+			copy_from(ptr, flags);
 		}
 		CCM_ALWAYS_INLINE simd(double const * ptr, int stride)
 			: simd(ptr[0], ptr[stride], ptr[2 * stride], ptr[3 * stride], ptr[4 * stride], ptr[5 * stride], ptr[6 * stride], ptr[7 * stride])
@@ -191,7 +458,9 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE simd operator-(simd const & other) const { return simd(_mm512_sub_pd(m_value, other.m_value)); }
 		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator-() const { return simd(_mm512_sub_pd(_mm512_set1_pd(0.0), m_value)); }
 		CCM_ALWAYS_INLINE void copy_from(double const * ptr, element_aligned_tag) { m_value = _mm512_loadu_pd(ptr); }
+		CCM_ALWAYS_INLINE void copy_from(double const * ptr, vector_aligned_tag /*unused*/) { m_value = _mm512_load_pd(ptr); }
 		CCM_ALWAYS_INLINE void copy_to(double * ptr, element_aligned_tag) const { _mm512_storeu_pd(ptr, m_value); }
+		CCM_ALWAYS_INLINE void copy_to(double * ptr, vector_aligned_tag /*unused*/) const { _mm512_store_pd(ptr, m_value); }
 		[[nodiscard]] CCM_ALWAYS_INLINE constexpr __m512d get() const { return m_value; }
 		[[nodiscard]] CCM_ALWAYS_INLINE double convert() const { return _mm512_cvtsd_f64(m_value); }
 		CCM_ALWAYS_INLINE simd_mask<double, abi::avx512> operator<(simd const & other) const
@@ -202,6 +471,22 @@ namespace ccm::intrin
 		{
 			return simd_mask<double, abi::avx512>(_mm512_cmpeq_pd_mask(m_value, other.m_value));
 		}
+		CCM_ALWAYS_INLINE simd_mask<double, abi::avx512> operator<=(simd const & other) const
+		{
+			return simd_mask<double, abi::avx512>(_mm512_cmp_pd_mask(m_value, other.m_value, _CMP_LE_OS));
+		}
+		CCM_ALWAYS_INLINE simd_mask<double, abi::avx512> operator>(simd const & other) const
+		{
+			return simd_mask<double, abi::avx512>(_mm512_cmp_pd_mask(m_value, other.m_value, _CMP_GT_OS));
+		}
+		CCM_ALWAYS_INLINE simd_mask<double, abi::avx512> operator>=(simd const & other) const
+		{
+			return simd_mask<double, abi::avx512>(_mm512_cmp_pd_mask(m_value, other.m_value, _CMP_GE_OS));
+		}
+		CCM_ALWAYS_INLINE simd_mask<double, abi::avx512> operator!=(simd const & other) const
+		{
+			return simd_mask<double, abi::avx512>(_mm512_cmp_pd_mask(m_value, other.m_value, _CMP_NEQ_UQ));
+		}
 
 	private:
 		__m512d m_value;
@@ -210,9 +495,202 @@ namespace ccm::intrin
 	CCM_ALWAYS_INLINE simd<double, abi::avx512> choose(simd_mask<double, abi::avx512> const & a, simd<double, abi::avx512> const & b,
 															  simd<double, abi::avx512> const & c)
 	{
-		return simd<double, abi::avx512>(_mm512_mask_blend_pd(a.get(), c.get(), b.get()));
+		return {_mm512_mask_blend_pd(a.get(), c.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> fma(simd<double, abi::avx512> const & a, simd<double, abi::avx512> const & b, simd<double, abi::avx512> const & c)
+	{
+		return {_mm512_fmadd_pd(a.get(), b.get(), c.get())};
 	}
 
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> fms(simd<double, abi::avx512> const & a, simd<double, abi::avx512> const & b, simd<double, abi::avx512> const & c)
+	{
+		return {_mm512_fmsub_pd(a.get(), b.get(), c.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> fnma(simd<double, abi::avx512> const & a, simd<double, abi::avx512> const & b, simd<double, abi::avx512> const & c)
+	{
+		return {_mm512_fnmadd_pd(a.get(), b.get(), c.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> min(simd<double, abi::avx512> const & a, simd<double, abi::avx512> const & b)
+	{
+		return {_mm512_min_pd(a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> max(simd<double, abi::avx512> const & a, simd<double, abi::avx512> const & b)
+	{
+		return {_mm512_max_pd(a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> abs(simd<double, abi::avx512> const & a)
+	{
+		return {_mm512_abs_pd(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> copysign(simd<double, abi::avx512> const & magnitude, simd<double, abi::avx512> const & sign)
+	{
+		// Bitwise select of the sign bit from sign and the other bits from magnitude.
+		const __m512i sign_bit = _mm512_castpd_si512(_mm512_set1_pd(-0.0));
+		return {_mm512_castsi512_pd(_mm512_ternarylogic_epi64(sign_bit, _mm512_castpd_si512(magnitude.get()), _mm512_castpd_si512(sign.get()), 0xAC))};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> rsqrt(simd<double, abi::avx512> const & a)
+	{
+		return internal::rsqrt_newton(a, internal::rsqrt_newton(a, simd<double, abi::avx512>(_mm512_rsqrt14_pd(a.get()))));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> rsqrt_estimate(simd<double, abi::avx512> const & a)
+	{
+		return {_mm512_rsqrt14_pd(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> rcp(simd<double, abi::avx512> const & a)
+	{
+		return internal::rcp_newton(a, internal::rcp_newton(a, simd<double, abi::avx512>(_mm512_rcp14_pd(a.get()))));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> floor(simd<double, abi::avx512> const & a)
+	{
+		return {_mm512_roundscale_pd(a.get(), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> ceil(simd<double, abi::avx512> const & a)
+	{
+		return {_mm512_roundscale_pd(a.get(), _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC)};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> trunc(simd<double, abi::avx512> const & a)
+	{
+		return {_mm512_roundscale_pd(a.get(), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> round(simd<double, abi::avx512> const & a)
+	{
+		return internal::round_from_trunc(a, trunc(a));
+	}
+
+	CCM_ALWAYS_INLINE double reduce_add(simd<double, abi::avx512> const & a)
+	{
+		return _mm512_reduce_add_pd(a.get());
+	}
+
+	CCM_ALWAYS_INLINE double reduce_mul(simd<double, abi::avx512> const & a)
+	{
+		return _mm512_reduce_mul_pd(a.get());
+	}
+
+	CCM_ALWAYS_INLINE double reduce_min(simd<double, abi::avx512> const & a)
+	{
+		return _mm512_reduce_min_pd(a.get());
+	}
+
+	CCM_ALWAYS_INLINE double reduce_max(simd<double, abi::avx512> const & a)
+	{
+		return _mm512_reduce_max_pd(a.get());
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::avx512> prefix_sum(simd<double, abi::avx512> const & a)
+	{
+		// Shift the lanes up by 1, 2 and 4 with zeros shifted in, adding after each shift.
+		const __m512i zero = _mm512_setzero_si512();
+		__m512i x			= _mm512_castpd_si512(a.get());
+		x					= _mm512_castpd_si512(_mm512_add_pd(_mm512_castsi512_pd(x), _mm512_castsi512_pd(_mm512_alignr_epi64(x, zero, 7))));
+		x					= _mm512_castpd_si512(_mm512_add_pd(_mm512_castsi512_pd(x), _mm512_castsi512_pd(_mm512_alignr_epi64(x, zero, 6))));
+		return {_mm512_add_pd(_mm512_castsi512_pd(x), _mm512_castsi512_pd(_mm512_alignr_epi64(x, zero, 4)))};
+	}
+
+	/// Gather with vgatherqpd, vgatherdps, vpgatherqq or vpgatherdd. See the generic gather for the index requirements.
+	/// The masked forms with a zero source and a full mask are used, as GCC warns about the undefined source of the plain ones.
+	template <class T, class Index>
+	CCM_ALWAYS_INLINE simd<T, abi::avx512> gather(T const * base, simd<Index, abi::avx512> const & index)
+	{
+		static_assert(is_simd_integer_v<Index> && sizeof(Index) == sizeof(T), "gather indices must be integers of the width of the loaded lanes.");
+		if constexpr (std::is_same_v<T, double>) { return simd<T, abi::avx512>(_mm512_mask_i64gather_pd(_mm512_setzero_pd(), 0xFF, index.get(), base, 8)); }
+		else if constexpr (std::is_same_v<T, float>) { return simd<T, abi::avx512>(_mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, index.get(), base, 4)); }
+		else if constexpr (sizeof(T) == 8) { return simd<T, abi::avx512>(_mm512_mask_i64gather_epi64(_mm512_setzero_si512(), 0xFF, index.get(), base, 8)); }
+		else { return simd<T, abi::avx512>(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF, index.get(), base, 4)); }
+	}
+
+	/// Partial loads and stores with a lane mask. Masked out lanes are neither read nor written.
+	template <class T>
+	struct simd_partial<T, abi::avx512>
+	{
+		using mask_type = std::conditional_t<sizeof(T) == 8, __mmask8, __mmask16>;
+
+		static CCM_ALWAYS_INLINE mask_type mask(int count) { return static_cast<mask_type>((1U << static_cast<unsigned>(count)) - 1U); }
+
+		static CCM_ALWAYS_INLINE simd<T, abi::avx512> load(T const * ptr, int count)
+		{
+			if constexpr (std::is_same_v<T, double>) { return simd<T, abi::avx512>(_mm512_maskz_loadu_pd(mask(count), ptr)); }
+			else if constexpr (std::is_same_v<T, float>) { return simd<T, abi::avx512>(_mm512_maskz_loadu_ps(mask(count), ptr)); }
+			else if constexpr (sizeof(T) == 8) { return simd<T, abi::avx512>(_mm512_maskz_loadu_epi64(mask(count), ptr)); }
+			else { return simd<T, abi::avx512>(_mm512_maskz_loadu_epi32(mask(count), ptr)); }
+		}
+
+		static CCM_ALWAYS_INLINE void store(simd<T, abi::avx512> const & value, T * ptr, int count)
+		{
+			if constexpr (std::is_same_v<T, double>) { _mm512_mask_storeu_pd(ptr, mask(count), value.get()); }
+			else if constexpr (std::is_same_v<T, float>) { _mm512_mask_storeu_ps(ptr, mask(count), value.get()); }
+			else if constexpr (sizeof(T) == 8) { _mm512_mask_storeu_epi64(ptr, mask(count), value.get()); }
+			else { _mm512_mask_storeu_epi32(ptr, mask(count), value.get()); }
+		}
+	};
+
+	/// Masked arithmetic and stores straight on the mask registers, without a blend. Integer lanes have no multiply or divide.
+	template <class T>
+	struct simd_masked<T, abi::avx512>
+	{
+		using simd_type = simd<T, abi::avx512>;
+		using mask_type = simd_mask<T, abi::avx512>;
+
+		static CCM_ALWAYS_INLINE simd_type assign(mask_type const & mask, simd_type const & value, simd_type const & x)
+		{
+			if constexpr (std::is_same_v<T, double>) { return {_mm512_mask_mov_pd(value.get(), mask.get(), x.get())}; }
+			else if constexpr (std::is_same_v<T, float>) { return {_mm512_mask_mov_ps(value.get(), mask.get(), x.get())}; }
+			else if constexpr (sizeof(T) == 8) { return simd_type(_mm512_mask_mov_epi64(value.get(), mask.get(), x.get())); }
+			else { return simd_type(_mm512_mask_mov_epi32(value.get(), mask.get(), x.get())); }
+		}
+
+		static CCM_ALWAYS_INLINE simd_type add(mask_type const & mask, simd_type const & value, simd_type const & x)
+		{
+			if constexpr (std::is_same_v<T, double>) { return {_mm512_mask_add_pd(value.get(), mask.get(), value.get(), x.get())}; }
+			else if constexpr (std::is_same_v<T, float>) { return {_mm512_mask_add_ps(value.get(), mask.get(), value.get(), x.get())}; }
+			else if constexpr (sizeof(T) == 8) { return simd_type(_mm512_mask_add_epi64(value.get(), mask.get(), value.get(), x.get())); }
+			else { return simd_type(_mm512_mask_add_epi32(value.get(), mask.get(), value.get(), x.get())); }
+		}
+
+		static CCM_ALWAYS_INLINE simd_type sub(mask_type const & mask, simd_type const & value, simd_type const & x)
+		{
+			if constexpr (std::is_same_v<T, double>) { return {_mm512_mask_sub_pd(value.get(), mask.get(), value.get(), x.get())}; }
+			else if constexpr (std::is_same_v<T, float>) { return {_mm512_mask_sub_ps(value.get(), mask.get(), value.get(), x.get())}; }
+			else if constexpr (sizeof(T) == 8) { return simd_type(_mm512_mask_sub_epi64(value.get(), mask.get(), value.get(), x.get())); }
+			else { return simd_type(_mm512_mask_sub_epi32(value.get(), mask.get(), value.get(), x.get())); }
+		}
+
+		static CCM_ALWAYS_INLINE simd_type mul(mask_type const & mask, simd_type const & value, simd_type const & x)
+		{
+			static_assert(std::is_floating_point_v<T>, "Masked multiply needs float or double lanes.");
+			if constexpr (std::is_same_v<T, double>) { return {_mm512_mask_mul_pd(value.get(), mask.get(), value.get(), x.get())}; }
+			else { return {_mm512_mask_mul_ps(value.get(), mask.get(), value.get(), x.get())}; }
+		}
+
+		static CCM_ALWAYS_INLINE simd_type div(mask_type const & mask, simd_type const & value, simd_type const & x)
+		{
+			static_assert(std::is_floating_point_v<T>, "Masked divide needs float or double lanes.");
+			if constexpr (std::is_same_v<T, double>) { return {_mm512_mask_div_pd(value.get(), mask.get(), value.get(), x.get())}; }
+			else { return {_mm512_mask_div_ps(value.get(), mask.get(), value.get(), x.get())}; }
+		}
+
+		static CCM_ALWAYS_INLINE void store(mask_type const & mask, simd_type const & value, T * ptr)
+		{
+			if constexpr (std::is_same_v<T, double>) { _mm512_mask_storeu_pd(ptr, mask.get(), value.get()); }
+			else if constexpr (std::is_same_v<T, float>) { _mm512_mask_storeu_ps(ptr, mask.get(), value.get()); }
+			else if constexpr (sizeof(T) == 8) { _mm512_mask_storeu_epi64(ptr, mask.get(), value.get()); }
+			else { _mm512_mask_storeu_epi32(ptr, mask.get(), value.get()); }
+		}
+	};
+
 } // namespace ccm::intrin
 
 	#endif // CCMATH_HAS_SIMD_AVX512F
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/math/runtime/simd/common.hpp"
+#include "ccmath/internal/math/runtime/simd/instructions/sse_int.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_AVX
+		#include <immintrin.h>
+
+/**
+ * 32 and 64 bit integer lanes in one __m256i, shared by the AVX and AVX2 ABIs.
+ *
+ * AVX only has 256 bit integer loads, stores, tests and blends. Without AVX2 the arithmetic, shifts and compares run on
+ * the two 128 bit halves with the SSE integer operations, and the bitwise operations use their float equivalents.
+ */
+namespace ccm::intrin::internal
+{
+	template <class T>
+	struct avx_int_ops
+	{
+		static_assert(is_simd_integer_v<T>, "Integer simd lanes must be 32 or 64 bit integers.");
+
+		static constexpr bool is_64bit = sizeof(T) == 8;
+
+		static CCM_ALWAYS_INLINE __m256i set1(T value)
+		{
+			if constexpr (is_64bit) { return _mm256_set1_epi64x(static_cast<long long>(value)); }
+			else { return _mm256_set1_epi32(static_cast<int>(value)); }
+		}
+
+		static CCM_ALWAYS_INLINE __m256i bit_and(__m256i a, __m256i b)
+		{
+		#ifdef CCMATH_HAS_SIMD_AVX2
+			return _mm256_and_si256(a, b);
+		#else
+			return _mm256_castps_si256(_mm256_and_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+		#endif
+		}
+
+		static CCM_ALWAYS_INLINE __m256i bit_or(__m256i a, __m256i b)
+		{
+		#ifdef CCMATH_HAS_SIMD_AVX2
+			return _mm256_or_si256(a, b);
+		#else
+			return _mm256_castps_si256(_mm256_or_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+		#endif
+		}
+
+		static CCM_ALWAYS_INLINE __m256i bit_xor(__m256i a, __m256i b)
+		{
+		#ifdef CCMATH_HAS_SIMD_AVX2
+			return _mm256_xor_si256(a, b);
+		#else
+			return _mm256_castps_si256(_mm256_xor_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+		#endif
+		}
+
+		static CCM_ALWAYS_INLINE __m256i bit_not(__m256i a) { return bit_xor(a, _mm256_set1_epi32(-1)); }
+
+		/// Lanes of b where mask is set, lanes of c elsewhere.
+		static CCM_ALWAYS_INLINE __m256i blend(__m256i mask, __m256i b, __m256i c)
+		{
+		#ifdef CCMATH_HAS_SIMD_AVX2
+			return _mm256_blendv_epi8(c, b, mask);
+		#else
+			return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(c), _mm256_castsi256_ps(b), _mm256_castsi256_ps(mask)));
+		#endif
+		}
+
+		#ifdef CCMATH_HAS_SIMD_AVX2
+		static CCM_ALWAYS_INLINE __m256i add(__m256i a, __m256i b)
+		{
+			if constexpr (is_64bit) { return _mm256_add_epi64(a, b); }
+			else { return _mm256_add_epi32(a, b); }
+		}
+
+		static CCM_ALWAYS_INLINE __m256i sub(__m256i a, __m256i b)
+		{
+			if constexpr (is_64bit) { return _mm256_sub_epi64(a, b); }
+			else { return _mm256_sub_epi32(a, b); }
+		}
+
+		static CCM_ALWAYS_INLINE __m256i shl(__m256i a, int count)
+		{
+			if constexpr (is_64bit) { return _mm256_sll_epi64(a, _mm_cvtsi32_si128(count)); }
+			else { return _mm256_sll_epi32(a, _mm_cvtsi32_si128(count)); }
+		}
+
+		/// Arithmetic shift for signed lanes, logical shift for unsigned lanes.
+		static CCM_ALWAYS_INLINE __m256i shr(__m256i a, int count)
+		{
+			const __m128i n = _mm_cvtsi32_si128(count);
+			if constexpr (is_64bit && std::is_signed_v<T>)
+			{
+			#if defined(CCMATH_HAS_SIMD_AVX512F) && defined(CCMATH_HAS_SIMD_AVX512VL)
+				return _mm256_sra_epi64(a, n);
+			#else
+				const __m256i m = _mm256_srl_epi64(_mm256_set1_epi64x(std::numeric_limits<long long>::min()), n);
+				return _mm256_sub_epi64(_mm256_xor_si256(_mm256_srl_epi64(a, n), m), m);
+			#endif
+			}
+			else if constexpr (is_64bit) { return _mm256_srl_epi64(a, n); }
+			else if constexpr (std::is_signed_v<T>) { return _mm256_sra_epi32(a, n); }
+			else { return _mm256_srl_epi32(a, n); }
+		}
+
+		static CCM_ALWAYS_INLINE __m256i eq(__m256i a, __m256i b)
+		{
+			if constexpr (is_64bit) { return _mm256_cmpeq_epi64(a, b); }
+			else { return _mm256_cmpeq_epi32(a, b); }
+		}
+
+		/// a < b. Unsigned lanes are compared with the sign bit flipped.
+		static CCM_ALWAYS_INLINE __m256i lt(__m256i a, __m256i b)
+		{
+			if constexpr (std::is_unsigned_v<T>)
+			{
+				const __m256i sign = set1(static_cast<T>(T{1} << (8 * sizeof(T) - 1)));
+				a				   = _mm256_xor_si256(a, sign);
+				b				   = _mm256_xor_si256(b, sign);
+			}
+			if constexpr (is_64bit) { return _mm256_cmpgt_epi64(b, a); }
+			else { return _mm256_cmpgt_epi32(b, a); }
+		}
+		#else
+		/// Apply a 128 bit operation to both halves.
+		template <class Op>
+		static CCM_ALWAYS_INLINE __m256i halves(__m256i a, __m256i b, Op op)
+		{
+			const __m128i lo = op(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b));
+			const __m128i hi = op(_mm256_extractf128_si256(a, 1), _mm256_extractf128_si256(b, 1));
+			return _mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1);
+		}
+
+		static CCM_ALWAYS_INLINE __m256i add(__m256i a, __m256i b) { return halves(a, b, sse_int_ops<T>::add); }
+		static CCM_ALWAYS_INLINE __m256i sub(__m256i a, __m256i b) { return halves(a, b, sse_int_ops<T>::sub); }
+		static CCM_ALWAYS_INLINE __m256i eq(__m256i a, __m256i b) { return halves(a, b, sse_int_ops<T>::eq); }
+		static CCM_ALWAYS_INLINE __m256i lt(__m256i a, __m256i b) { return halves(a, b, sse_int_ops<T>::lt); }
+
+		static CCM_ALWAYS_INLINE __m256i shl(__m256i a, int count)
+		{
+			return halves(a, a, [count](__m128i x, __m128i /*unused*/) { return sse_int_ops<T>::shl(x, count); });
+		}
+
+		static CCM_ALWAYS_INLINE __m256i shr(__m256i a, int count)
+		{
+			return halves(a, a, [count](__m128i x, __m128i /*unused*/) { return sse_int_ops<T>::shr(x, count); });
+		}
+		#endif
+	};
+
+	template <class T, class Abi>
+	struct avx_int_mask
+	{
+		using value_type					 = bool;
+		using simd_type						 = simd<T, Abi>;
+		using abi_type						 = Abi;
+		CCM_ALWAYS_INLINE avx_int_mask() = default;
+		CCM_ALWAYS_INLINE explicit avx_int_mask(bool value) : m_value(_mm256_set1_epi32(-static_cast<int>(value))) {}
+		static constexpr int size() { return static_cast<int>(32 / sizeof(T)); }
+		constexpr explicit avx_int_mask(__m256i const & value_in) : m_value(value_in) {}
+		[[nodiscard]] CCM_ALWAYS_INLINE constexpr __m256i get() const { return m_value; }
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator||(simd_mask<T, Abi> const & other) const
+		{
+			return simd_mask<T, Abi>(avx_int_ops<T>::bit_or(m_value, other.get()));
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator&&(simd_mask<T, Abi> const & other) const
+		{
+			return simd_mask<T, Abi>(avx_int_ops<T>::bit_and(m_value, other.get()));
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator!() const { return simd_mask<T, Abi>(avx_int_ops<T>::bit_not(m_value)); }
+
+	private:
+		__m256i m_value;
+	};
+
+	template <class T, class Abi>
+	struct avx_int_simd
+	{
+		using value_type				= T;
+		using abi_type					= Abi;
+		using mask_type					= simd_mask<T, abi_type>;
+		using storage_type				= simd_storage<T, abi_type>;
+		using ops						= avx_int_ops<T>;
+		CCM_ALWAYS_INLINE avx_int_simd() = default;
+		static constexpr int size() { return static_cast<int>(32 / sizeof(T)); }
+		CCM_ALWAYS_INLINE avx_int_simd(T value) : m_value(ops::set1(value)) {}
+		CCM_ALWAYS_INLINE avx_int_simd(storage_type const & value) { copy_from(value.data(), element_aligned_tag()); }
+		template <class Flags>
+		CCM_ALWAYS_INLINE avx_int_simd(T const * ptr, Flags flags)
+		{
+			copy_from(ptr, flags);
+		}
+		CCM_ALWAYS_INLINE avx_int_simd(T const * ptr, int stride)
+		{
+			std::array<T, size()> lanes;
+			for (int i = 0; i < size(); ++i) { lanes[i] = ptr[i * stride]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			copy_from(lanes.data(), element_aligned_tag());
+		}
+		CCM_ALWAYS_INLINE constexpr avx_int_simd(__m256i const & value_in) : m_value(value_in) {}
+		CCM_ALWAYS_INLINE simd<T, Abi> operator+(simd<T, Abi> const & other) const { return {ops::add(m_value, other.get())}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator-(simd<T, Abi> const & other) const { return {ops::sub(m_value, other.get())}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator-() const { return {ops::sub(_mm256_setzero_si256(), m_value)}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator&(simd<T, Abi> const & other) const { return {ops::bit_and(m_value, other.get())}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator|(simd<T, Abi> const & other) const { return {ops::bit_or(m_value, other.get())}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator^(simd<T, Abi> const & other) const { return {ops::bit_xor(m_value, other.get())}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator~() const { return {ops::bit_not(m_value)}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator<<(int count) const { return {ops::shl(m_value, count)}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator>>(int count) const { return {ops::shr(m_value, count)}; }
+		CCM_ALWAYS_INLINE void copy_from(T const * ptr, element_aligned_tag /*unused*/) { m_value = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(ptr)); }
+		CCM_ALWAYS_INLINE void copy_from(T const * ptr, vector_aligned_tag /*unused*/) { m_value = _mm256_load_si256(reinterpret_cast<__m256i const *>(ptr)); }
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, element_aligned_tag /*unused*/) const { _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), m_value); }
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, vector_aligned_tag /*unused*/) const { _mm256_store_si256(reinterpret_cast<__m256i *>(ptr), m_value); }
+		[[nodiscard]] CCM_ALWAYS_INLINE constexpr __m256i get() const { return m_value; }
+		[[nodiscard]] CCM_ALWAYS_INLINE T convert() const
+		{
+			std::array<T, size()> lanes;
+			copy_to(lanes.data(), element_aligned_tag());
+			return lanes[0];
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator<(simd<T, Abi> const & other) const { return simd_mask<T, Abi>(ops::lt(m_value, other.get())); }
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator==(simd<T, Abi> const & other) const { return simd_mask<T, Abi>(ops::eq(m_value, other.get())); }
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator<=(simd<T, Abi> const & other) const { return simd_mask<T, Abi>(ops::bit_not(ops::lt(other.get(), m_value))); }
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator>(simd<T, Abi> const & other) const { return simd_mask<T, Abi>(ops::lt(other.get(), m_value)); }
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator>=(simd<T, Abi> const & other) const { return simd_mask<T, Abi>(ops::bit_not(ops::lt(m_value, other.get()))); }
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator!=(simd<T, Abi> const & other) const { return simd_mask<T, Abi>(ops::bit_not(ops::eq(m_value, other.get()))); }
+
+	private:
+		__m256i m_value;
+	};
+
+	/// Eight set words followed by eight clear ones. Loading 32 bytes at offset 8 - k gives a mask of the first k words.
+	alignas(64) inline constexpr std::array<std::int32_t, 16> avx_partial_mask_words{-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0};
+
+	/// Partial loads and stores with vmaskmovps and vmaskmovpd, which never touch the masked out lanes. Shared by the AVX and AVX2 ABIs.
+	template <class T, class Abi>
+	struct avx_partial
+	{
+		static CCM_ALWAYS_INLINE __m256i mask(int count)
+		{
+			const int words = count * static_cast<int>(sizeof(T) / sizeof(std::int32_t));
+			return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(avx_partial_mask_words.data() + 8 - words));
+		}
+
+		static CCM_ALWAYS_INLINE simd<T, Abi> load(T const * ptr, int count)
+		{
+			if constexpr (std::is_same_v<T, double>) { return {_mm256_maskload_pd(ptr, mask(count))}; }
+			else if constexpr (std::is_same_v<T, float>) { return {_mm256_maskload_ps(ptr, mask(count))}; }
+			else if constexpr (sizeof(T) == 8) { return {_mm256_castpd_si256(_mm256_maskload_pd(reinterpret_cast<double const *>(ptr), mask(count)))}; }
+			else { return {_mm256_castps_si256(_mm256_maskload_ps(reinterpret_cast<float const *>(ptr), mask(count)))}; }
+		}
+
+		static CCM_ALWAYS_INLINE void store(simd<T, Abi> const & value, T * ptr, int count)
+		{
+			if constexpr (std::is_same_v<T, double>) { _mm256_maskstore_pd(ptr, mask(count), value.get()); }
+			else if constexpr (std::is_same_v<T, float>) { _mm256_maskstore_ps(ptr, mask(count), value.get()); }
+			else if constexpr (sizeof(T) == 8) { _mm256_maskstore_pd(reinterpret_cast<double *>(ptr), mask(count), _mm256_castsi256_pd(value.get())); }
+			else { _mm256_maskstore_ps(reinterpret_cast<float *>(ptr), mask(count), _mm256_castsi256_ps(value.get())); }
+		}
+	};
+} // namespace ccm::intrin::internal
+
+namespace ccm::intrin
+{
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE bool all_of(internal::avx_int_mask<T, Abi> const & a)
+	{
+		return _mm256_testc_si256(a.get(), _mm256_set1_epi32(-1)) != 0;
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE bool any_of(internal::avx_int_mask<T, Abi> const & a)
+	{
+		return _mm256_testz_si256(a.get(), a.get()) == 0;
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> choose(internal::avx_int_mask<T, Abi> const & a, simd<T, Abi> const & b, simd<T, Abi> const & c)
+	{
+		return {internal::avx_int_ops<T>::blend(a.get(), b.get(), c.get())};
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_AVX
+#endif	   // CCMATH_HAS_SIMD
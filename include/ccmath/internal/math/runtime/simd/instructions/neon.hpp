@@ -13,6 +13,10 @@
 #include "ccmath/internal/config/arch/check_simd_support.hpp"
 #include "ccmath/internal/math/runtime/simd/common.hpp"
 
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
 #ifdef CCMATH_HAS_SIMD
 	#ifdef CCMATH_HAS_SIMD_NEON
 		#include <arm_neon.h>
@@ -27,6 +31,195 @@ namespace ccm::intrin
 
 	} // namespace abi
 
+	/**
+	 * 32 and 64 bit integer lanes. The lanes are kept in an unsigned register and reinterpreted as signed for the
+	 * arithmetic shifts and signed compares. float and double have their own specializations below.
+	 */
+	template <class T>
+	struct simd_mask<T, abi::neon>
+	{
+		static_assert(is_simd_integer_v<T>, "Integer simd lanes must be 32 or 64 bit integers.");
+		static constexpr bool is_64bit = sizeof(T) == 8;
+
+		using value_type					 = bool;
+		using simd_type						 = simd<T, abi::neon>;
+		using abi_type						 = abi::neon;
+		using register_type					 = std::conditional_t<is_64bit, uint64x2_t, uint32x4_t>;
+		CCM_ALWAYS_INLINE simd_mask() = default;
+		CCM_ALWAYS_INLINE explicit simd_mask(bool value)
+		{
+			if constexpr (is_64bit) { m_value = vdupq_n_u64(value ? ~std::uint64_t{0} : 0); }
+			else { m_value = vdupq_n_u32(value ? ~std::uint32_t{0} : 0); }
+		}
+		static constexpr int size() { return static_cast<int>(16 / sizeof(T)); }
+		CCM_ALWAYS_INLINE constexpr simd_mask(register_type const & value_in) : m_value(value_in) {}
+		[[nodiscard]] CCM_ALWAYS_INLINE constexpr register_type get() const { return m_value; }
+		CCM_ALWAYS_INLINE simd_mask operator||(simd_mask const & other) const
+		{
+			if constexpr (is_64bit) { return simd_mask(vorrq_u64(m_value, other.m_value)); }
+			else { return simd_mask(vorrq_u32(m_value, other.m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd_mask operator&&(simd_mask const & other) const
+		{
+			if constexpr (is_64bit) { return simd_mask(vandq_u64(m_value, other.m_value)); }
+			else { return simd_mask(vandq_u32(m_value, other.m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd_mask operator!() const
+		{
+			if constexpr (is_64bit) { return simd_mask(vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(m_value)))); }
+			else { return simd_mask(vmvnq_u32(m_value)); }
+		}
+
+	private:
+		register_type m_value;
+	};
+
+	template <class T>
+	CCM_ALWAYS_INLINE bool all_of(simd_mask<T, abi::neon> const & a)
+	{
+		if constexpr (sizeof(T) == 8) { return vminvq_u32(vreinterpretq_u32_u64(a.get())) == static_cast<std::uint32_t>(-1); }
+		else { return vminvq_u32(a.get()) == static_cast<std::uint32_t>(-1); }
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE bool any_of(simd_mask<T, abi::neon> const & a)
+	{
+		if constexpr (sizeof(T) == 8) { return vmaxvq_u32(vreinterpretq_u32_u64(a.get())) != 0; }
+		else { return vmaxvq_u32(a.get()) != 0; }
+	}
+
+	template <class T>
+	struct simd<T, abi::neon>
+	{
+		static_assert(is_simd_integer_v<T>, "Integer simd lanes must be 32 or 64 bit integers.");
+		static constexpr bool is_64bit = sizeof(T) == 8;
+
+		using value_type				= T;
+		using abi_type					= abi::neon;
+		using mask_type					= simd_mask<T, abi_type>;
+		using storage_type				= simd_storage<T, abi_type>;
+		using register_type				= std::conditional_t<is_64bit, uint64x2_t, uint32x4_t>;
+		CCM_ALWAYS_INLINE simd() = default;
+		static constexpr int size() { return static_cast<int>(16 / sizeof(T)); }
+		CCM_ALWAYS_INLINE simd(T value)
+		{
+			if constexpr (is_64bit) { m_value = vdupq_n_u64(static_cast<std::uint64_t>(value)); }
+			else { m_value = vdupq_n_u32(static_cast<std::uint32_t>(value)); }
+		}
+		CCM_ALWAYS_INLINE simd(storage_type const & value) { copy_from(value.data(), element_aligned_tag()); }
+		CCM_ALWAYS_INLINE simd & operator=(storage_type const & value)
+		{
+			copy_from(value.data(), element_aligned_tag());
+			return *this;
+		}
+		template <class Flags>
+		CCM_ALWAYS_INLINE simd(T const * ptr, Flags flags)
+		{
+			copy_from(ptr, flags);
+		}
+		CCM_ALWAYS_INLINE simd(T const * ptr, int stride)
+		{
+			std::array<T, size()> lanes;
+			for (int i = 0; i < size(); ++i) { lanes[i] = ptr[i * stride]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			copy_from(lanes.data(), element_aligned_tag());
+		}
+		CCM_ALWAYS_INLINE constexpr simd(register_type const & value_in) : m_value(value_in) {}
+		CCM_ALWAYS_INLINE simd operator+(simd const & other) const
+		{
+			if constexpr (is_64bit) { return simd(vaddq_u64(m_value, other.m_value)); }
+			else { return simd(vaddq_u32(m_value, other.m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd operator-(simd const & other) const
+		{
+			if constexpr (is_64bit) { return simd(vsubq_u64(m_value, other.m_value)); }
+			else { return simd(vsubq_u32(m_value, other.m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd operator-() const { return simd(T{0}) - *this; }
+		CCM_ALWAYS_INLINE simd operator&(simd const & other) const
+		{
+			if constexpr (is_64bit) { return simd(vandq_u64(m_value, other.m_value)); }
+			else { return simd(vandq_u32(m_value, other.m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd operator|(simd const & other) const
+		{
+			if constexpr (is_64bit) { return simd(vorrq_u64(m_value, other.m_value)); }
+			else { return simd(vorrq_u32(m_value, other.m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd operator^(simd const & other) const
+		{
+			if constexpr (is_64bit) { return simd(veorq_u64(m_value, other.m_value)); }
+			else { return simd(veorq_u32(m_value, other.m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd operator~() const
+		{
+			if constexpr (is_64bit) { return simd(vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(m_value)))); }
+			else { return simd(vmvnq_u32(m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd operator<<(int count) const
+		{
+			if constexpr (is_64bit) { return simd(vshlq_u64(m_value, vdupq_n_s64(count))); }
+			else { return simd(vshlq_u32(m_value, vdupq_n_s32(count))); }
+		}
+		/// Arithmetic shift for signed lanes, logical shift for unsigned lanes. NEON shifts right by a negative left shift.
+		CCM_ALWAYS_INLINE simd operator>>(int count) const
+		{
+			if constexpr (is_64bit && std::is_signed_v<T>) { return simd(vreinterpretq_u64_s64(vshlq_s64(vreinterpretq_s64_u64(m_value), vdupq_n_s64(-count)))); }
+			else if constexpr (is_64bit) { return simd(vshlq_u64(m_value, vdupq_n_s64(-count))); }
+			else if constexpr (std::is_signed_v<T>) { return simd(vreinterpretq_u32_s32(vshlq_s32(vreinterpretq_s32_u32(m_value), vdupq_n_s32(-count)))); }
+			else { return simd(vshlq_u32(m_value, vdupq_n_s32(-count))); }
+		}
+		CCM_ALWAYS_INLINE void copy_from(T const * ptr, element_aligned_tag /*unused*/)
+		{
+			if constexpr (is_64bit) { m_value = vld1q_u64(reinterpret_cast<std::uint64_t const *>(ptr)); }
+			else { m_value = vld1q_u32(reinterpret_cast<std::uint32_t const *>(ptr)); }
+		}
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, element_aligned_tag /*unused*/) const
+		{
+			if constexpr (is_64bit) { vst1q_u64(reinterpret_cast<std::uint64_t *>(ptr), m_value); }
+			else { vst1q_u32(reinterpret_cast<std::uint32_t *>(ptr), m_value); }
+		}
+		CCM_ALWAYS_INLINE void copy_from(T const * ptr, vector_aligned_tag /*unused*/) { copy_from(ptr, element_aligned_tag()); }
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, vector_aligned_tag /*unused*/) const { copy_to(ptr, element_aligned_tag()); }
+		[[nodiscard]] CCM_ALWAYS_INLINE constexpr register_type get() const { return m_value; }
+		[[nodiscard]] CCM_ALWAYS_INLINE T convert() const
+		{
+			if constexpr (is_64bit) { return static_cast<T>(vgetq_lane_u64(m_value, 0)); }
+			else { return static_cast<T>(vgetq_lane_u32(m_value, 0)); }
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::neon> operator<(simd const & other) const
+		{
+			if constexpr (is_64bit && std::is_signed_v<T>)
+			{
+				return simd_mask<T, abi::neon>(vcltq_s64(vreinterpretq_s64_u64(m_value), vreinterpretq_s64_u64(other.m_value)));
+			}
+			else if constexpr (is_64bit) { return simd_mask<T, abi::neon>(vcltq_u64(m_value, other.m_value)); }
+			else if constexpr (std::is_signed_v<T>)
+			{
+				return simd_mask<T, abi::neon>(vcltq_s32(vreinterpretq_s32_u32(m_value), vreinterpretq_s32_u32(other.m_value)));
+			}
+			else { return simd_mask<T, abi::neon>(vcltq_u32(m_value, other.m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::neon> operator==(simd const & other) const
+		{
+			if constexpr (is_64bit) { return simd_mask<T, abi::neon>(vceqq_u64(m_value, other.m_value)); }
+			else { return simd_mask<T, abi::neon>(vceqq_u32(m_value, other.m_value)); }
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::neon> operator<=(simd const & other) const { return !(other < *this); }
+		CCM_ALWAYS_INLINE simd_mask<T, abi::neon> operator>(simd const & other) const { return other < *this; }
+		CCM_ALWAYS_INLINE simd_mask<T, abi::neon> operator>=(simd const & other) const { return !(*this < other); }
+		CCM_ALWAYS_INLINE simd_mask<T, abi::neon> operator!=(simd const & other) const { return !(*this == other); }
+
+	private:
+		register_type m_value;
+	};
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::neon> choose(simd_mask<T, abi::neon> const & a, simd<T, abi::neon> const & b, simd<T, abi::neon> const & c)
+	{
+		if constexpr (sizeof(T) == 8) { return simd<T, abi::neon>(vbslq_u64(a.get(), b.get(), c.get())); }
+		else { return simd<T, abi::neon>(vbslq_u32(a.get(), b.get(), c.get())); }
+	}
+
 	template <>
 	struct simd_mask<float, abi::neon>
 	{
@@ -87,7 +280,9 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE simd operator-(simd const & other) const { return simd(vsubq_f32(m_value, other.m_value)); }
 		CCM_ALWAYS_INLINE simd operator-() const { return simd(vnegq_f32(m_value)); }
 		CCM_ALWAYS_INLINE void copy_from(float const * ptr, element_aligned_tag) { m_value = vld1q_f32(ptr); }
+		CCM_ALWAYS_INLINE void copy_from(float const * ptr, vector_aligned_tag /*unused*/) { m_value = vld1q_f32(ptr); }
 		CCM_ALWAYS_INLINE void copy_to(float * ptr, element_aligned_tag) const { vst1q_f32(ptr, m_value); }
+		CCM_ALWAYS_INLINE void copy_to(float * ptr, vector_aligned_tag /*unused*/) const { vst1q_f32(ptr, m_value); }
 		[[nodiscard]] CCM_ALWAYS_INLINE constexpr float32x4_t get() const { return m_value; }
 		[[nodiscard]] CCM_ALWAYS_INLINE float convert() const { return vgetq_lane_f32(m_value, 0); }
 		CCM_ALWAYS_INLINE simd_mask<float, abi::neon> operator<(simd const & other) const
@@ -98,6 +293,22 @@ namespace ccm::intrin
 		{
 			return simd_mask<float, abi::neon>(vceqq_f32(m_value, other.m_value));
 		}
+		CCM_ALWAYS_INLINE simd_mask<float, abi::neon> operator<=(simd const & other) const
+		{
+			return simd_mask<float, abi::neon>(vcleq_f32(m_value, other.m_value));
+		}
+		CCM_ALWAYS_INLINE simd_mask<float, abi::neon> operator>(simd const & other) const
+		{
+			return simd_mask<float, abi::neon>(vcgtq_f32(m_value, other.m_value));
+		}
+		CCM_ALWAYS_INLINE simd_mask<float, abi::neon> operator>=(simd const & other) const
+		{
+			return simd_mask<float, abi::neon>(vcgeq_f32(m_value, other.m_value));
+		}
+		CCM_ALWAYS_INLINE simd_mask<float, abi::neon> operator!=(simd const & other) const
+		{
+			return simd_mask<float, abi::neon>(vmvnq_u32(vceqq_f32(m_value, other.m_value)));
+		}
 
 	private:
 		float32x4_t m_value;
@@ -106,7 +317,110 @@ namespace ccm::intrin
 	CCM_ALWAYS_INLINE simd<float, abi::neon> choose(simd_mask<float, abi::neon> const & a, simd<float, abi::neon> const & b,
 														   simd<float, abi::neon> const & c)
 	{
-		return simd<float, abi::neon>(vreinterpretq_f32_u32(vbslq_u32(a.get(), vreinterpretq_u32_f32(b.get()), vreinterpretq_u32_f32(c.get()))));
+		return {vreinterpretq_f32_u32(vbslq_u32(a.get(), vreinterpretq_u32_f32(b.get()), vreinterpretq_u32_f32(c.get())))};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> fma(simd<float, abi::neon> const & a, simd<float, abi::neon> const & b, simd<float, abi::neon> const & c)
+	{
+		return {vfmaq_f32(c.get(), a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> fms(simd<float, abi::neon> const & a, simd<float, abi::neon> const & b, simd<float, abi::neon> const & c)
+	{
+		return {vnegq_f32(vfmsq_f32(c.get(), a.get(), b.get()))};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> fnma(simd<float, abi::neon> const & a, simd<float, abi::neon> const & b, simd<float, abi::neon> const & c)
+	{
+		return {vfmsq_f32(c.get(), a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> min(simd<float, abi::neon> const & a, simd<float, abi::neon> const & b)
+	{
+		return {vbslq_f32(vcltq_f32(a.get(), b.get()), a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> max(simd<float, abi::neon> const & a, simd<float, abi::neon> const & b)
+	{
+		return {vbslq_f32(vcltq_f32(b.get(), a.get()), a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> abs(simd<float, abi::neon> const & a)
+	{
+		return {vabsq_f32(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> copysign(simd<float, abi::neon> const & magnitude, simd<float, abi::neon> const & sign)
+	{
+		return {vbslq_f32(vdupq_n_u32(0x80000000U), sign.get(), magnitude.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> rsqrt(simd<float, abi::neon> const & a)
+	{
+		// vrsqrtsq(x, y * y) keeps zero and infinite lanes exact, unlike vrsqrtsq(x * y, y).
+		float32x4_t estimate = vrsqrteq_f32(a.get());
+		for (int i = 0; i < 2; ++i) { estimate = vmulq_f32(estimate, vrsqrtsq_f32(a.get(), vmulq_f32(estimate, estimate))); }
+		return simd<float, abi::neon>(estimate);
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> rsqrt_estimate(simd<float, abi::neon> const & a)
+	{
+		return {vrsqrteq_f32(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> rcp(simd<float, abi::neon> const & a)
+	{
+		float32x4_t estimate = vrecpeq_f32(a.get());
+		for (int i = 0; i < 2; ++i) { estimate = vmulq_f32(estimate, vrecpsq_f32(a.get(), estimate)); }
+		return simd<float, abi::neon>(estimate);
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> floor(simd<float, abi::neon> const & a)
+	{
+		return {vrndmq_f32(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> ceil(simd<float, abi::neon> const & a)
+	{
+		return {vrndpq_f32(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> trunc(simd<float, abi::neon> const & a)
+	{
+		return {vrndq_f32(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> round(simd<float, abi::neon> const & a)
+	{
+		return {vrndaq_f32(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE float reduce_add(simd<float, abi::neon> const & a)
+	{
+		return vaddvq_f32(a.get());
+	}
+
+	CCM_ALWAYS_INLINE float reduce_mul(simd<float, abi::neon> const & a)
+	{
+		const float32x2_t pairs = vmul_f32(vget_low_f32(a.get()), vget_high_f32(a.get()));
+		return vget_lane_f32(pairs, 0) * vget_lane_f32(pairs, 1);
+	}
+
+	CCM_ALWAYS_INLINE float reduce_min(simd<float, abi::neon> const & a)
+	{
+		return vminvq_f32(a.get());
+	}
+
+	CCM_ALWAYS_INLINE float reduce_max(simd<float, abi::neon> const & a)
+	{
+		return vmaxvq_f32(a.get());
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::neon> prefix_sum(simd<float, abi::neon> const & a)
+	{
+		const float32x4_t zero = vdupq_n_f32(0.0F);
+		const float32x4_t x	   = vaddq_f32(a.get(), vextq_f32(zero, a.get(), 3));
+		return {vaddq_f32(x, vextq_f32(zero, x, 2))};
 	}
 
 	template <>
@@ -172,7 +486,9 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE simd operator-(simd const & other) const { return simd(vsubq_f64(m_value, other.m_value)); }
 		CCM_ALWAYS_INLINE simd operator-() const { return simd(vnegq_f64(m_value)); }
 		CCM_ALWAYS_INLINE void copy_from(double const * ptr, element_aligned_tag) { m_value = vld1q_f64(ptr); }
+		CCM_ALWAYS_INLINE void copy_from(double const * ptr, vector_aligned_tag /*unused*/) { m_value = vld1q_f64(ptr); }
 		CCM_ALWAYS_INLINE void copy_to(double * ptr, element_aligned_tag) const { vst1q_f64(ptr, m_value); }
+		CCM_ALWAYS_INLINE void copy_to(double * ptr, vector_aligned_tag /*unused*/) const { vst1q_f64(ptr, m_value); }
 		[[nodiscard]] CCM_ALWAYS_INLINE constexpr float64x2_t get() const { return m_value; }
 		[[nodiscard]] CCM_ALWAYS_INLINE double convert() const { return vgetq_lane_f64(m_value, 0); }
 		CCM_ALWAYS_INLINE simd_mask<double, abi::neon> operator<(simd const & other) const
@@ -183,6 +499,22 @@ namespace ccm::intrin
 		{
 			return simd_mask<double, abi::neon>(vceqq_f64(m_value, other.m_value));
 		}
+		CCM_ALWAYS_INLINE simd_mask<double, abi::neon> operator<=(simd const & other) const
+		{
+			return simd_mask<double, abi::neon>(vcleq_f64(m_value, other.m_value));
+		}
+		CCM_ALWAYS_INLINE simd_mask<double, abi::neon> operator>(simd const & other) const
+		{
+			return simd_mask<double, abi::neon>(vcgtq_f64(m_value, other.m_value));
+		}
+		CCM_ALWAYS_INLINE simd_mask<double, abi::neon> operator>=(simd const & other) const
+		{
+			return simd_mask<double, abi::neon>(vcgeq_f64(m_value, other.m_value));
+		}
+		CCM_ALWAYS_INLINE simd_mask<double, abi::neon> operator!=(simd const & other) const
+		{
+			return simd_mask<double, abi::neon>(vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(vceqq_f64(m_value, other.m_value)))));
+		}
 
 	private:
 		float64x2_t m_value;
@@ -191,7 +523,107 @@ namespace ccm::intrin
 	CCM_ALWAYS_INLINE simd<double, abi::neon> choose(simd_mask<double, abi::neon> const & a, simd<double, abi::neon> const & b,
 															simd<double, abi::neon> const & c)
 	{
-		return simd<double, abi::neon>(vreinterpretq_f64_u64(vbslq_u64(a.get(), vreinterpretq_u64_f64(b.get()), vreinterpretq_u64_f64(c.get()))));
+		return {vreinterpretq_f64_u64(vbslq_u64(a.get(), vreinterpretq_u64_f64(b.get()), vreinterpretq_u64_f64(c.get())))};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> fma(simd<double, abi::neon> const & a, simd<double, abi::neon> const & b, simd<double, abi::neon> const & c)
+	{
+		return {vfmaq_f64(c.get(), a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> fms(simd<double, abi::neon> const & a, simd<double, abi::neon> const & b, simd<double, abi::neon> const & c)
+	{
+		return {vnegq_f64(vfmsq_f64(c.get(), a.get(), b.get()))};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> fnma(simd<double, abi::neon> const & a, simd<double, abi::neon> const & b, simd<double, abi::neon> const & c)
+	{
+		return {vfmsq_f64(c.get(), a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> min(simd<double, abi::neon> const & a, simd<double, abi::neon> const & b)
+	{
+		return {vbslq_f64(vcltq_f64(a.get(), b.get()), a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> max(simd<double, abi::neon> const & a, simd<double, abi::neon> const & b)
+	{
+		return {vbslq_f64(vcltq_f64(b.get(), a.get()), a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> abs(simd<double, abi::neon> const & a)
+	{
+		return {vabsq_f64(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> copysign(simd<double, abi::neon> const & magnitude, simd<double, abi::neon> const & sign)
+	{
+		return {vbslq_f64(vdupq_n_u64(0x8000000000000000ULL), sign.get(), magnitude.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> rsqrt(simd<double, abi::neon> const & a)
+	{
+		// vrsqrtsq(x, y * y) keeps zero and infinite lanes exact, unlike vrsqrtsq(x * y, y).
+		float64x2_t estimate = vrsqrteq_f64(a.get());
+		for (int i = 0; i < 3; ++i) { estimate = vmulq_f64(estimate, vrsqrtsq_f64(a.get(), vmulq_f64(estimate, estimate))); }
+		return simd<double, abi::neon>(estimate);
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> rsqrt_estimate(simd<double, abi::neon> const & a)
+	{
+		return {vrsqrteq_f64(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> rcp(simd<double, abi::neon> const & a)
+	{
+		float64x2_t estimate = vrecpeq_f64(a.get());
+		for (int i = 0; i < 3; ++i) { estimate = vmulq_f64(estimate, vrecpsq_f64(a.get(), estimate)); }
+		return simd<double, abi::neon>(estimate);
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> floor(simd<double, abi::neon> const & a)
+	{
+		return {vrndmq_f64(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> ceil(simd<double, abi::neon> const & a)
+	{
+		return {vrndpq_f64(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> trunc(simd<double, abi::neon> const & a)
+	{
+		return {vrndq_f64(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> round(simd<double, abi::neon> const & a)
+	{
+		return {vrndaq_f64(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE double reduce_add(simd<double, abi::neon> const & a)
+	{
+		return vaddvq_f64(a.get());
+	}
+
+	CCM_ALWAYS_INLINE double reduce_mul(simd<double, abi::neon> const & a)
+	{
+		return vgetq_lane_f64(a.get(), 0) * vgetq_lane_f64(a.get(), 1);
+	}
+
+	CCM_ALWAYS_INLINE double reduce_min(simd<double, abi::neon> const & a)
+	{
+		return vminvq_f64(a.get());
+	}
+
+	CCM_ALWAYS_INLINE double reduce_max(simd<double, abi::neon> const & a)
+	{
+		return vmaxvq_f64(a.get());
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::neon> prefix_sum(simd<double, abi::neon> const & a)
+	{
+		return {vaddq_f64(a.get(), vextq_f64(vdupq_n_f64(0.0), a.get(), 1))};
 	}
 } // namespace ccm::intrin
 	#endif // CCMATH_HAS_SIMD_NEON
@@ -12,6 +12,9 @@
 
 #include "ccmath/internal/math/runtime/simd/common.hpp"
 
+#include <cmath>
+#include <type_traits>
+
 namespace ccm::intrin
 {
 	namespace abi
@@ -31,9 +34,9 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE static constexpr int size() { return 1; }
 		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE explicit simd_mask(bool value) : m_value(value) {}
 		[[nodiscard]] CCM_GPU_HOST_DEVICE constexpr bool get() const { return m_value; }
-		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd_mask operator||(simd_mask const & other) const { return m_value || other.m_value; }
-		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd_mask operator&&(simd_mask const & other) const { return m_value && other.m_value; }
-		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd_mask operator!() const { return !m_value; }
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd_mask operator||(simd_mask const & other) const { return simd_mask(m_value || other.m_value); }
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd_mask operator&&(simd_mask const & other) const { return simd_mask(m_value && other.m_value); }
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd_mask operator!() const { return simd_mask(!m_value); }
 
 	private:
 		bool m_value;
@@ -113,8 +116,17 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator+(simd const & other) const { return simd(m_value + other.m_value); }
 		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator-(simd const & other) const { return simd(m_value - other.m_value); }
 		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator-() const { return simd(-m_value); }
+		// Bitwise operators and shifts are only instantiated for the integer lane types.
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator&(simd const & other) const { return simd(static_cast<T>(m_value & other.m_value)); }
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator|(simd const & other) const { return simd(static_cast<T>(m_value | other.m_value)); }
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator^(simd const & other) const { return simd(static_cast<T>(m_value ^ other.m_value)); }
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator~() const { return simd(static_cast<T>(~m_value)); }
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator<<(int count) const { return simd(static_cast<T>(static_cast<std::make_unsigned_t<T>>(m_value) << count)); }
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator>>(int count) const { return simd(static_cast<T>(m_value >> count)); }
 		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE void copy_from(T const * ptr, element_aligned_tag /*unused*/) { m_value = *ptr; }
 		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE void copy_to(T * ptr, element_aligned_tag /*unused*/) const { *ptr = m_value; }
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE void copy_from(T const * ptr, vector_aligned_tag /*unused*/) { copy_from(ptr, element_aligned_tag()); }
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE void copy_to(T * ptr, vector_aligned_tag /*unused*/) const { copy_to(ptr, element_aligned_tag()); }
 		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE constexpr T get() const { return m_value; }
 		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE T convert() const { return m_value; }
 
@@ -126,6 +138,22 @@ namespace ccm::intrin
 		{
 			return simd_mask<T, abi::scalar>(m_value == other.m_value);
 		}
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd_mask<T, abi::scalar> operator<=(simd const & other) const
+		{
+			return simd_mask<T, abi::scalar>(m_value <= other.m_value);
+		}
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd_mask<T, abi::scalar> operator>(simd const & other) const
+		{
+			return simd_mask<T, abi::scalar>(m_value > other.m_value);
+		}
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd_mask<T, abi::scalar> operator>=(simd const & other) const
+		{
+			return simd_mask<T, abi::scalar>(m_value >= other.m_value);
+		}
+		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd_mask<T, abi::scalar> operator!=(simd const & other) const
+		{
+			return simd_mask<T, abi::scalar>(m_value != other.m_value);
+		}
 
 	private:
 		T m_value;
@@ -137,4 +165,94 @@ namespace ccm::intrin
 	{
 		return simd<T, abi::scalar>(choose(a.get(), b.get(), c.get()));
 	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> fma(simd<T, abi::scalar> const & a, simd<T, abi::scalar> const & b, simd<T, abi::scalar> const & c)
+	{
+#ifdef CCMATH_HAS_SIMD_FMA
+		return simd<T, abi::scalar>(std::fma(a.get(), b.get(), c.get()));
+#else
+		return simd<T, abi::scalar>(a.get() * b.get() + c.get());
+#endif
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> fms(simd<T, abi::scalar> const & a, simd<T, abi::scalar> const & b, simd<T, abi::scalar> const & c)
+	{
+#ifdef CCMATH_HAS_SIMD_FMA
+		return simd<T, abi::scalar>(std::fma(a.get(), b.get(), -c.get()));
+#else
+		return simd<T, abi::scalar>(a.get() * b.get() - c.get());
+#endif
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> fnma(simd<T, abi::scalar> const & a, simd<T, abi::scalar> const & b, simd<T, abi::scalar> const & c)
+	{
+#ifdef CCMATH_HAS_SIMD_FMA
+		return simd<T, abi::scalar>(std::fma(-a.get(), b.get(), c.get()));
+#else
+		return simd<T, abi::scalar>(c.get() - a.get() * b.get());
+#endif
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> min(simd<T, abi::scalar> const & a, simd<T, abi::scalar> const & b)
+	{
+		return simd<T, abi::scalar>(a.get() < b.get() ? a.get() : b.get());
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> max(simd<T, abi::scalar> const & a, simd<T, abi::scalar> const & b)
+	{
+		return simd<T, abi::scalar>(b.get() < a.get() ? a.get() : b.get());
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> abs(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(std::fabs(a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> copysign(simd<T, abi::scalar> const & magnitude, simd<T, abi::scalar> const & sign)
+	{
+		return simd<T, abi::scalar>(std::copysign(magnitude.get(), sign.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> rsqrt(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(T{1} / std::sqrt(a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> rcp(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(T{1} / a.get());
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> floor(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(std::floor(a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> ceil(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(std::ceil(a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> trunc(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(std::trunc(a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::scalar> round(simd<T, abi::scalar> const & a)
+	{
+		return simd<T, abi::scalar>(std::round(a.get()));
+	}
 } // namespace ccm::intrin
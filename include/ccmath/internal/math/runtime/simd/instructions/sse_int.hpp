@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/math/runtime/simd/common.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SSE2
+		#include <emmintrin.h> // SSE2
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSE4_1
+		#include <smmintrin.h> // SSE4.1
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSE4_2
+		#include <nmmintrin.h> // SSE4.2
+	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SSE2
+
+/**
+ * 32 and 64 bit integer lanes in one __m128i, shared by every SSE ABI and by the two halves of the AVX integer types.
+ *
+ * SSE2 has no 64 bit compares and no 64 bit arithmetic right shift. Those are built from 32 bit operations and replaced
+ * by the native instructions when SSE4.1 (pcmpeqq) or SSE4.2 (pcmpgtq) are available.
+ */
+namespace ccm::intrin::internal
+{
+	template <class T>
+	struct sse_int_ops
+	{
+		static_assert(is_simd_integer_v<T>, "Integer simd lanes must be 32 or 64 bit integers.");
+
+		static constexpr bool is_64bit = sizeof(T) == 8;
+
+		static CCM_ALWAYS_INLINE __m128i set1(T value)
+		{
+			if constexpr (is_64bit) { return _mm_set1_epi64x(static_cast<long long>(value)); }
+			else { return _mm_set1_epi32(static_cast<int>(value)); }
+		}
+
+		static CCM_ALWAYS_INLINE __m128i add(__m128i a, __m128i b)
+		{
+			if constexpr (is_64bit) { return _mm_add_epi64(a, b); }
+			else { return _mm_add_epi32(a, b); }
+		}
+
+		static CCM_ALWAYS_INLINE __m128i sub(__m128i a, __m128i b)
+		{
+			if constexpr (is_64bit) { return _mm_sub_epi64(a, b); }
+			else { return _mm_sub_epi32(a, b); }
+		}
+
+		static CCM_ALWAYS_INLINE __m128i bit_not(__m128i a) { return _mm_xor_si128(a, _mm_set1_epi32(-1)); }
+
+		static CCM_ALWAYS_INLINE __m128i shl(__m128i a, int count)
+		{
+			if constexpr (is_64bit) { return _mm_sll_epi64(a, _mm_cvtsi32_si128(count)); }
+			else { return _mm_sll_epi32(a, _mm_cvtsi32_si128(count)); }
+		}
+
+		/// Arithmetic shift for signed lanes, logical shift for unsigned lanes.
+		static CCM_ALWAYS_INLINE __m128i shr(__m128i a, int count)
+		{
+			const __m128i n = _mm_cvtsi32_si128(count);
+			if constexpr (is_64bit && std::is_signed_v<T>)
+			{
+				// (a >>> n ^ m) - m with m = sign bit >>> n sign extends the logical shift.
+				const __m128i m = _mm_srl_epi64(_mm_set1_epi64x(std::numeric_limits<long long>::min()), n);
+				return _mm_sub_epi64(_mm_xor_si128(_mm_srl_epi64(a, n), m), m);
+			}
+			else if constexpr (is_64bit) { return _mm_srl_epi64(a, n); }
+			else if constexpr (std::is_signed_v<T>) { return _mm_sra_epi32(a, n); }
+			else { return _mm_srl_epi32(a, n); }
+		}
+
+		static CCM_ALWAYS_INLINE __m128i eq(__m128i a, __m128i b)
+		{
+			if constexpr (is_64bit)
+			{
+		#ifdef CCMATH_HAS_SIMD_SSE4_1
+				return _mm_cmpeq_epi64(a, b);
+		#else
+				// Both 32 bit halves of a lane have to match.
+				const __m128i halves = _mm_cmpeq_epi32(a, b);
+				return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+		#endif
+			}
+			else { return _mm_cmpeq_epi32(a, b); }
+		}
+
+		/// Signed a < b. Unsigned lanes are compared with the sign bit flipped.
+		static CCM_ALWAYS_INLINE __m128i lt(__m128i a, __m128i b)
+		{
+			if constexpr (std::is_unsigned_v<T>)
+			{
+				const __m128i sign = set1(static_cast<T>(T{1} << (8 * sizeof(T) - 1)));
+				a				   = _mm_xor_si128(a, sign);
+				b				   = _mm_xor_si128(b, sign);
+			}
+
+			if constexpr (is_64bit)
+			{
+		#ifdef CCMATH_HAS_SIMD_SSE4_2
+				return _mm_cmpgt_epi64(b, a);
+		#else
+				// The sign bit of (a & ~b) | (~(a ^ b) & (a - b)) is a < b, then broadcast from the high half of each lane.
+				const __m128i less = _mm_or_si128(_mm_andnot_si128(b, a), _mm_andnot_si128(_mm_xor_si128(a, b), _mm_sub_epi64(a, b)));
+				return _mm_shuffle_epi32(_mm_srai_epi32(less, 31), _MM_SHUFFLE(3, 3, 1, 1));
+		#endif
+			}
+			else { return _mm_cmplt_epi32(a, b); }
+		}
+
+		/// Lanes of b where mask is set, lanes of c elsewhere.
+		static CCM_ALWAYS_INLINE __m128i blend(__m128i mask, __m128i b, __m128i c)
+		{
+		#ifdef CCMATH_HAS_SIMD_SSE4_1
+			return _mm_blendv_epi8(c, b, mask);
+		#else
+			return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, c));
+		#endif
+		}
+	};
+
+	template <class T, class Abi>
+	struct sse_int_mask
+	{
+		using value_type					 = bool;
+		using simd_type						 = simd<T, Abi>;
+		using abi_type						 = Abi;
+		CCM_ALWAYS_INLINE sse_int_mask() = default;
+		CCM_ALWAYS_INLINE explicit sse_int_mask(bool value) : m_value(_mm_set1_epi32(-static_cast<int>(value))) {}
+		static constexpr int size() { return static_cast<int>(16 / sizeof(T)); }
+		constexpr explicit sse_int_mask(__m128i const & value_in) : m_value(value_in) {}
+		[[nodiscard]] CCM_ALWAYS_INLINE constexpr __m128i get() const { return m_value; }
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator||(simd_mask<T, Abi> const & other) const
+		{
+			return simd_mask<T, Abi>(_mm_or_si128(m_value, other.get()));
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator&&(simd_mask<T, Abi> const & other) const
+		{
+			return simd_mask<T, Abi>(_mm_and_si128(m_value, other.get()));
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator!() const { return simd_mask<T, Abi>(sse_int_ops<T>::bit_not(m_value)); }
+
+	private:
+		__m128i m_value;
+	};
+
+	template <class T, class Abi>
+	struct sse_int_simd
+	{
+		using value_type				= T;
+		using abi_type					= Abi;
+		using mask_type					= simd_mask<T, abi_type>;
+		using storage_type				= simd_storage<T, abi_type>;
+		using ops						= sse_int_ops<T>;
+		CCM_ALWAYS_INLINE sse_int_simd() = default;
+		static constexpr int size() { return static_cast<int>(16 / sizeof(T)); }
+		CCM_ALWAYS_INLINE sse_int_simd(T value) : m_value(ops::set1(value)) {}
+		CCM_ALWAYS_INLINE sse_int_simd(storage_type const & value) { copy_from(value.data(), element_aligned_tag()); }
+		template <class Flags>
+		CCM_ALWAYS_INLINE sse_int_simd(T const * ptr, Flags flags)
+		{
+			copy_from(ptr, flags);
+		}
+		CCM_ALWAYS_INLINE sse_int_simd(T const * ptr, int stride)
+		{
+			std::array<T, size()> lanes;
+			for (int i = 0; i < size(); ++i) { lanes[i] = ptr[i * stride]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			copy_from(lanes.data(), element_aligned_tag());
+		}
+		CCM_ALWAYS_INLINE constexpr sse_int_simd(__m128i const & value_in) : m_value(value_in) {}
+		CCM_ALWAYS_INLINE simd<T, Abi> operator+(simd<T, Abi> const & other) const { return {ops::add(m_value, other.get())}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator-(simd<T, Abi> const & other) const { return {ops::sub(m_value, other.get())}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator-() const { return {ops::sub(_mm_setzero_si128(), m_value)}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator&(simd<T, Abi> const & other) const { return {_mm_and_si128(m_value, other.get())}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator|(simd<T, Abi> const & other) const { return {_mm_or_si128(m_value, other.get())}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator^(simd<T, Abi> const & other) const { return {_mm_xor_si128(m_value, other.get())}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator~() const { return {ops::bit_not(m_value)}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator<<(int count) const { return {ops::shl(m_value, count)}; }
+		CCM_ALWAYS_INLINE simd<T, Abi> operator>>(int count) const { return {ops::shr(m_value, count)}; }
+		CCM_ALWAYS_INLINE void copy_from(T const * ptr, element_aligned_tag /*unused*/) { m_value = _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr)); }
+		CCM_ALWAYS_INLINE void copy_from(T const * ptr, vector_aligned_tag /*unused*/) { m_value = _mm_load_si128(reinterpret_cast<__m128i const *>(ptr)); }
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, element_aligned_tag /*unused*/) const { _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), m_value); }
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, vector_aligned_tag /*unused*/) const { _mm_store_si128(reinterpret_cast<__m128i *>(ptr), m_value); }
+		[[nodiscard]] CCM_ALWAYS_INLINE constexpr __m128i get() const { return m_value; }
+		[[nodiscard]] CCM_ALWAYS_INLINE T convert() const
+		{
+			std::array<T, size()> lanes;
+			copy_to(lanes.data(), element_aligned_tag());
+			return lanes[0];
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator<(simd<T, Abi> const & other) const { return simd_mask<T, Abi>(ops::lt(m_value, other.get())); }
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator==(simd<T, Abi> const & other) const { return simd_mask<T, Abi>(ops::eq(m_value, other.get())); }
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator<=(simd<T, Abi> const & other) const { return simd_mask<T, Abi>(ops::bit_not(ops::lt(other.get(), m_value))); }
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator>(simd<T, Abi> const & other) const { return simd_mask<T, Abi>(ops::lt(other.get(), m_value)); }
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator>=(simd<T, Abi> const & other) const { return simd_mask<T, Abi>(ops::bit_not(ops::lt(m_value, other.get()))); }
+		CCM_ALWAYS_INLINE simd_mask<T, Abi> operator!=(simd<T, Abi> const & other) const { return simd_mask<T, Abi>(ops::bit_not(ops::eq(m_value, other.get()))); }
+
+	private:
+		__m128i m_value;
+	};
+
+} // namespace ccm::intrin::internal
+
+namespace ccm::intrin
+{
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE bool all_of(internal::sse_int_mask<T, Abi> const & a)
+	{
+		return _mm_movemask_epi8(a.get()) == 0xFFFF;
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE bool any_of(internal::sse_int_mask<T, Abi> const & a)
+	{
+		return _mm_movemask_epi8(a.get()) != 0x0;
+	}
+
+	template <class T, class Abi>
+	CCM_ALWAYS_INLINE simd<T, Abi> choose(internal::sse_int_mask<T, Abi> const & a, simd<T, Abi> const & b, simd<T, Abi> const & c)
+	{
+		return {internal::sse_int_ops<T>::blend(a.get(), b.get(), c.get())};
+	}
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_SSE2
+#endif	   // CCMATH_HAS_SIMD
@@ -12,6 +12,7 @@
 
 #include "ccmath/internal/config/arch/check_simd_support.hpp"
 #include "ccmath/internal/math/runtime/simd/common.hpp"
+#include "ccmath/internal/math/runtime/simd/instructions/sse_int.hpp"
 
 #ifdef CCMATH_HAS_SIMD
 	#ifdef CCMATH_HAS_SIMD_SSSE3
@@ -35,6 +36,19 @@ namespace ccm::intrin
 
 	} // namespace abi
 
+	/// 32 and 64 bit integer lanes. float and double have their own specializations below.
+	template <class T>
+	struct simd_mask<T, abi::ssse3> : internal::sse_int_mask<T, abi::ssse3>
+	{
+		using internal::sse_int_mask<T, abi::ssse3>::sse_int_mask;
+	};
+
+	template <class T>
+	struct simd<T, abi::ssse3> : internal::sse_int_simd<T, abi::ssse3>
+	{
+		using internal::sse_int_simd<T, abi::ssse3>::sse_int_simd;
+	};
+
 	template <>
 	struct simd_mask<float, abi::ssse3>
 	{
@@ -82,8 +96,9 @@ namespace ccm::intrin
 			return *this;
 		}
 		template <class Flags>
-		CCM_ALWAYS_INLINE simd(float const * ptr, Flags /*flags*/) : m_value(_mm_loadu_ps(ptr))
+		CCM_ALWAYS_INLINE simd(float const * ptr, Flags flags)
 		{
+			copy_from(ptr, flags);
 		}
 		CCM_ALWAYS_INLINE simd(float const * ptr, int stride) : simd(ptr[0], ptr[stride], ptr[2 * stride], ptr[3 * stride]) {}
 		CCM_ALWAYS_INLINE constexpr simd(__m128 const & value_in) : m_value(value_in) {}
@@ -93,7 +108,9 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE simd operator-(simd const & other) const { return {_mm_sub_ps(m_value, other.m_value)}; }
 		CCM_ALWAYS_INLINE simd operator-() const { return {_mm_sub_ps(_mm_set1_ps(0.0F), m_value)}; }
 		CCM_ALWAYS_INLINE void copy_from(float const * ptr, element_aligned_tag /*unused*/) { m_value = _mm_loadu_ps(ptr); }
+		CCM_ALWAYS_INLINE void copy_from(float const * ptr, vector_aligned_tag /*unused*/) { m_value = _mm_load_ps(ptr); }
 		CCM_ALWAYS_INLINE void copy_to(float * ptr, element_aligned_tag /*unused*/) const { _mm_storeu_ps(ptr, m_value); }
+		CCM_ALWAYS_INLINE void copy_to(float * ptr, vector_aligned_tag /*unused*/) const { _mm_store_ps(ptr, m_value); }
 		[[nodiscard]] CCM_ALWAYS_INLINE constexpr __m128 get() const { return m_value; }
 		[[nodiscard]] CCM_ALWAYS_INLINE float convert() const { return _mm_cvtss_f32(m_value); }
 		CCM_ALWAYS_INLINE simd_mask<float, abi::ssse3> operator<(simd const & other) const
@@ -104,6 +121,22 @@ namespace ccm::intrin
 		{
 			return simd_mask<float, abi::ssse3>(_mm_cmpeq_ps(m_value, other.m_value));
 		}
+		CCM_ALWAYS_INLINE simd_mask<float, abi::ssse3> operator<=(simd const & other) const
+		{
+			return simd_mask<float, abi::ssse3>(_mm_cmple_ps(m_value, other.m_value));
+		}
+		CCM_ALWAYS_INLINE simd_mask<float, abi::ssse3> operator>(simd const & other) const
+		{
+			return simd_mask<float, abi::ssse3>(_mm_cmpgt_ps(m_value, other.m_value));
+		}
+		CCM_ALWAYS_INLINE simd_mask<float, abi::ssse3> operator>=(simd const & other) const
+		{
+			return simd_mask<float, abi::ssse3>(_mm_cmpge_ps(m_value, other.m_value));
+		}
+		CCM_ALWAYS_INLINE simd_mask<float, abi::ssse3> operator!=(simd const & other) const
+		{
+			return simd_mask<float, abi::ssse3>(_mm_cmpneq_ps(m_value, other.m_value));
+		}
 
 	private:
 		__m128 m_value;
@@ -113,7 +146,124 @@ namespace ccm::intrin
 															simd<float, abi::ssse3> const & c)
 	{
 		// NOLINTNEXTLINE(modernize-return-braced-init-list)
-		return simd<float, abi::ssse3>(_mm_add_ps(_mm_and_ps(a.get(), b.get()), _mm_andnot_ps(a.get(), c.get())));
+		return {_mm_or_ps(_mm_and_ps(a.get(), b.get()), _mm_andnot_ps(a.get(), c.get()))};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> fma(simd<float, abi::ssse3> const & a, simd<float, abi::ssse3> const & b, simd<float, abi::ssse3> const & c)
+	{
+	#ifdef CCMATH_HAS_SIMD_FMA
+		return {_mm_fmadd_ps(a.get(), b.get(), c.get())};
+	#else
+		return {_mm_add_ps(_mm_mul_ps(a.get(), b.get()), c.get())};
+	#endif
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> fms(simd<float, abi::ssse3> const & a, simd<float, abi::ssse3> const & b, simd<float, abi::ssse3> const & c)
+	{
+	#ifdef CCMATH_HAS_SIMD_FMA
+		return {_mm_fmsub_ps(a.get(), b.get(), c.get())};
+	#else
+		return {_mm_sub_ps(_mm_mul_ps(a.get(), b.get()), c.get())};
+	#endif
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> fnma(simd<float, abi::ssse3> const & a, simd<float, abi::ssse3> const & b, simd<float, abi::ssse3> const & c)
+	{
+	#ifdef CCMATH_HAS_SIMD_FMA
+		return {_mm_fnmadd_ps(a.get(), b.get(), c.get())};
+	#else
+		return {_mm_sub_ps(c.get(), _mm_mul_ps(a.get(), b.get()))};
+	#endif
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> min(simd<float, abi::ssse3> const & a, simd<float, abi::ssse3> const & b)
+	{
+		return {_mm_min_ps(a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> max(simd<float, abi::ssse3> const & a, simd<float, abi::ssse3> const & b)
+	{
+		return {_mm_max_ps(a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> abs(simd<float, abi::ssse3> const & a)
+	{
+		return {_mm_andnot_ps(_mm_set1_ps(-0.0F), a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> copysign(simd<float, abi::ssse3> const & magnitude, simd<float, abi::ssse3> const & sign)
+	{
+		return {_mm_or_ps(_mm_andnot_ps(_mm_set1_ps(-0.0F), magnitude.get()), _mm_and_ps(_mm_set1_ps(-0.0F), sign.get()))};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> rsqrt(simd<float, abi::ssse3> const & a)
+	{
+		return internal::rsqrt_newton(a, simd<float, abi::ssse3>(_mm_rsqrt_ps(a.get())));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> rsqrt_estimate(simd<float, abi::ssse3> const & a)
+	{
+		return {_mm_rsqrt_ps(a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> rcp(simd<float, abi::ssse3> const & a)
+	{
+		return internal::rcp_newton(a, simd<float, abi::ssse3>(_mm_rcp_ps(a.get())));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> floor(simd<float, abi::ssse3> const & a)
+	{
+		return internal::floor_by_addition(a);
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> ceil(simd<float, abi::ssse3> const & a)
+	{
+		return internal::ceil_by_addition(a);
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> trunc(simd<float, abi::ssse3> const & a)
+	{
+		return internal::trunc_by_addition(a);
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> round(simd<float, abi::ssse3> const & a)
+	{
+		return internal::round_from_trunc(a, trunc(a));
+	}
+
+	CCM_ALWAYS_INLINE float reduce_add(simd<float, abi::ssse3> const & a)
+	{
+		const __m128 x		= a.get();
+		const __m128 pairs = _mm_add_ps(x, _mm_movehl_ps(x, x));
+		return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+
+	CCM_ALWAYS_INLINE float reduce_mul(simd<float, abi::ssse3> const & a)
+	{
+		const __m128 x		= a.get();
+		const __m128 pairs = _mm_mul_ps(x, _mm_movehl_ps(x, x));
+		return _mm_cvtss_f32(_mm_mul_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+
+	CCM_ALWAYS_INLINE float reduce_min(simd<float, abi::ssse3> const & a)
+	{
+		const __m128 x		= a.get();
+		const __m128 pairs = _mm_min_ps(x, _mm_movehl_ps(x, x));
+		return _mm_cvtss_f32(_mm_min_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+
+	CCM_ALWAYS_INLINE float reduce_max(simd<float, abi::ssse3> const & a)
+	{
+		const __m128 x		= a.get();
+		const __m128 pairs = _mm_max_ps(x, _mm_movehl_ps(x, x));
+		return _mm_cvtss_f32(_mm_max_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+
+	CCM_ALWAYS_INLINE simd<float, abi::ssse3> prefix_sum(simd<float, abi::ssse3> const & a)
+	{
+		__m128 x = a.get();
+		x		 = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)));
+		return {_mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 8)))};
 	}
 
 	template <>
@@ -167,8 +317,9 @@ namespace ccm::intrin
 			return *this;
 		}
 		template <class Flags>
-		CCM_ALWAYS_INLINE simd(double const * ptr, Flags /*flags*/) : m_value(_mm_loadu_pd(ptr))
+		CCM_ALWAYS_INLINE simd(double const * ptr, Flags flags)
 		{
+			copy_from(ptr, flags);
 		}
 		CCM_ALWAYS_INLINE simd(double const * ptr, int stride) : simd(ptr[0], ptr[stride]) {}
 		CCM_ALWAYS_INLINE constexpr simd(__m128d const & value_in) : m_value(value_in) {}
@@ -178,7 +329,9 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE simd operator-(simd const & other) const { return {_mm_sub_pd(m_value, other.m_value)}; }
 		CCM_ALWAYS_INLINE simd operator-() const { return {_mm_sub_pd(_mm_set1_pd(0.0), m_value)}; }
 		CCM_ALWAYS_INLINE void copy_from(double const * ptr, element_aligned_tag /*unused*/) { m_value = _mm_loadu_pd(ptr); }
+		CCM_ALWAYS_INLINE void copy_from(double const * ptr, vector_aligned_tag /*unused*/) { m_value = _mm_load_pd(ptr); }
 		CCM_ALWAYS_INLINE void copy_to(double * ptr, element_aligned_tag /*unused*/) const { _mm_storeu_pd(ptr, m_value); }
+		CCM_ALWAYS_INLINE void copy_to(double * ptr, vector_aligned_tag /*unused*/) const { _mm_store_pd(ptr, m_value); }
 		[[nodiscard]] constexpr __m128d get() const { return m_value; }
 		[[nodiscard]] CCM_ALWAYS_INLINE double convert() const { return _mm_cvtsd_f64(m_value); }
 
@@ -190,6 +343,22 @@ namespace ccm::intrin
 		{
 			return simd_mask<double, abi::ssse3>(_mm_cmpeq_pd(m_value, other.m_value));
 		}
+		CCM_ALWAYS_INLINE simd_mask<double, abi::ssse3> operator<=(simd const & other) const
+		{
+			return simd_mask<double, abi::ssse3>(_mm_cmple_pd(m_value, other.m_value));
+		}
+		CCM_ALWAYS_INLINE simd_mask<double, abi::ssse3> operator>(simd const & other) const
+		{
+			return simd_mask<double, abi::ssse3>(_mm_cmpgt_pd(m_value, other.m_value));
+		}
+		CCM_ALWAYS_INLINE simd_mask<double, abi::ssse3> operator>=(simd const & other) const
+		{
+			return simd_mask<double, abi::ssse3>(_mm_cmpge_pd(m_value, other.m_value));
+		}
+		CCM_ALWAYS_INLINE simd_mask<double, abi::ssse3> operator!=(simd const & other) const
+		{
+			return simd_mask<double, abi::ssse3>(_mm_cmpneq_pd(m_value, other.m_value));
+		}
 
 	private:
 		__m128d m_value;
@@ -199,7 +368,114 @@ namespace ccm::intrin
 															 simd<double, abi::ssse3> const & c)
 	{
 		// NOLINTNEXTLINE(modernize-return-braced-init-list)
-		return simd<double, abi::ssse3>(_mm_add_pd(_mm_and_pd(a.get(), b.get()), _mm_andnot_pd(a.get(), c.get())));
+		return {_mm_or_pd(_mm_and_pd(a.get(), b.get()), _mm_andnot_pd(a.get(), c.get()))};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> fma(simd<double, abi::ssse3> const & a, simd<double, abi::ssse3> const & b, simd<double, abi::ssse3> const & c)
+	{
+	#ifdef CCMATH_HAS_SIMD_FMA
+		return {_mm_fmadd_pd(a.get(), b.get(), c.get())};
+	#else
+		return {_mm_add_pd(_mm_mul_pd(a.get(), b.get()), c.get())};
+	#endif
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> fms(simd<double, abi::ssse3> const & a, simd<double, abi::ssse3> const & b, simd<double, abi::ssse3> const & c)
+	{
+	#ifdef CCMATH_HAS_SIMD_FMA
+		return {_mm_fmsub_pd(a.get(), b.get(), c.get())};
+	#else
+		return {_mm_sub_pd(_mm_mul_pd(a.get(), b.get()), c.get())};
+	#endif
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> fnma(simd<double, abi::ssse3> const & a, simd<double, abi::ssse3> const & b, simd<double, abi::ssse3> const & c)
+	{
+	#ifdef CCMATH_HAS_SIMD_FMA
+		return {_mm_fnmadd_pd(a.get(), b.get(), c.get())};
+	#else
+		return {_mm_sub_pd(c.get(), _mm_mul_pd(a.get(), b.get()))};
+	#endif
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> min(simd<double, abi::ssse3> const & a, simd<double, abi::ssse3> const & b)
+	{
+		return {_mm_min_pd(a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> max(simd<double, abi::ssse3> const & a, simd<double, abi::ssse3> const & b)
+	{
+		return {_mm_max_pd(a.get(), b.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> abs(simd<double, abi::ssse3> const & a)
+	{
+		return {_mm_andnot_pd(_mm_set1_pd(-0.0), a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> copysign(simd<double, abi::ssse3> const & magnitude, simd<double, abi::ssse3> const & sign)
+	{
+		return {_mm_or_pd(_mm_andnot_pd(_mm_set1_pd(-0.0), magnitude.get()), _mm_and_pd(_mm_set1_pd(-0.0), sign.get()))};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> rsqrt(simd<double, abi::ssse3> const & a)
+	{
+		return {_mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(a.get()))};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> rcp(simd<double, abi::ssse3> const & a)
+	{
+		return {_mm_div_pd(_mm_set1_pd(1.0), a.get())};
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> floor(simd<double, abi::ssse3> const & a)
+	{
+		return internal::floor_by_addition(a);
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> ceil(simd<double, abi::ssse3> const & a)
+	{
+		return internal::ceil_by_addition(a);
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> trunc(simd<double, abi::ssse3> const & a)
+	{
+		return internal::trunc_by_addition(a);
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> round(simd<double, abi::ssse3> const & a)
+	{
+		return internal::round_from_trunc(a, trunc(a));
+	}
+
+	CCM_ALWAYS_INLINE double reduce_add(simd<double, abi::ssse3> const & a)
+	{
+		const __m128d x = a.get();
+		return _mm_cvtsd_f64(_mm_add_sd(x, _mm_unpackhi_pd(x, x)));
+	}
+
+	CCM_ALWAYS_INLINE double reduce_mul(simd<double, abi::ssse3> const & a)
+	{
+		const __m128d x = a.get();
+		return _mm_cvtsd_f64(_mm_mul_sd(x, _mm_unpackhi_pd(x, x)));
+	}
+
+	CCM_ALWAYS_INLINE double reduce_min(simd<double, abi::ssse3> const & a)
+	{
+		const __m128d x = a.get();
+		return _mm_cvtsd_f64(_mm_min_sd(x, _mm_unpackhi_pd(x, x)));
+	}
+
+	CCM_ALWAYS_INLINE double reduce_max(simd<double, abi::ssse3> const & a)
+	{
+		const __m128d x = a.get();
+		return _mm_cvtsd_f64(_mm_max_sd(x, _mm_unpackhi_pd(x, x)));
+	}
+
+	CCM_ALWAYS_INLINE simd<double, abi::ssse3> prefix_sum(simd<double, abi::ssse3> const & a)
+	{
+		const __m128d x = a.get();
+		return {_mm_add_pd(x, _mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(x), 8)))};
 	}
 } // namespace ccm::intrin
 
@@ -0,0 +1,433 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/math/runtime/simd/common.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+#ifdef CCMATH_HAS_SIMD
+	#ifdef CCMATH_HAS_SIMD_SVE
+		#include <arm_sve.h>
+
+namespace ccm::intrin
+{
+	namespace abi
+	{
+		/**
+		 * ARM Scalable Vector Extension with the vector length fixed at compile time by -msve-vector-bits. A simd holds
+		 * one full register, __ARM_FEATURE_SVE_BITS / 8 / sizeof(T) lanes, and only runs on hosts with that vector length.
+		 */
+		struct sve
+		{
+		};
+	} // namespace abi
+
+	namespace internal
+	{
+		/**
+		 * The sizeless ACLE register type of a lane type and its fixed length counterpart. Sizeless types cannot be class
+		 * members, so the simd types store the fixed length type and convert to the sizeless type for the intrinsics.
+		 */
+		template <class T>
+		struct sve_register;
+
+		template <>
+		struct sve_register<float>
+		{
+			using type = svfloat32_t;
+			typedef svfloat32_t fixed_type __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS))); // NOLINT(modernize-use-using)
+		};
+
+		template <>
+		struct sve_register<double>
+		{
+			using type = svfloat64_t;
+			typedef svfloat64_t fixed_type __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS))); // NOLINT(modernize-use-using)
+		};
+
+		template <>
+		struct sve_register<std::int32_t>
+		{
+			using type = svint32_t;
+			typedef svint32_t fixed_type __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS))); // NOLINT(modernize-use-using)
+		};
+
+		template <>
+		struct sve_register<std::uint32_t>
+		{
+			using type = svuint32_t;
+			typedef svuint32_t fixed_type __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS))); // NOLINT(modernize-use-using)
+		};
+
+		template <>
+		struct sve_register<std::int64_t>
+		{
+			using type = svint64_t;
+			typedef svint64_t fixed_type __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS))); // NOLINT(modernize-use-using)
+		};
+
+		template <>
+		struct sve_register<std::uint64_t>
+		{
+			using type = svuint64_t;
+			typedef svuint64_t fixed_type __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS))); // NOLINT(modernize-use-using)
+		};
+
+		typedef svbool_t sve_fixed_bool __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS))); // NOLINT(modernize-use-using)
+
+		/// The predicate with every lane of a simd<T, abi::sve> active.
+		template <class T>
+		CCM_ALWAYS_INLINE svbool_t sve_all()
+		{
+			if constexpr (sizeof(T) == 8) { return svptrue_b64(); }
+			else { return svptrue_b32(); }
+		}
+
+		/// The predicate with the first count lanes active, from whilelt.
+		template <class T>
+		CCM_ALWAYS_INLINE svbool_t sve_first(int count)
+		{
+			if constexpr (sizeof(T) == 8) { return svwhilelt_b64(0, count); }
+			else { return svwhilelt_b32(0, count); }
+		}
+
+		template <class T>
+		CCM_ALWAYS_INLINE typename sve_register<T>::type sve_dup(T value)
+		{
+			if constexpr (std::is_same_v<T, float>) { return svdup_n_f32(value); }
+			else if constexpr (std::is_same_v<T, double>) { return svdup_n_f64(value); }
+			else if constexpr (std::is_same_v<T, std::int32_t>) { return svdup_n_s32(value); }
+			else if constexpr (std::is_same_v<T, std::uint32_t>) { return svdup_n_u32(value); }
+			else if constexpr (std::is_same_v<T, std::int64_t>) { return svdup_n_s64(value); }
+			else { return svdup_n_u64(value); }
+		}
+
+		/// The lane indices 0, stride, 2 * stride, ... as signed integers of the lane width.
+		template <class T>
+		CCM_ALWAYS_INLINE auto sve_index(int stride)
+		{
+			if constexpr (sizeof(T) == 8) { return svindex_s64(0, stride); }
+			else { return svindex_s32(0, stride); }
+		}
+	} // namespace internal
+
+	/// One predicate register. Comparisons set one predicate bit per lane of T, so masks only combine with masks of the same lane width.
+	template <class T>
+	struct simd_mask<T, abi::sve>
+	{
+		static_assert(std::is_floating_point_v<T> || is_simd_integer_v<T>, "SVE simd lanes must be float, double or 32 or 64 bit integers.");
+
+		using value_type	= bool;
+		using simd_type		= simd<T, abi::sve>;
+		using abi_type		= abi::sve;
+		using register_type = svbool_t;
+		CCM_ALWAYS_INLINE simd_mask() = default;
+		CCM_ALWAYS_INLINE simd_mask(bool value) : m_value(value ? internal::sve_all<T>() : svpfalse_b()) {}
+		static constexpr int size() { return static_cast<int>(__ARM_FEATURE_SVE_BITS / 8 / sizeof(T)); }
+		CCM_ALWAYS_INLINE simd_mask(register_type const & value_in) : m_value(value_in) {}
+		[[nodiscard]] CCM_ALWAYS_INLINE register_type get() const { return m_value; }
+		CCM_ALWAYS_INLINE simd_mask operator||(simd_mask const & other) const { return simd_mask(svorr_z(internal::sve_all<T>(), m_value, other.m_value)); }
+		CCM_ALWAYS_INLINE simd_mask operator&&(simd_mask const & other) const { return simd_mask(svand_z(internal::sve_all<T>(), m_value, other.m_value)); }
+		CCM_ALWAYS_INLINE simd_mask operator!() const { return simd_mask(svnot_z(internal::sve_all<T>(), m_value)); }
+
+	private:
+		internal::sve_fixed_bool m_value;
+	};
+
+	template <class T>
+	CCM_ALWAYS_INLINE bool all_of(simd_mask<T, abi::sve> const & a)
+	{
+		return !svptest_any(internal::sve_all<T>(), svnot_z(internal::sve_all<T>(), a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE bool any_of(simd_mask<T, abi::sve> const & a)
+	{
+		return svptest_any(internal::sve_all<T>(), a.get());
+	}
+
+	/**
+	 * Every lane type shares this template, as the ACLE intrinsics are overloaded on the register type. The operations
+	 * are predicated on all lanes with the _x forms. Bitwise operators and shifts are for integer lanes only.
+	 */
+	template <class T>
+	struct simd<T, abi::sve>
+	{
+		static_assert(std::is_floating_point_v<T> || is_simd_integer_v<T>, "SVE simd lanes must be float, double or 32 or 64 bit integers.");
+
+		using value_type	= T;
+		using abi_type		= abi::sve;
+		using mask_type		= simd_mask<T, abi_type>;
+		using storage_type	= simd_storage<T, abi_type>;
+		using register_type = typename internal::sve_register<T>::type;
+		CCM_ALWAYS_INLINE simd() = default;
+		static constexpr int size() { return static_cast<int>(__ARM_FEATURE_SVE_BITS / 8 / sizeof(T)); }
+		CCM_ALWAYS_INLINE simd(T value) : m_value(internal::sve_dup(value)) {}
+		CCM_ALWAYS_INLINE simd(storage_type const & value) { copy_from(value.data(), element_aligned_tag()); }
+		CCM_ALWAYS_INLINE simd & operator=(storage_type const & value)
+		{
+			copy_from(value.data(), element_aligned_tag());
+			return *this;
+		}
+		template <class Flags>
+		CCM_ALWAYS_INLINE simd(T const * ptr, Flags flags)
+		{
+			copy_from(ptr, flags);
+		}
+		CCM_ALWAYS_INLINE simd(T const * ptr, int stride) : m_value(svld1_gather_index(internal::sve_all<T>(), ptr, internal::sve_index<T>(stride))) {}
+		CCM_ALWAYS_INLINE simd(register_type const & value_in) : m_value(value_in) {}
+		CCM_ALWAYS_INLINE simd operator*(simd const & other) const { return simd(svmul_x(internal::sve_all<T>(), get(), other.get())); }
+		CCM_ALWAYS_INLINE simd operator/(simd const & other) const { return simd(svdiv_x(internal::sve_all<T>(), get(), other.get())); }
+		CCM_ALWAYS_INLINE simd operator+(simd const & other) const { return simd(svadd_x(internal::sve_all<T>(), get(), other.get())); }
+		CCM_ALWAYS_INLINE simd operator-(simd const & other) const { return simd(svsub_x(internal::sve_all<T>(), get(), other.get())); }
+		CCM_ALWAYS_INLINE simd operator-() const
+		{
+			if constexpr (std::is_unsigned_v<T>) { return simd(T{0}) - *this; }
+			else { return simd(svneg_x(internal::sve_all<T>(), get())); }
+		}
+		CCM_ALWAYS_INLINE simd operator&(simd const & other) const { return simd(svand_x(internal::sve_all<T>(), get(), other.get())); }
+		CCM_ALWAYS_INLINE simd operator|(simd const & other) const { return simd(svorr_x(internal::sve_all<T>(), get(), other.get())); }
+		CCM_ALWAYS_INLINE simd operator^(simd const & other) const { return simd(sveor_x(internal::sve_all<T>(), get(), other.get())); }
+		CCM_ALWAYS_INLINE simd operator~() const { return simd(svnot_x(internal::sve_all<T>(), get())); }
+		CCM_ALWAYS_INLINE simd operator<<(int count) const
+		{
+			return simd(svlsl_x(internal::sve_all<T>(), get(), static_cast<std::make_unsigned_t<T>>(count)));
+		}
+		/// Arithmetic shift for signed lanes, logical shift for unsigned lanes.
+		CCM_ALWAYS_INLINE simd operator>>(int count) const
+		{
+			if constexpr (std::is_signed_v<T>) { return simd(svasr_x(internal::sve_all<T>(), get(), static_cast<std::make_unsigned_t<T>>(count))); }
+			else { return simd(svlsr_x(internal::sve_all<T>(), get(), static_cast<T>(count))); }
+		}
+		CCM_ALWAYS_INLINE void copy_from(T const * ptr, element_aligned_tag /*unused*/) { m_value = svld1(internal::sve_all<T>(), ptr); }
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, element_aligned_tag /*unused*/) const { svst1(internal::sve_all<T>(), ptr, get()); }
+		CCM_ALWAYS_INLINE void copy_from(T const * ptr, vector_aligned_tag /*unused*/) { copy_from(ptr, element_aligned_tag()); }
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, vector_aligned_tag /*unused*/) const { copy_to(ptr, element_aligned_tag()); }
+		[[nodiscard]] CCM_ALWAYS_INLINE register_type get() const { return m_value; }
+		/// Lane 0. lasta with no active lanes reads the lane after the last active one, which is the first.
+		[[nodiscard]] CCM_ALWAYS_INLINE T convert() const { return svlasta(svpfalse_b(), get()); }
+		CCM_ALWAYS_INLINE mask_type operator<(simd const & other) const { return mask_type(svcmplt(internal::sve_all<T>(), get(), other.get())); }
+		CCM_ALWAYS_INLINE mask_type operator==(simd const & other) const { return mask_type(svcmpeq(internal::sve_all<T>(), get(), other.get())); }
+		CCM_ALWAYS_INLINE mask_type operator<=(simd const & other) const { return mask_type(svcmple(internal::sve_all<T>(), get(), other.get())); }
+		CCM_ALWAYS_INLINE mask_type operator>(simd const & other) const { return mask_type(svcmpgt(internal::sve_all<T>(), get(), other.get())); }
+		CCM_ALWAYS_INLINE mask_type operator>=(simd const & other) const { return mask_type(svcmpge(internal::sve_all<T>(), get(), other.get())); }
+		/// Not equal is the complement of equal, so it holds for NaN lanes.
+		CCM_ALWAYS_INLINE mask_type operator!=(simd const & other) const { return mask_type(svcmpne(internal::sve_all<T>(), get(), other.get())); }
+
+	private:
+		typename internal::sve_register<T>::fixed_type m_value;
+	};
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> choose(simd_mask<T, abi::sve> const & a, simd<T, abi::sve> const & b, simd<T, abi::sve> const & c)
+	{
+		return simd<T, abi::sve>(svsel(a.get(), b.get(), c.get()));
+	}
+
+	// svmad is a * b + c, svnmsb is a * b - c and svmsb is c - a * b, all with a single rounding.
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> fma(simd<T, abi::sve> const & a, simd<T, abi::sve> const & b, simd<T, abi::sve> const & c)
+	{
+		return simd<T, abi::sve>(svmad_x(internal::sve_all<T>(), a.get(), b.get(), c.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> fms(simd<T, abi::sve> const & a, simd<T, abi::sve> const & b, simd<T, abi::sve> const & c)
+	{
+		return simd<T, abi::sve>(svnmsb_x(internal::sve_all<T>(), a.get(), b.get(), c.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> fnma(simd<T, abi::sve> const & a, simd<T, abi::sve> const & b, simd<T, abi::sve> const & c)
+	{
+		return simd<T, abi::sve>(svmsb_x(internal::sve_all<T>(), a.get(), b.get(), c.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> min(simd<T, abi::sve> const & a, simd<T, abi::sve> const & b)
+	{
+		return choose(a < b, a, b);
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> max(simd<T, abi::sve> const & a, simd<T, abi::sve> const & b)
+	{
+		return choose(b < a, a, b);
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> abs(simd<T, abi::sve> const & a)
+	{
+		return simd<T, abi::sve>(svabs_x(internal::sve_all<T>(), a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> copysign(simd<T, abi::sve> const & magnitude, simd<T, abi::sve> const & sign)
+	{
+		static_assert(std::is_floating_point_v<T>, "copysign needs float or double lanes.");
+		const svbool_t all = internal::sve_all<T>();
+		if constexpr (std::is_same_v<T, double>)
+		{
+			const svuint64_t sign_bit = svdup_n_u64(0x8000000000000000ULL);
+			return simd<T, abi::sve>(svreinterpret_f64(svorr_x(all, svbic_x(all, svreinterpret_u64(magnitude.get()), sign_bit),
+															  svand_x(all, svreinterpret_u64(sign.get()), sign_bit))));
+		}
+		else
+		{
+			const svuint32_t sign_bit = svdup_n_u32(0x80000000U);
+			return simd<T, abi::sve>(svreinterpret_f32(svorr_x(all, svbic_x(all, svreinterpret_u32(magnitude.get()), sign_bit),
+															  svand_x(all, svreinterpret_u32(sign.get()), sign_bit))));
+		}
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> rsqrt(simd<T, abi::sve> const & a)
+	{
+		// svrsqrts(x, y * y) keeps zero and infinite lanes exact, unlike svrsqrts(x * y, y).
+		const svbool_t all = internal::sve_all<T>();
+		auto estimate	   = svrsqrte(a.get());
+		for (int i = 0; i < (sizeof(T) == 8 ? 3 : 2); ++i) { estimate = svmul_x(all, estimate, svrsqrts(a.get(), svmul_x(all, estimate, estimate))); }
+		return simd<T, abi::sve>(estimate);
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> rsqrt_estimate(simd<T, abi::sve> const & a)
+	{
+		return simd<T, abi::sve>(svrsqrte(a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> rcp(simd<T, abi::sve> const & a)
+	{
+		const svbool_t all = internal::sve_all<T>();
+		auto estimate	   = svrecpe(a.get());
+		for (int i = 0; i < (sizeof(T) == 8 ? 3 : 2); ++i) { estimate = svmul_x(all, estimate, svrecps(a.get(), estimate)); }
+		return simd<T, abi::sve>(estimate);
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> floor(simd<T, abi::sve> const & a)
+	{
+		return simd<T, abi::sve>(svrintm_x(internal::sve_all<T>(), a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> ceil(simd<T, abi::sve> const & a)
+	{
+		return simd<T, abi::sve>(svrintp_x(internal::sve_all<T>(), a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> trunc(simd<T, abi::sve> const & a)
+	{
+		return simd<T, abi::sve>(svrintz_x(internal::sve_all<T>(), a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> round(simd<T, abi::sve> const & a)
+	{
+		return simd<T, abi::sve>(svrinta_x(internal::sve_all<T>(), a.get()));
+	}
+
+	// reduce_mul has no SVE instruction and uses the generic version.
+
+	template <class T>
+	CCM_ALWAYS_INLINE T reduce_add(simd<T, abi::sve> const & a)
+	{
+		// Integer lanes are summed into 64 bits, which wraps back to the lane width like a sequential sum.
+		return static_cast<T>(svaddv(internal::sve_all<T>(), a.get()));
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE T reduce_min(simd<T, abi::sve> const & a)
+	{
+		return svminv(internal::sve_all<T>(), a.get());
+	}
+
+	template <class T>
+	CCM_ALWAYS_INLINE T reduce_max(simd<T, abi::sve> const & a)
+	{
+		return svmaxv(internal::sve_all<T>(), a.get());
+	}
+
+	namespace internal
+	{
+		/// Add a shifted up by Shift, 2 * Shift, ... lanes with zeros shifted in, until the shift covers the register.
+		template <int Shift, class T>
+		CCM_ALWAYS_INLINE simd<T, abi::sve> sve_prefix_sum(simd<T, abi::sve> const & a)
+		{
+			if constexpr (Shift >= simd<T, abi::sve>::size()) { return a; }
+			else
+			{
+				const simd<T, abi::sve> shifted(svext(sve_dup(T{0}), a.get(), simd<T, abi::sve>::size() - Shift));
+				return sve_prefix_sum<Shift * 2>(a + shifted);
+			}
+		}
+	} // namespace internal
+
+	template <class T>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> prefix_sum(simd<T, abi::sve> const & a)
+	{
+		return internal::sve_prefix_sum<1>(a);
+	}
+
+	/// Gather with ld1 and a vector of lane indices. See the generic gather for the index requirements.
+	template <class T, class Index>
+	CCM_ALWAYS_INLINE simd<T, abi::sve> gather(T const * base, simd<Index, abi::sve> const & index)
+	{
+		static_assert(is_simd_integer_v<Index> && sizeof(Index) == sizeof(T), "gather indices must be integers of the width of the loaded lanes.");
+		return simd<T, abi::sve>(svld1_gather_index(internal::sve_all<T>(), base, index.get()));
+	}
+
+	/// Partial loads and stores predicated by whilelt. Inactive lanes are neither read nor written, and loaded as zero.
+	template <class T>
+	struct simd_partial<T, abi::sve>
+	{
+		static CCM_ALWAYS_INLINE simd<T, abi::sve> load(T const * ptr, int count) { return simd<T, abi::sve>(svld1(internal::sve_first<T>(count), ptr)); }
+
+		static CCM_ALWAYS_INLINE void store(simd<T, abi::sve> const & value, T * ptr, int count) { svst1(internal::sve_first<T>(count), ptr, value.get()); }
+	};
+
+	/// Masked arithmetic and stores with the merging _m forms, which keep the inactive lanes of the first operand.
+	template <class T>
+	struct simd_masked<T, abi::sve>
+	{
+		using simd_type = simd<T, abi::sve>;
+		using mask_type = simd_mask<T, abi::sve>;
+
+		static CCM_ALWAYS_INLINE simd_type assign(mask_type const & mask, simd_type const & value, simd_type const & x) { return choose(mask, x, value); }
+		static CCM_ALWAYS_INLINE simd_type add(mask_type const & mask, simd_type const & value, simd_type const & x)
+		{
+			return simd_type(svadd_m(mask.get(), value.get(), x.get()));
+		}
+		static CCM_ALWAYS_INLINE simd_type sub(mask_type const & mask, simd_type const & value, simd_type const & x)
+		{
+			return simd_type(svsub_m(mask.get(), value.get(), x.get()));
+		}
+		static CCM_ALWAYS_INLINE simd_type mul(mask_type const & mask, simd_type const & value, simd_type const & x)
+		{
+			return simd_type(svmul_m(mask.get(), value.get(), x.get()));
+		}
+		static CCM_ALWAYS_INLINE simd_type div(mask_type const & mask, simd_type const & value, simd_type const & x)
+		{
+			return simd_type(svdiv_m(mask.get(), value.get(), x.get()));
+		}
+
+		static CCM_ALWAYS_INLINE void store(mask_type const & mask, simd_type const & value, T * ptr) { svst1(mask.get(), ptr, value.get()); }
+	};
+} // namespace ccm::intrin
+
+	#endif // CCMATH_HAS_SIMD_SVE
+#endif	   // CCMATH_HAS_SIMD
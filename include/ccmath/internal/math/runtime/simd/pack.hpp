@@ -13,6 +13,9 @@
 #include "common.hpp"
 #include "simd_vectorize.hpp"
 
+#include <cmath>
+#include <type_traits>
+
 namespace ccm::intrin
 {
 
@@ -33,37 +36,38 @@ namespace ccm::intrin
 		[[nodiscard]] static constexpr int size() { return N; }
 		CCM_ALWAYS_INLINE explicit simd_mask(bool value)
 		{
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
 				m_value[i] = value;
 			}
 		}
 		constexpr bool operator[](int i) const { return m_value[i]; }
 		CCM_ALWAYS_INLINE int & operator[](int i) { return m_value[i]; }
+		// The logical operators are evaluated bitwise so that the loops have no short circuit branches left to if-convert.
 		CCM_ALWAYS_INLINE simd_mask operator||(simd_mask const & other) const
 		{
 			simd_mask result;
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
-				result.m_value[i] = m_value[i] || other.m_value[i];
+				result.m_value[i] = (m_value[i] | other.m_value[i]) != 0;
 			}
 			return result;
 		}
 		CCM_ALWAYS_INLINE simd_mask operator&&(simd_mask const & other) const
 		{
 			simd_mask result;
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
-				result.m_value[i] = m_value[i] && other.m_value[i];
+				result.m_value[i] = (m_value[i] != 0) & (other.m_value[i] != 0);
 			}
 			return result;
 		}
 		CCM_ALWAYS_INLINE simd_mask operator!() const
 		{
 			simd_mask result;
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
-				result.m_value[i] = !m_value[i];
+				result.m_value[i] = m_value[i] == 0;
 			}
 			return result;
 		}
@@ -82,7 +86,7 @@ namespace ccm::intrin
 		[[nodiscard]] static constexpr int size() { return N; }
 		CCM_ALWAYS_INLINE explicit simd_mask(bool value)
 		{
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
 				m_value[i] = value;
 			}
@@ -92,27 +96,27 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE simd_mask operator||(simd_mask const & other) const
 		{
 			simd_mask result;
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
-				result.m_value[i] = m_value[i] || other.m_value[i];
+				result.m_value[i] = (m_value[i] | other.m_value[i]) != 0;
 			}
 			return result;
 		}
 		CCM_ALWAYS_INLINE simd_mask operator&&(simd_mask const & other) const
 		{
 			simd_mask result;
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
-				result.m_value[i] = m_value[i] && other.m_value[i];
+				result.m_value[i] = (m_value[i] != 0) & (other.m_value[i] != 0);
 			}
 			return result;
 		}
 		CCM_ALWAYS_INLINE simd_mask operator!() const
 		{
 			simd_mask result;
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
-				result.m_value[i] = !m_value[i];
+				result.m_value[i] = m_value[i] == 0;
 			}
 			return result;
 		}
@@ -121,11 +125,61 @@ namespace ccm::intrin
 		std::array<std::int64_t, N> m_value;
 	};
 
+	/// Mask of the integer lane types. float and double have their own specializations above.
+	template <class T, int N>
+	struct simd_mask<T, abi::pack<N>>
+	{
+		using value_type					 = bool;
+		using simd_type						 = simd<T, abi::pack<N>>;
+		using abi_type						 = abi::pack<N>;
+		CCM_ALWAYS_INLINE simd_mask() = default;
+		[[nodiscard]] static constexpr int size() { return N; }
+		CCM_ALWAYS_INLINE explicit simd_mask(bool value)
+		{
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				m_value[i] = value;
+			}
+		}
+		constexpr bool operator[](int i) const { return m_value[i]; }
+		CCM_ALWAYS_INLINE T & operator[](int i) { return m_value[i]; }
+		CCM_ALWAYS_INLINE simd_mask operator||(simd_mask const & other) const
+		{
+			simd_mask result;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result.m_value[i] = (m_value[i] | other.m_value[i]) != 0;
+			}
+			return result;
+		}
+		CCM_ALWAYS_INLINE simd_mask operator&&(simd_mask const & other) const
+		{
+			simd_mask result;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result.m_value[i] = (m_value[i] != 0) & (other.m_value[i] != 0);
+			}
+			return result;
+		}
+		CCM_ALWAYS_INLINE simd_mask operator!() const
+		{
+			simd_mask result;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result.m_value[i] = m_value[i] == 0;
+			}
+			return result;
+		}
+
+	private:
+		std::array<T, N> m_value;
+	};
+
 	template <class T, int N>
 	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE bool all_of(simd_mask<T, abi::pack<N>> const & a)
 	{
 		bool result = true;
-		CCM_SIMD_VECTORIZE for (int i = 0; i < a.size(); ++i)
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 		{
 			result = result && a[i];
 		}
@@ -136,7 +190,7 @@ namespace ccm::intrin
 	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE bool any_of(simd_mask<T, abi::pack<N>> const & a)
 	{
 		bool result = false;
-		CCM_SIMD_VECTORIZE for (int i = 0; i < a.size(); ++i)
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 		{
 			result = result || a[i];
 		}
@@ -155,7 +209,7 @@ namespace ccm::intrin
 		[[nodiscard]] static constexpr int size() { return N; }
 		CCM_ALWAYS_INLINE explicit simd(T value)
 		{
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
 				m_value[i] = value;
 			}
@@ -174,7 +228,7 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE simd operator*(simd const & other) const
 		{
 			simd result;
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
 				result[i] = m_value[i] * other.m_value[i];
 			}
@@ -183,7 +237,7 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE simd operator/(simd const & other) const
 		{
 			simd result;
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
 				result[i] = m_value[i] / other.m_value[i];
 			}
@@ -192,7 +246,7 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE simd operator+(simd const & other) const
 		{
 			simd result;
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
 				result[i] = m_value[i] + other.m_value[i];
 			}
@@ -201,7 +255,7 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE simd operator-(simd const & other) const
 		{
 			simd result;
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
 				result[i] = m_value[i] - other.m_value[i];
 			}
@@ -210,32 +264,88 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator-() const
 		{
 			simd result;
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
 				result[i] = -m_value[i];
 			}
 			return result;
 		}
+		CCM_ALWAYS_INLINE simd operator&(simd const & other) const
+		{
+			simd result;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result[i] = static_cast<T>(m_value[i] & other.m_value[i]);
+			}
+			return result;
+		}
+		CCM_ALWAYS_INLINE simd operator|(simd const & other) const
+		{
+			simd result;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result[i] = static_cast<T>(m_value[i] | other.m_value[i]);
+			}
+			return result;
+		}
+		CCM_ALWAYS_INLINE simd operator^(simd const & other) const
+		{
+			simd result;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result[i] = static_cast<T>(m_value[i] ^ other.m_value[i]);
+			}
+			return result;
+		}
+		CCM_ALWAYS_INLINE simd operator~() const
+		{
+			simd result;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result[i] = static_cast<T>(~m_value[i]);
+			}
+			return result;
+		}
+		CCM_ALWAYS_INLINE simd operator<<(int count) const
+		{
+			simd result;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result[i] = static_cast<T>(static_cast<std::make_unsigned_t<T>>(m_value[i]) << count);
+			}
+			return result;
+		}
+		CCM_ALWAYS_INLINE simd operator>>(int count) const
+		{
+			simd result;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result[i] = static_cast<T>(m_value[i] >> count);
+			}
+			return result;
+		}
 		CCM_ALWAYS_INLINE void copy_from(T const * ptr, element_aligned_tag /*unused*/)
 		{
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
 				m_value[i] = ptr[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 			}
 		}
 		CCM_ALWAYS_INLINE void copy_to(T * ptr, element_aligned_tag /*unused*/) const
 		{
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
 				ptr[i] = m_value[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 			}
 		}
+		CCM_ALWAYS_INLINE void copy_from(T const * ptr, vector_aligned_tag /*unused*/) { copy_from(ptr, element_aligned_tag()); }
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, vector_aligned_tag /*unused*/) const { copy_to(ptr, element_aligned_tag()); }
 		CCM_ALWAYS_INLINE constexpr T operator[](int i) const { return m_value[i]; }
 		CCM_ALWAYS_INLINE T & operator[](int i) { return m_value[i]; }
 		CCM_ALWAYS_INLINE simd_mask<T, abi::pack<N>> operator<(simd const & other) const
 		{
 			simd_mask<T, abi::pack<N>> result;
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
 				result[i] = m_value[i] < other.m_value[i];
 			}
@@ -244,12 +354,48 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE simd_mask<T, abi::pack<N>> operator==(simd const & other) const
 		{
 			simd_mask<T, abi::pack<N>> result;
-			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 			{
 				result[i] = m_value[i] == other.m_value[i];
 			}
 			return result;
 		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::pack<N>> operator<=(simd const & other) const
+		{
+			simd_mask<T, abi::pack<N>> result;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result[i] = m_value[i] <= other.m_value[i];
+			}
+			return result;
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::pack<N>> operator>(simd const & other) const
+		{
+			simd_mask<T, abi::pack<N>> result;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result[i] = m_value[i] > other.m_value[i];
+			}
+			return result;
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::pack<N>> operator>=(simd const & other) const
+		{
+			simd_mask<T, abi::pack<N>> result;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result[i] = m_value[i] >= other.m_value[i];
+			}
+			return result;
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::pack<N>> operator!=(simd const & other) const
+		{
+			simd_mask<T, abi::pack<N>> result;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result[i] = m_value[i] != other.m_value[i];
+			}
+			return result;
+		}
 
 	private:
 		std::array<T, N> m_value;
@@ -260,9 +406,177 @@ namespace ccm::intrin
 																			  simd<T, abi::pack<N>> const & c)
 	{
 		simd<T, abi::pack<N>> result;
-		CCM_SIMD_VECTORIZE for (int i = 0; i < a.size(); ++i)
+		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+		{
+			// A bitwise blend, as GCC turns a ternary on floating lanes back into a branch per lane and sinks both operands into it.
+			using bits_t = std::conditional_t<sizeof(T) == sizeof(std::uint64_t), std::uint64_t, std::uint32_t>;
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				const bits_t select = bits_t{0} - static_cast<bits_t>(a[i]);
+				result[i] = support::bit_cast<T>((support::bit_cast<bits_t>(b[i]) & select) | (support::bit_cast<bits_t>(c[i]) & ~select));
+			}
+		}
+		else
+		{
+			CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+			{
+				result[i] = a[i] ? b[i] : c[i];
+			}
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::pack<N>> fma(simd<T, abi::pack<N>> const & a, simd<T, abi::pack<N>> const & b, simd<T, abi::pack<N>> const & c)
+	{
+		simd<T, abi::pack<N>> result;
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+		{
+#ifdef CCMATH_HAS_SIMD_FMA
+			result[i] = std::fma(a[i], b[i], c[i]);
+#else
+			result[i] = a[i] * b[i] + c[i];
+#endif
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::pack<N>> fms(simd<T, abi::pack<N>> const & a, simd<T, abi::pack<N>> const & b, simd<T, abi::pack<N>> const & c)
+	{
+		simd<T, abi::pack<N>> result;
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+		{
+#ifdef CCMATH_HAS_SIMD_FMA
+			result[i] = std::fma(a[i], b[i], -c[i]);
+#else
+			result[i] = a[i] * b[i] - c[i];
+#endif
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::pack<N>> fnma(simd<T, abi::pack<N>> const & a, simd<T, abi::pack<N>> const & b, simd<T, abi::pack<N>> const & c)
+	{
+		simd<T, abi::pack<N>> result;
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+		{
+#ifdef CCMATH_HAS_SIMD_FMA
+			result[i] = std::fma(-a[i], b[i], c[i]);
+#else
+			result[i] = c[i] - a[i] * b[i];
+#endif
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::pack<N>> min(simd<T, abi::pack<N>> const & a, simd<T, abi::pack<N>> const & b)
+	{
+		simd<T, abi::pack<N>> result;
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+		{
+			result[i] = a[i] < b[i] ? a[i] : b[i];
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::pack<N>> max(simd<T, abi::pack<N>> const & a, simd<T, abi::pack<N>> const & b)
+	{
+		simd<T, abi::pack<N>> result;
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+		{
+			result[i] = b[i] < a[i] ? a[i] : b[i];
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::pack<N>> abs(simd<T, abi::pack<N>> const & a)
+	{
+		simd<T, abi::pack<N>> result;
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+		{
+			result[i] = std::fabs(a[i]);
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::pack<N>> copysign(simd<T, abi::pack<N>> const & magnitude, simd<T, abi::pack<N>> const & sign)
+	{
+		simd<T, abi::pack<N>> result;
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+		{
+			result[i] = std::copysign(magnitude[i], sign[i]);
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::pack<N>> rsqrt(simd<T, abi::pack<N>> const & a)
+	{
+		simd<T, abi::pack<N>> result;
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+		{
+			result[i] = T{1} / std::sqrt(a[i]);
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::pack<N>> rcp(simd<T, abi::pack<N>> const & a)
+	{
+		simd<T, abi::pack<N>> result;
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+		{
+			result[i] = T{1} / a[i];
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::pack<N>> floor(simd<T, abi::pack<N>> const & a)
+	{
+		simd<T, abi::pack<N>> result;
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+		{
+			result[i] = std::floor(a[i]);
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::pack<N>> ceil(simd<T, abi::pack<N>> const & a)
+	{
+		simd<T, abi::pack<N>> result;
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+		{
+			result[i] = std::ceil(a[i]);
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::pack<N>> trunc(simd<T, abi::pack<N>> const & a)
+	{
+		simd<T, abi::pack<N>> result;
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
+		{
+			result[i] = std::trunc(a[i]);
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::pack<N>> round(simd<T, abi::pack<N>> const & a)
+	{
+		simd<T, abi::pack<N>> result;
+		CCM_SIMD_VECTORIZE CCM_SIMD_UNROLL_LANES for (int i = 0; i < N; ++i)
 		{
-			result[i] = a[i] ? b[i] : c[i];
+			result[i] = std::round(a[i]);
 		}
 		return result;
 	}
@@ -49,6 +49,10 @@
 	#ifdef CCMATH_HAS_SIMD_NEON
 		#include "instructions/neon.hpp"
 	#endif
+
+	#ifdef CCMATH_HAS_SIMD_SVE
+		#include "instructions/sve.hpp"
+	#endif
 #endif
 
 namespace ccm::intrin
@@ -69,18 +73,13 @@ namespace ccm::intrin
 		using native = sse3;
 #elif defined(CCMATH_HAS_SIMD_SSE2)
 		using native = sse2;
-#elif defined(CCMATH_HAS_SIMD_NEON) && !defined(__ARM_FEATURE_SVE_BITS) && !defined(__ARM_FEATURE_SVE)
+#elif defined(CCMATH_HAS_SIMD_SVE)
+		using native = sve;
+#elif defined(CCMATH_HAS_SIMD_NEON)
+		// Also the native ABI of SVE targets built without a fixed vector length.
 		using native = neon;
 #elif defined(CCMATH_HAS_SIMD_ENABLE_VECTOR_SIZE)
-	#if defined(__ARM_FEATURE_SVE_BITS)
-		using native = vector_size<__ARM_FEATURE_SVE_BITS / 8>;
-	#else
-		#if defined(__ARM_FEATURE_SVE)
-		using native = vector_size<64>;
-		#else
 		using native = vector_size<32>;
-		#endif
-	#endif
 #else
 		using native = pack<8>;
 #endif
@@ -19,8 +19,21 @@
 	#elif defined(__clang__)
 		#define CCM_SIMD_VECTORIZE _Pragma("clang loop vectorize(enable)")
 	#elif defined(__GNUC__) && !defined(__FUJITSU)
-		#define CCM_SIMD_VECTORIZE _Pragma("GCC ivdep")
+		// GCC drops ivdep on the fixed trip count loops of pack<N> and warns with "ignoring loop annotation"
+		// for every instantiation. Those loops vectorize without the hint.
+		#define CCM_SIMD_VECTORIZE
 	#else
 		#define CCM_SIMD_VECTORIZE
 	#endif
 #endif
+
+#ifndef CCM_SIMD_UNROLL_LANES
+	#if defined(__GNUC__) && !defined(__clang__) && !defined(__FUJITSU)
+		// Below -O3, GCC turns the lane loops of pack<N> that copy into memcpy calls before unrolling them, and expands those
+		// in 16-byte pieces. Unrolled up front, the loops vectorize into whole registers. GCC drops the annotation from loops
+		// bounded by a call, so the pack loops run to N rather than size().
+		#define CCM_SIMD_UNROLL_LANES _Pragma("GCC unroll 16")
+	#else
+		#define CCM_SIMD_UNROLL_LANES
+	#endif
+#endif
@@ -13,6 +13,8 @@
 #include "common.hpp"
 #include "simd_vectorize.hpp"
 
+#include <cmath>
+
 #if (defined(__clang__) && (__clang_major__ >= 11))
 
 	#ifndef CCMATH_SIMD_ENABLE_VECTOR_SIZE
@@ -137,6 +139,13 @@ namespace ccm::intrin
 		CCM_ALWAYS_INLINE simd operator+=(simd const & other) const { return m_value += other.m_value; }
 		CCM_ALWAYS_INLINE simd operator-(simd const & other) const { return simd(m_value - other.m_value); }
 		CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd operator-() const { return simd(-m_value); }
+		// Bitwise operators and shifts are only instantiated for the integer lane types.
+		CCM_ALWAYS_INLINE simd operator&(simd const & other) const { return simd(m_value & other.m_value); }
+		CCM_ALWAYS_INLINE simd operator|(simd const & other) const { return simd(m_value | other.m_value); }
+		CCM_ALWAYS_INLINE simd operator^(simd const & other) const { return simd(m_value ^ other.m_value); }
+		CCM_ALWAYS_INLINE simd operator~() const { return simd(~m_value); }
+		CCM_ALWAYS_INLINE simd operator<<(int count) const { return simd(m_value << count); }
+		CCM_ALWAYS_INLINE simd operator>>(int count) const { return simd(m_value >> count); }
 		CCM_ALWAYS_INLINE void copy_from(T const * ptr, element_aligned_tag /*unused*/)
 		{
 			CCM_SIMD_VECTORIZE for (int i = 0; i < size(); ++i)
@@ -151,6 +160,8 @@ namespace ccm::intrin
 				ptr[i] = reinterpret_cast<T *>(&m_value)[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 			}
 		}
+		CCM_ALWAYS_INLINE void copy_from(T const * ptr, vector_aligned_tag /*unused*/) { copy_from(ptr, element_aligned_tag()); }
+		CCM_ALWAYS_INLINE void copy_to(T * ptr, vector_aligned_tag /*unused*/) const { copy_to(ptr, element_aligned_tag()); }
 		CCM_ALWAYS_INLINE constexpr T operator[](int i) const { return m_value[i]; }
 		[[nodiscard]] CCM_ALWAYS_INLINE native_type const & get() const { return m_value; }
 		CCM_ALWAYS_INLINE native_type & get() { return m_value; }
@@ -162,6 +173,22 @@ namespace ccm::intrin
 		{
 			return simd_mask<T, abi::vector_size<N>>(m_value == other.m_value);
 		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::vector_size<N>> operator<=(simd const & other) const
+		{
+			return simd_mask<T, abi::vector_size<N>>(m_value <= other.m_value);
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::vector_size<N>> operator>(simd const & other) const
+		{
+			return simd_mask<T, abi::vector_size<N>>(m_value > other.m_value);
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::vector_size<N>> operator>=(simd const & other) const
+		{
+			return simd_mask<T, abi::vector_size<N>>(m_value >= other.m_value);
+		}
+		CCM_ALWAYS_INLINE simd_mask<T, abi::vector_size<N>> operator!=(simd const & other) const
+		{
+			return simd_mask<T, abi::vector_size<N>>(m_value != other.m_value);
+		}
 
 	private:
 		native_type m_value;
@@ -193,6 +220,139 @@ namespace ccm::intrin
 		return choose(a < b, a, b);
 	}
 
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::vector_size<N>> fma(simd<T, abi::vector_size<N>> const & a, simd<T, abi::vector_size<N>> const & b, simd<T, abi::vector_size<N>> const & c)
+	{
+		simd<T, abi::vector_size<N>> result;
+		CCM_SIMD_VECTORIZE for (int i = 0; i < a.size(); ++i)
+		{
+#ifdef CCMATH_HAS_SIMD_FMA
+			result.get()[i] = std::fma(a.get()[i], b.get()[i], c.get()[i]);
+#else
+			result.get()[i] = a.get()[i] * b.get()[i] + c.get()[i];
+#endif
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::vector_size<N>> fms(simd<T, abi::vector_size<N>> const & a, simd<T, abi::vector_size<N>> const & b, simd<T, abi::vector_size<N>> const & c)
+	{
+		simd<T, abi::vector_size<N>> result;
+		CCM_SIMD_VECTORIZE for (int i = 0; i < a.size(); ++i)
+		{
+#ifdef CCMATH_HAS_SIMD_FMA
+			result.get()[i] = std::fma(a.get()[i], b.get()[i], -c.get()[i]);
+#else
+			result.get()[i] = a.get()[i] * b.get()[i] - c.get()[i];
+#endif
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::vector_size<N>> fnma(simd<T, abi::vector_size<N>> const & a, simd<T, abi::vector_size<N>> const & b, simd<T, abi::vector_size<N>> const & c)
+	{
+		simd<T, abi::vector_size<N>> result;
+		CCM_SIMD_VECTORIZE for (int i = 0; i < a.size(); ++i)
+		{
+#ifdef CCMATH_HAS_SIMD_FMA
+			result.get()[i] = std::fma(-a.get()[i], b.get()[i], c.get()[i]);
+#else
+			result.get()[i] = c.get()[i] - a.get()[i] * b.get()[i];
+#endif
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::vector_size<N>> abs(simd<T, abi::vector_size<N>> const & a)
+	{
+		simd<T, abi::vector_size<N>> result;
+		CCM_SIMD_VECTORIZE for (int i = 0; i < a.size(); ++i)
+		{
+			result.get()[i] = std::fabs(a.get()[i]);
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::vector_size<N>> copysign(simd<T, abi::vector_size<N>> const & magnitude, simd<T, abi::vector_size<N>> const & sign)
+	{
+		simd<T, abi::vector_size<N>> result;
+		CCM_SIMD_VECTORIZE for (int i = 0; i < magnitude.size(); ++i)
+		{
+			result.get()[i] = std::copysign(magnitude.get()[i], sign.get()[i]);
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::vector_size<N>> rsqrt(simd<T, abi::vector_size<N>> const & a)
+	{
+		simd<T, abi::vector_size<N>> result;
+		CCM_SIMD_VECTORIZE for (int i = 0; i < a.size(); ++i)
+		{
+			result.get()[i] = T{1} / std::sqrt(a.get()[i]);
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::vector_size<N>> rcp(simd<T, abi::vector_size<N>> const & a)
+	{
+		simd<T, abi::vector_size<N>> result;
+		CCM_SIMD_VECTORIZE for (int i = 0; i < a.size(); ++i)
+		{
+			result.get()[i] = T{1} / a.get()[i];
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::vector_size<N>> floor(simd<T, abi::vector_size<N>> const & a)
+	{
+		simd<T, abi::vector_size<N>> result;
+		CCM_SIMD_VECTORIZE for (int i = 0; i < a.size(); ++i)
+		{
+			result.get()[i] = std::floor(a.get()[i]);
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::vector_size<N>> ceil(simd<T, abi::vector_size<N>> const & a)
+	{
+		simd<T, abi::vector_size<N>> result;
+		CCM_SIMD_VECTORIZE for (int i = 0; i < a.size(); ++i)
+		{
+			result.get()[i] = std::ceil(a.get()[i]);
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::vector_size<N>> trunc(simd<T, abi::vector_size<N>> const & a)
+	{
+		simd<T, abi::vector_size<N>> result;
+		CCM_SIMD_VECTORIZE for (int i = 0; i < a.size(); ++i)
+		{
+			result.get()[i] = std::trunc(a.get()[i]);
+		}
+		return result;
+	}
+
+	template <class T, int N>
+	CCM_ALWAYS_INLINE CCM_GPU_HOST_DEVICE simd<T, abi::vector_size<N>> round(simd<T, abi::vector_size<N>> const & a)
+	{
+		simd<T, abi::vector_size<N>> result;
+		CCM_SIMD_VECTORIZE for (int i = 0; i < a.size(); ++i)
+		{
+			result.get()[i] = std::round(a.get()[i]);
+		}
+		return result;
+	}
+
 } // namespace ccm::intrin
 
 #endif
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/predef/has_attribute.hpp"
+
+// This macro compiles a single function for an instruction set the rest of the translation unit was not built for.
+// Only call such a function after checking at runtime that the host supports the instruction set.
+// CCM_HAS_TARGET_ATTRIBUTE is defined when the compiler understands the attribute.
+#ifndef CCM_TARGET
+	#if (defined(__GNUC__) || defined(__clang__)) && CCM_HAS_ATTR(target)
+		#define CCM_TARGET(x)			 __attribute__((target(x)))
+		#define CCM_HAS_TARGET_ATTRIBUTE 1
+	#else
+		#define CCM_TARGET(x)
+	#endif
+#endif
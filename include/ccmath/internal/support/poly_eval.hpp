@@ -12,6 +12,8 @@
 
 #include "ccmath/internal/support/multiply_add.hpp"
 
+#include <array>
+#include <cstddef>
 #include <type_traits>
 
 namespace ccm::support
@@ -54,6 +56,29 @@ namespace ccm::support
 		return multiply_add(x, polyeval(x, a...), a0);
 	}
 
+	/**
+	 * @brief Adds x2 * (a[First] + x * a[First + 1]) + x2^2 * (a[First + 2] + x * a[First + 3]) + ... to acc, lowest power first.
+	 *
+	 * This is the pairwise scheme of the table driven exp and log kernels written for any number of coefficients. An
+	 * unpaired last coefficient is added as a single term.
+	 * @param acc The value the terms are added to.
+	 * @param x The variable.
+	 * @param x2 x * x.
+	 * @param a The coefficients.
+	 */
+	template <std::size_t First, typename T, std::size_t N>
+	constexpr T polyeval_pairs(T acc, T x, T x2, const std::array<T, N> & a)
+	{
+		T power = x2;
+		for (std::size_t i = First; i < N; i += 2)
+		{
+			if (i + 1 < N) { acc = acc + power * (a[i] + x * a[i + 1]); }
+			else { acc = acc + power * a[i]; }
+			power = power * x2;
+		}
+		return acc;
+	}
+
 	struct fp_helpers
 	{
 
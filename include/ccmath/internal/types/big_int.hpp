@@ -786,8 +786,12 @@ namespace ccm::types
 		 */
 		[[nodiscard]] constexpr bool is_zero() const
 		{
-			// If at any point this operation see's a value that is not zero, it will return false.
-			return std::none_of(val.begin(), val.end(), [](auto part) { return part != 0; });
+			// std::none_of is not constexpr before C++20.
+			for (const auto part : val)
+			{
+				if (part != 0) { return false; }
+			}
+			return true;
 		}
 
 		/**
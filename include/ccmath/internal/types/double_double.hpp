@@ -64,8 +64,10 @@ namespace ccm
 		{
 			DoubleDouble r{0.0, 0.0};
 
-			// If we have builtin FMA, we can use it to get the exact product.
-			#if defined(__GNUC__) && (__GNUC__ > 6 || (__GNUC__ == 6 && __GNUC_MINOR__ >= 1)) && !defined(__clang__)
+			// If we have builtin FMA, we can use it to get the exact product. Without a hardware fma the builtin becomes a
+			// libm call, which is slower than Dekker's product.
+			#if defined(__GNUC__) && (__GNUC__ > 6 || (__GNUC__ == 6 && __GNUC_MINOR__ >= 1)) && !defined(__clang__) &&                                              \
+				(defined(__FMA__) || defined(__FP_FAST_FMA) || defined(__ARM_FEATURE_FMA))
 			r.hi = a * b;
 			r.lo = support::multiply_add(a, b, -r.hi);
 			#else
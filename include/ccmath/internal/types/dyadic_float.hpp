@@ -181,7 +181,7 @@ namespace ccm::types
 			bool sticky_bit		 = !(mantissa & sticky_mask).is_zero();
 			int round_and_sticky = static_cast<int>(round_bit) * 2 + static_cast<int>(sticky_bit);
 
-			T d_lo;
+			T d_lo{};
 
 			if (CCM_UNLIKELY(exp_lo <= 0))
 			{
@@ -10,10 +10,9 @@
 
 #pragma once
 
-#include "ccmath/internal/predef/unlikely.hpp"
-#include "ccmath/math/compare/isinf.hpp"
-#include "ccmath/math/compare/isnan.hpp"
-#include "ccmath/math/compare/signbit.hpp"
+#include "ccmath/internal/math/generic/func/basic/fma_gen.hpp"
+#include "ccmath/internal/math/runtime/func/basic/fma_rt.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
 
 #include <limits>
 #include <type_traits>
@@ -32,46 +31,8 @@ namespace ccm
 	template <typename T, std::enable_if_t<!std::is_integral_v<T>, bool> = true>
 	constexpr T fma(T x, T y, T z) noexcept
 	{
-		// Check for GCC 6.1 or later
-		#if defined(__GNUC__) && (__GNUC__ > 6 || (__GNUC__ == 6 && __GNUC_MINOR__ >= 1)) && !defined(__clang__)
-		if constexpr (std::is_same_v<T, float>) { return __builtin_fmaf(x, y, z); }
-		if constexpr (std::is_same_v<T, double>) { return __builtin_fma(x, y, z); }
-		if constexpr (std::is_same_v<T, long double>) { return __builtin_fmal(x, y, z); }
-		return static_cast<T>(__builtin_fmal(x, y, z));
-		#else
-		if (CCM_UNLIKELY(x == 0 || y == 0 || z == 0)) { return x * y + z; }
-
-		// If x is zero and y is infinity, or if y is zero and x is infinity and...
-		if ((x == static_cast<T>(0) && ccm::isinf(y)) || (y == T{0} && ccm::isinf(x)))
-		{
-			// ...z is NaN, return +NaN...
-			if (ccm::isnan(z))
-			{
-				return std::numeric_limits<T>::quiet_NaN();
-			}
-
-			// ...else return -NaN if Z is not NaN.
-			return -std::numeric_limits<T>::quiet_NaN();
-		}
-
-		// If x is a zero and y is an infinity, or if y is zero and x is an infinity and Z is NaN, then the result is -NaN.
-		if (ccm::isinf(x * y) && ccm::isinf(z) && ccm::signbit(x * y) != ccm::signbit(z))
-		{
-			return -std::numeric_limits<T>::quiet_NaN();
-		}
-
-		// If x or y are NaN, NaN is returned.
-		if (ccm::isnan(x) || ccm::isnan(y)) { return std::numeric_limits<T>::quiet_NaN(); }
-
-		// If z is NaN, and x * y is not 0 * Inf or Inf * 0, then +NaN is returned
-		if (ccm::isnan(z) && (x * y != 0 * std::numeric_limits<T>::infinity() || x * y != std::numeric_limits<T>::infinity() * 0))
-		{
-			return std::numeric_limits<T>::quiet_NaN();
-		}
-
-		// Hope the compiler optimizes this.
-		return (x * y) + z;
-#endif
+		if (support::is_constant_evaluated()) { return gen::fma_gen<T>(x, y, z); }
+		return rt::fma_rt<T>(x, y, z);
 	}
 
 	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "batch/basic.hpp"
+#include "batch/exponential.hpp"
+#include "batch/hyperbolic.hpp"
+#include "batch/power.hpp"
+#include "batch/trig.hpp"
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/func/basic/fma_rt.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ccm::batch
+{
+	/**
+	 * @brief Computes x[i] * y[i] + z[i] rounded once for every element of three arrays.
+	 * @tparam T float or double
+	 * @param x Pointer to count first factors.
+	 * @param y Pointer to count second factors.
+	 * @param z Pointer to count addends.
+	 * @param out Pointer to count output values. May be the same array as any of the inputs.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void fma(const T * x, const T * y, const T * z, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_fma_batch_kernel<T>()(x, y, z, out, count);
+	}
+} // namespace ccm::batch
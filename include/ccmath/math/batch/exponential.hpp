@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/func/dispatch_rt.hpp"
+#include "ccmath/internal/math/runtime/func/exponential/exp2_rt.hpp"
+#include "ccmath/internal/math/runtime/func/exponential/exp_rt.hpp"
+#include "ccmath/internal/math/runtime/func/exponential/log2_rt.hpp"
+#include "ccmath/internal/math/runtime/func/exponential/log_rt.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ccm::batch
+{
+	/**
+	 * @brief Computes e raised to the power of every element of an array.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values.
+	 * @param out Pointer to count output values. May be the same array as in.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void exp(const T * in, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_kernel<rt::simd_impl::exp_batch_kernel, T>()(in, out, count);
+	}
+
+	/**
+	 * @brief Computes 2 raised to the power of every element of an array.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values.
+	 * @param out Pointer to count output values. May be the same array as in.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void exp2(const T * in, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_kernel<rt::simd_impl::exp2_batch_kernel, T>()(in, out, count);
+	}
+
+	/**
+	 * @brief Computes the natural (base e) logarithm of every element of an array.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values.
+	 * @param out Pointer to count output values. May be the same array as in.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void log(const T * in, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_kernel<rt::simd_impl::log_batch_kernel, T>()(in, out, count);
+	}
+
+	/**
+	 * @brief Computes the base 2 logarithm of every element of an array.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values.
+	 * @param out Pointer to count output values. May be the same array as in.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void log2(const T * in, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_kernel<rt::simd_impl::log2_batch_kernel, T>()(in, out, count);
+	}
+} // namespace ccm::batch
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/func/dispatch_rt.hpp"
+#include "ccmath/internal/math/runtime/func/hyperbolic/hyperbolic_rt.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ccm::batch
+{
+	/**
+	 * @brief Computes the hyperbolic sine of every element of an array.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values.
+	 * @param out Pointer to count output values. May be the same array as in.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void sinh(const T * in, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_kernel<rt::simd_impl::sinh_batch_kernel, T>()(in, out, count);
+	}
+
+	/**
+	 * @brief Computes the hyperbolic cosine of every element of an array.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values.
+	 * @param out Pointer to count output values. May be the same array as in.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void cosh(const T * in, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_kernel<rt::simd_impl::cosh_batch_kernel, T>()(in, out, count);
+	}
+
+	/**
+	 * @brief Computes the hyperbolic tangent of every element of an array.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values.
+	 * @param out Pointer to count output values. May be the same array as in.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void tanh(const T * in, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_kernel<rt::simd_impl::tanh_batch_kernel, T>()(in, out, count);
+	}
+
+	/**
+	 * @brief Computes the hyperbolic sine and cosine of every element of an array from a single exponential per element.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values.
+	 * @param sinh_out Pointer to count hyperbolic sine values. May be the same array as in.
+	 * @param cosh_out Pointer to count hyperbolic cosine values. May be the same array as in, but not the same as sinh_out.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void sinhcosh(const T * in, T * sinh_out, T * cosh_out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_pair_kernel<rt::simd_impl::sinhcosh_batch_kernel, T>()(in, sinh_out, cosh_out, count);
+	}
+} // namespace ccm::batch
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/power/pow_int_gen.hpp"
+#include "ccmath/internal/math/runtime/func/power/cbrt_rt.hpp"
+#include "ccmath/internal/math/runtime/func/power/hypot_rt.hpp"
+#include "ccmath/internal/math/runtime/func/power/pow_rt.hpp"
+#include "ccmath/internal/math/runtime/func/power/sqrt_rt.hpp"
+#include "ccmath/math/power/pow.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace ccm::batch
+{
+	/**
+	 * @brief Computes the square root of every element of an array.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values.
+	 * @param out Pointer to count output values. May be the same array as in.
+	 * @param count Number of elements to process.
+	 *
+	 * Every result is correctly rounded, like std::sqrt. Negative inputs give NaN.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void sqrt(const T * in, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_sqrt_batch_kernel<T>()(in, out, count);
+	}
+
+	/**
+	 * @brief Computes the cube root of every element of an array.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values.
+	 * @param out Pointer to count output values. May be the same array as in.
+	 * @param count Number of elements to process.
+	 *
+	 * Runs the seed, polynomial and Halley steps of ccm::cbrt in SIMD lanes, float in double lanes, and every result is
+	 * the correctly rounded one ccm::cbrt returns. Double lanes that need rescaling or are special are handled with
+	 * masked moves, without a scalar fallback.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void cbrt(const T * in, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_cbrt_batch_kernel<T>()(in, out, count);
+	}
+
+	/**
+	 * @brief Raises every element of an array to the same power.
+	 * @tparam T float or double
+	 * @param base Pointer to count bases.
+	 * @param exp The exponent.
+	 * @param out Pointer to count output values. May be the same array as base.
+	 * @param count Number of elements to process.
+	 *
+	 * The exponent is classified once: zero, integer and half exponents take the paths ccm::pow would take for every
+	 * element, and any other exponent runs the vector log and exp. Results match ccm::pow.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void pow(const T * base, T exp, T * out, std::size_t count) noexcept
+	{
+		if (exp == 0)
+		{
+			for (std::size_t i = 0; i < count; ++i) { out[i] = 1; }
+		}
+		else if (exp >= -internal::impl::pow_int_fast_path_limit && exp <= internal::impl::pow_int_fast_path_limit && internal::impl::pow_is_integer(exp))
+		{
+			const auto n = static_cast<int>(exp);
+			for (std::size_t i = 0; i < count; ++i) { out[i] = gen::pow_int_gen(base[i], n); }
+		}
+		else if (exp == static_cast<T>(0.5) || exp == static_cast<T>(-0.5))
+		{
+			for (std::size_t i = 0; i < count; ++i) { out[i] = internal::impl::pow_half(base[i], exp); }
+		}
+		else { rt::simd_impl::resolve_pow_batch_kernel<rt::simd_impl::pow_operands::array_scalar, T>()(base, &exp, out, count); }
+	}
+
+	/**
+	 * @brief Raises the same base to every element of an array.
+	 * @tparam T float or double
+	 * @param base The base.
+	 * @param exp Pointer to count exponents.
+	 * @param out Pointer to count output values. May be the same array as exp.
+	 * @param count Number of elements to process.
+	 *
+	 * log(base) is computed once, which leaves a vector exp per element. Bases that are not positive and finite follow
+	 * the sign and special value rules of ccm::pow element by element. Results match ccm::pow.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void pow(T base, const T * exp, T * out, std::size_t count) noexcept
+	{
+		// pow(1, y) is 1 for every y, NaN included.
+		if (base == 1)
+		{
+			for (std::size_t i = 0; i < count; ++i) { out[i] = 1; }
+		}
+		else if (base > 0 && base < std::numeric_limits<T>::infinity())
+		{
+			rt::simd_impl::resolve_pow_batch_kernel<rt::simd_impl::pow_operands::scalar_array, T>()(&base, exp, out, count);
+		}
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i) { out[i] = ccm::pow(base, exp[i]); }
+		}
+	}
+
+	/**
+	 * @brief Raises every element of an array to the power of the matching element of another.
+	 * @tparam T float or double
+	 * @param base Pointer to count bases.
+	 * @param exp Pointer to count exponents.
+	 * @param out Pointer to count output values. May be the same array as base or exp.
+	 * @param count Number of elements to process.
+	 *
+	 * Lanes with a positive finite base and a finite exponent run the vector log and exp; the others, and the rare
+	 * results the vector pass cannot round, call ccm::pow. Results match ccm::pow.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void pow(const T * base, const T * exp, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_pow_batch_kernel<rt::simd_impl::pow_operands::array_array, T>()(base, exp, out, count);
+	}
+
+	/**
+	 * @brief Computes sqrt(x^2 + y^2) for every pair of elements of two arrays, without undue overflow or underflow.
+	 * @tparam T float or double
+	 * @param x Pointer to count first operands.
+	 * @param y Pointer to count second operands.
+	 * @param out Pointer to count output values. May be the same array as x or y.
+	 * @param count Number of elements to process.
+	 *
+	 * Double lanes run the exact square sum of ccm::hypot, and lanes outside the common exponent range are rescaled with
+	 * masked moves instead of branches. Float lanes are evaluated in double. Results are within an ulp of ccm::hypot,
+	 * including its zero, infinite and NaN cases.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void hypot(const T * x, const T * y, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_hypot_batch_kernel<T>()(x, y, out, count);
+	}
+} // namespace ccm::batch
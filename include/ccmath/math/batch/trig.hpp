@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/runtime/func/dispatch_rt.hpp"
+#include "ccmath/internal/math/runtime/func/trig/atan2_rt.hpp"
+#include "ccmath/internal/math/runtime/func/trig/sincos_rt.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ccm::batch
+{
+	/**
+	 * @brief Computes the sine of every element of an array.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values in radians.
+	 * @param out Pointer to count output values. May be the same array as in.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void sin(const T * in, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_kernel<rt::simd_impl::sin_batch_kernel, T>()(in, out, count);
+	}
+
+	/**
+	 * @brief Computes the cosine of every element of an array.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values in radians.
+	 * @param out Pointer to count output values. May be the same array as in.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void cos(const T * in, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_kernel<rt::simd_impl::cos_batch_kernel, T>()(in, out, count);
+	}
+
+	/**
+	 * @brief Computes the tangent of every element of an array.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values in radians.
+	 * @param out Pointer to count output values. May be the same array as in.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void tan(const T * in, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_kernel<rt::simd_impl::tan_batch_kernel, T>()(in, out, count);
+	}
+
+	/**
+	 * @brief Computes the sine and cosine of every element of an array, reducing each argument once.
+	 * @tparam T float or double
+	 * @param in Pointer to count input values in radians.
+	 * @param sin_out Pointer to count sine values. May be the same array as in.
+	 * @param cos_out Pointer to count cosine values. May be the same array as in, but not the same as sin_out.
+	 * @param count Number of elements to process.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void sincos(const T * in, T * sin_out, T * cos_out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_pair_kernel<rt::simd_impl::sincos_batch_kernel, T>()(in, sin_out, cos_out, count);
+	}
+
+	/**
+	 * @brief Computes the arc tangent of y/x for every pair of elements of two arrays, using their signs to pick the quadrant.
+	 * @tparam T float or double
+	 * @param y Pointer to count y coordinates.
+	 * @param x Pointer to count x coordinates.
+	 * @param out Pointer to count angles in radians. May be the same array as y or x.
+	 * @param count Number of elements to process.
+	 *
+	 * The quadrant is fixed up with masked moves rather than per lane branches. Zero, infinite and NaN coordinates and
+	 * ratios beyond 2^60 are handled by ccm::atan2, whose results the vector path matches to within an ulp.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void atan2(const T * y, const T * x, T * out, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_binary_kernel<rt::simd_impl::atan2_batch_kernel, T>()(y, x, out, count);
+	}
+
+	/**
+	 * @brief Converts every point of two coordinate arrays to polar form.
+	 * @tparam T float or double
+	 * @param x Pointer to count x coordinates.
+	 * @param y Pointer to count y coordinates.
+	 * @param r Pointer to count radii sqrt(x^2 + y^2). May be the same array as x or y.
+	 * @param theta Pointer to count angles atan2(y, x) in radians. May be the same array as x or y, but not the same as r.
+	 * @param count Number of elements to process.
+	 *
+	 * The radius and the angle share the loads and the range checks of one pass over the data. Both are within an ulp of the exact result.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	inline void polar(const T * x, const T * y, T * r, T * theta, std::size_t count) noexcept
+	{
+		rt::simd_impl::resolve_batch_binary_pair_kernel<rt::simd_impl::polar_batch_kernel, T>()(x, y, r, theta, count);
+	}
+} // namespace ccm::batch
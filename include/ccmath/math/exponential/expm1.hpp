@@ -10,37 +10,55 @@
 
 #pragma once
 
+#include "ccmath/math/exponential/impl/expm1_double_impl.hpp"
+#include "ccmath/math/exponential/impl/expm1_float_impl.hpp"
+
 #include <type_traits>
 
 namespace ccm
 {
+	/**
+	 * @brief Computes e raised to the given power, minus one.
+	 * @tparam T floating-point type
+	 * @param num floating-point value
+	 * @return If no errors occur, e^num - 1 is returned. The result is accurate even when num is close to zero.
+	 * @note long double arguments are evaluated in double precision.
+	 */
 	template <typename T, std::enable_if_t<!std::is_integral_v<T>, bool> = true>
 	constexpr T expm1(T num)
 	{
-		#if defined(__GNUC__) && (__GNUC__ > 6 || (__GNUC__ == 6 && __GNUC_MINOR__ >= 1)) && !defined(__clang__)
-		if constexpr (std::is_same_v<T, float>) { return __builtin_expm1f(num); }
-		if constexpr (std::is_same_v<T, double>) { return __builtin_expm1(num); }
-		if constexpr (std::is_same_v<T, long double>) { return __builtin_expm1l(num); }
-		return static_cast<T>(__builtin_expm1l(num));
-		#else
-		if constexpr (std::is_same_v<T, float>) { return 0; }
-		if constexpr (std::is_same_v<T, double>) { return 0; }
-		if constexpr (std::is_same_v<T, long double>) { return 0; }
-		return 0;
-		#endif
+		if constexpr (std::is_same_v<T, float>) { return internal::impl::expm1_float_impl(num); }
+		else if constexpr (std::is_same_v<T, double>) { return internal::impl::expm1_double_impl(num); }
+		else { return static_cast<T>(internal::impl::expm1_double_impl(static_cast<double>(num))); }
 	}
 
+	/**
+	 * @brief Computes e raised to the given power, minus one.
+	 * @tparam Integer integer type
+	 * @param num integer value
+	 * @return If no errors occur, e^num - 1 is returned as double.
+	 */
 	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
 	constexpr double expm1(Integer num)
 	{
 		return ccm::expm1<double>(static_cast<double>(num));
 	}
 
+	/**
+	 * @brief Computes e raised to the given power, minus one.
+	 * @param num floating-point value
+	 * @return If no errors occur, e^num - 1 is returned as float.
+	 */
 	constexpr float expm1f(float num)
 	{
 		return ccm::expm1<float>(num);
 	}
 
+	/**
+	 * @brief Computes e raised to the given power, minus one.
+	 * @param num floating-point value
+	 * @return If no errors occur, e^num - 1 is returned as long double.
+	 */
 	constexpr long double expm1l(long double num)
 	{
 		return ccm::expm1<long double>(num);
@@ -14,10 +14,10 @@
 #include "ccmath/internal/predef/unlikely.hpp"
 #include "ccmath/internal/support/fp/bit_mask_traits.hpp"
 #include "ccmath/internal/types/fp_types.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
 #include "ccmath/math/exponential/impl/exp2_data.hpp"
 
-#include <ccmath/internal/support/poly_eval.hpp>
-
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 
@@ -67,18 +67,14 @@ namespace ccm::internal
 			return result;
 		}
 
+		/**
+		 * @brief Table driven 2^x.
+		 * @tparam TableBits Log2 of the size of the lookup table. See exp2_double_data.
+		 */
+		template <std::size_t TableBits = k_exp2_table_bits_dbl>
 		constexpr double exp2_double_impl(double x)
 		{
-			constexpr auto exp2_data_double				 = ccm::internal::exp2_data<double>();
-			constexpr auto shift_for_index_calculation	 = exp2_data_double.shift;
-			constexpr auto lookup_table					 = exp2_data_double.tab;
-			constexpr auto first_polynomial_coefficient	 = exp2_data_double.poly[0];
-			constexpr auto second_polynomial_coefficient = exp2_data_double.poly[1];
-			constexpr auto third_polynomial_coefficient	 = exp2_data_double.poly[2];
-			constexpr auto fourth_polynomial_coefficient = exp2_data_double.poly[3];
-			constexpr auto fifth_polynomial_coefficient	 = exp2_data_double.poly[4];
-			constexpr auto table_size					 = (1 << exp2_data<double>::table_bits);
-			constexpr auto table_bits					 = exp2_data<double>::table_bits;
+			using data = exp2_double_data<TableBits>;
 
 			namespace sp = support;
 
@@ -113,24 +109,22 @@ namespace ccm::internal
 
 			// exp2(x) = 2^(k/N) * 2^r, with 2^r in [2^(-1/2N),2^(1/2N)].
 			// x = k/N + r, with int k and r in [-1/2N, 1/2N].
-			expo						   = x + shift_for_index_calculation;
+			expo						   = x + data::shift;
 			const std::uint64_t expo_int64 = sp::double_to_uint64(expo); // This is k.
-			expo -= shift_for_index_calculation;						 // This is k/N for int k
+			expo -= data::shift;										 // This is k/N for int k
 			const ccm::double_t rem = x - expo;
 
 			// 2^(k/N) ~= scale * (1 + tail).
-			const std::uint64_t index = 2 * (expo_int64 % table_size);
-			const std::uint64_t top	  = expo_int64 << (52 - table_bits);
-			const ccm::double_t tail  = sp::uint64_to_double(lookup_table.at(index));
+			const std::uint64_t index = 2 * (expo_int64 % data::shifted_table_bits);
+			const std::uint64_t top	  = expo_int64 << (52 - TableBits);
+			const ccm::double_t tail  = sp::uint64_to_double(data::tab[index]);
 
 			// This is only a valid scale when -1023*N < k < 1024*N.
-			const std::uint64_t sign_bits = lookup_table.at(index + 1) + top;
+			const std::uint64_t sign_bits = data::tab[index + 1] + top;
 
 			const ccm::double_t remSqr = rem * rem;
 
-			const ccm::double_t tmp = tail + rem * first_polynomial_coefficient +
-									  remSqr * (second_polynomial_coefficient + rem * third_polynomial_coefficient) +
-									  remSqr * remSqr * (fourth_polynomial_coefficient + rem * fifth_polynomial_coefficient);
+			const ccm::double_t tmp = sp::polyeval_pairs<1>(tail + rem * data::poly[0], rem, remSqr, data::poly);
 			if (CCM_UNLIKELY(abs_top == 0.0)) { return handle_special_cases(tmp, sign_bits, expo_int64); }
 
 			const ccm::double_t scale = sp::uint64_to_double(sign_bits);
@@ -63,12 +63,12 @@ namespace ccm::internal
 			const ccm::double_t rem = input_as_double - corrected_input_double;
 
 			// exp2(x) = 2^(k/N) * 2^r ~= s * (C0*r^3 + C1*r^2 + C2*r + 1)
-			intermediate_value = lookup_table.at(lookup_index % shifted_table_bits);
+			intermediate_value = lookup_table[lookup_index % shifted_table_bits];
 			intermediate_value += lookup_index << (52 - table_bits);
 			const ccm::double_t scale					= sp::uint64_to_double(intermediate_value);
-			const ccm::double_t polynomial_intermediate = polynomial_coefficients.at(0) * rem + polynomial_coefficients.at(1);
+			const ccm::double_t polynomial_intermediate = polynomial_coefficients[0] * rem + polynomial_coefficients[1];
 			const ccm::double_t remSqr					= rem * rem;
-			result										= polynomial_coefficients.at(2) * rem + 1;
+			result										= polynomial_coefficients[2] * rem + 1;
 			result										= polynomial_intermediate * remSqr + result;
 			result										= result * scale;
 
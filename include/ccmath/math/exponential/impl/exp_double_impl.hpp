@@ -12,8 +12,10 @@
 
 #include "ccmath/internal/support/helpers/exp_helpers.hpp"
 #include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
 #include "ccmath/internal/types/fp_types.hpp"
 #include "ccmath/math/exponential/impl/exp_data.hpp"
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 
@@ -24,7 +26,7 @@ namespace ccm::internal::impl
 	constexpr auto exp_negLn2HiN_dbl		= internal_exp_data_dbl.negln2hiN;
 	constexpr auto exp_negLn2LoN_dbl		= internal_exp_data_dbl.negln2loN;
 	constexpr auto exp_shift_dbl			= internal_exp_data_dbl.shift;
-	constexpr auto exp_tab_dbl				= internal_exp_data_dbl.tab;
+	inline constexpr auto & exp_tab_dbl			= exp_data<double>::tab;
 	constexpr auto exp_poly_coeff_one_dbl	= internal_exp_data_dbl.poly[5 - k_exp_poly_order_dbl];
 	constexpr auto exp_poly_coeff_two_dbl	= internal_exp_data_dbl.poly[6 - k_exp_poly_order_dbl];
 	constexpr auto exp_poly_coeff_three_dbl = internal_exp_data_dbl.poly[7 - k_exp_poly_order_dbl];
@@ -69,8 +71,15 @@ namespace ccm::internal::impl
 		return result;
 	}
 
+	/**
+	 * @brief Table driven e^x.
+	 * @tparam TableBits Log2 of the size of the lookup table. See exp_double_data.
+	 */
+	template <std::size_t TableBits = k_exp_table_bits_dbl>
 	constexpr double exp_double_impl(double x)
 	{
+		using data = exp_double_data<TableBits>;
+
 		std::uint32_t abs_top{};
 		std::uint64_t expo_int64{};
 		std::uint64_t index{};
@@ -110,30 +119,29 @@ namespace ccm::internal::impl
 
 		// exp(x) = 2^(expo/N) * exp(r), with exp(rem) in [2^(-1/2N),2^(1/2N)].
 		// x = ln2/N*expo + rem, with int expo and rem in [-ln2/2N, ln2/2N].
-		scaled_input = exp_invLn2N_dbl * x;
+		scaled_input = data::invln2N * x;
 
 		// scaled_input - expo is in [-1, 1] in non-nearest rounding modes.
-		expo	   = support::helpers::narrow_eval(scaled_input + exp_shift_dbl);
+		expo	   = support::helpers::narrow_eval(scaled_input + data::shift);
 		expo_int64 = support::double_to_uint64(expo);
-		expo -= exp_shift_dbl;
+		expo -= data::shift;
 
-		rem = x + expo * exp_negLn2HiN_dbl + expo * exp_negLn2LoN_dbl;
+		rem = x + expo * data::negln2hiN + expo * data::negln2loN;
 
 		// 2^(expo/N) ~= scale * (1 + tail).
-		index = 2 * (expo_int64 % k_exp_table_n_dbl);
-		top	  = expo_int64 << (52 - k_exp_table_bits_dbl);
-		tail  = support::uint64_to_double(exp_tab_dbl.at(index));
+		index = 2 * (expo_int64 % data::table_size);
+		top	  = expo_int64 << (52 - TableBits);
+		tail  = support::uint64_to_double(data::tab[index]);
 
 		// This is only a valid scale when -1023*N < expo < 1024*N.
-		sign_bits = exp_tab_dbl.at(index + 1) + top;
+		sign_bits = data::tab[index + 1] + top;
 
 		// exp(x) = 2^(expo/N) * exp(rem) ~= scale + scale * (tail + exp(rem) - 1).
 		// This evaluation is optimized assuming super scalar pipelined execution.
 		remSqr = rem * rem;
 
 		// Worst case error is less than (0.5+1.11/N+(abs poly error * 2^53))+0.25/N ulp.
-		tmp = tail + rem + remSqr * (exp_poly_coeff_one_dbl + rem * exp_poly_coeff_two_dbl) +
-			  remSqr * remSqr * (exp_poly_coeff_three_dbl + rem * exp_poly_coeff_four_dbl);
+		tmp = support::polyeval_pairs<0>(tail + rem, rem, remSqr, data::poly);
 		if (CCM_UNLIKELY(abs_top == 0.0)) { return handle_special_case(tmp, sign_bits, expo_int64); }
 
 		scale = support::uint64_to_double(sign_bits);
@@ -74,12 +74,12 @@ namespace ccm::internal::impl
 		rem = scaled_input - expo;
 
 		// exp(x) = 2^(k/N) * 2^(r/N) ~= s * (C0*r^3 + C1*r^2 + C2*r + 1)
-		tmp = static_cast<std::uint64_t>(exp_tab_flt.at(expo_int64 % k_exp_table_n_flt));
+		tmp = static_cast<std::uint64_t>(exp_tab_flt[expo_int64 % k_exp_table_n_flt]);
 		tmp += (expo_int64 << (52 - k_exp_table_bits_flt));
 		scale		 = support::uint64_to_double(tmp);
-		scaled_input = exp_poly_scaled_flt.at(0) * rem + exp_poly_scaled_flt.at(1);
+		scaled_input = exp_poly_scaled_flt[0] * rem + exp_poly_scaled_flt[1];
 		remSqr		 = rem * rem;
-		result		 = exp_poly_scaled_flt.at(2) * rem + 1.0F;
+		result		 = exp_poly_scaled_flt[2] * rem + 1.0F;
 		result		 = scaled_input * remSqr + result;
 		result		 = scale * result;
 
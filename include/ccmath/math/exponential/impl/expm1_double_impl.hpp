@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/helpers/exp_helpers.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
+#include "ccmath/internal/types/fp_types.hpp"
+#include "ccmath/math/exponential/impl/exp_data.hpp"
+#include "ccmath/math/exponential/impl/exp_double_impl.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	/// 1/2!, 1/3!, ..., 1/11!. The Taylor series of e^x - 1 - x to x^11 is within 2^-65 relative for |x| < 2^-4.
+	constexpr std::array<double, 10> expm1_taylor_dbl{
+		0x1.0000000000000p-1,  0x1.5555555555555p-3,  0x1.5555555555555p-5,	0x1.1111111111111p-7,  0x1.6c16c16c16c17p-10,
+		0x1.a01a01a01a01ap-13, 0x1.a01a01a01a01ap-16, 0x1.71de3a556c734p-19, 0x1.27e4fb7789f5cp-22, 0x1.ae64567f544e4p-26,
+	};
+
+	/**
+	 * @brief Table driven e^x - 1.
+	 *
+	 * For |x| < 2^-4 the Taylor series is summed from the small terms up and x is added last, so nothing cancels. Elsewhere
+	 * e^x = s * (1 + tmp) comes from the exp tables as in exp_double_impl, and s - 1 is formed exactly with a two-sum
+	 * before s * tmp is added. Worst-case error is about 0.52 ULP.
+	 */
+	constexpr double expm1_double_impl(double x)
+	{
+		using data = exp_data<double>;
+
+		const std::uint32_t abs_top = support::top12_bits_of_double(x) & 0x7ff;
+
+		if (abs_top < support::top12_bits_of_double(0x1p-4))
+		{
+			// expm1(x) rounds to x. This also keeps the sign of zero.
+			if (abs_top < support::top12_bits_of_double(0x1p-54)) { return x; }
+
+			const ccm::double_t xSqr = x * x;
+			return x + support::polyeval_pairs<0>(0.0, x, xSqr, expm1_taylor_dbl);
+		}
+
+		if (CCM_UNLIKELY(abs_top >= support::top12_bits_of_double(64.0)))
+		{
+			if (x != x) { return x + x; }
+
+			// e^x is below half an ulp of 1 for x < -38, so the result rounds to -1. This includes -inf.
+			if (x < 0.0) { return -1.0; }
+
+			// 1 is below half an ulp of e^x. exp handles overflow and +inf.
+			return exp_double_impl(x);
+		}
+
+		// x = ln2/N*expo + rem, with int expo and rem in [-ln2/2N, ln2/2N].
+		ccm::double_t expo			   = support::helpers::narrow_eval(data::invln2N * x + data::shift);
+		const std::uint64_t expo_int64 = support::double_to_uint64(expo);
+		expo -= data::shift;
+		const ccm::double_t rem = x + expo * data::negln2hiN + expo * data::negln2loN;
+
+		// 2^(expo/N) ~= scale * (1 + tail). |x| < 64 keeps scale a normal double.
+		const std::uint64_t index = 2 * (expo_int64 % data::table_size);
+		const ccm::double_t tail  = support::uint64_to_double(data::tab[index]);
+		const ccm::double_t scale = support::uint64_to_double(data::tab[index + 1] + (expo_int64 << (52 - data::table_bits)));
+
+		// e^x - 1 = (scale - 1) + scale * (tail + e^rem - 1).
+		const ccm::double_t remSqr = rem * rem;
+		const ccm::double_t tmp	   = support::polyeval_pairs<0>(tail + rem, rem, remSqr, data::poly);
+
+		// highPart + lowPart = scale - 1 exactly (Knuth's two-sum).
+		const ccm::double_t highPart = scale - 1.0;
+		const ccm::double_t virtualB = highPart - scale;
+		const ccm::double_t lowPart	 = (scale - (highPart - virtualB)) + (-1.0 - virtualB);
+
+		return highPart + (lowPart + scale * tmp);
+	}
+} // namespace ccm::internal::impl
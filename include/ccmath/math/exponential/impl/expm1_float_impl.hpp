@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/helpers/exp_helpers.hpp"
+#include "ccmath/internal/types/fp_types.hpp"
+#include "ccmath/math/exponential/impl/exp_data.hpp"
+
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	/**
+	 * @brief Table driven e^x - 1 for float, evaluated in double.
+	 *
+	 * Uses the double exp table, whose reduced range is small enough for a quartic. With expo = 0 the result is the
+	 * series itself, so small inputs keep their relative precision without a separate path.
+	 */
+	constexpr float expm1_float_impl(float x)
+	{
+		using data = exp_data<double>;
+
+		const std::uint32_t abs_top = support::top12_bits_of_float(x) & 0x7ff;
+
+		// expm1(x) rounds to x. This also keeps the sign of zero.
+		if (abs_top < support::top12_bits_of_float(0x1p-25F)) { return x; }
+
+		if (CCM_UNLIKELY(abs_top >= support::top12_bits_of_float(16.0F)))
+		{
+			if (x != x) { return x + x; }
+
+			// e^x is below half an ulp of 1 for x < -17.4, so the result rounds to -1. This includes -inf.
+			if (x < -18.0F) { return -1.0F; }
+
+			// x > log(0x1p128) ~= 88.72. This includes +inf.
+			if (x > 0x1.62e42ep6F) { return 0x1p97F * 0x1p97F; }
+		}
+
+		// x = ln2/N*expo + rem, with int expo and rem in [-ln2/2N, ln2/2N].
+		const auto x_dbl_t			   = static_cast<ccm::double_t>(x);
+		ccm::double_t expo			   = support::helpers::narrow_eval(data::invln2N * x_dbl_t + data::shift);
+		const std::uint64_t expo_int64 = support::double_to_uint64(expo);
+		expo -= data::shift;
+		const ccm::double_t rem = x_dbl_t + expo * data::negln2hiN + expo * data::negln2loN;
+
+		// 2^(expo/N) ~= scale * (1 + tail).
+		const std::uint64_t index = 2 * (expo_int64 % data::table_size);
+		const ccm::double_t tail  = support::uint64_to_double(data::tab[index]);
+		const ccm::double_t scale = support::uint64_to_double(data::tab[index + 1] + (expo_int64 << (52 - data::table_bits)));
+
+		// e^rem - 1 = rem + rem^2/2 + rem^3/6 + rem^4/24, within 2^-40 relative on the reduced range.
+		const ccm::double_t tmp = tail + rem + rem * rem * (0.5 + rem * (0x1.5555555555555p-3 + rem * 0x1.5555555555555p-5));
+		return static_cast<float>((scale - 1.0) + scale * tmp);
+	}
+} // namespace ccm::internal::impl
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
+#include "ccmath/internal/types/fp_types.hpp"
+#include "ccmath/math/exponential/impl/log_data.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	constexpr double log10_inverse_ln10_dbl		 = 0x1.bcb7b1526e50ep-2;
+	constexpr double log10_inverse_ln10_high_dbl = 0x1.bcb7b152p-2;		  // 32 bits, so a 21 bit factor multiplies exactly.
+	constexpr double log10_inverse_ln10_low_dbl	 = 0x1.b9438ca9aadd5p-36;
+
+	/**
+	 * @brief Table driven base 10 logarithm for positive finite x.
+	 *
+	 * The natural logarithm is formed as hi + lo as in log_double_impl, on the generated default table, and scaled by 1/ln10
+	 * as in log2_double_impl: the top 21 bits of hi times the top 32 bits of 1/ln10 are exact, and everything else is
+	 * small enough to round once. Worst-case error is about 0.52 ULP, and powers of ten give exact integers.
+	 */
+	constexpr double log10_double_impl(double x)
+	{
+		using data = log_double_generated_data<k_logTableBitsDbl>;
+
+		std::uint64_t intX		= support::double_to_uint64(x);
+		const std::uint32_t top = support::top16_bits_of_double(x);
+
+		constexpr std::uint64_t low	 = support::double_to_uint64(1.0 - 0x1p-4);
+		constexpr std::uint64_t high = support::double_to_uint64(1.0 + 0x1p-4);
+
+		// Handle the inputs close to 1.0 with the polynomial of log_double_impl.
+		if (CCM_UNLIKELY(intX - low < high - low))
+		{
+			if (CCM_UNLIKELY(intX == support::double_to_uint64(1.0))) { return 0.0; }
+
+			const ccm::double_t rem		 = x - 1.0;
+			const ccm::double_t remHi	 = support::uint64_to_double(support::double_to_uint64(rem) & -1ULL << 32);
+			const ccm::double_t remLo	 = rem - remHi;
+			const ccm::double_t highPart = remHi * log10_inverse_ln10_high_dbl;
+			ccm::double_t lowPart		 = remLo * log10_inverse_ln10_high_dbl + rem * log10_inverse_ln10_low_dbl;
+
+			// log1p(rem) - rem = rem^2 * poly1(rem), scaled by 1/ln10.
+			const ccm::double_t remSqr		   = rem * rem;
+			const ccm::double_t polynomialTerm = log10_inverse_ln10_dbl * remSqr *
+												 support::polyeval_pairs<2>(data::poly1[0] + rem * data::poly1[1], rem, remSqr, data::poly1);
+			const ccm::double_t result = highPart + polynomialTerm;
+			lowPart += highPart - result + polynomialTerm;
+			return result + lowPart;
+		}
+
+		if (CCM_UNLIKELY(top - 0x0010 >= 0x7ff0 - 0x0010))
+		{
+			// x is subnormal, normalize it.
+			intX = support::double_to_uint64(x * 0x1p52);
+			intX -= 52ULL << 52;
+		}
+
+		// x = 2^expo normVal; where normVal is in range [k_logTableOffDbl, 2 * k_logTableOffDbl) and exact.
+		const std::uint64_t tmp = intX - k_logTableOffDbl;
+		// NOLINTBEGIN
+		const std::int64_t i	= (tmp >> (52 - data::table_bits)) % data::table_size;
+		const std::int64_t expo = static_cast<std::int64_t>(tmp) >> 52;
+		// NOLINTEND
+		const typename data::TabEntry & entry = data::tab[static_cast<std::size_t>(i)];
+		const ccm::double_t normVal			  = support::uint64_to_double(intX - (tmp & 0xfffULL << 52));
+
+		// log(x) = log1p(rem) + log(c) + expo*Ln2.
+		const ccm::double_t rem			= (normVal - entry.chi - static_cast<double>(entry.clo)) * entry.invc;
+		const auto scaleFactor			= static_cast<ccm::double_t>(expo);
+
+		// hi + lo = rem + log(c) + expo*Ln2.
+		const ccm::double_t workspace = scaleFactor * data::ln2hi + entry.logc;
+		const ccm::double_t highPart  = workspace + rem;
+		const ccm::double_t remSqr	  = rem * rem;
+		const ccm::double_t lowPart	  = workspace - highPart + rem + scaleFactor * data::ln2lo + static_cast<double>(entry.logclo) + remSqr * data::poly[0] +
+									  rem * remSqr * support::polyeval_pairs<3>(data::poly[1] + rem * data::poly[2], rem, remSqr, data::poly);
+
+		// log10(x) = (hi + lo) / ln10.
+		const ccm::double_t highPartHi = support::uint64_to_double(support::double_to_uint64(highPart) & -1ULL << 32);
+		return highPartHi * log10_inverse_ln10_high_dbl +
+			   ((highPart - highPartHi) * log10_inverse_ln10_high_dbl + highPart * log10_inverse_ln10_low_dbl + lowPart * log10_inverse_ln10_dbl);
+	}
+} // namespace ccm::internal::impl
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/types/fp_types.hpp"
+#include "ccmath/math/exponential/impl/log1p_float_impl.hpp"
+
+namespace ccm::internal::impl
+{
+	/// log10(x) for float and positive finite x. Subnormal floats are normal doubles, so they need no extra step.
+	constexpr float log10_float_impl(float x)
+	{
+		return static_cast<float>(logf_kernel(static_cast<ccm::double_t>(x)) * 0x1.bcb7b1526e50ep-2); // 1/ln10
+	}
+} // namespace ccm::internal::impl
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
+#include "ccmath/internal/types/fp_types.hpp"
+#include "ccmath/math/exponential/impl/log_data.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	/**
+	 * @brief Table driven log(1 + x) for finite x > -1.
+	 *
+	 * For |x| < 2^-4 this is the polynomial log_double_impl uses around 1.0, applied to x itself, which is exact where
+	 * 1 + x would not be. Elsewhere 1 + x = c + corr is split exactly, c goes through the table reduction of
+	 * log_double_impl on the generated default table and corr/c joins the reduced argument. Worst-case error is about 0.52 ULP.
+	 * @param x The argument.
+	 * @param xLow Low part of an argument x + xLow with |xLow| below an ULP of x, such as the rounding error of a
+	 * computed argument. It joins the low order sums, so it is not rounded a second time.
+	 */
+	constexpr double log1p_double_impl(double x, double xLow = 0.0)
+	{
+		using data = log_double_generated_data<k_logTableBitsDbl>;
+
+		ccm::double_t workspace{};
+		ccm::double_t result{};
+		ccm::double_t lowPart{};
+
+		const std::uint64_t absX = support::double_to_uint64(x) & 0x7fffffffffffffffULL;
+
+		if (absX < support::double_to_uint64(0x1p-4))
+		{
+			// log1p(x) rounds to x. This also keeps the sign of zero.
+			if (absX < support::double_to_uint64(0x1p-54)) { return x; }
+
+			const ccm::double_t remSqr	 = x * x;
+			const ccm::double_t remCubed = x * remSqr;
+			result						 = remCubed * (data::poly1[1] + x * data::poly1[2] + remSqr * data::poly1[3] +
+								   remCubed * (data::poly1[4] + x * data::poly1[5] + remSqr * data::poly1[6] +
+											   remCubed * (data::poly1[7] + x * data::poly1[8] + remSqr * data::poly1[9] +
+														   remCubed * data::poly1[10])));
+
+			// x + poly1[0] * x^2 is summed in extra precision, as in log_double_impl.
+			workspace					 = x * 0x1p27;
+			const ccm::double_t rhi		 = x + workspace - workspace;
+			const ccm::double_t rlo		 = x - rhi;
+			workspace					 = rhi * rhi * data::poly1[0]; // poly1[0] == -0.5.
+			const ccm::double_t highPart = x + workspace;
+			lowPart						 = x - highPart + workspace;
+			lowPart += data::poly1[0] * rlo * (rhi + x);
+			lowPart += xLow - x * xLow; // xLow / (1 + x) to first order.
+			result += lowPart;
+			result += highPart;
+			return result;
+		}
+
+		// 1 + x = c + corr exactly (Knuth's two-sum). c is a normal double for every x > -1 outside the interval above.
+		const ccm::double_t c		 = 1.0 + x;
+		const ccm::double_t virtualB = c - x;
+		const ccm::double_t corr	 = ((x - (c - virtualB)) + (1.0 - virtualB)) + xLow;
+
+		// c = 2^expo normVal; where normVal is in range [k_logTableOffDbl, 2 * k_logTableOffDbl) and exact.
+		const std::uint64_t intC = support::double_to_uint64(c);
+		const std::uint64_t tmp	 = intC - k_logTableOffDbl;
+		// NOLINTBEGIN
+		const std::int64_t i	= (tmp >> (52 - data::table_bits)) % data::table_size;
+		const std::int64_t expo = static_cast<std::int64_t>(tmp) >> 52;
+		// NOLINTEND
+		const typename data::TabEntry & entry = data::tab[static_cast<std::size_t>(i)];
+		const ccm::double_t normVal			  = support::uint64_to_double(intC - (tmp & 0xfffULL << 52));
+
+		// corr scaled by 2^-expo like normVal, so log(c + corr) reduces in one step. From expo = 1023 on, 2^-expo is not a
+		// normal double, but there corr/c is far below the last bit of the result.
+		const ccm::double_t corrScaled = expo < 1023 ? corr * support::uint64_to_double(static_cast<std::uint64_t>(1023 - expo) << 52) : 0.0;
+
+		// log(1 + x) = log1p(rem) + log(c) + expo*Ln2, with rem ~= (normVal + corrScaled)/c - 1.
+		const ccm::double_t rem			= (normVal - entry.chi - static_cast<double>(entry.clo) + corrScaled) * entry.invc;
+		const auto scaleFactor			= static_cast<ccm::double_t>(expo);
+
+		// hi + lo = rem + log(c) + expo*Ln2.
+		workspace					 = scaleFactor * data::ln2hi + entry.logc;
+		const ccm::double_t highPart = workspace + rem;
+		lowPart						 = workspace - highPart + rem + scaleFactor * data::ln2lo + static_cast<double>(entry.logclo);
+
+		// log(1 + x) = lo + (log1p(rem) - rem) + hi.
+		const ccm::double_t remSqr = rem * rem;
+		return lowPart + remSqr * data::poly[0] + rem * remSqr * support::polyeval_pairs<3>(data::poly[1] + rem * data::poly[2], rem, remSqr, data::poly) +
+			   highPart;
+	}
+} // namespace ccm::internal::impl
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/types/fp_types.hpp"
+#include "ccmath/math/exponential/impl/log_data.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ccm::internal::impl
+{
+	/**
+	 * @brief log(z) for a positive normal double, accurate enough to round to float.
+	 *
+	 * The double log table reduces z to |rem| < 1/256, where the series of log1p to rem^4 is within 2^-34 relative.
+	 * The table entries next to 1.0 have c == 1, so results near zero keep their relative precision.
+	 */
+	constexpr double logf_kernel(double z)
+	{
+		using data = log_double_generated_data<k_logTableBitsDbl>;
+
+		// z = 2^expo normVal; where normVal is in range [k_logTableOffDbl, 2 * k_logTableOffDbl) and exact.
+		const std::uint64_t intZ = support::double_to_uint64(z);
+		const std::uint64_t tmp	 = intZ - k_logTableOffDbl;
+		// NOLINTBEGIN
+		const std::int64_t i	= (tmp >> (52 - data::table_bits)) % data::table_size;
+		const std::int64_t expo = static_cast<std::int64_t>(tmp) >> 52;
+		// NOLINTEND
+		const typename data::TabEntry & entry = data::tab[static_cast<std::size_t>(i)];
+		const ccm::double_t normVal			  = support::uint64_to_double(intZ - (tmp & 0xfffULL << 52));
+
+		// log(z) = log1p(rem) + log(c) + expo*Ln2, with invc == 1/c.
+		const ccm::double_t rem		 = normVal * entry.invc - 1.0;
+		const ccm::double_t log1pRem = rem + rem * rem * (-0.5 + rem * (0x1.5555555555555p-2 - rem * 0.25));
+		return static_cast<ccm::double_t>(expo) * (data::ln2hi + data::ln2lo) + entry.logc + log1pRem;
+	}
+
+	/// log(1 + x) for float and finite x > -1.
+	constexpr float log1p_float_impl(float x)
+	{
+		const auto x_dbl_t = static_cast<ccm::double_t>(x);
+
+		// |x| < 2^-16: x - x^2/2 + x^3/3 is within 2^-50 relative. This also keeps the sign of zero.
+		if ((support::float_to_uint32(x) & 0x7fffffff) < support::float_to_uint32(0x1p-16F))
+		{
+			return static_cast<float>(x_dbl_t - x_dbl_t * x_dbl_t * (0.5 - x_dbl_t * 0x1.5555555555555p-2));
+		}
+
+		// 1 + x is exact in double for every float in range below 2^29, and beyond that its rounding is far below float precision.
+		return static_cast<float>(logf_kernel(1.0 + x_dbl_t));
+	}
+} // namespace ccm::internal::impl
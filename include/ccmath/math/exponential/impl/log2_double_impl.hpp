@@ -12,10 +12,12 @@
 
 #include "ccmath/internal/predef/unlikely.hpp"
 #include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
 #include "ccmath/internal/types/fp_types.hpp"
 #include "ccmath/math/exponential/impl/log2_data.hpp"
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace ccm::internal
@@ -23,17 +25,23 @@ namespace ccm::internal
 	namespace impl
 	{
 		constexpr auto internalLog2DataDbl			   = ccm::internal::log2_data<double>();
-		constexpr auto log2_tab_values_dbl			   = log2_data<double>::tab;
-		constexpr auto log2_tab2_values_dbl			   = log2_data<double>::tab2;
+		inline constexpr auto & log2_tab_values_dbl			   = log2_data<double>::tab;
 		constexpr auto log2_poly_values_dbl			   = internalLog2DataDbl.poly;
 		constexpr auto log2_poly1_values_dbl		   = internalLog2DataDbl.poly1;
 		constexpr auto log2_inverse_ln2_high_value_dbl = internalLog2DataDbl.invln2hi;
 		constexpr auto log2_inverse_ln2_low_value_dbl  = internalLog2DataDbl.invln2lo;
 		constexpr auto k_log2TableN_dbl				   = (1 << k_log2TableBitsDbl);
-		constexpr auto k_log2TableOff_dbl			   = 0x3fe6000000000000;
+		constexpr auto k_log2TableOff_dbl			   = k_log2TableOffDbl;
 
+		/**
+		 * @brief Table driven base 2 logarithm.
+		 * @tparam TableBits Log2 of the size of the lookup tables. See log2_double_data.
+		 */
+		template <std::size_t TableBits = k_log2TableBitsDbl>
 		constexpr double log2_double_impl(double x)
 		{
+			using data = log2_double_data<TableBits>;
+
 			ccm::double_t result{};
 			ccm::double_t lowPart{};
 
@@ -52,20 +60,20 @@ namespace ccm::internal
 				const ccm::double_t rem		 = x - 1.0;
 				const ccm::double_t remHi	 = support::uint64_to_double(support::double_to_uint64(rem) & -1ULL << 32);
 				const ccm::double_t remLo	 = rem - remHi;
-				const ccm::double_t highPart = remHi * log2_inverse_ln2_high_value_dbl;
-				lowPart						 = remLo * log2_inverse_ln2_high_value_dbl + rem * log2_inverse_ln2_low_value_dbl;
+				const ccm::double_t highPart = remHi * data::invln2hi;
+				lowPart						 = remLo * data::invln2hi + rem * data::invln2lo;
 
 				const ccm::double_t remSqr	= rem * rem; // rounding error: 0x1p-62.
 				const ccm::double_t remQuad = remSqr * remSqr;
 
 				// The Worst-case error is less than 0.55 ULP
-				const ccm::double_t polynomialTerm = remSqr * (log2_poly1_values_dbl[0] + rem * log2_poly1_values_dbl[1]);
+				const ccm::double_t polynomialTerm = remSqr * (data::poly1[0] + rem * data::poly1[1]);
 				result							   = highPart + polynomialTerm;
 				lowPart += highPart - result + polynomialTerm;
 				lowPart += remQuad *
-						   (log2_poly1_values_dbl[2] + rem * log2_poly1_values_dbl[3] + remSqr * (log2_poly1_values_dbl[4] + rem * log2_poly1_values_dbl[5]) +
-							remQuad * (log2_poly1_values_dbl[6] + rem * log2_poly1_values_dbl[7] +
-									   remSqr * (log2_poly1_values_dbl[8] + rem * log2_poly1_values_dbl[9])));
+						   (data::poly1[2] + rem * data::poly1[3] + remSqr * (data::poly1[4] + rem * data::poly1[5]) +
+							remQuad * (data::poly1[6] + rem * data::poly1[7] +
+									   remSqr * (data::poly1[8] + rem * data::poly1[9])));
 				result += lowPart;
 
 				return result;
@@ -82,41 +90,38 @@ namespace ccm::internal
 			// x = 2^expo normVal; where normVal is in range [k_logTableOff_dbl, 2 * k_logTableOff_dbl) and exact.
 			//  The range is split into N sub-intervals.
 			// The ith sub-interval contains normVal and c is near its center.
-			const std::uint64_t tmp = intX - k_log2TableOff_dbl;
+			const std::uint64_t tmp = intX - k_log2TableOffDbl;
 			// NOLINTBEGIN
-			std::int64_t i	  = (tmp >> (52 - ccm::internal::k_log2TableBitsDbl)) % k_log2TableN_dbl;
+			std::int64_t i	  = (tmp >> (52 - TableBits)) % data::table_size;
 			std::int64_t expo = static_cast<std::int64_t>(tmp) >> 52; // Arithmetic shift.
 			// NOLINTEND
 			const std::uint64_t intNorm		   = intX - (tmp & 0xfffULL << 52);
-			const ccm::double_t inverseCoeff   = log2_tab_values_dbl.at(static_cast<unsigned long>(i)).invc;
-			const ccm::double_t logarithmCoeff = log2_tab_values_dbl.at(static_cast<unsigned long>(i)).logc;
-			const ccm::double_t normVal		   = support::uint64_to_double(intNorm);
-			const auto expoDbl				   = static_cast<double_t>(expo);
+			// One record holds everything the lookup needs. i is in range by construction, so it is not bounds checked.
+			const typename data::TabEntry & entry = data::tab[static_cast<std::size_t>(i)];
+			const ccm::double_t inverseCoeff	  = entry.invc;
+			const ccm::double_t logarithmCoeff	  = entry.logc;
+			const ccm::double_t normVal			  = support::uint64_to_double(intNorm);
+			const auto expoDbl					  = static_cast<double_t>(expo);
 
 			// rounding error: 0x1p-55/N + 0x1p-65.
-			const ccm::double_t rem =
-				(normVal - log2_tab2_values_dbl.at(static_cast<unsigned long>(i)).chi - log2_tab2_values_dbl.at(static_cast<unsigned long>(i)).clo) *
-				inverseCoeff;
+			const ccm::double_t rem			= (normVal - entry.chi - static_cast<double>(entry.clo)) * inverseCoeff;
 			const ccm::double_t remHi		= support::uint64_to_double(support::double_to_uint64(rem) & -1ULL << 32);
 			const ccm::double_t remLo		= rem - remHi;
-			const ccm::double_t remHighPart = remHi * log2_inverse_ln2_high_value_dbl;
-			const ccm::double_t remLowPart	= remLo * log2_inverse_ln2_high_value_dbl + rem * log2_inverse_ln2_low_value_dbl;
+			const ccm::double_t remHighPart = remHi * data::invln2hi;
+			const ccm::double_t remLowPart	= remLo * data::invln2hi + rem * data::invln2lo;
 
 			// hi + lo = rem/ln2 + log2(c) + expo
 			const ccm::double_t logExpoSum = expoDbl + logarithmCoeff;
 			const ccm::double_t highPart   = logExpoSum + remHighPart;
-			lowPart						   = logExpoSum - highPart + remHighPart + remLowPart;
+			lowPart						   = logExpoSum - highPart + remHighPart + remLowPart + static_cast<double>(entry.logclo);
 
 			// log2(rem+1) = rem/ln2 + rem^2*poly(rem)
 			// Evaluation is optimized assuming super scalar pipelined execution.
-			const ccm::double_t remSqr	= rem * rem; // rounding error: 0x1p-62.
-			const ccm::double_t remQuad = remSqr * remSqr;
+			const ccm::double_t remSqr = rem * rem; // rounding error: 0x1p-62.
 
 			// Worst-case error if |result| > 0x1p-4: 0.550 ULP.
 			// ~ 0.5 + 2/N/ln2 + abs-poly-error*0x1p56+0.003 ULP.
-			const ccm::double_t polynomialTerm = log2_poly_values_dbl[0] + rem * log2_poly_values_dbl[1] +
-												 remSqr * (log2_poly_values_dbl[2] + rem * log2_poly_values_dbl[3]) +
-												 remQuad * (log2_poly_values_dbl[4] + rem * log2_poly_values_dbl[5]);
+			const ccm::double_t polynomialTerm = support::polyeval_pairs<2>(data::poly[0] + rem * data::poly[1], rem, remSqr, data::poly);
 			result = lowPart + remSqr * polynomialTerm + highPart;
 
 			return result;
@@ -16,6 +16,7 @@
 #include "ccmath/math/exponential/impl/log2_data.hpp"
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace ccm::internal
@@ -23,7 +24,7 @@ namespace ccm::internal
 	namespace impl
 	{
 		constexpr auto internalLog2DataFlt	= ccm::internal::log2_data<float>();
-		constexpr auto log2_tab_values_flt	= ccm::internal::log2_data<float>::tab;
+		inline constexpr auto & log2_tab_values_flt = ccm::internal::log2_data<float>::tab;
 		constexpr auto log2_poly_values_flt = internalLog2DataFlt.poly;
 		constexpr auto k_log2TableN_flt		= (1 << ccm::internal::k_log2TableBitsFlt);
 		constexpr auto k_log2TableOff_flt	= 0x3f330000;
@@ -60,8 +61,8 @@ namespace ccm::internal
 			const std::uint32_t intNorm = intX - top;
 			// NOLINTNEXTLINE
 			const int expo					   = tmp >> 23; // Arithmetic shift.
-			const ccm::double_t inverseCoeff   = log2_tab_values_flt.at(static_cast<unsigned long>(i)).invc;
-			const ccm::double_t logarithmCoeff = log2_tab_values_flt.at(static_cast<unsigned long>(i)).logc;
+			const ccm::double_t inverseCoeff   = log2_tab_values_flt[static_cast<std::size_t>(i)].invc;
+			const ccm::double_t logarithmCoeff = log2_tab_values_flt[static_cast<std::size_t>(i)].logc;
 			const auto normVal				   = static_cast<ccm::double_t>(support::uint32_to_float(intNorm));
 
 			// log2(x) = log1p(normVal/c-1)/ln2 + log2(c) + expo
@@ -12,10 +12,12 @@
 
 #include "ccmath/internal/predef/unlikely.hpp"
 #include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/support/poly_eval.hpp"
 #include "ccmath/internal/types/fp_types.hpp"
 #include "ccmath/math/exponential/impl/log_data.hpp"
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace ccm::internal
@@ -23,17 +25,23 @@ namespace ccm::internal
 	namespace impl
 	{
 		constexpr auto internalLogDataDbl	= ccm::internal::log_data<double>();
-		constexpr auto log_tab_values_dbl	= log_data<double>::tab;
-		constexpr auto log_tab2_values_dbl	= log_data<double>::tab2;
+		inline constexpr auto & log_tab_values_dbl	= log_data<double>::tab;
 		constexpr auto log_poly_values_dbl	= internalLogDataDbl.poly;
 		constexpr auto log_poly1_values_dbl = internalLogDataDbl.poly1;
 		constexpr auto log_ln2hi_value_dbl	= internalLogDataDbl.ln2hi;
 		constexpr auto log_ln2lo_value_dbl	= internalLogDataDbl.ln2lo;
 		constexpr auto k_logTableN_dbl		= (1 << ccm::internal::k_logTableBitsDbl);
-		constexpr auto k_logTableOff_dbl	= 0x3fe6000000000000;
+		constexpr auto k_logTableOff_dbl	= k_logTableOffDbl;
 
+		/**
+		 * @brief Table driven natural logarithm.
+		 * @tparam TableBits Log2 of the size of the lookup tables. See log_double_data.
+		 */
+		template <std::size_t TableBits = k_logTableBitsDbl>
 		constexpr double log_double_impl(double x)
 		{
+			using data = log_double_data<TableBits>;
+
 			// Declare variables for intermediate calculations
 			ccm::double_t workspace{};
 			ccm::double_t result{};
@@ -57,20 +65,20 @@ namespace ccm::internal
 				const ccm::double_t rem		 = x - 1.0;
 				const ccm::double_t remSqr	 = rem * rem;
 				const ccm::double_t remCubed = rem * remSqr;
-				result						 = remCubed * (log_poly1_values_dbl[1] + rem * log_poly1_values_dbl[2] + remSqr * log_poly1_values_dbl[3] +
-									   remCubed * (log_poly1_values_dbl[4] + rem * log_poly1_values_dbl[5] + remSqr * log_poly1_values_dbl[6] +
-												   remCubed * (log_poly1_values_dbl[7] + rem * log_poly1_values_dbl[8] + remSqr * log_poly1_values_dbl[9] +
-															   remCubed * log_poly1_values_dbl[10])));
+				result						 = remCubed * (data::poly1[1] + rem * data::poly1[2] + remSqr * data::poly1[3] +
+									   remCubed * (data::poly1[4] + rem * data::poly1[5] + remSqr * data::poly1[6] +
+												   remCubed * (data::poly1[7] + rem * data::poly1[8] + remSqr * data::poly1[9] +
+															   remCubed * data::poly1[10])));
 
 				// Additional error correction
 				// Worst-case error is around 0.507 ULP.
 				workspace					 = rem * 0x1p27;
 				const ccm::double_t rhi		 = rem + workspace - workspace;
 				const ccm::double_t rlo		 = rem - rhi;
-				workspace					 = rhi * rhi * log_poly1_values_dbl[0]; // poly1_values[0] == -0.5.
+				workspace					 = rhi * rhi * data::poly1[0]; // poly1_values[0] == -0.5.
 				const ccm::double_t highPart = rem + workspace;
 				lowPart						 = rem - highPart + workspace;
-				lowPart += log_poly1_values_dbl[0] * rlo * (rhi + rem);
+				lowPart += data::poly1[0] * rlo * (rhi + rem);
 				result += lowPart;
 				result += highPart;
 				return result;
@@ -91,37 +99,36 @@ namespace ccm::internal
 			 */
 
 			// Calculate logarithm for normalized inputs
-			const std::uint64_t tmp = intX - k_logTableOff_dbl;
+			const std::uint64_t tmp = intX - k_logTableOffDbl;
 			// NOLINTBEGIN
-			const std::int64_t i	= (tmp >> (52 - ccm::internal::k_logTableBitsDbl)) % k_logTableN_dbl;
+			const std::int64_t i	= (tmp >> (52 - TableBits)) % data::table_size;
 			const std::int64_t expo = static_cast<std::int64_t>(tmp) >> 52;
 			// NOLINTEND
 			const std::uint64_t intNorm		   = intX - (tmp & 0xfffULL << 52); // Arithmetic shift
-			const ccm::double_t inverseCoeff   = log_tab_values_dbl.at(static_cast<unsigned long>(i)).invc;
-			const ccm::double_t logarithmCoeff = log_tab_values_dbl.at(static_cast<unsigned long>(i)).logc;
-			const ccm::double_t normVal		   = support::uint64_to_double(intNorm);
+			// One record holds everything the lookup needs. i is in range by construction, so it is not bounds checked.
+			const typename data::TabEntry & entry = data::tab[static_cast<std::size_t>(i)];
+			const ccm::double_t inverseCoeff	  = entry.invc;
+			const ccm::double_t logarithmCoeff	  = entry.logc;
+			const ccm::double_t normVal			  = support::uint64_to_double(intNorm);
 
 			// Calculate intermediate value for logarithm computation
 			// log(x) = log1p(normVal/c-1) + log(c) + expo*Ln2.
 			// r ~= z/c - 1, |r| < 1/(2*N)
-			const ccm::double_t rem =
-				(normVal - log_tab2_values_dbl.at(static_cast<unsigned long>(i)).chi - log_tab2_values_dbl.at(static_cast<unsigned long>(i)).clo) *
-				inverseCoeff;
+			const ccm::double_t rem = (normVal - entry.chi - static_cast<double>(entry.clo)) * inverseCoeff;
 			const auto scaleFactor = static_cast<ccm::double_t>(expo);
 
 			// Calculate high and low parts of logarithm
 			// hi + lo = r + log(c) + expo*Ln2.
-			workspace					 = scaleFactor * log_ln2hi_value_dbl + logarithmCoeff;
+			workspace					 = scaleFactor * data::ln2hi + logarithmCoeff;
 			const ccm::double_t highPart = workspace + rem;
-			lowPart						 = workspace - highPart + rem + scaleFactor * log_ln2lo_value_dbl;
+			lowPart						 = workspace - highPart + rem + scaleFactor * data::ln2lo + static_cast<double>(entry.logclo);
 
 			// Final computation of logarithm
 			// log(x) = lo + (log1p(rem) - rem) + hi.
 			const ccm::double_t remSqr = rem * rem; // rounding error: 0x1p-54/k_logTableN^2.
 			// Worst case error if |result| > 0x1p-4: 0.520 ULP
 			// 0.5 + 2.06/k_logTableN + abs-poly-error*2^56+0.001 ULP
-			result = lowPart + remSqr * log_poly_values_dbl[0] +
-					 rem * remSqr * (log_poly_values_dbl[1] + rem * log_poly_values_dbl[2] + remSqr * (log_poly_values_dbl[3] + rem * log_poly_values_dbl[4])) +
+			result = lowPart + remSqr * data::poly[0] + rem * remSqr * support::polyeval_pairs<3>(data::poly[1] + rem * data::poly[2], rem, remSqr, data::poly) +
 					 highPart;
 			return result;
 		}
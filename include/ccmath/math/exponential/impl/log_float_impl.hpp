@@ -17,6 +17,7 @@
 #include "ccmath/math/exponential/impl/log_data.hpp"
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <type_traits>
@@ -26,7 +27,7 @@ namespace ccm::internal
 	namespace impl
 	{
 		constexpr auto internalLogDataFlt  = ccm::internal::log_data<float>();
-		constexpr auto log_tab_values_flt  = log_data<float>::tab;
+		inline constexpr auto & log_tab_values_flt = log_data<float>::tab;
 		constexpr auto log_poly_values_flt = internalLogDataFlt.poly;
 		constexpr auto log_ln2_value_flt   = internalLogDataFlt.ln2;
 		constexpr auto k_logTableN_flt	   = (1 << ccm::internal::k_logTableBitsFlt);
@@ -69,8 +70,8 @@ namespace ccm::internal
 			i			   = (tmp >> (23 - ccm::internal::k_logTableBitsFlt)) % k_logTableN_flt; // NOLINT
 			expo		   = static_cast<std::int32_t>(tmp) >> 23;
 			intNorm		   = intX - (tmp & static_cast<std::uint32_t>(0x1ff << 23));
-			inverseCoeff   = log_tab_values_flt.at(static_cast<unsigned long>(i)).invc;
-			logarithmCoeff = log_tab_values_flt.at(static_cast<unsigned long>(i)).logc;
+			inverseCoeff   = log_tab_values_flt[static_cast<std::size_t>(i)].invc;
+			logarithmCoeff = log_tab_values_flt[static_cast<std::size_t>(i)].logc;
 			normVal		   = static_cast<ccm::double_t>(ccm::support::uint32_to_float(intNorm));
 
 			// log(x) = log1p(normVal / inverseCoeff - 1) + log(inverseCoeff) + expo * Ln2
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/basic/fma_gen.hpp"
+#include "ccmath/internal/support/bits.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Compile time generation of the lookup tables and Taylor polynomials used by exp, exp2, log and log2.
+ *
+ * Everything here is meant to be evaluated in constant expressions only. Tables are computed in double-double
+ * arithmetic, which is exact to about 2^-104 and leaves the tables correct to the last bit in all but a handful of
+ * entries, and rounded to double once at the end.
+ */
+namespace ccm::internal::table_gen
+{
+	using type::DoubleDouble;
+
+	/// ln(2) as a double-double.
+	constexpr DoubleDouble ln2_dd{0x1.62e42fefa39efp-1, 0x1.abc9e3b39803fp-56};
+
+	/// Absolute polynomial error the generated tables aim for. The table paths produce results of magnitude 2^-5 or more.
+	constexpr double target_poly_error = 0x1p-64;
+
+	constexpr DoubleDouble dd_renormalize(double hi, double lo)
+	{
+		return type::exact_add(hi, lo);
+	}
+
+	constexpr DoubleDouble dd_add(const DoubleDouble & a, const DoubleDouble & b)
+	{
+		const type::NumberPair<double> hi = gen::internal::fma_two_sum(a.hi, b.hi);
+		const type::NumberPair<double> lo = gen::internal::fma_two_sum(a.lo, b.lo);
+		const DoubleDouble sum			  = dd_renormalize(hi.hi, hi.lo + lo.hi);
+		return dd_renormalize(sum.hi, sum.lo + lo.lo);
+	}
+
+	constexpr DoubleDouble dd_neg(const DoubleDouble & a)
+	{
+		return {-a.hi, -a.lo};
+	}
+
+	constexpr DoubleDouble dd_mul(const DoubleDouble & a, const DoubleDouble & b)
+	{
+		const type::NumberPair<double> p = gen::internal::fma_two_product(a.hi, b.hi);
+		return dd_renormalize(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+	}
+
+	constexpr DoubleDouble dd_div(const DoubleDouble & a, const DoubleDouble & b)
+	{
+		// Two correction steps on the double quotient.
+		const double q1		 = a.hi / b.hi;
+		DoubleDouble rem	 = dd_add(a, dd_neg(dd_mul(b, {q1, 0.0})));
+		const double q2		 = rem.hi / b.hi;
+		rem					 = dd_add(rem, dd_neg(dd_mul(b, {q2, 0.0})));
+		const double q3		 = rem.hi / b.hi;
+		const DoubleDouble q = dd_renormalize(q1, q2);
+		return dd_renormalize(q.hi, q.lo + q3);
+	}
+
+	constexpr double dd_abs(double x)
+	{
+		return x < 0.0 ? -x : x;
+	}
+
+	/// e^x for |x| <= 0.5 by its Taylor series.
+	constexpr DoubleDouble dd_exp(const DoubleDouble & x)
+	{
+		DoubleDouble sum{1.0, 0.0};
+		DoubleDouble term{1.0, 0.0};
+		for (int n = 1; dd_abs(term.hi) > 0x1p-110; ++n)
+		{
+			term = dd_div(dd_mul(term, x), {static_cast<double>(n), 0.0});
+			sum	 = dd_add(sum, term);
+		}
+		return sum;
+	}
+
+	/// log(x) for x in [0.5, 2] as 2 atanh((x - 1) / (x + 1)).
+	constexpr DoubleDouble dd_log(const DoubleDouble & x)
+	{
+		const DoubleDouble u  = dd_div(dd_add(x, {-1.0, 0.0}), dd_add(x, {1.0, 0.0}));
+		const DoubleDouble u2 = dd_mul(u, u);
+		DoubleDouble sum	  = u;
+		DoubleDouble power	  = u;
+		for (int k = 3; dd_abs(power.hi) > 0x1p-110; k += 2)
+		{
+			power = dd_mul(power, u2);
+			sum	  = dd_add(sum, dd_div(power, {static_cast<double>(k), 0.0}));
+		}
+		return {2.0 * sum.hi, 2.0 * sum.lo};
+	}
+
+	/// ln(2) rounded to the given number of significant bits, and the rest of ln(2) rounded to double.
+	constexpr DoubleDouble ln2_split(std::size_t bits)
+	{
+		double scale = 1.0;
+		for (std::size_t i = 0; i < bits; ++i) { scale *= 2.0; }
+		const double head = static_cast<double>(static_cast<std::int64_t>(ln2_dd.hi * scale + 0.5)) / scale;
+		return {head, dd_add(ln2_dd, {-head, 0.0}).hi};
+	}
+
+	/// An upper bound of |x|^n / d.
+	constexpr double power_over(double x, std::size_t n, double d)
+	{
+		double result = 1.0 / d;
+		for (std::size_t i = 0; i < n; ++i) { result *= x; }
+		return result;
+	}
+
+	/**
+	 * @brief Bits of 2^(k/N) for the exp and exp2 tables, N = 2^TableBits.
+	 *
+	 * 2^(k/N) ~= H[k] * (1 + T[k]). tab[2k] holds the bits of T[k] and tab[2k+1] the bits of H[k] minus (k << 52) / N, so that
+	 * adding the scaled integer part of the exponent to it gives the bits of the scale.
+	 */
+	template <std::size_t TableBits>
+	constexpr std::array<std::uint64_t, 2 * (std::size_t{1} << TableBits)> make_exp2_table()
+	{
+		constexpr std::size_t table_size = std::size_t{1} << TableBits;
+		std::array<std::uint64_t, 2 * table_size> tab{};
+		for (std::size_t k = 0; k < table_size; ++k)
+		{
+			// Evaluate 2^(j/N) with |j/N| <= 1/2 and scale the upper half of the table back by 2.
+			const bool upper	   = 2 * k > table_size;
+			const double exponent  = (static_cast<double>(k) - (upper ? static_cast<double>(table_size) : 0.0)) / static_cast<double>(table_size);
+			DoubleDouble power	   = dd_exp(dd_mul(ln2_dd, {exponent, 0.0}));
+			if (upper) { power = {2.0 * power.hi, 2.0 * power.lo}; }
+			tab[2 * k]	   = support::double_to_uint64(power.lo / power.hi);
+			tab[2 * k + 1] = support::double_to_uint64(power.hi) - (static_cast<std::uint64_t>(k) << (52 - TableBits));
+		}
+		return tab;
+	}
+
+	/// The exp2 table for 2^TableBits entries. exp and exp2 share it. The tail and scale of one entry are 16 bytes and never straddle a cache line.
+	template <std::size_t TableBits>
+	alignas(64) inline constexpr std::array<std::uint64_t, 2 * (std::size_t{1} << TableBits)> exp2_table = make_exp2_table<TableBits>();
+
+	/// The scale half of make_exp2_table, as used by the single precision kernels.
+	template <std::size_t TableBits>
+	constexpr std::array<std::uint64_t, std::size_t{1} << TableBits> make_exp2_scale_table()
+	{
+		std::array<std::uint64_t, std::size_t{1} << TableBits> tab{};
+		for (std::size_t k = 0; k < tab.size(); ++k) { tab[k] = exp2_table<TableBits>[2 * k + 1]; }
+		return tab;
+	}
+
+	/// Number of coefficients after the linear term needed for e^r - 1 - r with |r| <= ln2 / 2^(TableBits + 1).
+	constexpr std::size_t exp_poly_size(std::size_t table_bits)
+	{
+		const double bound = 0x1.62e42fefa39efp-1 / static_cast<double>(std::size_t{2} << table_bits);
+		std::size_t degree = 2;
+		double factorial   = 6.0;
+		while (power_over(bound, degree + 1, factorial) > target_poly_error) { factorial *= static_cast<double>(++degree + 1); }
+		return degree - 1;
+	}
+
+	/// Taylor coefficients 1/2!, 1/3!, ... of e^r - 1 - r.
+	template <std::size_t Size>
+	constexpr std::array<double, Size> make_exp_poly()
+	{
+		std::array<double, Size> poly{};
+		DoubleDouble coeff{1.0, 0.0};
+		for (std::size_t i = 0; i < Size; ++i)
+		{
+			coeff	= dd_div(coeff, {static_cast<double>(i + 2), 0.0});
+			poly[i] = coeff.hi;
+		}
+		return poly;
+	}
+
+	/// Number of coefficients needed for 2^r - 1 with |r| <= 1 / 2^(TableBits + 1).
+	constexpr std::size_t exp2_poly_size(std::size_t table_bits)
+	{
+		return exp_poly_size(table_bits) + 1;
+	}
+
+	/// Taylor coefficients ln2, ln2^2/2!, ... of 2^r - 1.
+	template <std::size_t Size>
+	constexpr std::array<double, Size> make_exp2_poly()
+	{
+		std::array<double, Size> poly{};
+		DoubleDouble coeff{1.0, 0.0};
+		for (std::size_t i = 0; i < Size; ++i)
+		{
+			coeff	= dd_div(dd_mul(coeff, ln2_dd), {static_cast<double>(i + 1), 0.0});
+			poly[i] = coeff.hi;
+		}
+		return poly;
+	}
+
+	/// Number of coefficients of log1p(r) - r starting at r^2, for |r| <= 1 / 2^(TableBits + 1).
+	constexpr std::size_t log_poly_size(std::size_t table_bits)
+	{
+		const double bound = 1.0 / static_cast<double>(std::size_t{2} << table_bits);
+		std::size_t degree = 2;
+		while (power_over(bound, degree + 1, static_cast<double>(degree + 1)) > target_poly_error) { ++degree; }
+		return degree - 1;
+	}
+
+	/// Taylor coefficients -1/2, 1/3, -1/4, ... of log1p(r) - r, each divided by Divisor.
+	template <std::size_t Size>
+	constexpr std::array<double, Size> make_log_poly(const DoubleDouble & divisor)
+	{
+		std::array<double, Size> poly{};
+		for (std::size_t i = 0; i < Size; ++i)
+		{
+			const double sign = i % 2 == 0 ? -1.0 : 1.0;
+			poly[i]			  = dd_div({sign, 0.0}, dd_mul(divisor, {static_cast<double>(i + 2), 0.0})).hi;
+		}
+		return poly;
+	}
+
+	/// One subinterval of the log and log2 tables.
+	struct log_table_point
+	{
+		double invc;	 // 1/c rounded to double.
+		DoubleDouble c;	 // 1/invc, so that (z - c) * invc ~= z/c - 1.
+		DoubleDouble logc; // log(c).
+	};
+
+	/**
+	 * @brief Reference point of subinterval i of [Off, 2 Off), where Off is the double with bits Off and the range is split
+	 * into 2^TableBits equal steps of the bit pattern.
+	 */
+	template <std::size_t TableBits, std::uint64_t Off>
+	constexpr log_table_point make_log_table_point(std::size_t i)
+	{
+		const std::uint64_t step = std::uint64_t{1} << (52 - TableBits);
+		const double low		 = support::uint64_to_double(Off + i * step);
+		const double high		 = support::uint64_to_double(Off + (i + 1) * step);
+		const double invc		 = 1.0 / ((low + high) * 0.5);
+		return {invc, dd_div({1.0, 0.0}, {invc, 0.0}), dd_neg(dd_log({invc, 0.0}))};
+	}
+} // namespace ccm::internal::table_gen
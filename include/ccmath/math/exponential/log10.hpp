@@ -10,38 +10,71 @@
 
 #pragma once
 
+#include "ccmath/internal/config/compiler.hpp"
+#include "ccmath/math/exponential/impl/log10_double_impl.hpp"
+#include "ccmath/math/exponential/impl/log10_float_impl.hpp"
+
+#include <limits>
 #include <type_traits>
 
 namespace ccm
 {
+	/**
+	 * @brief Returns the base 10 logarithm of a number.
+	 * @tparam T The type of the number.
+	 * @param num The number to calculate the base 10 logarithm of.
+	 * @return The base 10 logarithm of the number. Powers of ten give exact integers.
+	 * @note long double arguments are evaluated in double precision.
+	 */
 	template <typename T, std::enable_if_t<!std::is_integral_v<T>, bool> = true>
-	constexpr T log10(T num)
+	constexpr T log10(T num) noexcept
 	{
-		#if defined(__GNUC__) && (__GNUC__ > 6 || (__GNUC__ == 6 && __GNUC_MINOR__ >= 1)) && !defined(__clang__)
-		if constexpr (std::is_same_v<T, float>) { return __builtin_log10f(num); }
-		if constexpr (std::is_same_v<T, double>) { return __builtin_log10(num); }
-		if constexpr (std::is_same_v<T, long double>) { return __builtin_log10l(num); }
-		return static_cast<T>(__builtin_expm1l(num));
-		#else
-		if constexpr (std::is_same_v<T, float>) { return 0; }
-		if constexpr (std::is_same_v<T, double>) { return 0; }
-		if constexpr (std::is_same_v<T, long double>) { return 0; }
-		return 0;
+		// If the argument is ±0, -∞ is returned
+		if (num == static_cast<T>(0)) { return -std::numeric_limits<T>::infinity(); }
+
+		// If the argument is NaN or +∞, it is returned.
+		if (num != num || num == std::numeric_limits<T>::infinity()) { return num; }
+
+		// If the argument is negative, -NaN is returned
+		#ifdef CCMATH_COMPILER_APPLE_CLANG // Apple clang returns +qNaN
+		if (num < static_cast<T>(0)) { return std::numeric_limits<T>::quiet_NaN(); }
+		#else // All other major compilers return -qNaN
+		if (num < static_cast<T>(0)) { return -std::numeric_limits<T>::quiet_NaN(); }
 		#endif
+
+		if constexpr (std::is_same_v<T, float>) { return internal::impl::log10_float_impl(num); }
+		else if constexpr (std::is_same_v<T, double>) { return internal::impl::log10_double_impl(num); }
+		else { return static_cast<T>(internal::impl::log10_double_impl(static_cast<double>(num))); }
 	}
 
+	/**
+	 * @brief Returns the base 10 logarithm of a number.
+	 * @tparam Integer The type of the integer.
+	 * @param num The number to calculate the base 10 logarithm of.
+	 * @return The base 10 logarithm of the number as a double.
+	 */
 	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
-	constexpr double log10(Integer num)
+	constexpr double log10(Integer num) noexcept
 	{
 		return ccm::log10<double>(static_cast<double>(num));
 	}
 
-	constexpr float log10f(float num)
+	/**
+	 * @brief Returns the base 10 logarithm of a number.
+	 * @param num The number to calculate the base 10 logarithm of.
+	 * @return The base 10 logarithm of the number as a float.
+	 */
+	constexpr float log10f(float num) noexcept
 	{
 		return ccm::log10<float>(num);
 	}
 
-	constexpr long double log10l(long double num)
+	/**
+	 * @brief Returns the base 10 logarithm of a number.
+	 * @param num The number to calculate the base 10 logarithm of.
+	 * @return The base 10 logarithm of the number as a long double.
+	 */
+	constexpr long double log10l(long double num) noexcept
 	{
 		return ccm::log10<long double>(num);
 	}
@@ -10,39 +10,72 @@
 
 #pragma once
 
+#include "ccmath/internal/config/compiler.hpp"
+#include "ccmath/math/exponential/impl/log1p_double_impl.hpp"
+#include "ccmath/math/exponential/impl/log1p_float_impl.hpp"
+
+#include <limits>
 #include <type_traits>
 
 namespace ccm
 {
+	/**
+	 * @brief Computes the natural (base e) logarithm of 1 + num.
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value.
+	 * @return If no errors occur, ln(1 + num) is returned. The result is accurate even when num is close to zero.
+	 * @note long double arguments are evaluated in double precision.
+	 */
 	template <typename T, std::enable_if_t<!std::is_integral_v<T>, bool> = true>
-	constexpr T log1p(T num)
+	constexpr T log1p(T num) noexcept
 	{
-		#if defined(__GNUC__) && (__GNUC__ > 6 || (__GNUC__ == 6 && __GNUC_MINOR__ >= 1)) && !defined(__clang__)
-		if constexpr (std::is_same_v<T, float>) { return __builtin_log1pf(num); }
-		if constexpr (std::is_same_v<T, double>) { return __builtin_log1p(num); }
-		if constexpr (std::is_same_v<T, long double>) { return __builtin_log1pl(num); }
-		return static_cast<T>(__builtin_log1p(num));
-		#else
-		if constexpr (std::is_same_v<T, float>) { return 0; }
-		if constexpr (std::is_same_v<T, double>) { return 0; }
-		if constexpr (std::is_same_v<T, long double>) { return 0; }
-		return 0;
+		// If the argument is -1, -∞ is returned.
+		if (num == static_cast<T>(-1)) { return -std::numeric_limits<T>::infinity(); }
+
+		// If the argument is less than -1, -NaN is returned.
+		#ifdef CCMATH_COMPILER_APPLE_CLANG // Apple clang returns +qNaN
+		if (num < static_cast<T>(-1)) { return std::numeric_limits<T>::quiet_NaN(); }
+		#else // All other major compilers return -qNaN
+		if (num < static_cast<T>(-1)) { return -std::numeric_limits<T>::quiet_NaN(); }
 		#endif
+
+		// If the argument is NaN or +∞, it is returned.
+		if (num != num || num == std::numeric_limits<T>::infinity()) { return num; }
+
+		if constexpr (std::is_same_v<T, float>) { return internal::impl::log1p_float_impl(num); }
+		else if constexpr (std::is_same_v<T, double>) { return internal::impl::log1p_double_impl(num); }
+		else { return static_cast<T>(internal::impl::log1p_double_impl(static_cast<double>(num))); }
 	}
 
+	/**
+	 * @brief Computes the natural (base e) logarithm of 1 + num.
+	 * @tparam Integer The type of the integer.
+	 * @param num An integer value.
+	 * @return If no errors occur, ln(1 + num) is returned as double.
+	 */
 	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
-	constexpr double log1p(Integer num)
+	constexpr double log1p(Integer num) noexcept
 	{
 		return ccm::log1p<double>(static_cast<double>(num));
 	}
 
-	constexpr float log1pf(float num)
+	/**
+	 * @brief Computes the natural (base e) logarithm of 1 + num.
+	 * @param num A floating-point value.
+	 * @return If no errors occur, ln(1 + num) is returned as float.
+	 */
+	constexpr float log1pf(float num) noexcept
 	{
 		return ccm::log1p<float>(num);
 	}
 
-	constexpr long double log1pl(double num)
+	/**
+	 * @brief Computes the natural (base e) logarithm of 1 + num.
+	 * @param num A floating-point value.
+	 * @return If no errors occur, ln(1 + num) is returned as long double.
+	 */
+	constexpr long double log1pl(long double num) noexcept
 	{
-		return ccm::log1p<double>(num);
+		return ccm::log1p<long double>(num);
 	}
 } // namespace ccm
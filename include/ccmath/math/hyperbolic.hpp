@@ -15,4 +15,5 @@
 #include "hyperbolic/atanh.hpp"
 #include "hyperbolic/cosh.hpp"
 #include "hyperbolic/sinh.hpp"
+#include "hyperbolic/sinhcosh.hpp"
 #include "hyperbolic/tanh.hpp"
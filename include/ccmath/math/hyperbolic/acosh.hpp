@@ -10,7 +10,56 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/hyperbolic/acosh_gen.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the inverse hyperbolic cosine of num.
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value.
+	 * @return If no errors occur, the inverse hyperbolic cosine of num (acosh(num)) in the range [0, +∞] is returned. If num is less than 1, NaN is returned.
+	 * @note long double arguments are evaluated in double precision.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T acosh(T num) noexcept
+	{
+		return gen::acosh_gen<T>(num);
+	}
+
+	/**
+	 * @brief Computes the inverse hyperbolic cosine of num.
+	 * @tparam Integer The type of the number.
+	 * @param num An integral value.
+	 * @return If no errors occur, the result for num converted to double is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double acosh(Integer num) noexcept
+	{
+		return gen::acosh_gen<double>(static_cast<double>(num));
+	}
 
+	/**
+	 * @brief Computes the inverse hyperbolic cosine of num.
+	 * @param num A float value.
+	 * @return If no errors occur, the inverse hyperbolic cosine of num (acosh(num)) in the range [0, +∞] is returned. If num is less than 1, NaN is returned.
+	 */
+	constexpr float acoshf(float num) noexcept
+	{
+		return ccm::acosh<float>(num);
+	}
+
+	/**
+	 * @brief Computes the inverse hyperbolic cosine of num.
+	 * @param num A long double value.
+	 * @return If no errors occur, the inverse hyperbolic cosine of num (acosh(num)) in the range [0, +∞] is returned. If num is less than 1, NaN is returned.
+	 */
+	constexpr long double acoshl(long double num) noexcept
+	{
+		return ccm::acosh<long double>(num);
+	}
 } // namespace ccm
+
+/// @ingroup hyperbolic
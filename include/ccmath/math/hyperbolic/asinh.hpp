@@ -10,7 +10,56 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/hyperbolic/asinh_gen.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the inverse hyperbolic sine of num.
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value.
+	 * @return If no errors occur, the inverse hyperbolic sine of num (asinh(num)) is returned. If num is ±0, ±∞ or NaN, it is returned.
+	 * @note long double arguments are evaluated in double precision.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T asinh(T num) noexcept
+	{
+		return gen::asinh_gen<T>(num);
+	}
+
+	/**
+	 * @brief Computes the inverse hyperbolic sine of num.
+	 * @tparam Integer The type of the number.
+	 * @param num An integral value.
+	 * @return If no errors occur, the result for num converted to double is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double asinh(Integer num) noexcept
+	{
+		return gen::asinh_gen<double>(static_cast<double>(num));
+	}
 
+	/**
+	 * @brief Computes the inverse hyperbolic sine of num.
+	 * @param num A float value.
+	 * @return If no errors occur, the inverse hyperbolic sine of num (asinh(num)) is returned. If num is ±0, ±∞ or NaN, it is returned.
+	 */
+	constexpr float asinhf(float num) noexcept
+	{
+		return ccm::asinh<float>(num);
+	}
+
+	/**
+	 * @brief Computes the inverse hyperbolic sine of num.
+	 * @param num A long double value.
+	 * @return If no errors occur, the inverse hyperbolic sine of num (asinh(num)) is returned. If num is ±0, ±∞ or NaN, it is returned.
+	 */
+	constexpr long double asinhl(long double num) noexcept
+	{
+		return ccm::asinh<long double>(num);
+	}
 } // namespace ccm
+
+/// @ingroup hyperbolic
@@ -10,7 +10,60 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/hyperbolic/sinh_gen.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the hyperbolic sine of num.
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value.
+	 * @return If no errors occur, the hyperbolic sine of num (sinh(num)) is returned. If num is ±∞ or NaN, it is returned. If the result overflows, ±∞ is
+	 * returned.
+	 * @note Arguments below 1 in magnitude use a Taylor polynomial, larger ones a single table driven e^|num|. long double arguments are evaluated in double
+	 * precision.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T sinh(T num) noexcept
+	{
+		return gen::sinh_gen<T>(num);
+	}
+
+	/**
+	 * @brief Computes the hyperbolic sine of num.
+	 * @tparam Integer The type of the number.
+	 * @param num An integral value.
+	 * @return If no errors occur, the result for num converted to double is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double sinh(Integer num) noexcept
+	{
+		return gen::sinh_gen<double>(static_cast<double>(num));
+	}
 
+	/**
+	 * @brief Computes the hyperbolic sine of num.
+	 * @param num A float value.
+	 * @return If no errors occur, the hyperbolic sine of num (sinh(num)) is returned. If num is ±∞ or NaN, it is returned. If the result overflows, ±∞ is
+	 * returned.
+	 */
+	constexpr float sinhf(float num) noexcept
+	{
+		return ccm::sinh<float>(num);
+	}
+
+	/**
+	 * @brief Computes the hyperbolic sine of num.
+	 * @param num A long double value.
+	 * @return If no errors occur, the hyperbolic sine of num (sinh(num)) is returned. If num is ±∞ or NaN, it is returned. If the result overflows, ±∞ is
+	 * returned.
+	 */
+	constexpr long double sinhl(long double num) noexcept
+	{
+		return ccm::sinh<long double>(num);
+	}
 } // namespace ccm
+
+/// @ingroup hyperbolic
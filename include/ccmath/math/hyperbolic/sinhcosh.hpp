@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/hyperbolic/sinhcosh_gen.hpp"
+
+#include <type_traits>
+
+namespace ccm
+{
+	/**
+	 * @brief Computes the hyperbolic sine and cosine of num from a single exponential.
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value.
+	 * @param sinh_out Pointer to store the hyperbolic sine of num.
+	 * @param cosh_out Pointer to store the hyperbolic cosine of num.
+	 * @note The results are identical to ccm::sinh(num) and ccm::cosh(num).
+	 *
+	 * @attention As with ccm::sincos, the output pointers must point to objects of the enclosing constant evaluation for this to work in a
+	 * constant context.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void sinhcosh(T num, T * sinh_out, T * cosh_out) noexcept
+	{
+		gen::sinhcosh_gen<T>(num, sinh_out, cosh_out);
+	}
+
+	/**
+	 * @brief Computes the hyperbolic sine and cosine of num from a single exponential.
+	 * @param num A float value.
+	 * @param sinh_out Pointer to store the hyperbolic sine of num.
+	 * @param cosh_out Pointer to store the hyperbolic cosine of num.
+	 */
+	constexpr void sinhcoshf(float num, float * sinh_out, float * cosh_out) noexcept
+	{
+		ccm::sinhcosh<float>(num, sinh_out, cosh_out);
+	}
+
+	/**
+	 * @brief Computes the hyperbolic sine and cosine of num from a single exponential.
+	 * @param num A long double value.
+	 * @param sinh_out Pointer to store the hyperbolic sine of num.
+	 * @param cosh_out Pointer to store the hyperbolic cosine of num.
+	 */
+	constexpr void sinhcoshl(long double num, long double * sinh_out, long double * cosh_out) noexcept
+	{
+		ccm::sinhcosh<long double>(num, sinh_out, cosh_out);
+	}
+} // namespace ccm
+
+/// @ingroup hyperbolic
@@ -10,7 +10,59 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/hyperbolic/tanh_gen.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the hyperbolic tangent of num.
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value.
+	 * @return If no errors occur, the hyperbolic tangent of num (tanh(num)) in the range [-1, +1] is returned. If num is ±∞, ±1 is returned. If num is NaN, NaN
+	 * is returned.
+	 * @note long double arguments are evaluated in double precision.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T tanh(T num) noexcept
+	{
+		return gen::tanh_gen<T>(num);
+	}
+
+	/**
+	 * @brief Computes the hyperbolic tangent of num.
+	 * @tparam Integer The type of the number.
+	 * @param num An integral value.
+	 * @return If no errors occur, the result for num converted to double is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double tanh(Integer num) noexcept
+	{
+		return gen::tanh_gen<double>(static_cast<double>(num));
+	}
 
+	/**
+	 * @brief Computes the hyperbolic tangent of num.
+	 * @param num A float value.
+	 * @return If no errors occur, the hyperbolic tangent of num (tanh(num)) in the range [-1, +1] is returned. If num is ±∞, ±1 is returned. If num is NaN, NaN
+	 * is returned.
+	 */
+	constexpr float tanhf(float num) noexcept
+	{
+		return ccm::tanh<float>(num);
+	}
+
+	/**
+	 * @brief Computes the hyperbolic tangent of num.
+	 * @param num A long double value.
+	 * @return If no errors occur, the hyperbolic tangent of num (tanh(num)) in the range [-1, +1] is returned. If num is ±∞, ±1 is returned. If num is NaN, NaN
+	 * is returned.
+	 */
+	constexpr long double tanhl(long double num) noexcept
+	{
+		return ccm::tanh<long double>(num);
+	}
 } // namespace ccm
+
+/// @ingroup hyperbolic
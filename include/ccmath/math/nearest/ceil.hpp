@@ -10,7 +10,58 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/nearest/ceil_gen.hpp"
+#include "ccmath/internal/math/runtime/func/nearest/ceil_rt.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the smallest integer value not less than num.
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value.
+	 * @return If no errors occur, the smallest integer value not less than num, that is ⌈num⌉, is returned. If num is ±∞, ±0 or NaN, num is returned unmodified.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T ceil(T num) noexcept
+	{
+		if (support::is_constant_evaluated()) { return gen::ceil_gen<T>(num); }
+		return rt::ceil_rt<T>(num);
+	}
+
+	/**
+	 * @brief Computes the smallest integer value not less than num.
+	 * @tparam Integer The type of the number.
+	 * @param num An integral value.
+	 * @return num converted to double, as every integer is already integral.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double ceil(Integer num) noexcept
+	{
+		return static_cast<double>(num);
+	}
 
+	/**
+	 * @brief Computes the smallest integer value not less than num.
+	 * @param num A float value.
+	 * @return If no errors occur, the smallest integer value not less than num, that is ⌈num⌉, is returned. If num is ±∞, ±0 or NaN, num is returned unmodified.
+	 */
+	constexpr float ceilf(float num) noexcept
+	{
+		return ccm::ceil<float>(num);
+	}
+
+	/**
+	 * @brief Computes the smallest integer value not less than num.
+	 * @param num A long double value.
+	 * @return If no errors occur, the smallest integer value not less than num, that is ⌈num⌉, is returned. If num is ±∞, ±0 or NaN, num is returned unmodified.
+	 */
+	constexpr long double ceill(long double num) noexcept
+	{
+		return ccm::ceil<long double>(num);
+	}
 } // namespace ccm
+
+/// @ingroup nearest
@@ -10,59 +10,58 @@
 
 #pragma once
 
-#include <ccmath/internal/support/fenv/rounding_mode.hpp>
-#include <ccmath/internal/support/fp/directional_rounding_utils.hpp>
-#include <ccmath/math/compare/isinf.hpp>
-#include <ccmath/math/compare/isnan.hpp>
-#include <ccmath/math/compare/signbit.hpp>
-#include <ccmath/math/nearest/trunc.hpp>
+#include "ccmath/internal/math/generic/func/nearest/nearbyint_gen.hpp"
+#include "ccmath/internal/math/runtime/func/nearest/nearbyint_rt.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
 #include <type_traits>
 
 namespace ccm
 {
 	/**
-	 * @brief The nearest integer value to num, according to the rounding mode FE_TONEAREST, is returned.
+	 * @brief Rounds num to an integer value using the current rounding mode without raising FE_INEXACT.
 	 * @tparam T The type of the number.
 	 * @param num A floating-point value.
-	 * @return If no errors occur, the rounded floating point value. Otherwise, returns the input floating point value unmodified.
+	 * @return If no errors occur, the nearest integer value to num according to the current rounding mode is returned. If num is ±∞, ±0 or NaN, num is returned unmodified.
 	 */
-	template <class T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
 	constexpr T nearbyint(T num) noexcept
 	{
-		constexpr auto rounding_mode{ccm::support::fenv::get_rounding_mode()};
-		return ccm::support::fp::directional_round(num, rounding_mode);
+		if (support::is_constant_evaluated()) { return gen::nearbyint_gen<T>(num); }
+		return rt::nearbyint_rt<T>(num);
 	}
 
 	/**
-	 * @brief The nearest integer value to num, according to the rounding mode FE_TONEAREST, is returned.
+	 * @brief Rounds num to an integer value using the current rounding mode without raising FE_INEXACT.
 	 * @tparam Integer The type of the number.
 	 * @param num An integral value.
-	 * @return If no errors occur, the rounded floating point value. Otherwise, returns the input integer value unmodified.
+	 * @return num converted to double, as every integer is already integral.
 	 */
-	template <class Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
 	constexpr double nearbyint(Integer num) noexcept
 	{
 		return static_cast<double>(num);
 	}
 
 	/**
-	 * @brief The nearest integer value to num, according to the rounding mode FE_TONEAREST, is returned.
+	 * @brief Rounds num to an integer value using the current rounding mode without raising FE_INEXACT.
 	 * @param num A float value.
-	 * @return If no errors occur, the rounded floating point value. Otherwise, returns the input integer value unmodified.
+	 * @return If no errors occur, the nearest integer value to num according to the current rounding mode is returned. If num is ±∞, ±0 or NaN, num is returned unmodified.
 	 */
 	constexpr float nearbyintf(float num) noexcept
 	{
-		return ccm::nearbyint(num);
+		return ccm::nearbyint<float>(num);
 	}
 
 	/**
-	 * @brief The nearest integer value to num, according to the rounding mode FE_TONEAREST, is returned.
+	 * @brief Rounds num to an integer value using the current rounding mode without raising FE_INEXACT.
 	 * @param num A long double value.
-	 * @return If no errors occur, the rounded floating point value. Otherwise, returns the input integer value unmodified.
+	 * @return If no errors occur, the nearest integer value to num according to the current rounding mode is returned. If num is ±∞, ±0 or NaN, num is returned unmodified.
 	 */
 	constexpr long double nearbyintl(long double num) noexcept
 	{
-		return ccm::nearbyint(num);
+		return ccm::nearbyint<long double>(num);
 	}
-
 } // namespace ccm
+
+/// @ingroup nearest
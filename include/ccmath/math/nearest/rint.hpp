@@ -10,7 +10,58 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/nearest/rint_gen.hpp"
+#include "ccmath/internal/math/runtime/func/nearest/rint_rt.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Rounds num to an integer value using the current rounding mode.
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value.
+	 * @return If no errors occur, the nearest integer value to num according to the current rounding mode is returned. If num is ±∞, ±0 or NaN, num is returned unmodified.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T rint(T num) noexcept
+	{
+		if (support::is_constant_evaluated()) { return gen::rint_gen<T>(num); }
+		return rt::rint_rt<T>(num);
+	}
+
+	/**
+	 * @brief Rounds num to an integer value using the current rounding mode.
+	 * @tparam Integer The type of the number.
+	 * @param num An integral value.
+	 * @return num converted to double, as every integer is already integral.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double rint(Integer num) noexcept
+	{
+		return static_cast<double>(num);
+	}
 
+	/**
+	 * @brief Rounds num to an integer value using the current rounding mode.
+	 * @param num A float value.
+	 * @return If no errors occur, the nearest integer value to num according to the current rounding mode is returned. If num is ±∞, ±0 or NaN, num is returned unmodified.
+	 */
+	constexpr float rintf(float num) noexcept
+	{
+		return ccm::rint<float>(num);
+	}
+
+	/**
+	 * @brief Rounds num to an integer value using the current rounding mode.
+	 * @param num A long double value.
+	 * @return If no errors occur, the nearest integer value to num according to the current rounding mode is returned. If num is ±∞, ±0 or NaN, num is returned unmodified.
+	 */
+	constexpr long double rintl(long double num) noexcept
+	{
+		return ccm::rint<long double>(num);
+	}
 } // namespace ccm
+
+/// @ingroup nearest
@@ -10,7 +10,58 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/nearest/round_gen.hpp"
+#include "ccmath/internal/math/runtime/func/nearest/round_rt.hpp"
+#include "ccmath/internal/support/is_constant_evaluated.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the nearest integer value to num, rounding halfway cases away from zero regardless of the current rounding mode.
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value.
+	 * @return If no errors occur, the nearest integer value to num is returned. If num is ±∞, ±0 or NaN, num is returned unmodified.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T round(T num) noexcept
+	{
+		if (support::is_constant_evaluated()) { return gen::round_gen<T>(num); }
+		return rt::round_rt<T>(num);
+	}
+
+	/**
+	 * @brief Computes the nearest integer value to num, rounding halfway cases away from zero regardless of the current rounding mode.
+	 * @tparam Integer The type of the number.
+	 * @param num An integral value.
+	 * @return num converted to double, as every integer is already integral.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double round(Integer num) noexcept
+	{
+		return static_cast<double>(num);
+	}
 
+	/**
+	 * @brief Computes the nearest integer value to num, rounding halfway cases away from zero regardless of the current rounding mode.
+	 * @param num A float value.
+	 * @return If no errors occur, the nearest integer value to num is returned. If num is ±∞, ±0 or NaN, num is returned unmodified.
+	 */
+	constexpr float roundf(float num) noexcept
+	{
+		return ccm::round<float>(num);
+	}
+
+	/**
+	 * @brief Computes the nearest integer value to num, rounding halfway cases away from zero regardless of the current rounding mode.
+	 * @param num A long double value.
+	 * @return If no errors occur, the nearest integer value to num is returned. If num is ±∞, ±0 or NaN, num is returned unmodified.
+	 */
+	constexpr long double roundl(long double num) noexcept
+	{
+		return ccm::round<long double>(num);
+	}
 } // namespace ccm
+
+/// @ingroup nearest
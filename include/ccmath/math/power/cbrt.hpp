@@ -10,7 +10,56 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/power/cbrt_gen.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the cube root of num.
+	 * @tparam T The type of the argument.
+	 * @param num A floating-point value.
+	 * @return If no errors occur, the cube root of num is returned. If num is ±0 or ±∞, it is returned unmodified. If num is NaN, NaN is returned.
+	 * @note Float and double results are correctly rounded. Long double arguments are evaluated in double precision.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T cbrt(T num) noexcept
+	{
+		return gen::cbrt_gen<T>(num);
+	}
+
+	/**
+	 * @brief Computes the cube root of num.
+	 * @tparam Integer The type of the argument.
+	 * @param num An integral value.
+	 * @return If no errors occur, the cube root of num converted to double is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double cbrt(Integer num) noexcept
+	{
+		return gen::cbrt_gen<double>(static_cast<double>(num));
+	}
 
+	/**
+	 * @brief Computes the cube root of num.
+	 * @param num A float value.
+	 * @return If no errors occur, the cube root of num is returned.
+	 */
+	constexpr float cbrtf(float num) noexcept
+	{
+		return ccm::cbrt<float>(num);
+	}
+
+	/**
+	 * @brief Computes the cube root of num.
+	 * @param num A long double value.
+	 * @return If no errors occur, the cube root of num is returned.
+	 */
+	constexpr long double cbrtl(long double num) noexcept
+	{
+		return ccm::cbrt<long double>(num);
+	}
 } // namespace ccm
+
+/// @ingroup power
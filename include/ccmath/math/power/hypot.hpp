@@ -10,7 +10,127 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/power/hypot_gen.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the square root of the sum of the squares of x and y, without undue overflow or underflow at intermediate stages of the computation.
+	 * @tparam T The type of the arguments.
+	 * @param x A floating-point value.
+	 * @param y A floating-point value.
+	 * @return If no errors occur, the hypotenuse of a right-angled triangle, sqrt(x^2 + y^2), is returned. If either argument is ±∞, +∞ is returned,
+	 * even if the other argument is NaN. Otherwise, if either argument is NaN, NaN is returned.
+	 * @note The exact squares are summed with fused multiply-adds where the target has them, and the arguments are only rescaled when the larger one
+	 * is outside [2^-500, 2^501). Double results are within 0.51 ulp. Long double arguments are evaluated in double precision.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T hypot(T x, T y) noexcept
+	{
+		return gen::hypot_gen<T>(x, y);
+	}
+
+	/**
+	 * @brief Computes the square root of the sum of the squares of x and y, without undue overflow or underflow at intermediate stages of the computation.
+	 * @tparam T The type of the first argument.
+	 * @tparam U The type of the second argument.
+	 * @param x A floating-point value.
+	 * @param y A floating-point value.
+	 * @return If no errors occur, the hypotenuse of a right-angled triangle, sqrt(x^2 + y^2), is returned.
+	 */
+	template <typename T, typename U, std::enable_if_t<std::is_floating_point_v<T> && std::is_floating_point_v<U>, bool> = true>
+	constexpr auto hypot(T x, U y) noexcept
+	{
+		using shared_type = std::common_type_t<T, U>;
+		return ccm::hypot<shared_type>(static_cast<shared_type>(x), static_cast<shared_type>(y));
+	}
+
+	/**
+	 * @brief Computes the square root of the sum of the squares of x and y, without undue overflow or underflow at intermediate stages of the computation.
+	 * @tparam Integer The type of the arguments.
+	 * @param x An integral value.
+	 * @param y An integral value.
+	 * @return If no errors occur, the hypotenuse of a right-angled triangle, sqrt(x^2 + y^2), converted to double is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double hypot(Integer x, Integer y) noexcept
+	{
+		return gen::hypot_gen<double>(static_cast<double>(x), static_cast<double>(y));
+	}
+
+	/**
+	 * @brief Computes the square root of the sum of the squares of x, y and z, without undue overflow or underflow at intermediate stages of the
+	 * computation.
+	 * @tparam T The type of the arguments.
+	 * @param x A floating-point value.
+	 * @param y A floating-point value.
+	 * @param z A floating-point value.
+	 * @return If no errors occur, the distance from the origin in 3D space, sqrt(x^2 + y^2 + z^2), is returned. If any argument is ±∞, +∞ is
+	 * returned, even if another argument is NaN. Otherwise, if any argument is NaN, NaN is returned.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T hypot(T x, T y, T z) noexcept
+	{
+		return gen::hypot_gen<T>(x, y, z);
+	}
 
+	/**
+	 * @brief Computes the square root of the sum of the squares of x, y and z, without undue overflow or underflow at intermediate stages of the
+	 * computation.
+	 * @tparam T The type of the first argument.
+	 * @tparam U The type of the second argument.
+	 * @tparam V The type of the third argument.
+	 * @param x A floating-point value.
+	 * @param y A floating-point value.
+	 * @param z A floating-point value.
+	 * @return If no errors occur, the distance from the origin in 3D space, sqrt(x^2 + y^2 + z^2), is returned.
+	 */
+	template <typename T, typename U, typename V,
+			  std::enable_if_t<std::is_floating_point_v<T> && std::is_floating_point_v<U> && std::is_floating_point_v<V>, bool> = true>
+	constexpr auto hypot(T x, U y, V z) noexcept
+	{
+		using shared_type = std::common_type_t<T, U, V>;
+		return ccm::hypot<shared_type>(static_cast<shared_type>(x), static_cast<shared_type>(y), static_cast<shared_type>(z));
+	}
+
+	/**
+	 * @brief Computes the square root of the sum of the squares of x, y and z, without undue overflow or underflow at intermediate stages of the
+	 * computation.
+	 * @tparam Integer The type of the arguments.
+	 * @param x An integral value.
+	 * @param y An integral value.
+	 * @param z An integral value.
+	 * @return If no errors occur, the distance from the origin in 3D space, sqrt(x^2 + y^2 + z^2), converted to double is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double hypot(Integer x, Integer y, Integer z) noexcept
+	{
+		return gen::hypot_gen<double>(static_cast<double>(x), static_cast<double>(y), static_cast<double>(z));
+	}
+
+	/**
+	 * @brief Computes the square root of the sum of the squares of x and y, without undue overflow or underflow at intermediate stages of the computation.
+	 * @param x A float value.
+	 * @param y A float value.
+	 * @return If no errors occur, the hypotenuse of a right-angled triangle, sqrt(x^2 + y^2), is returned.
+	 */
+	constexpr float hypotf(float x, float y) noexcept
+	{
+		return ccm::hypot<float>(x, y);
+	}
+
+	/**
+	 * @brief Computes the square root of the sum of the squares of x and y, without undue overflow or underflow at intermediate stages of the computation.
+	 * @param x A long double value.
+	 * @param y A long double value.
+	 * @return If no errors occur, the hypotenuse of a right-angled triangle, sqrt(x^2 + y^2), is returned.
+	 */
+	constexpr long double hypotl(long double x, long double y) noexcept
+	{
+		return ccm::hypot<long double>(x, y);
+	}
 } // namespace ccm
+
+/// @ingroup power
@@ -13,30 +13,271 @@
 // turn on fenv access
 // #pragma STDC FENV_ACCESS ON
 
+#include "ccmath/internal/math/generic/func/basic/fma_gen.hpp"
+#include "ccmath/internal/predef/likely.hpp"
+#include "ccmath/internal/predef/unlikely.hpp"
+#include "ccmath/internal/support/bits.hpp"
 #include "ccmath/internal/support/floating_point_traits.hpp"
 #include "ccmath/internal/support/fp/bit_mask_traits.hpp"
 #include "ccmath/internal/support/fp/directional_rounding_utils.hpp"
 #include "ccmath/internal/support/fp/fp_bits.hpp"
 #include "ccmath/internal/support/unreachable.hpp"
 #include "ccmath/internal/types/big_int.hpp"
+#include "ccmath/internal/types/double_double.hpp"
+#include "ccmath/internal/types/dyadic_float.hpp"
 #include "ccmath/math/basic/abs.hpp"
 #include "ccmath/math/compare/isnan.hpp"
+#include "ccmath/math/exponential/impl/exp_data.hpp"
+#include "ccmath/math/exponential/impl/log_data.hpp"
 #include "ccmath/math/power/sqrt.hpp"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 
 namespace ccm::internal::impl
 {
-	template <typename T>
-	constexpr T pow_exp_helper(T base, T exp) noexcept
+	using pow_float128 = types::DyadicFloat<128>;
+
+	/// Coefficients of r^2 to r^10 of log1p(r) - r. Degree 10 leaves an error below 2^-80 for |r| <= 2^-7.
+	inline constexpr std::array<double, 9> pow_log_poly_dbl = table_gen::make_log_poly<9>({1.0, 0.0});
+
+	/// 1/3, the coefficient of r^3 in log1p(r), as a double-double.
+	constexpr type::DoubleDouble pow_third_dd = table_gen::dd_div({1.0, 0.0}, {3.0, 0.0});
+
+	/// Coefficients of r^2 to r^6 of e^r - 1 - r. Degree 6 leaves an error below 2^-71 for |r| <= ln2 / 256.
+	inline constexpr std::array<double, 5> pow_exp_poly_dbl = table_gen::make_exp_poly<5>();
+
+	/// Relative error bound of the fast exp (2^-68.7 measured): the polynomial and the roundings that follow it.
+	constexpr double pow_fast_error_dbl = 0x1.8p-68;
+
+	/// Relative error bound of the fast log (2^-73 measured). It is an absolute error of y log(x), so it scales with the exponent.
+	constexpr double pow_fast_log_error_dbl = 0x1p-72;
+
+	/// Terms of the log1p series in the accurate pass: |r|^18 / 18 < 2^-125 |r| for |r| <= 2^-7.
+	constexpr std::size_t pow_log1p_terms_128 = 18;
+
+	/// Terms of the exp series in the accurate pass: |r|^13 / 13! < 2^-127 for |r| <= ln2 / 256.
+	constexpr std::size_t pow_exp_terms_128 = 13;
+
+	/// ln(2) to 128 bits.
+	constexpr pow_float128 pow_ln2_128 = {types::Sign::POS, -128, types::UInt<128>({0xC9E3B39803F2F6AF, 0xB17217F7D1CF79AB})};
+
+	constexpr pow_float128 pow_negate_128(pow_float128 x) noexcept
 	{
-		return 0;
+		x.sign = x.sign.is_neg() ? types::Sign::POS : types::Sign::NEG;
+		return x;
 	}
 
-	template <typename T>
-	constexpr T pow_log_helper(T base, T exp) noexcept
+	/// 1/d to 128 bits: the double quotient refined by two Newton steps q += q * (1 - d * q).
+	constexpr pow_float128 pow_reciprocal_128(double d) noexcept
+	{
+		const pow_float128 one(1.0);
+		const pow_float128 divisor(d);
+		pow_float128 quotient(1.0 / d);
+		for (int step = 0; step < 2; ++step)
+		{
+			const pow_float128 residual = types::quick_add(one, pow_negate_128(types::quick_mul(divisor, quotient)));
+			quotient					= types::multiply_add(quotient, residual, quotient);
+		}
+		return quotient;
+	}
+
+	/// (-1)^i / (i + 1), the coefficients of log1p(r) / r.
+	constexpr std::array<pow_float128, pow_log1p_terms_128> make_pow_log1p_coeffs_128() noexcept
+	{
+		std::array<pow_float128, pow_log1p_terms_128> coeffs{};
+		for (std::size_t i = 0; i < coeffs.size(); ++i)
+		{
+			coeffs[i] = pow_reciprocal_128(static_cast<double>(i + 1));
+			if (i % 2 == 1) { coeffs[i] = pow_negate_128(coeffs[i]); }
+		}
+		return coeffs;
+	}
+
+	/// 1 / i!, the coefficients of e^r. Every factorial up to 12! is exact in double.
+	constexpr std::array<pow_float128, pow_exp_terms_128> make_pow_exp_coeffs_128() noexcept
+	{
+		std::array<pow_float128, pow_exp_terms_128> coeffs{};
+		double factorial = 1.0;
+		for (std::size_t i = 0; i < coeffs.size(); ++i)
+		{
+			if (i > 1) { factorial *= static_cast<double>(i); }
+			coeffs[i] = pow_reciprocal_128(factorial);
+		}
+		return coeffs;
+	}
+
+	inline constexpr std::array<pow_float128, pow_log1p_terms_128> pow_log1p_coeffs_128 = make_pow_log1p_coeffs_128();
+	inline constexpr std::array<pow_float128, pow_exp_terms_128> pow_exp_coeffs_128	 = make_pow_exp_coeffs_128();
+
+	/// x = 2^k z with z in the range of the double log table, and the index of the subinterval holding z.
+	struct pow_log_reduction
+	{
+		double z;
+		double k;
+		std::size_t index;
+	};
+
+	constexpr pow_log_reduction pow_reduce_log_argument(double x) noexcept
+	{
+		std::uint64_t int_x = support::double_to_uint64(x);
+
+		// x is subnormal, normalize it.
+		if (CCM_UNLIKELY(int_x < 0x0010000000000000ULL)) { int_x = support::double_to_uint64(x * 0x1p52) - (52ULL << 52); }
+
+		const std::uint64_t tmp = int_x - k_logTableOffDbl;
+		// NOLINTBEGIN
+		return {support::uint64_to_double(int_x - (tmp & 0xfffULL << 52)), static_cast<double>(static_cast<std::int64_t>(tmp) >> 52),
+				static_cast<std::size_t>((tmp >> (52 - k_logTableBitsDbl)) % log_double_generated_data<k_logTableBitsDbl>::table_size)};
+		// NOLINTEND
+	}
+
+	/**
+	 * @brief log(x) as a double-double with a relative error below 2^-72, for positive finite x.
+	 *
+	 * Uses the generated log table: log(x) = k ln2 + log(c) + log1p(r) with r = z/c - 1. r is exact as the double-double
+	 * z * invc - 1, and log(c) is carried to double-double precision with logctail. The table entries next to 1 have
+	 * c = 1, so near 1 the result is log1p(x - 1) and keeps its relative precision however small log(x) gets.
+	 */
+	constexpr type::DoubleDouble pow_log_helper(double x) noexcept
 	{
-		return 0;
+		using data = log_double_generated_data<k_logTableBitsDbl>;
+
+		const pow_log_reduction reduced	   = pow_reduce_log_argument(x);
+		const log_double_tab_entry & entry = data::tab[reduced.index];
+
+		// z * invc is within 2^-7 of 1, so subtracting 1 from its high part is exact.
+		const type::DoubleDouble product = type::exact_mult(reduced.z, entry.invc);
+		const type::DoubleDouble rem	 = type::exact_add(product.hi - 1.0, product.lo);
+
+		// k * ln2hi + logc is exact, and either zero or larger than r in magnitude, so the fast two-sum applies.
+		const type::DoubleDouble sum = type::exact_add(reduced.k * data::ln2hi + entry.logc, rem.hi);
+
+		// log1p(r) = r - r^2/2 + r^3/3 + r^4 p(r). The first three terms are added in double-double, so what is left to
+		// round is at most 2^-30 and the relative error stays below 2^-72 even where r reaches 2^-7.
+		const type::DoubleDouble rem_sqr = type::exact_mult(rem.hi, rem.hi);
+		const type::DoubleDouble cube	 = type::exact_mult(rem.hi, rem_sqr.hi);
+		const type::DoubleDouble third	 = type::exact_mult(cube.hi, pow_third_dd.hi);
+		const double third_lo			 = third.lo + cube.hi * pow_third_dd.lo + (cube.lo + rem.hi * rem_sqr.lo) * pow_third_dd.hi;
+		const type::DoubleDouble square	 = type::exact_add(sum.hi, -0.5 * rem_sqr.hi);
+		const type::DoubleDouble high	 = type::exact_add(square.hi, third.hi);
+
+		const double rem_quad  = rem_sqr.hi * rem_sqr.hi;
+		const auto & poly	   = pow_log_poly_dbl;
+		const double tail_poly = rem_quad * (poly[2] + rem.hi * poly[3] + rem_sqr.hi * (poly[4] + rem.hi * poly[5]) +
+											 rem_quad * (poly[6] + rem.hi * poly[7] + rem_sqr.hi * poly[8]));
+
+		// The rest of k ln2 and log(c), the rounding errors of the sums, and r.lo / (1 + r.hi) to second order.
+		const double low = reduced.k * data::ln2lo + static_cast<double>(entry.logclo) + data::logctail[reduced.index] + sum.lo + square.lo + high.lo +
+						   third_lo + (rem.lo * (1.0 - rem.hi + rem_sqr.hi) - 0.5 * rem_sqr.lo) + tail_poly;
+		return type::exact_add(high.hi, low);
+	}
+
+	/**
+	 * @brief e^x as a double-double with a relative error below 2^-68, for x = hi + lo with |hi| <= 690.
+	 *
+	 * Uses the exp table: e^x = 2^(k/N) e^r with |r| <= ln2 / 2N and 2^(k/N) = scale (1 + tail). Removing k ln2hi / N
+	 * from hi is exact and lo joins r, so the result keeps the precision of the exponent it is given.
+	 */
+	constexpr type::DoubleDouble pow_exp_helper(const type::DoubleDouble & x) noexcept
+	{
+		using data = exp_data<double>;
+
+		const double shifted	   = x.hi * data::invln2N + data::shift;
+		const std::uint64_t k_bits = support::double_to_uint64(shifted);
+		const double k			   = shifted - data::shift;
+
+		const type::NumberPair<double> rem = gen::internal::fma_two_sum(x.hi + k * data::negln2hiN, x.lo + k * data::negln2loN);
+
+		const std::uint64_t index = 2 * (k_bits % data::table_size);
+		const double tail		  = support::uint64_to_double(data::tab[index]);
+		const double scale		  = support::uint64_to_double(data::tab[index + 1] + (k_bits << (52 - data::table_bits)));
+
+		// 2^(k/N) e^r = scale (1 + r.hi + small), where small gathers e^r - 1 - r.hi and the table tail.
+		const double rem_sqr	 = rem.hi * rem.hi;
+		const auto & poly		 = pow_exp_poly_dbl;
+		const double exp_poly	 = rem_sqr * (poly[0] + rem.hi * poly[1] + rem_sqr * (poly[2] + rem.hi * poly[3] + rem_sqr * poly[4]));
+		const double small		 = exp_poly + rem.lo * (1.0 + rem.hi) + tail + tail * rem.hi;
+		const type::DoubleDouble one_plus = type::exact_add(1.0, rem.hi);
+		const type::DoubleDouble result	  = type::exact_mult(scale, one_plus.hi);
+		return {result.hi, result.lo + scale * (one_plus.lo + small)};
+	}
+
+	/// log(x) in 128-bit arithmetic on the reduction of pow_log_helper. log(c) limits it to about 2^-104.
+	constexpr pow_float128 pow_log_accurate(double x) noexcept
+	{
+		using data = log_double_generated_data<k_logTableBitsDbl>;
+
+		const pow_log_reduction reduced	   = pow_reduce_log_argument(x);
+		const log_double_tab_entry & entry = data::tab[reduced.index];
+
+		// z * invc is exact in 128 bits, and so is r.
+		const pow_float128 rem = types::quick_add(types::quick_mul(pow_float128(reduced.z), pow_float128(entry.invc)), pow_float128(-1.0));
+
+		pow_float128 series = pow_log1p_coeffs_128.back();
+		for (std::size_t i = pow_log1p_coeffs_128.size() - 1; i-- > 0;) { series = types::multiply_add(series, rem, pow_log1p_coeffs_128[i]); }
+
+		const pow_float128 log_c =
+			types::quick_add(types::quick_add(pow_float128(entry.logc), pow_float128(static_cast<double>(entry.logclo))), pow_float128(data::logctail[reduced.index]));
+		return types::quick_add(types::quick_add(types::quick_mul(pow_float128(reduced.k), pow_ln2_128), log_c), types::quick_mul(series, rem));
+	}
+
+	/// e^x in 128-bit arithmetic, rounded once to double. hi is x rounded to double and picks the table entry.
+	constexpr double pow_exp_accurate(const pow_float128 & x, double hi) noexcept
+	{
+		using data = exp_data<double>;
+
+		const double k			= (hi * data::invln2N + data::shift) - data::shift;
+		const auto k_int		= static_cast<std::int64_t>(k);
+		const std::size_t index = static_cast<std::size_t>(k_int) % data::table_size;
+
+		// r = x - k ln2 / N.
+		const pow_float128 k_ln2 = types::mul_pow_2(types::quick_mul(pow_float128(k), pow_ln2_128), -static_cast<std::int32_t>(data::table_bits));
+		const pow_float128 rem	 = types::quick_add(x, pow_negate_128(k_ln2));
+
+		pow_float128 series = pow_exp_coeffs_128.back();
+		for (std::size_t i = pow_exp_coeffs_128.size() - 1; i-- > 0;) { series = types::multiply_add(series, rem, pow_exp_coeffs_128[i]); }
+
+		// 2^(index/N) = scale (1 + tail) with scale in [1, 2), and 2^(k/N) is that times 2^((k - index)/N).
+		const double scale		 = support::uint64_to_double(data::tab[2 * index + 1] + (static_cast<std::uint64_t>(index) << (52 - data::table_bits)));
+		const double tail		 = support::uint64_to_double(data::tab[2 * index]);
+		const pow_float128 power = types::quick_mul(pow_float128(scale), types::quick_add(pow_float128(1.0), pow_float128(tail)));
+		const auto exponent		 = static_cast<std::int32_t>((k_int - static_cast<std::int64_t>(index)) / static_cast<std::int64_t>(data::table_size));
+		return static_cast<double>(types::mul_pow_2(types::quick_mul(power, series), exponent));
+	}
+
+	/**
+	 * @brief x^y for positive finite x and finite y.
+	 *
+	 * The fast pass computes y log(x) and its exponential in double-double. When its error bound leaves the rounding
+	 * undecided, which happens for about one input in five thousand, or the result is near the overflow or subnormal range,
+	 * the accurate pass redoes the computation in 128-bit arithmetic. The result is then correctly rounded unless it lies
+	 * within about 2^-100 (relative) of a midpoint between two doubles.
+	 */
+	constexpr double pow_double_core(double x, double y) noexcept
+	{
+		const type::DoubleDouble log_x	 = pow_log_helper(x);
+		const type::DoubleDouble product = type::exact_mult(y, log_x.hi);
+		const type::DoubleDouble expo	 = {product.hi, y * log_x.lo + product.lo};
+
+		// Beyond 690 the fast exp could overflow in Dekker's split or lose its low part to the subnormal range.
+		const double abs_expo = expo.hi < 0.0 ? -expo.hi : expo.hi;
+		if (CCM_UNLIKELY(abs_expo < 0x1p-60)) { return 1.0 + expo.hi; }
+		if (CCM_UNLIKELY(abs_expo > 690.0))
+		{
+			// ln(DBL_MAX) ~= 709.78 and ln(2^-1075) ~= -745.13.
+			if (expo.hi > 709.8) { return 0x1p769 * 0x1p769; }
+			if (expo.hi < -745.2) { return 0x1p-767 * 0x1p-767; }
+			return pow_exp_accurate(types::quick_mul(pow_float128(y), pow_log_accurate(x)), expo.hi);
+		}
+
+		const type::DoubleDouble result = pow_exp_helper(expo);
+		const double error				= result.hi * (pow_fast_error_dbl + abs_expo * pow_fast_log_error_dbl);
+		const double upper				= result.hi + (result.lo + error);
+		if (CCM_LIKELY(upper == result.hi + (result.lo - error))) { return upper; }
+		return pow_exp_accurate(types::quick_mul(pow_float128(y), pow_log_accurate(x)), expo.hi);
 	}
 
 	template <typename T>
@@ -235,9 +476,9 @@ namespace ccm::internal::impl
 			// y is a positive even integer or a positive non-integer
 			if (y > 0.0) { return 0.0; }
 
-			// y is a negative, even, and finite integer or non-integer
+			// y is a negative, even, and finite integer or non-integer: pow(-0, y) = +inf
 			ccm::support::fenv::raise_except_if_required(FE_DIVBYZERO);
-			return -std::numeric_limits<T>::infinity();
+			return std::numeric_limits<T>::infinity();
 		}
 
 		if (!is_y_an_integer)
@@ -261,34 +502,37 @@ namespace ccm::internal::impl
 		return std::numeric_limits<T>::min();
 	}
 
-	// make sure TStorage is of the type support::fp::FPBits<T>::storage_type
-	template <typename T, typename TStorage, std::enable_if_t<std::is_same_v<TStorage, typename support::fp::FPBits<T>::storage_type>, bool> = true>
-	constexpr std::enable_if_t<std::is_floating_point_v<T>, T> pow_check_over_under_flow(support::fp::FPBits<T> & x_bits, support::fp::FPBits<T> & y_bits,
-																						 TStorage & x_abs, TStorage & y_abs) noexcept
+	/**
+	 * @brief x^y for float and double. Both run the double core, float rounding its result a second time, which can
+	 * only differ from the correctly rounded float when the double lies within 2^-29 ulp of a float midpoint.
+	 */
+	template <typename T, std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>, bool> = true>
+	constexpr T pow_impl(T x, T y) noexcept
 	{
+		// Positive finite bases with finite exponents are the common case and need none of the checks below. NaN fails every comparison.
+		if (CCM_LIKELY(x > 0 && x < std::numeric_limits<T>::infinity() && y > -std::numeric_limits<T>::infinity() && y < std::numeric_limits<T>::infinity()))
+		{
+			return static_cast<T>(pow_double_core(static_cast<double>(x), static_cast<double>(y)));
+		}
 
-		return 0;
-	}
-
-	template <typename T>
-	constexpr std::enable_if_t<std::is_floating_point_v<T>, T> pow_impl(T x, T y) noexcept
-	{
 		support::fp::FPBits<T> x_bits(x);
 		support::fp::FPBits<T> y_bits(y);
-		double sign_of_result = 1.0;
+		T sign_of_result = 1.0;
 
 		// Handle edge cases when x or y is a non-finite value
 		if (CCM_UNLIKELY(!x_bits.is_finite() || !y_bits.is_finite())) { return pow_impl_handle_special_cases<T>(x_bits, y_bits, x, y); }
 
+		if (y == 0.0) { return 1.0; }
+
 		// Handle edge cases when x is zero or lees than zero
 		if (x <= 0.0)
 		{
 			const auto handling_zero_or_less_result = pow_impl_handle_zero_or_less<T>(x_bits, x, y, sign_of_result);
 			if (handling_zero_or_less_result != std::numeric_limits<T>::min()) { return handling_zero_or_less_result; }
 		}
-		// Begin the actual calculation
 
-		return 0;
+		// Begin the actual calculation
+		return sign_of_result * static_cast<T>(pow_double_core(static_cast<double>(x), static_cast<double>(y)));
 	}
 
 } // namespace ccm::internal::impl
@@ -10,10 +10,14 @@
 
 #pragma once
 
+#include <limits>
 #include <type_traits>
 
+#include "ccmath/internal/math/generic/func/power/pow_int_gen.hpp"
+#include "ccmath/internal/math/generic/func/power/rsqrt_gen.hpp"
 #include "ccmath/math/exponential/exp2.hpp"
 #include "ccmath/math/exponential/log2.hpp"
+#include "ccmath/math/power/sqrt.hpp"
 
 #include "ccmath/math/power/impl/pow_impl.hpp"
 
@@ -57,13 +61,91 @@ namespace ccm
 			// For now this is more of a hold over till I have time to implement a better generic version.
 			return ccm::exp2(exp * ccm::log2(base));
 		}
+
+		/// Integer exponents up to this magnitude take binary exponentiation, whose 16 squarings still beat log and exp.
+		constexpr int pow_int_fast_path_limit = 1 << 16;
+
+		/// is_integer reads the bits of an IEEE binary format, which the x87 extended long double with its explicit integer bit is not.
+		template <typename T>
+		constexpr bool pow_is_integer(T exp) noexcept
+		{
+			if constexpr (std::is_same_v<T, long double> && std::numeric_limits<long double>::digits != std::numeric_limits<double>::digits)
+			{
+				return static_cast<T>(static_cast<int>(exp)) == exp;
+			}
+			else { return is_integer(exp); }
+		}
+
+		/// x^(1/2) and x^(-1/2) from the square root. pow(±0, 1/2) is +0 and pow(-inf, 1/2) is +inf, where sqrt gives -0 and NaN.
+		template <typename T>
+		constexpr T pow_half(T base, T exp) noexcept
+		{
+			if (base == 0) { return exp > 0 ? static_cast<T>(0) : std::numeric_limits<T>::infinity(); }
+			if (base == -std::numeric_limits<T>::infinity()) { return exp > 0 ? std::numeric_limits<T>::infinity() : static_cast<T>(0); }
+			if (exp > 0) { return ccm::sqrt(base); }
+			// Float divides in double, which rounds correctly (see gen::rsqrt_gen). Wider types divide in place and stay within one ulp.
+			if constexpr (std::is_same_v<T, float>) { return gen::rsqrt_gen(base); }
+			else { return 1 / ccm::sqrt(base); }
+		}
 	} // namespace internal::impl
 
+	/**
+	 * @brief Computes x raised to a power known at compile time.
+	 *
+	 * Unrolls into the multiplications of an addition chain, so x^3 is two multiplies and x^15 five. Float is raised in
+	 * double and double in double-double, which keeps the result correctly rounded except for rare inputs.
+	 * @tparam N Integer exponent.
+	 * @tparam T Floating-point type.
+	 * @param x Base.
+	 * @return x raised to the power N, with the special values of ccm::pow(x, N).
+	 */
+	template <int N, typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T pow(T x) noexcept
+	{
+		return gen::pow_n_gen<N>(x);
+	}
+
+	/**
+	 * @brief Computes x raised to a power known at compile time.
+	 * @tparam N Integer exponent.
+	 * @tparam Integer Integer type.
+	 * @param x Base, converted to double.
+	 * @return x raised to the power N as a double.
+	 */
+	template <int N, typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double pow(Integer x) noexcept
+	{
+		return gen::pow_n_gen<N>(static_cast<double>(x));
+	}
+
+	/**
+	 * @brief Computes base raised to the power exp.
+	 *
+	 * Integer exponents up to 2^16 in magnitude use binary exponentiation in double-double (double for float), and
+	 * exponents of 1/2 and -1/2 the square root. Every other exponent computes e^(exp * log(base)) with a double-double
+	 * log and exp and a 128-bit fallback for the rare inputs where that is not enough to round correctly. Float runs
+	 * the same double core. Long double still goes through exp2(exp * log2(base)).
+	 * @tparam T Floating-point or unsigned integer type.
+	 * @param base Base.
+	 * @param exp Exponent.
+	 * @return base raised to the power exp.
+	 */
 	template <typename T>
 	constexpr T pow(T base, T exp) noexcept
 	{
 		if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T>) { return internal::impl::pow_expo_by_sqr(base, exp); }
-		return internal::impl::pow_generic(base, exp);
+		else if constexpr (std::is_floating_point_v<T>)
+		{
+			if (exp == 0) { return 1; }
+			if (exp >= -internal::impl::pow_int_fast_path_limit && exp <= internal::impl::pow_int_fast_path_limit && internal::impl::pow_is_integer(exp))
+			{
+				return gen::pow_int_gen(base, static_cast<int>(exp));
+			}
+			if (exp == static_cast<T>(0.5) || exp == static_cast<T>(-0.5)) { return internal::impl::pow_half(base, exp); }
+			if constexpr (std::is_same_v<T, long double>) { return internal::impl::pow_generic(base, exp); }
+			else { return internal::impl::pow_impl(base, exp); }
+		}
+		else { return internal::impl::pow_generic(base, exp); }
 	}
 
 } // namespace ccm
@@ -10,7 +10,60 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/trig/acos_gen.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the principal value of the arc cosine of num.
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value.
+	 * @return If no errors occur, the arc cosine of num (arccos(num)) in the range [0, π] radians is returned. If num is outside [-1, +1] or NaN, NaN is
+	 * returned.
+	 * @note Arguments above 1/2 in magnitude are reduced with acos(x) = 2 asin(sqrt((1 - x) / 2)). Float and long double arguments are evaluated in double
+	 * precision.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T acos(T num) noexcept
+	{
+		return gen::acos_gen<T>(num);
+	}
+
+	/**
+	 * @brief Computes the principal value of the arc cosine of num.
+	 * @tparam Integer The type of the number.
+	 * @param num An integral value.
+	 * @return If no errors occur, the arc cosine of num converted to double is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double acos(Integer num) noexcept
+	{
+		return gen::acos_gen<double>(static_cast<double>(num));
+	}
 
+	/**
+	 * @brief Computes the principal value of the arc cosine of num.
+	 * @param num A float value.
+	 * @return If no errors occur, the arc cosine of num (arccos(num)) in the range [0, π] radians is returned. If num is outside [-1, +1] or NaN, NaN is
+	 * returned.
+	 */
+	constexpr float acosf(float num) noexcept
+	{
+		return ccm::acos<float>(num);
+	}
+
+	/**
+	 * @brief Computes the principal value of the arc cosine of num.
+	 * @param num A long double value.
+	 * @return If no errors occur, the arc cosine of num (arccos(num)) in the range [0, π] radians is returned. If num is outside [-1, +1] or NaN, NaN is
+	 * returned.
+	 */
+	constexpr long double acosl(long double num) noexcept
+	{
+		return ccm::acos<long double>(num);
+	}
 } // namespace ccm
+
+/// @ingroup trig
@@ -10,7 +10,60 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/trig/atan_gen.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the principal value of the arc tangent of num.
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value.
+	 * @return If no errors occur, the arc tangent of num (arctan(num)) in the range [-π/2, +π/2] radians is returned. If num is ±∞, ±π/2 is returned. If num is
+	 * NaN, NaN is returned.
+	 * @note Arguments above 7/16 are reduced onto a table of four breakpoints before a minimax polynomial is applied. Float and long double arguments are
+	 * evaluated in double precision.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T atan(T num) noexcept
+	{
+		return gen::atan_gen<T>(num);
+	}
+
+	/**
+	 * @brief Computes the principal value of the arc tangent of num.
+	 * @tparam Integer The type of the number.
+	 * @param num An integral value.
+	 * @return If no errors occur, the arc tangent of num converted to double is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double atan(Integer num) noexcept
+	{
+		return gen::atan_gen<double>(static_cast<double>(num));
+	}
 
+	/**
+	 * @brief Computes the principal value of the arc tangent of num.
+	 * @param num A float value.
+	 * @return If no errors occur, the arc tangent of num (arctan(num)) in the range [-π/2, +π/2] radians is returned. If num is ±∞, ±π/2 is returned. If num is
+	 * NaN, NaN is returned.
+	 */
+	constexpr float atanf(float num) noexcept
+	{
+		return ccm::atan<float>(num);
+	}
+
+	/**
+	 * @brief Computes the principal value of the arc tangent of num.
+	 * @param num A long double value.
+	 * @return If no errors occur, the arc tangent of num (arctan(num)) in the range [-π/2, +π/2] radians is returned. If num is ±∞, ±π/2 is returned. If num is
+	 * NaN, NaN is returned.
+	 */
+	constexpr long double atanl(long double num) noexcept
+	{
+		return ccm::atan<long double>(num);
+	}
 } // namespace ccm
+
+/// @ingroup trig
@@ -10,7 +10,76 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/trig/atan2_gen.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the arc tangent of y/x using the signs of the arguments to determine the correct quadrant.
+	 * @tparam T The type of the arguments.
+	 * @param y A floating-point value.
+	 * @param x A floating-point value.
+	 * @return If no errors occur, the arc tangent of y/x (arctan(y/x)) in the range [-π, +π] radians is returned. If y or x is NaN, NaN is returned.
+	 * @note The rounding error of the quotient y/x is recovered and folded into the result, so atan2 is as accurate as atan. Zeros and infinities
+	 * follow the signed cases of the standard. Float and long double arguments are evaluated in double precision.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T atan2(T y, T x) noexcept
+	{
+		return gen::atan2_gen<T>(y, x);
+	}
+
+	/**
+	 * @brief Computes the arc tangent of y/x using the signs of the arguments to determine the correct quadrant.
+	 * @tparam T The type of the first argument.
+	 * @tparam U The type of the second argument.
+	 * @param y A floating-point value.
+	 * @param x A floating-point value.
+	 * @return If no errors occur, the arc tangent of y/x (arctan(y/x)) in the range [-π, +π] radians is returned. If y or x is NaN, NaN is returned.
+	 */
+	template <typename T, typename U, std::enable_if_t<std::is_floating_point_v<T> && std::is_floating_point_v<U>, bool> = true>
+	constexpr auto atan2(T y, U x) noexcept
+	{
+		using shared_type = std::common_type_t<T, U>;
+		return ccm::atan2<shared_type>(static_cast<shared_type>(y), static_cast<shared_type>(x));
+	}
 
+	/**
+	 * @brief Computes the arc tangent of y/x using the signs of the arguments to determine the correct quadrant.
+	 * @tparam Integer The type of the arguments.
+	 * @param y An integral value.
+	 * @param x An integral value.
+	 * @return If no errors occur, the arc tangent of y/x converted to double is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double atan2(Integer y, Integer x) noexcept
+	{
+		return gen::atan2_gen<double>(static_cast<double>(y), static_cast<double>(x));
+	}
+
+	/**
+	 * @brief Computes the arc tangent of y/x using the signs of the arguments to determine the correct quadrant.
+	 * @param y A float value.
+	 * @param x A float value.
+	 * @return If no errors occur, the arc tangent of y/x (arctan(y/x)) in the range [-π, +π] radians is returned. If y or x is NaN, NaN is returned.
+	 */
+	constexpr float atan2f(float y, float x) noexcept
+	{
+		return ccm::atan2<float>(y, x);
+	}
+
+	/**
+	 * @brief Computes the arc tangent of y/x using the signs of the arguments to determine the correct quadrant.
+	 * @param y A long double value.
+	 * @param x A long double value.
+	 * @return If no errors occur, the arc tangent of y/x (arctan(y/x)) in the range [-π, +π] radians is returned. If y or x is NaN, NaN is returned.
+	 */
+	constexpr long double atan2l(long double y, long double x) noexcept
+	{
+		return ccm::atan2<long double>(y, x);
+	}
 } // namespace ccm
+
+/// @ingroup trig
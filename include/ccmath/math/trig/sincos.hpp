@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include "ccmath/internal/math/generic/func/trig/sincos_gen.hpp"
+
+#include <type_traits>
+
+namespace ccm
+{
+	/**
+	 * @brief Computes the sine and cosine of num (measured in radians) with a single argument reduction.
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value representing an angle in radians.
+	 * @param sin_out Pointer to store the sine of num.
+	 * @param cos_out Pointer to store the cosine of num.
+	 * @note The results are identical to ccm::sin(num) and ccm::cos(num). If num is ±∞ or NaN, both results are NaN.
+	 *
+	 * @attention As with ccm::remquo, the output pointers must point to objects of the enclosing constant evaluation for this to work in a
+	 * constant context:
+	 *
+	 * @code
+	 * constexpr double get_sine(double x)
+	 * {
+	 *      double s {0};
+	 *      double c {0};
+	 *      ccm::sincos(x, &s, &c);
+	 *      return s;
+	 * }
+	 * @endcode
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr void sincos(T num, T * sin_out, T * cos_out) noexcept
+	{
+		gen::sincos_gen<T>(num, sin_out, cos_out);
+	}
+
+	/**
+	 * @brief Computes the sine and cosine of num (measured in radians) with a single argument reduction.
+	 * @param num A float value representing an angle in radians.
+	 * @param sin_out Pointer to store the sine of num.
+	 * @param cos_out Pointer to store the cosine of num.
+	 */
+	constexpr void sincosf(float num, float * sin_out, float * cos_out) noexcept
+	{
+		ccm::sincos<float>(num, sin_out, cos_out);
+	}
+
+	/**
+	 * @brief Computes the sine and cosine of num (measured in radians) with a single argument reduction.
+	 * @param num A long double value representing an angle in radians.
+	 * @param sin_out Pointer to store the sine of num.
+	 * @param cos_out Pointer to store the cosine of num.
+	 */
+	constexpr void sincosl(long double num, long double * sin_out, long double * cos_out) noexcept
+	{
+		ccm::sincos<long double>(num, sin_out, cos_out);
+	}
+} // namespace ccm
+
+/// @ingroup trig
@@ -10,7 +10,57 @@
 
 #pragma once
 
+#include "ccmath/internal/math/generic/func/trig/tan_gen.hpp"
+
+#include <type_traits>
+
 namespace ccm
 {
+	/**
+	 * @brief Computes the tangent of num (measured in radians).
+	 * @tparam T The type of the number.
+	 * @param num A floating-point value representing an angle in radians.
+	 * @return If no errors occur, the tangent of num (tan(num)) in the range (-∞, +∞) is returned. If num is ±∞ or NaN, NaN is returned.
+	 * @note Arguments up to 2^20 in magnitude are reduced with a Cody-Waite reduction, larger ones with an exact Payne-Hanek reduction.
+	 * long double arguments are evaluated in double precision.
+	 */
+	template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+	constexpr T tan(T num) noexcept
+	{
+		return gen::tan_gen<T>(num);
+	}
+
+	/**
+	 * @brief Computes the tangent of num (measured in radians).
+	 * @tparam Integer The type of the number.
+	 * @param num An integral value representing an angle in radians.
+	 * @return If no errors occur, the tangent of num converted to double is returned.
+	 */
+	template <typename Integer, std::enable_if_t<std::is_integral_v<Integer>, bool> = true>
+	constexpr double tan(Integer num) noexcept
+	{
+		return gen::tan_gen<double>(static_cast<double>(num));
+	}
 
+	/**
+	 * @brief Computes the tangent of num (measured in radians).
+	 * @param num A float value representing an angle in radians.
+	 * @return If no errors occur, the tangent of num (tan(num)) in the range (-∞, +∞) is returned. If num is ±∞ or NaN, NaN is returned.
+	 */
+	constexpr float tanf(float num) noexcept
+	{
+		return ccm::tan<float>(num);
+	}
+
+	/**
+	 * @brief Computes the tangent of num (measured in radians).
+	 * @param num A long double value representing an angle in radians.
+	 * @return If no errors occur, the tangent of num (tan(num)) in the range (-∞, +∞) is returned. If num is ±∞ or NaN, NaN is returned.
+	 */
+	constexpr long double tanl(long double num) noexcept
+	{
+		return ccm::tan<long double>(num);
+	}
 } // namespace ccm
+
+/// @ingroup trig
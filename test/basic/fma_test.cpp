@@ -11,8 +11,28 @@
 #include <gtest/gtest.h>
 
 #include <ccmath/ccmath.hpp>
+#include "support/batch.hpp"
+#include "support/ulp.hpp"
 #include <cmath>
 #include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using ccm::test::for_each_runnable_simd_level;
+	using ccm::test::same_bits;
+
+	// Random value with a uniformly distributed exponent in [min_exp, max_exp] and a random sign.
+	template <typename T>
+	T random_value(std::mt19937_64 & gen, int min_exp, int max_exp)
+	{
+		std::uniform_real_distribution<T> mantissa(1, 2);
+		std::uniform_int_distribution<int> exponent(min_exp, max_exp);
+		const T value = std::ldexp(mantissa(gen), exponent(gen));
+		return (gen() & 1U) != 0 ? -value : value;
+	}
+} // namespace
 
 TEST(CcmathBasicTests, Fma)
 {
@@ -31,6 +51,13 @@ TEST(CcmathBasicTests, Fma)
 	EXPECT_EQ(ccm::fma(0.0, 0.0, 0.0), std::fma(0.0, 0.0, 0.0));
 	EXPECT_EQ(ccm::fma(-0.0, -0.0, -0.0), std::fma(-0.0, -0.0, -0.0));
 
+	// The result must be rounded once, which a separate multiply and add cannot do.
+	static_assert(ccm::fma(1.0 + 0x1p-52, 1.0 - 0x1p-52, -1.0) == -0x1p-104, "fma has failed testing that it is fused!");
+	static_assert(ccm::fma(1.0F + 0x1p-23F, 1.0F - 0x1p-23F, -1.0F) == -0x1p-46F, "fma has failed testing that it is fused!");
+	EXPECT_EQ(ccm::fma(1.0 + 0x1p-52, 1.0 - 0x1p-52, -1.0), -0x1p-104);
+	EXPECT_EQ(ccm::fma(1.0F + 0x1p-23F, 1.0F - 0x1p-23F, -1.0F), -0x1p-46F);
+	EXPECT_EQ(ccm::fma(1.0L + 0x1p-30L, 1.0L - 0x1p-30L, -1.0L), std::fma(1.0L + 0x1p-30L, 1.0L - 0x1p-30L, -1.0L));
+
 	/* TODO: Add these test back in once the implementation is complete
 
 	// If x is zero and y is infinity, or if y is zero and x is infinity and Z is not NaN, then the result is NaN.
@@ -178,3 +205,89 @@ TEST(CcmathBasicTests, Fma)
 
 */
 }
+
+TEST(CcmathBasicTests, FmaGenericIsCorrectlyRounded)
+{
+	std::mt19937_64 gen(0x5eed);
+	for (int i = 0; i < 20000; ++i)
+	{
+		// Typical magnitudes, products that nearly cancel the addend, and operands at both ends of the exponent range.
+		const double x = random_value<double>(gen, -40, 40);
+		const double y = random_value<double>(gen, -40, 40);
+		double z	   = random_value<double>(gen, -80, 80);
+		EXPECT_TRUE(same_bits(ccm::gen::fma_gen(x, y, z), std::fma(x, y, z))) << x << " * " << y << " + " << z;
+		z = -(x * y);
+		EXPECT_TRUE(same_bits(ccm::gen::fma_gen(x, y, z), std::fma(x, y, z))) << x << " * " << y << " + " << z;
+
+		const double xe = random_value<double>(gen, -1074, 1023);
+		const double ye = random_value<double>(gen, -1074, 1023);
+		const double ze = random_value<double>(gen, -1074, 1023);
+		EXPECT_TRUE(same_bits(ccm::gen::fma_gen(xe, ye, ze), std::fma(xe, ye, ze))) << xe << " * " << ye << " + " << ze;
+
+		const float xf = random_value<float>(gen, -149, 127);
+		const float yf = random_value<float>(gen, -149, 127);
+		const float zf = random_value<float>(gen, -149, 127);
+		EXPECT_TRUE(same_bits(ccm::gen::fma_gen(xf, yf, zf), std::fma(xf, yf, zf))) << xf << " * " << yf << " + " << zf;
+		EXPECT_TRUE(same_bits(ccm::gen::fma_gen(xf, yf, -(xf * yf)), std::fma(xf, yf, -(xf * yf)))) << xf << " * " << yf;
+
+		const long double xl = random_value<long double>(gen, -200, 200);
+		const long double yl = random_value<long double>(gen, -200, 200);
+		EXPECT_EQ(ccm::gen::fma_gen(xl, yl, -(xl * yl)), std::fma(xl, yl, -(xl * yl))) << xl << " * " << yl;
+	}
+
+	// Results that underflow to subnormals or overflow to infinity.
+	EXPECT_TRUE(same_bits(ccm::gen::fma_gen(0x1.8p-540, 0x1.0000000000001p-540, -0x1p-1074), std::fma(0x1.8p-540, 0x1.0000000000001p-540, -0x1p-1074)));
+	EXPECT_TRUE(same_bits(ccm::gen::fma_gen(0x1p-600, -0x1p-600, 0.0), -0.0));
+	EXPECT_TRUE(same_bits(ccm::gen::fma_gen(0x1p1000, 0x1p100, -1.0), std::numeric_limits<double>::infinity()));
+	EXPECT_TRUE(same_bits(ccm::gen::fma_gen(std::numeric_limits<double>::max(), 2.0, -std::numeric_limits<double>::max()), std::numeric_limits<double>::max()));
+	EXPECT_TRUE(same_bits(ccm::gen::fma_gen(1.0, 1.0, -1.0), 0.0));
+	EXPECT_TRUE(std::isnan(ccm::gen::fma_gen(0.0, std::numeric_limits<double>::infinity(), 1.0)));
+	EXPECT_TRUE(std::isnan(ccm::gen::fma_gen(std::numeric_limits<float>::infinity(), 1.0F, -std::numeric_limits<float>::infinity())));
+}
+
+TEST(CcmathBasicTests, FmaBatch)
+{
+	std::mt19937_64 gen(0xf3a);
+	// Use an odd count so every tail path is exercised.
+	constexpr std::size_t count = 1001;
+	std::vector<double> x(count);
+	std::vector<double> y(count);
+	std::vector<double> z(count);
+	std::vector<float> xf(count);
+	std::vector<float> yf(count);
+	std::vector<float> zf(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		x[i]  = random_value<double>(gen, -30, 30);
+		y[i]  = random_value<double>(gen, -30, 30);
+		z[i]  = (i % 2 == 0) ? -(x[i] * y[i]) : random_value<double>(gen, -60, 60);
+		xf[i] = random_value<float>(gen, -30, 30);
+		yf[i] = random_value<float>(gen, -30, 30);
+		zf[i] = (i % 2 == 0) ? -(xf[i] * yf[i]) : random_value<float>(gen, -60, 60);
+	}
+
+	const auto check = [&](auto fn_double, auto fn_float, std::size_t n)
+	{
+		std::vector<double> out(n);
+		std::vector<float> outf(n);
+		fn_double(x.data(), y.data(), z.data(), out.data(), n);
+		fn_float(xf.data(), yf.data(), zf.data(), outf.data(), n);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			EXPECT_TRUE(same_bits(out[i], std::fma(x[i], y[i], z[i]))) << "index: " << i;
+			EXPECT_TRUE(same_bits(outf[i], std::fma(xf[i], yf[i], zf[i]))) << "index: " << i;
+		}
+	};
+
+	check([](auto... a) { ccm::batch::fma(a...); }, [](auto... a) { ccm::batch::fma(a...); }, count);
+	check([](auto... a) { ccm::batch::fma(a...); }, [](auto... a) { ccm::batch::fma(a...); }, 3);
+
+	// Every tier compiled into this binary that the host can run must agree with the reference.
+	for_each_runnable_simd_level([&](ccm::rt::simd_level level) {
+		auto * fn_double = ccm::rt::simd_impl::fma_batch_kernel_for<double>(level);
+		auto * fn_float	 = ccm::rt::simd_impl::fma_batch_kernel_for<float>(level);
+		if (fn_double == nullptr || fn_float == nullptr) { return; }
+		check(fn_double, fn_float, count);
+		check(fn_double, fn_float, 5);
+	});
+}
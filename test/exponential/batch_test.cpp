@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/batch.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using ccm::test::expect_batch_matches;
+using ccm::test::for_each_runnable_simd_level;
+using ccm::test::make_range;
+
+TEST(CcmathExponentialTests, BatchExp)
+{
+	// Use an odd count so the scalar tail is exercised for every SIMD width.
+	expect_batch_matches(make_range(-700.0, 700.0, 1001), [](auto... a) { ccm::batch::exp(a...); }, [](double x) { return std::exp(x); });
+	expect_batch_matches(make_range(-1.0, 1.0, 1001), [](auto... a) { ccm::batch::exp(a...); }, [](double x) { return std::exp(x); });
+	expect_batch_matches(make_range(-100.0F, 88.5F, 1001), [](auto... a) { ccm::batch::exp(a...); }, [](float x) { return std::exp(x); });
+
+	// Special values are routed to the scalar kernel.
+	const std::vector<double> special = {0.0, -0.0, 1e-300, 710.0, -750.0, std::numeric_limits<double>::infinity(),
+										 -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN(), 1.0};
+	expect_batch_matches(special, [](auto... a) { ccm::batch::exp(a...); }, [](double x) { return std::exp(x); });
+}
+
+TEST(CcmathExponentialTests, BatchExp2)
+{
+	expect_batch_matches(make_range(-1070.0, 1023.0, 1001), [](auto... a) { ccm::batch::exp2(a...); }, [](double x) { return std::exp2(x); });
+	expect_batch_matches(make_range(-140.0F, 127.5F, 1001), [](auto... a) { ccm::batch::exp2(a...); }, [](float x) { return std::exp2(x); });
+
+	const std::vector<float> special = {0.0F, -0.0F, 128.0F, -150.0F, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+										std::numeric_limits<float>::quiet_NaN()};
+	expect_batch_matches(special, [](auto... a) { ccm::batch::exp2(a...); }, [](float x) { return std::exp2(x); });
+}
+
+TEST(CcmathExponentialTests, BatchLog)
+{
+	expect_batch_matches(make_range(1e-3, 1e3, 1001), [](auto... a) { ccm::batch::log(a...); }, [](double x) { return std::log(x); });
+	expect_batch_matches(make_range(0.5, 1.5, 1001), [](auto... a) { ccm::batch::log(a...); }, [](double x) { return std::log(x); });
+	expect_batch_matches(make_range(1e-3F, 1e3F, 1001), [](auto... a) { ccm::batch::log(a...); }, [](float x) { return std::log(x); });
+
+	const std::vector<double> special = {1.0, 0.0, -1.0, 4.9e-324, std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN(), 2.0};
+	expect_batch_matches(special, [](auto... a) { ccm::batch::log(a...); }, [](double x) { return std::log(x); });
+}
+
+TEST(CcmathExponentialTests, BatchLog2)
+{
+	expect_batch_matches(make_range(1e-3, 1e3, 1001), [](auto... a) { ccm::batch::log2(a...); }, [](double x) { return std::log2(x); });
+	expect_batch_matches(make_range(0.5, 1.5, 1001), [](auto... a) { ccm::batch::log2(a...); }, [](double x) { return std::log2(x); });
+	expect_batch_matches(make_range(1e-3F, 1e3F, 1001), [](auto... a) { ccm::batch::log2(a...); }, [](float x) { return std::log2(x); });
+
+	const std::vector<float> special = {1.0F, 0.0F, -1.0F, 1e-40F, std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(), 2.0F};
+	expect_batch_matches(special, [](auto... a) { ccm::batch::log2(a...); }, [](float x) { return std::log2(x); });
+}
+
+TEST(CcmathExponentialTests, BatchEveryDispatchTier)
+{
+	for_each_runnable_simd_level([](ccm::rt::simd_level level) {
+		using namespace ccm::rt::simd_impl;
+		if (auto * fn = batch_kernel_for<exp_batch_kernel, double>(level))
+		{
+			expect_batch_matches(make_range(-700.0, 700.0, 1001), fn, [](double x) { return std::exp(x); });
+		}
+		if (auto * fn = batch_kernel_for<exp2_batch_kernel, float>(level))
+		{
+			expect_batch_matches(make_range(-140.0F, 127.5F, 1001), fn, [](float x) { return std::exp2(x); });
+		}
+		if (auto * fn = batch_kernel_for<log_batch_kernel, double>(level))
+		{
+			expect_batch_matches(make_range(1e-3, 1e3, 1001), fn, [](double x) { return std::log(x); });
+		}
+		if (auto * fn = batch_kernel_for<log2_batch_kernel, float>(level))
+		{
+			expect_batch_matches(make_range(1e-3F, 1e3F, 1001), fn, [](float x) { return std::log2(x); });
+		}
+	});
+}
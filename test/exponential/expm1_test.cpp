@@ -10,11 +10,52 @@
 
 #include <gtest/gtest.h>
 
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
 #include <cmath>
 #include <limits>
-#include "ccmath/ccmath.hpp"
+#include <vector>
+
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
 
 TEST(CcmathExponentialTests, Expm1)
 {
+	// Inputs past 2^9 only overflow or round to -1, and the small ones cover the Taylor path.
+	for (const double x : make_inputs<double>(-60, 9, 64)) { EXPECT_LE(ulp_distance(ccm::expm1(x), std::expm1(x)), 1) << "input: " << x; }
+	for (const float x : make_inputs<float>(-30, 6, 64)) { EXPECT_LE(ulp_distance(ccm::expm1f(x), std::expm1(x)), 1) << "input: " << x; }
+
+	// Around the edges of the Taylor, table and saturation ranges.
+	for (const double x : {0x1p-4, -0x1p-4, 0x1.fffffffffffffp-5, 0x1p-54, 0x1.8p-54, 63.9, 64.0, -37.5, -38.0, 709.78, 709.79})
+	{
+		EXPECT_LE(ulp_distance(ccm::expm1(x), std::expm1(x)), 1) << "input: " << x;
+	}
+}
 
+TEST(CcmathExponentialTests, Expm1SpecialValues)
+{
+	EXPECT_EQ(ccm::expm1(0.0), 0.0);
+	EXPECT_TRUE(std::signbit(ccm::expm1(-0.0)));
+	EXPECT_TRUE(std::signbit(ccm::expm1f(-0.0F)));
+	EXPECT_EQ(ccm::expm1(1e-300), 1e-300);
+	EXPECT_EQ(ccm::expm1(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::expm1(-std::numeric_limits<double>::infinity()), -1.0);
+	EXPECT_EQ(ccm::expm1(1000.0), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::expm1(-1000.0), -1.0);
+	EXPECT_TRUE(std::isnan(ccm::expm1(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::expm1f(std::numeric_limits<float>::infinity()), std::numeric_limits<float>::infinity());
+	EXPECT_EQ(ccm::expm1f(-std::numeric_limits<float>::infinity()), -1.0F);
+	EXPECT_EQ(ccm::expm1f(100.0F), std::numeric_limits<float>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::expm1f(std::numeric_limits<float>::quiet_NaN())));
+	EXPECT_LE(ulp_distance(ccm::expm1(2), std::expm1(2.0)), 1);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::expm1l(1.0L)), std::expm1(1.0)), 1);
+}
+
+TEST(CcmathExponentialTests, Expm1CanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::expm1(0.0) == 0.0);
+	static_assert(ccm::expm1(1e-300) == 1e-300);
+	static_assert(ccm::expm1(-1000.0) == -1.0);
+	static_assert(ccm::expm1(1.0) > 1.718281828 && ccm::expm1(1.0) < 1.718281829);
+	static_assert(ccm::expm1f(1.0F) > 1.718F && ccm::expm1f(1.0F) < 1.719F);
 }
@@ -10,11 +10,62 @@
 
 #include <gtest/gtest.h>
 
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
 #include <cmath>
 #include <limits>
-#include "ccmath/ccmath.hpp"
+#include <random>
+#include <vector>
+
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
 
 TEST(CcmathExponentialTests, Log10)
 {
+	for (const double x : make_inputs<double>(-1074, 1023, 16, ccm::test::input_signs::positive))
+	{
+		EXPECT_LE(ulp_distance(ccm::log10(x), std::log10(x)), 1) << "input: " << x;
+	}
+	for (const float x : make_inputs<float>(-149, 127, 16, ccm::test::input_signs::positive))
+	{
+		EXPECT_LE(ulp_distance(ccm::log10f(x), std::log10(x)), 1) << "input: " << x;
+	}
+
+	// Close to 1, where the polynomial path keeps the relative precision of the result. Some standard libraries are up
+	// to 2 ULP off here themselves, so the bound is wider than above.
+	std::mt19937_64 generator(7);
+	std::uniform_real_distribution<double> near_one(0.9, 1.1);
+	for (int i = 0; i < 4096; ++i)
+	{
+		const double x = near_one(generator);
+		EXPECT_LE(ulp_distance(ccm::log10(x), std::log10(x)), 2) << "input: " << x;
+	}
+
+	// Powers of ten give exact integers.
+	double power = 1.0;
+	for (int e = 0; e <= 22; ++e, power *= 10.0) { EXPECT_EQ(ccm::log10(power), static_cast<double>(e)) << "input: " << power; }
+	EXPECT_EQ(ccm::log10f(1000.0F), 3.0F);
+}
+
+TEST(CcmathExponentialTests, Log10SpecialValues)
+{
+	EXPECT_EQ(ccm::log10(1.0), 0.0);
+	EXPECT_EQ(ccm::log10(0.0), -std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::log10(-0.0), -std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::log10f(0.0F), -std::numeric_limits<float>::infinity());
+	EXPECT_EQ(ccm::log10(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::log10(-1.0)));
+	EXPECT_TRUE(std::isnan(ccm::log10(-std::numeric_limits<double>::infinity())));
+	EXPECT_TRUE(std::isnan(ccm::log10(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::log10f(-1.0F)));
+	EXPECT_EQ(ccm::log10(100), 2.0);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::log10l(2.0L)), std::log10(2.0)), 1);
+}
 
+TEST(CcmathExponentialTests, Log10CanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::log10(1.0) == 0.0);
+	static_assert(ccm::log10(1000.0) == 3.0);
+	static_assert(ccm::log10f(100.0F) == 2.0F);
+	static_assert(ccm::log10(2.0) > 0.301029995 && ccm::log10(2.0) < 0.301029996);
 }
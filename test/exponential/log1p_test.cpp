@@ -10,11 +10,56 @@
 
 #include <gtest/gtest.h>
 
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
 #include <cmath>
 #include <limits>
-#include "ccmath/ccmath.hpp"
+#include <vector>
+
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
 
 TEST(CcmathExponentialTests, Log1p)
 {
+	// Negative inputs below -1 are dropped; the rest cover the polynomial near 0, the table and the corrected sum 1 + x.
+	for (const double x : make_inputs<double>(-60, 1023, 64))
+	{
+		if (x > -1.0) { EXPECT_LE(ulp_distance(ccm::log1p(x), std::log1p(x)), 1) << "input: " << x; }
+	}
+	for (const float x : make_inputs<float>(-30, 127, 64))
+	{
+		if (x > -1.0F) { EXPECT_LE(ulp_distance(ccm::log1pf(x), std::log1p(x)), 1) << "input: " << x; }
+	}
+
+	// Around the edge of the polynomial range and next to -1.
+	for (const double x : {0x1p-4, -0x1p-4, 0x1.fffffffffffffp-5, 0x1p-54, -0x1.fffffffffffffp-1, -0.75, 1e300})
+	{
+		EXPECT_LE(ulp_distance(ccm::log1p(x), std::log1p(x)), 1) << "input: " << x;
+	}
+}
 
+TEST(CcmathExponentialTests, Log1pSpecialValues)
+{
+	EXPECT_EQ(ccm::log1p(0.0), 0.0);
+	EXPECT_TRUE(std::signbit(ccm::log1p(-0.0)));
+	EXPECT_TRUE(std::signbit(ccm::log1pf(-0.0F)));
+	EXPECT_EQ(ccm::log1p(1e-300), 1e-300);
+	EXPECT_EQ(ccm::log1p(-1.0), -std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::log1pf(-1.0F), -std::numeric_limits<float>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::log1p(-2.0)));
+	EXPECT_TRUE(std::isnan(ccm::log1p(-std::numeric_limits<double>::infinity())));
+	EXPECT_TRUE(std::isnan(ccm::log1p(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::log1p(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::log1pf(-2.0F)));
+	EXPECT_EQ(ccm::log1pf(std::numeric_limits<float>::infinity()), std::numeric_limits<float>::infinity());
+	EXPECT_LE(ulp_distance(ccm::log1p(2), std::log1p(2.0)), 1);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::log1pl(1.0L)), std::log1p(1.0)), 1);
+}
+
+TEST(CcmathExponentialTests, Log1pCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::log1p(0.0) == 0.0);
+	static_assert(ccm::log1p(1e-300) == 1e-300);
+	static_assert(ccm::log1p(1.0) > 0.693147180 && ccm::log1p(1.0) < 0.693147181);
+	static_assert(ccm::log1pf(1.0F) > 0.6931F && ccm::log1pf(1.0F) < 0.6932F);
 }
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <cstddef>
+#include <random>
+
+namespace
+{
+	using ccm::test::ulp_distance;
+
+	template <std::size_t TableBits>
+	void expect_table_size_accurate()
+	{
+		std::mt19937_64 gen(TableBits);
+		std::uniform_real_distribution<double> exp_dist(-700.0, 700.0);
+		std::uniform_real_distribution<double> exp2_dist(-1000.0, 1000.0);
+		std::uniform_real_distribution<double> log_dist(-30.0, 30.0);
+		for (int i = 0; i < 20000; ++i)
+		{
+			const double x = exp_dist(gen);
+			EXPECT_LE(ulp_distance(ccm::internal::impl::exp_double_impl<TableBits>(x), std::exp(x)), 1) << "exp input: " << x;
+
+			const double x2 = exp2_dist(gen);
+			EXPECT_LE(ulp_distance(ccm::internal::impl::exp2_double_impl<TableBits>(x2), std::exp2(x2)), 1) << "exp2 input: " << x2;
+
+			const double y = std::exp2(log_dist(gen));
+			EXPECT_LE(ulp_distance(ccm::internal::impl::log_double_impl<TableBits>(y), std::log(y)), 1) << "log input: " << y;
+			EXPECT_LE(ulp_distance(ccm::internal::impl::log2_double_impl<TableBits>(y), std::log2(y)), 1) << "log2 input: " << y;
+		}
+	}
+
+	/// Whether tab holds the reference entries bit for bit, with clo rounded to the float of the packed record and no logclo.
+	template <typename Tab, typename Reference>
+	constexpr bool packs_reference(const Tab & tab, const Reference & reference)
+	{
+		if (tab.size() != reference.size()) { return false; }
+		for (std::size_t i = 0; i < tab.size(); ++i)
+		{
+			if (tab[i].invc != reference[i].invc || tab[i].logc != reference[i].logc || tab[i].chi != reference[i].chi ||
+				tab[i].clo != static_cast<float>(reference[i].clo) || tab[i].logclo != 0.0F)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+} // namespace
+
+TEST(CcmathExponentialTests, TableSizeDefaultMatchesData)
+{
+	EXPECT_EQ(ccm::internal::exp_data<double>::table_size, std::size_t{1} << ccm::internal::k_exp_table_bits_dbl);
+	EXPECT_EQ(ccm::internal::log2_data<double>::table_size, std::size_t{1} << ccm::internal::k_log2TableBitsDbl);
+	EXPECT_EQ(&ccm::internal::exp_double_data<6>::tab, &ccm::internal::exp2_double_data<6>::tab);
+}
+
+TEST(CcmathExponentialTests, TableSizeDefaultKeepsReferenceTables)
+{
+	using ccm::internal::k_log2ReferenceTabDbl;
+	using ccm::internal::k_logReferenceTabDbl;
+	static_assert(packs_reference(ccm::internal::log_data<double>::tab, k_logReferenceTabDbl));
+	static_assert(packs_reference(ccm::internal::log2_data<double>::tab, k_log2ReferenceTabDbl));
+
+	// Spot entries and leading coefficients of the reference tables, so a generated default cannot replace them unnoticed.
+	static_assert(k_logReferenceTabDbl[0].invc == 0x1.734f0c3e0de9fp+0 && k_logReferenceTabDbl[0].logc == -0x1.7cc7f79e69000p-2);
+	static_assert(k_logReferenceTabDbl[127].invc == 0x1.756cadbd6130cp-1 && k_logReferenceTabDbl[127].logc == 0x1.432eee32fe000p-2);
+	static_assert(k_logReferenceTabDbl[127].chi == 0x1.5efffe7b87a89p+0 && k_logReferenceTabDbl[127].clo == -0x1.47eb780ed6904p-54);
+	static_assert(k_log2ReferenceTabDbl[0].invc == 0x1.724286bb1acf8p+0 && k_log2ReferenceTabDbl[0].logc == -0x1.1095feecdb000p-1);
+	static_assert(k_log2ReferenceTabDbl[63].chi == 0x1.5dfffebfc3481p+0 && k_log2ReferenceTabDbl[63].clo == -0x1.180902e30e93ep-54);
+	static_assert(ccm::internal::log_data<double>::poly[0] == -0x1.0000000000001p-1);
+	static_assert(ccm::internal::log2_data<double>::poly[0] == -0x1.71547652b8339p-1);
+}
+
+TEST(CcmathExponentialTests, TableSizeConstexpr)
+{
+	static_assert(ccm::internal::impl::exp_double_impl<5>(0.0) == 1.0);
+	static_assert(ccm::internal::impl::exp2_double_impl<5>(3.0) == 8.0);
+	static_assert(ccm::internal::impl::log_double_impl<5>(1.0) == 0.0);
+	static_assert(ccm::internal::impl::log2_double_impl<5>(8.0) == 3.0);
+}
+
+TEST(CcmathExponentialTests, TableSize32)
+{
+	expect_table_size_accurate<5>();
+}
+
+TEST(CcmathExponentialTests, TableSize64)
+{
+	expect_table_size_accurate<6>();
+}
+
+TEST(CcmathExponentialTests, TableSize128)
+{
+	expect_table_size_accurate<7>();
+}
+
+TEST(CcmathExponentialTests, TableSize256)
+{
+	expect_table_size_accurate<8>();
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/norm.hpp"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// The norm of values, with every square summed in long double after the values are scaled by the largest magnitude.
+	template <typename T>
+	long double reference_norm(const std::vector<T> & values)
+	{
+		long double largest = 0;
+		for (const T v : values) { largest = std::fmax(largest, std::fabs(static_cast<long double>(v))); }
+		if (largest == 0) { return 0; }
+		long double sum = 0;
+		for (const T v : values)
+		{
+			const long double scaled = static_cast<long double>(v) / largest;
+			sum += scaled * scaled;
+		}
+		return std::sqrt(sum) * largest;
+	}
+
+	template <typename T>
+	std::vector<T> make_values(std::size_t count, int min_exponent, int max_exponent, unsigned seed)
+	{
+		std::mt19937_64 generator(seed);
+		std::uniform_real_distribution<double> mantissa(-2.0, 2.0);
+		std::uniform_int_distribution<int> exponent(min_exponent, max_exponent);
+		std::vector<T> values(count);
+		for (T & v : values) { v = static_cast<T>(std::ldexp(mantissa(generator), exponent(generator))); }
+		return values;
+	}
+
+	template <typename T>
+	void expect_close_to_reference(const std::vector<T> & values, T tolerance)
+	{
+		const T result			   = ccm::ext::norm(values);
+		const long double expected = reference_norm(values);
+		EXPECT_LE(std::fabs(static_cast<long double>(result) - expected), static_cast<long double>(tolerance) * expected) << "count: " << values.size();
+	}
+} // namespace
+
+TEST(CcmathExtTests, NormDouble)
+{
+	constexpr double tolerance = 8 * std::numeric_limits<double>::epsilon();
+	for (const std::size_t count : {1, 2, 3, 7, 64, 1001}) { expect_close_to_reference(make_values<double>(count, -4, 4, 1), tolerance); }
+
+	// Values close to overflow, close to underflow, and all three ranges mixed in one array.
+	expect_close_to_reference(make_values<double>(1001, 900, 1020, 2), tolerance);
+	expect_close_to_reference(make_values<double>(1001, -1074, -900, 3), tolerance);
+	expect_close_to_reference(make_values<double>(1001, -600, -450, 4), tolerance);
+	expect_close_to_reference(make_values<double>(1001, -1074, 1020, 5), tolerance);
+
+	const std::array<double, 3> triple = {2.0, -3.0, 6.0};
+	EXPECT_EQ(ccm::ext::norm(triple), 7.0);
+	const std::array<double, 2> huge = {3e307, 4e307};
+	EXPECT_EQ(ccm::ext::norm(huge), 5e307);
+	const std::array<double, 2> tiny = {3e-320, -4e-320};
+	EXPECT_EQ(ccm::ext::norm(tiny), 5e-320);
+}
+
+TEST(CcmathExtTests, NormFloat)
+{
+	constexpr float tolerance = 8 * std::numeric_limits<float>::epsilon();
+	for (const std::size_t count : {1, 5, 16, 333}) { expect_close_to_reference(make_values<float>(count, -4, 4, 6), tolerance); }
+	expect_close_to_reference(make_values<float>(333, 100, 120, 7), tolerance);
+	expect_close_to_reference(make_values<float>(333, -149, -100, 8), tolerance);
+	expect_close_to_reference(make_values<float>(333, -149, 120, 9), tolerance);
+
+	const float values[] = {1.0F, 4.0F, 8.0F};
+	EXPECT_EQ(ccm::ext::norm(values), 9.0F);
+	EXPECT_EQ(ccm::ext::norm(values, 2), std::sqrt(17.0F));
+}
+
+TEST(CcmathExtTests, NormSpecialValues)
+{
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+	EXPECT_EQ(ccm::ext::norm(static_cast<const double *>(nullptr), 0), 0.0);
+	EXPECT_EQ(ccm::ext::norm(std::vector<double>(17, 0.0)), 0.0);
+
+	// Infinity wins over NaN wherever the two are in the array.
+	std::vector<double> values = make_values<double>(37, -4, 4, 10);
+	values[3]				   = nan;
+	EXPECT_TRUE(std::isnan(ccm::ext::norm(values)));
+	values[30] = -inf;
+	EXPECT_EQ(ccm::ext::norm(values), inf);
+	values[3] = 1.0;
+	EXPECT_EQ(ccm::ext::norm(values), inf);
+
+	// A NaN must not be hidden by values that only fill the small sum.
+	const std::array<double, 3> small_and_nan = {1e-300, nan, 1e-310};
+	EXPECT_TRUE(std::isnan(ccm::ext::norm(small_and_nan)));
+}
+
+TEST(CcmathExtTests, NormCanBeEvaluatedAtCompileTime)
+{
+	constexpr std::array<double, 3> triple = {2.0, -3.0, 6.0};
+	static_assert(ccm::ext::norm(triple) == 7.0);
+	constexpr std::array<double, 2> huge = {3e300, 4e300};
+	static_assert(ccm::ext::norm(huge) == 5e300);
+	constexpr std::array<float, 2> pair = {-3.0F, 4.0F};
+	static_assert(ccm::ext::norm(pair) == 5.0F);
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/rsqrt.hpp"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace
+{
+	using ccm::ext::rsqrt_precision;
+
+	// True if y is 1/sqrt(x) rounded to nearest. The midpoints between y and its neighbours have 25 bits, so their squares
+	// are exact in double and one fma gives the exact sign of x * m^2 - 1.
+	bool is_correctly_rounded(float x, float y)
+	{
+		const auto above_one = [x](float neighbour, float y_value)
+		{
+			const double m	= (static_cast<double>(y_value) + static_cast<double>(neighbour)) * 0.5;
+			const double m2 = m * m;
+			const double p	= static_cast<double>(x) * m2;
+			return (p - 1.0) + std::fma(static_cast<double>(x), m2, -p);
+		};
+		return above_one(std::nextafter(y, std::numeric_limits<float>::infinity()), y) >= 0.0 && above_one(std::nextafter(y, 0.0F), y) <= 0.0;
+	}
+
+	template <class T>
+	T relative_error(T value, T x)
+	{
+		const long double exact = 1.0L / std::sqrt(static_cast<long double>(x));
+		return static_cast<T>(std::fabs((static_cast<long double>(value) - exact) / exact));
+	}
+
+	// The documented bounds of ccm::ext::rsqrt_precision for the instructions this test is built for.
+	template <class T>
+	T estimate_bound()
+	{
+#if defined(CCMATH_HAS_SIMD_AVX512F)
+		return static_cast<T>(0x1p-14);
+#elif defined(CCMATH_HAS_SIMD_SSE2)
+		return std::is_same_v<T, float> ? static_cast<T>(0x1.8p-12) : std::numeric_limits<T>::epsilon();
+#elif defined(CCMATH_HAS_SIMD_NEON) || defined(CCMATH_HAS_SIMD_SVE)
+		return static_cast<T>(0x1p-7);
+#else
+		return std::numeric_limits<T>::epsilon();
+#endif
+	}
+
+	template <class T>
+	T newton_bound()
+	{
+#if defined(CCMATH_HAS_SIMD_AVX512F)
+		return std::is_same_v<T, float> ? static_cast<T>(0x1p-23) : static_cast<T>(0x1p-27);
+#elif defined(CCMATH_HAS_SIMD_SSE2)
+		return std::is_same_v<T, float> ? static_cast<T>(0x1p-22) : std::numeric_limits<T>::epsilon();
+#elif defined(CCMATH_HAS_SIMD_NEON) || defined(CCMATH_HAS_SIMD_SVE)
+		return static_cast<T>(0x1p-14);
+#else
+		return std::numeric_limits<T>::epsilon();
+#endif
+	}
+
+	template <class T>
+	std::array<T, 64> sample_inputs(std::uint32_t seed)
+	{
+		std::mt19937 gen(seed);
+		std::uniform_real_distribution<T> mantissa(static_cast<T>(1), static_cast<T>(2));
+		std::uniform_int_distribution<int> exponent(std::numeric_limits<T>::min_exponent, std::numeric_limits<T>::max_exponent - 2);
+		std::array<T, 64> inputs{};
+		for (auto & x : inputs) { x = std::ldexp(mantissa(gen), exponent(gen)); }
+		return inputs;
+	}
+} // namespace
+
+TEST(CcmathExtTests, RsqrtConstexpr)
+{
+	static_assert(ccm::ext::rsqrt(4.0) == 0.5);
+	static_assert(ccm::ext::rsqrt(0.25F) == 2.0F);
+	static_assert(ccm::ext::rsqrt<rsqrt_precision::estimate>(16.0F) == 0.25F);
+	static_assert(ccm::ext::rsqrt<rsqrt_precision::newton>(0x1p-1074) == 0x1p537);
+	static_assert(ccm::ext::rsqrt(std::numeric_limits<double>::infinity()) == 0.0);
+	static_assert(ccm::ext::rsqrt(-0.0) == -std::numeric_limits<double>::infinity());
+	static_assert(ccm::ext::rsqrt(2.0) == 0x1.6a09e667f3bcdp-1);
+}
+
+TEST(CcmathExtTests, RsqrtExactFloatEveryValueInTwoBinades)
+{
+	// 1/sqrt(f * 4^k) = 2^-k / sqrt(f) scales exactly, so [1, 4) stands for every normal binade.
+	for (float x = 1.0F; x < 4.0F; x = std::nextafter(x, 4.0F))
+	{
+		const float y = ccm::ext::rsqrt(x);
+		if (!is_correctly_rounded(x, y)) { FAIL() << std::hexfloat << x << " gave " << y; }
+	}
+}
+
+TEST(CcmathExtTests, RsqrtExactFloatAcrossExponents)
+{
+	for (const float x : sample_inputs<float>(17)) { EXPECT_TRUE(is_correctly_rounded(x, ccm::ext::rsqrt(x))) << std::hexfloat << x; }
+	for (float x = std::numeric_limits<float>::denorm_min(); x < std::numeric_limits<float>::min(); x *= 3.0F)
+	{
+		EXPECT_TRUE(is_correctly_rounded(x, ccm::ext::rsqrt(x))) << std::hexfloat << x;
+	}
+	EXPECT_TRUE(is_correctly_rounded(std::numeric_limits<float>::max(), ccm::ext::rsqrt(std::numeric_limits<float>::max())));
+}
+
+TEST(CcmathExtTests, RsqrtExactDouble)
+{
+	// Inputs whose results lie within 2^-21 ulp of a midpoint, checked with exact rational arithmetic.
+	constexpr std::array<std::array<double, 2>, 12> near_midpoints{{
+		{0x1.335602c09951dp+0, 0x1.d34958851dea6p-1},
+		{0x1.227ec7d7197adp+0, 0x1.e0a3fd19cfc7ep-1},
+		{0x1.f5d1df23d608dp+1, 0x1.0295696d66c2fp-1},
+		{0x1.506a5d25c558ap+0, 0x1.bea2599ae2714p-1},
+		{0x1.d399c11780ce9p+1, 0x1.0be0d370aec23p-1},
+		{0x1.02aac51be22acp+1, 0x1.682ad9430b2b3p-1},
+		{0x1.417ea0dad6374p+1, 0x1.43104a6c8cb7cp-1},
+		{0x1.da75064d79727p+0, 0x1.7816f784c1bd7p-1},
+		{0x1.5a130170d101bp+0, 0x1.b85b7f0edf21cp-1},
+		{0x1.116471ffb17a1p+1, 0x1.5e5564df8e981p-1},
+		{0x1.28da47e1907c7p+1, 0x1.50348a66e390ep-1},
+		{0x1.92d785ad313abp+1, 0x1.209b862a9495fp-1},
+	}};
+	for (const auto & [x, expected] : near_midpoints)
+	{
+		EXPECT_EQ(ccm::ext::rsqrt(x), expected) << std::hexfloat << x;
+		EXPECT_EQ(ccm::ext::rsqrt(x * 0x1p-1000), expected * 0x1p500) << std::hexfloat << x;
+		EXPECT_EQ(ccm::ext::rsqrt(x * 0x1p1020), expected * 0x1p-510) << std::hexfloat << x;
+	}
+
+	// A correctly rounded result is within 2^-53 relative, which an 80 bit long double can check. Skipped where long double is double.
+	if constexpr (std::numeric_limits<long double>::digits >= 64)
+	{
+		for (const double x : sample_inputs<double>(23))
+		{
+			EXPECT_LE(relative_error(ccm::ext::rsqrt(x), x), std::numeric_limits<double>::epsilon() * 0.5) << std::hexfloat << x;
+		}
+		for (double x = std::numeric_limits<double>::denorm_min(); x < std::numeric_limits<double>::min(); x *= 5.0)
+		{
+			EXPECT_LE(relative_error(ccm::ext::rsqrt(x), x), std::numeric_limits<double>::epsilon() * 0.5) << std::hexfloat << x;
+		}
+	}
+}
+
+TEST(CcmathExtTests, RsqrtSpecialValues)
+{
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	EXPECT_EQ(ccm::ext::rsqrt(0.0), inf);
+	EXPECT_EQ(ccm::ext::rsqrt(-0.0), -inf);
+	EXPECT_EQ(ccm::ext::rsqrt(inf), 0.0);
+	EXPECT_TRUE(std::isnan(ccm::ext::rsqrt(-1.0)));
+	EXPECT_TRUE(std::isnan(ccm::ext::rsqrt(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::ext::rsqrt(-inf)));
+
+	EXPECT_EQ(ccm::ext::rsqrt<rsqrt_precision::estimate>(0.0F), std::numeric_limits<float>::infinity());
+	EXPECT_EQ(ccm::ext::rsqrt<rsqrt_precision::newton>(0.0F), std::numeric_limits<float>::infinity());
+	EXPECT_EQ(ccm::ext::rsqrt<rsqrt_precision::newton>(inf), 0.0);
+	EXPECT_TRUE(std::isnan(ccm::ext::rsqrt<rsqrt_precision::newton>(-4.0F)));
+}
+
+TEST(CcmathExtTests, RsqrtFastTiersStayWithinBounds)
+{
+	for (float x = 1.0F; x < 4.0F; x += 0x1p-12F)
+	{
+		EXPECT_LE(relative_error(ccm::ext::rsqrt<rsqrt_precision::estimate>(x), x), estimate_bound<float>()) << std::hexfloat << x;
+		EXPECT_LE(relative_error(ccm::ext::rsqrt<rsqrt_precision::newton>(x), x), newton_bound<float>()) << std::hexfloat << x;
+	}
+	for (const double x : sample_inputs<double>(29))
+	{
+		EXPECT_LE(relative_error(ccm::ext::rsqrt<rsqrt_precision::estimate>(x), x), estimate_bound<double>()) << std::hexfloat << x;
+		EXPECT_LE(relative_error(ccm::ext::rsqrt<rsqrt_precision::newton>(x), x), newton_bound<double>()) << std::hexfloat << x;
+	}
+}
+
+TEST(CcmathExtTests, RsqrtSimdTiers)
+{
+	using V = ccm::intrin::simd<double, ccm::intrin::abi::native>;
+	using W = ccm::intrin::simd<float, ccm::intrin::abi::native>;
+
+	const auto doubles = sample_inputs<double>(31);
+	const auto floats  = sample_inputs<float>(37);
+	for (std::size_t base = 0; base + V::size() <= doubles.size(); base += V::size())
+	{
+		const V x(doubles.data() + base, ccm::intrin::element_aligned_tag());
+		std::array<double, V::size()> exact{};
+		std::array<double, V::size()> estimate{};
+		std::array<double, V::size()> newton{};
+		ccm::ext::rsqrt(x).copy_to(exact.data(), ccm::intrin::element_aligned_tag());
+		ccm::ext::rsqrt<rsqrt_precision::estimate>(x).copy_to(estimate.data(), ccm::intrin::element_aligned_tag());
+		ccm::ext::rsqrt<rsqrt_precision::newton>(x).copy_to(newton.data(), ccm::intrin::element_aligned_tag());
+		for (std::size_t i = 0; i < exact.size(); ++i)
+		{
+			const double input = doubles[base + i];
+			EXPECT_EQ(exact[i], ccm::ext::rsqrt(input)) << std::hexfloat << input;
+			EXPECT_LE(relative_error(estimate[i], input), estimate_bound<double>()) << std::hexfloat << input;
+			EXPECT_LE(relative_error(newton[i], input), newton_bound<double>()) << std::hexfloat << input;
+		}
+	}
+	for (std::size_t base = 0; base + W::size() <= floats.size(); base += W::size())
+	{
+		const W x(floats.data() + base, ccm::intrin::element_aligned_tag());
+		std::array<float, W::size()> exact{};
+		std::array<float, W::size()> estimate{};
+		std::array<float, W::size()> newton{};
+		ccm::ext::rsqrt(x).copy_to(exact.data(), ccm::intrin::element_aligned_tag());
+		ccm::ext::rsqrt<rsqrt_precision::estimate>(x).copy_to(estimate.data(), ccm::intrin::element_aligned_tag());
+		ccm::ext::rsqrt<rsqrt_precision::newton>(x).copy_to(newton.data(), ccm::intrin::element_aligned_tag());
+		for (std::size_t i = 0; i < exact.size(); ++i)
+		{
+			const float input = floats[base + i];
+			EXPECT_TRUE(is_correctly_rounded(input, exact[i])) << std::hexfloat << input;
+			EXPECT_LE(relative_error(estimate[i], input), estimate_bound<float>()) << std::hexfloat << input;
+			EXPECT_LE(relative_error(newton[i], input), newton_bound<float>()) << std::hexfloat << input;
+		}
+	}
+}
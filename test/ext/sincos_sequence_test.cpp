@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ext/sincos_sequence.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <vector>
+
+namespace
+{
+	// sin and cos of start + k * step, where the phase is formed exactly as hi + lo and lo is applied to first order.
+	void reference(double start, double step, std::size_t k, double & s, double & c)
+	{
+		const double offset	   = static_cast<double>(k) * step;
+		const double offset_lo = std::fma(static_cast<double>(k), step, -offset);
+		const double phase	   = start + offset;
+		const double offset_v  = phase - start;
+		const double phase_lo  = (start - (phase - offset_v)) + (offset - offset_v) + offset_lo;
+		s					   = std::sin(phase) + std::cos(phase) * phase_lo;
+		c					   = std::cos(phase) - std::sin(phase) * phase_lo;
+	}
+
+	using ccm::test::ulp_distance;
+
+	constexpr double sin_at(double start, double step, int k)
+	{
+		ccm::ext::sincos_sequence<double> sequence(start, step);
+		for (int i = 0; i < k; ++i) { ++sequence; }
+		return sequence.sin();
+	}
+} // namespace
+
+TEST(CcmathExtTests, SincosSequenceDouble)
+{
+	constexpr std::size_t count = 5000;
+	for (const double step : {1e-4, 0.01, 0.3, -1.0})
+	{
+		for (const double start : {0.0, 1.3, -100.0})
+		{
+			// The absolute error is bounded by the number of rotations between re-seeds.
+			const double bound = static_cast<double>(ccm::ext::sincos_sequence<double>::default_reseed_interval) * 3.0 * 0x1p-53;
+
+			ccm::ext::sincos_sequence<double> sequence(start, step);
+			std::vector<double> sin_out(count);
+			std::vector<double> cos_out(count);
+			ccm::ext::sincos_sequence<double>(start, step).generate(sin_out.data(), cos_out.data(), count);
+			for (std::size_t k = 0; k < count; ++k, ++sequence)
+			{
+				double s{};
+				double c{};
+				reference(start, step, k, s, c);
+				ASSERT_EQ(sequence.index(), k);
+				EXPECT_NEAR(sequence.sin(), s, bound) << "start " << start << " step " << step << " k " << k;
+				EXPECT_NEAR(sequence.cos(), c, bound) << "start " << start << " step " << step << " k " << k;
+				EXPECT_NEAR(sin_out[k], s, bound) << "start " << start << " step " << step << " k " << k;
+				EXPECT_NEAR(cos_out[k], c, bound) << "start " << start << " step " << step << " k " << k;
+			}
+		}
+	}
+}
+
+TEST(CcmathExtTests, SincosSequenceFloat)
+{
+	constexpr std::size_t count = 5000;
+	for (const float step : {1e-3F, 0.25F, 2.0F})
+	{
+		ccm::ext::sincos_sequence<float> sequence(0.5F, step);
+		std::vector<float> sin_out(count);
+		std::vector<float> cos_out(count);
+		ccm::ext::sincos_sequence<float>(0.5F, step).generate(sin_out.data(), cos_out.data(), count);
+		for (std::size_t k = 0; k < count; ++k, ++sequence)
+		{
+			double s{};
+			double c{};
+			reference(0.5, static_cast<double>(step), k, s, c);
+			EXPECT_LE(ulp_distance(sequence.sin(), static_cast<float>(s)), 1) << "step " << step << " k " << k;
+			EXPECT_LE(ulp_distance(sequence.cos(), static_cast<float>(c)), 1) << "step " << step << " k " << k;
+			EXPECT_LE(ulp_distance(sin_out[k], static_cast<float>(s)), 1) << "step " << step << " k " << k;
+			EXPECT_LE(ulp_distance(cos_out[k], static_cast<float>(c)), 1) << "step " << step << " k " << k;
+		}
+	}
+}
+
+TEST(CcmathExtTests, SincosSequenceGenerateContinues)
+{
+	// Chunks of any size continue where the previous one stopped, including after a scalar tail.
+	ccm::ext::sincos_sequence<double> chunked(0.25, 0.01, 16);
+	std::vector<double> sin_out(1000);
+	std::vector<double> cos_out(1000);
+	std::size_t done = 0;
+	for (const std::size_t chunk : {1, 3, 7, 64, 125, 800})
+	{
+		chunked.generate(sin_out.data() + done, cos_out.data() + done, chunk);
+		done += chunk;
+		EXPECT_EQ(chunked.index(), done);
+	}
+	for (std::size_t k = 0; k < done; ++k)
+	{
+		double s{};
+		double c{};
+		reference(0.25, 0.01, k, s, c);
+		EXPECT_NEAR(sin_out[k], s, 0x1p-48);
+		EXPECT_NEAR(cos_out[k], c, 0x1p-48);
+	}
+}
+
+TEST(CcmathExtTests, SincosSequenceCanBeEvaluatedAtCompileTime)
+{
+	static_assert(sin_at(0.0, 0.5, 0) == 0.0);
+	static_assert(sin_at(0.0, 0.5, 3) > 0.99749 && sin_at(0.0, 0.5, 3) < 0.9975);
+	EXPECT_NEAR(sin_at(0.0, 0.5, 3), std::sin(1.5), 1e-15);
+}
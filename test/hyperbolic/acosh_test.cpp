@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using ccm::test::has_wide_long_double;
+using ccm::test::input_signs;
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
+using ccm::test::worst_ulp_error;
+
+TEST(CcmathHyperbolicTests, Acosh)
+{
+	for (const double x : make_inputs<double>(0, 1023, 64))
+	{
+		if (x > 0.0) { EXPECT_LE(ulp_distance(ccm::acosh(x), std::acosh(x)), 1) << "input: " << x; }
+	}
+	for (const float x : make_inputs<float>(0, 127, 64))
+	{
+		if (x > 0.0F) { EXPECT_LE(ulp_distance(ccm::acoshf(x), std::acosh(x)), 1) << "input: " << x; }
+	}
+
+	// Just above 1, where acosh(1 + t) ~= sqrt(2t). The standard libraries are up to 2 ULP off here.
+	for (int e = -52; e < 0; ++e)
+	{
+		const double x = 1.0 + std::ldexp(1.37, e);
+		EXPECT_LE(ulp_distance(ccm::acosh(x), std::acosh(x)), 2) << "input: " << x;
+	}
+
+	for (const double x : {1.0, 1.9999999999999998, 2.0, 0x1p28, 0x1.fffffffffffffp27})
+	{
+		EXPECT_LE(ulp_distance(ccm::acosh(x), std::acosh(x)), 1) << "input: " << x;
+	}
+}
+
+TEST(CcmathHyperbolicTests, AcoshIsWithinOneUlpOfLongDouble)
+{
+	if (!has_wide_long_double) { GTEST_SKIP() << "long double is no wider than double"; }
+	// Just above 1, where acosh(1 + t) ~= sqrt(2t), and over the log1p, log and large ranges.
+	std::vector<double> inputs;
+	for (const double t : make_inputs<double>(-52, -1, 256, input_signs::positive)) { inputs.push_back(1.0 + t); }
+	for (const double x : make_inputs<double>(0, 30, 1024, input_signs::positive)) { inputs.push_back(x); }
+	const auto [error, input] = worst_ulp_error(inputs, [](double x) { return ccm::acosh(x); }, [](long double x) { return std::acosh(x); });
+	EXPECT_LT(error, 1.0) << "input: " << input;
+}
+
+TEST(CcmathHyperbolicTests, AcoshSpecialValues)
+{
+	EXPECT_EQ(ccm::acosh(1.0), 0.0);
+	EXPECT_FALSE(std::signbit(ccm::acosh(1.0)));
+	EXPECT_TRUE(std::isnan(ccm::acosh(0.5)));
+	EXPECT_TRUE(std::isnan(ccm::acosh(0.0)));
+	EXPECT_TRUE(std::isnan(ccm::acosh(-1.0)));
+	EXPECT_TRUE(std::isnan(ccm::acosh(-std::numeric_limits<double>::infinity())));
+	EXPECT_EQ(ccm::acosh(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::acosh(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_LE(ulp_distance(ccm::acosh(std::numeric_limits<double>::max()), std::acosh(std::numeric_limits<double>::max())), 1);
+	EXPECT_TRUE(std::isnan(ccm::acoshf(0.0F)));
+	EXPECT_EQ(ccm::acoshf(std::numeric_limits<float>::infinity()), std::numeric_limits<float>::infinity());
+	EXPECT_LE(ulp_distance(ccm::acosh(3), std::acosh(3.0)), 1);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::acoshl(2.5L)), std::acosh(2.5)), 1);
+}
+
+TEST(CcmathHyperbolicTests, AcoshCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::acosh(1.0) == 0.0);
+	static_assert(ccm::acosh(2.0) > 1.316957896 && ccm::acosh(2.0) < 1.316957897);
+	static_assert(ccm::acosh(1e10) > 23.718998110 && ccm::acosh(1e10) < 23.718998111);
+	static_assert(ccm::acoshf(1.5F) > 0.9624F && ccm::acoshf(1.5F) < 0.9625F);
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using ccm::test::has_wide_long_double;
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
+using ccm::test::worst_ulp_error;
+
+TEST(CcmathHyperbolicTests, Asinh)
+{
+	for (const double x : make_inputs<double>(-40, 1023, 64)) { EXPECT_LE(ulp_distance(ccm::asinh(x), std::asinh(x)), 1) << "input: " << x; }
+	for (const float x : make_inputs<float>(-20, 127, 64)) { EXPECT_LE(ulp_distance(ccm::asinhf(x), std::asinh(x)), 1) << "input: " << x; }
+
+	// Around the edges of the log1p, log and large ranges.
+	for (const double x : {0x1p-27, 0x1.fffffffffffffp-28, 1.9999999999999998, 2.0, -2.0, 0x1p28, 0x1.fffffffffffffp27})
+	{
+		EXPECT_LE(ulp_distance(ccm::asinh(x), std::asinh(x)), 1) << "input: " << x;
+	}
+}
+
+TEST(CcmathHyperbolicTests, AsinhIsWithinOneUlpOfLongDouble)
+{
+	if (!has_wide_long_double) { GTEST_SKIP() << "long double is no wider than double"; }
+	const auto [error, input] = worst_ulp_error(make_inputs<double>(-30, 30, 1024), [](double x) { return ccm::asinh(x); },
+												[](long double x) { return std::asinh(x); });
+	EXPECT_LT(error, 1.0) << "input: " << input;
+}
+
+TEST(CcmathHyperbolicTests, AsinhSpecialValues)
+{
+	EXPECT_EQ(ccm::asinh(0.0), 0.0);
+	EXPECT_TRUE(std::signbit(ccm::asinh(-0.0)));
+	EXPECT_TRUE(std::signbit(ccm::asinhf(-0.0F)));
+	EXPECT_EQ(ccm::asinh(1e-300), 1e-300);
+	EXPECT_EQ(ccm::asinh(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::asinh(-std::numeric_limits<double>::infinity()), -std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::asinh(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_LE(ulp_distance(ccm::asinh(std::numeric_limits<double>::max()), std::asinh(std::numeric_limits<double>::max())), 1);
+	EXPECT_EQ(ccm::asinhf(std::numeric_limits<float>::infinity()), std::numeric_limits<float>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::asinhf(std::numeric_limits<float>::quiet_NaN())));
+	EXPECT_LE(ulp_distance(ccm::asinh(3), std::asinh(3.0)), 1);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::asinhl(1.0L)), std::asinh(1.0)), 1);
+}
+
+TEST(CcmathHyperbolicTests, AsinhCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::asinh(0.0) == 0.0);
+	static_assert(ccm::asinh(1.0) > 0.881373587 && ccm::asinh(1.0) < 0.881373588);
+	static_assert(ccm::asinh(-1e10) < -23.718998110 && ccm::asinh(-1e10) > -23.718998111);
+	static_assert(ccm::asinhf(0.5F) > 0.4812F && ccm::asinhf(0.5F) < 0.4813F);
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using ccm::test::has_wide_long_double;
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
+using ccm::test::worst_ulp_error;
+
+TEST(CcmathHyperbolicTests, Atanh)
+{
+	for (const double x : make_inputs<double>(-40, -1, 64)) { EXPECT_LE(ulp_distance(ccm::atanh(x), std::atanh(x)), 1) << "input: " << x; }
+	for (const float x : make_inputs<float>(-20, -1, 64)) { EXPECT_LE(ulp_distance(ccm::atanhf(x), std::atanh(x)), 1) << "input: " << x; }
+
+	// Around 1/2, where the two log1p forms meet, and up to the pole at 1.
+	for (int e = -52; e < 0; ++e)
+	{
+		const double x = 1.0 - std::ldexp(1.37, e);
+		EXPECT_LE(ulp_distance(ccm::atanh(x), std::atanh(x)), 1) << "input: " << x;
+		EXPECT_LE(ulp_distance(ccm::atanh(-x), std::atanh(-x)), 1) << "input: " << -x;
+	}
+	for (const double x : {0x1p-27, 0x1.fffffffffffffp-28, 0.5, 0.49999999999999994, 0.9999999999999999})
+	{
+		EXPECT_LE(ulp_distance(ccm::atanh(x), std::atanh(x)), 1) << "input: " << x;
+	}
+}
+
+TEST(CcmathHyperbolicTests, AtanhIsWithinOneUlpOfLongDouble)
+{
+	if (!has_wide_long_double) { GTEST_SKIP() << "long double is no wider than double"; }
+	const auto [error, input] = worst_ulp_error(make_inputs<double>(-30, -1, 1024), [](double x) { return ccm::atanh(x); },
+												[](long double x) { return std::atanh(x); });
+	EXPECT_LT(error, 1.0) << "input: " << input;
+}
+
+TEST(CcmathHyperbolicTests, AtanhSpecialValues)
+{
+	EXPECT_EQ(ccm::atanh(0.0), 0.0);
+	EXPECT_TRUE(std::signbit(ccm::atanh(-0.0)));
+	EXPECT_TRUE(std::signbit(ccm::atanhf(-0.0F)));
+	EXPECT_EQ(ccm::atanh(1e-300), 1e-300);
+	EXPECT_EQ(ccm::atanh(1.0), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::atanh(-1.0), -std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::atanh(1.5)));
+	EXPECT_TRUE(std::isnan(ccm::atanh(-std::numeric_limits<double>::infinity())));
+	EXPECT_TRUE(std::isnan(ccm::atanh(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::atanhf(1.0F), std::numeric_limits<float>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::atanhf(2.0F)));
+	EXPECT_EQ(ccm::atanh(0), 0.0);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::atanhl(0.5L)), std::atanh(0.5)), 1);
+}
+
+TEST(CcmathHyperbolicTests, AtanhCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::atanh(0.0) == 0.0);
+	static_assert(ccm::atanh(1.0) == std::numeric_limits<double>::infinity());
+	static_assert(ccm::atanh(0.5) > 0.549306144 && ccm::atanh(0.5) < 0.549306145);
+	static_assert(ccm::atanh(-0.9) < -1.472219489 && ccm::atanh(-0.9) > -1.472219490);
+	static_assert(ccm::atanhf(0.25F) > 0.2554F && ccm::atanhf(0.25F) < 0.2555F);
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/batch.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+	using ccm::test::expect_batch_matches;
+	using ccm::test::for_each_runnable_simd_level;
+	using ccm::test::make_range;
+	using ccm::test::ulp_distance;
+
+	template <typename T, typename Batch>
+	void expect_batch_sinhcosh_matches(const std::vector<T> & in, Batch batch)
+	{
+		std::vector<T> sinh_out(in.size());
+		std::vector<T> cosh_out(in.size());
+		batch(in.data(), sinh_out.data(), cosh_out.data(), in.size());
+		for (std::size_t i = 0; i < in.size(); ++i)
+		{
+			EXPECT_LE(ulp_distance(sinh_out[i], static_cast<T>(std::sinh(in[i]))), 1) << "input: " << in[i];
+			EXPECT_LE(ulp_distance(cosh_out[i], static_cast<T>(std::cosh(in[i]))), 1) << "input: " << in[i];
+		}
+	}
+
+	template <typename T>
+	std::vector<T> special_values()
+	{
+		// Zeros, tiny values, values past the exponential range and non-finite values are routed to the scalar kernel.
+		return {T(0.0),
+				T(-0.0),
+				T(1e-30),
+				T(-1e-9),
+				T(0.55),
+				T(1.0),
+				T(-22.0),
+				T(80.0),
+				std::numeric_limits<T>::max(),
+				std::numeric_limits<T>::infinity(),
+				-std::numeric_limits<T>::infinity(),
+				std::numeric_limits<T>::quiet_NaN()};
+	}
+} // namespace
+
+TEST(CcmathHyperbolicTests, BatchSinh)
+{
+	// Use an odd count so the scalar tail is exercised for every SIMD width.
+	expect_batch_matches(make_range(-30.0, 30.0, 1001), [](auto... a) { ccm::batch::sinh(a...); }, [](double x) { return std::sinh(x); });
+	expect_batch_matches(make_range(-2.0, 2.0, 1001), [](auto... a) { ccm::batch::sinh(a...); }, [](double x) { return std::sinh(x); });
+	expect_batch_matches(make_range(-30.0F, 30.0F, 1001), [](auto... a) { ccm::batch::sinh(a...); }, [](float x) { return std::sinh(x); });
+	expect_batch_matches(special_values<double>(), [](auto... a) { ccm::batch::sinh(a...); }, [](double x) { return std::sinh(x); });
+	expect_batch_matches(special_values<float>(), [](auto... a) { ccm::batch::sinh(a...); }, [](float x) { return std::sinh(x); });
+}
+
+TEST(CcmathHyperbolicTests, BatchCosh)
+{
+	expect_batch_matches(make_range(-30.0, 30.0, 1001), [](auto... a) { ccm::batch::cosh(a...); }, [](double x) { return std::cosh(x); });
+	expect_batch_matches(make_range(-2.0, 2.0, 1001), [](auto... a) { ccm::batch::cosh(a...); }, [](double x) { return std::cosh(x); });
+	expect_batch_matches(make_range(-30.0F, 30.0F, 1001), [](auto... a) { ccm::batch::cosh(a...); }, [](float x) { return std::cosh(x); });
+	expect_batch_matches(special_values<double>(), [](auto... a) { ccm::batch::cosh(a...); }, [](double x) { return std::cosh(x); });
+}
+
+TEST(CcmathHyperbolicTests, BatchTanh)
+{
+	// Some standard libraries are up to 2 ULP off below 1 themselves.
+	expect_batch_matches(make_range(-25.0, 25.0, 1001), [](auto... a) { ccm::batch::tanh(a...); }, [](double x) { return std::tanh(x); }, 2);
+	expect_batch_matches(make_range(-1.0, 1.0, 1001), [](auto... a) { ccm::batch::tanh(a...); }, [](double x) { return std::tanh(x); }, 2);
+	expect_batch_matches(make_range(-10.0F, 10.0F, 1001), [](auto... a) { ccm::batch::tanh(a...); }, [](float x) { return std::tanh(x); });
+	expect_batch_matches(special_values<double>(), [](auto... a) { ccm::batch::tanh(a...); }, [](double x) { return std::tanh(x); });
+	expect_batch_matches(special_values<float>(), [](auto... a) { ccm::batch::tanh(a...); }, [](float x) { return std::tanh(x); });
+}
+
+TEST(CcmathHyperbolicTests, BatchSinhcosh)
+{
+	expect_batch_sinhcosh_matches(make_range(-30.0, 30.0, 1001), [](auto... a) { ccm::batch::sinhcosh(a...); });
+	expect_batch_sinhcosh_matches(make_range(-30.0F, 30.0F, 1001), [](auto... a) { ccm::batch::sinhcosh(a...); });
+	expect_batch_sinhcosh_matches(special_values<double>(), [](auto... a) { ccm::batch::sinhcosh(a...); });
+
+	// The input array may double as one of the outputs.
+	std::vector<double> values = make_range(-10.0, 10.0, 101);
+	std::vector<double> cosh_out(values.size());
+	const std::vector<double> in = values;
+	ccm::batch::sinhcosh(values.data(), values.data(), cosh_out.data(), values.size());
+	for (std::size_t i = 0; i < in.size(); ++i) { EXPECT_LE(ulp_distance(values[i], std::sinh(in[i])), 1) << "input: " << in[i]; }
+}
+
+TEST(CcmathHyperbolicTests, BatchEveryDispatchTier)
+{
+	for_each_runnable_simd_level([](ccm::rt::simd_level level) {
+		using namespace ccm::rt::simd_impl;
+		if (auto * fn = batch_kernel_for<sinh_batch_kernel, double>(level))
+		{
+			expect_batch_matches(make_range(-30.0, 30.0, 1001), fn, [](double x) { return std::sinh(x); });
+		}
+		if (auto * fn = batch_kernel_for<cosh_batch_kernel, float>(level))
+		{
+			expect_batch_matches(make_range(-30.0F, 30.0F, 1001), fn, [](float x) { return std::cosh(x); });
+		}
+		if (auto * fn = batch_kernel_for<tanh_batch_kernel, double>(level))
+		{
+			expect_batch_matches(make_range(-25.0, 25.0, 1001), fn, [](double x) { return std::tanh(x); }, 2);
+		}
+		if (auto * fn = batch_pair_kernel_for<sinhcosh_batch_kernel, double>(level)) { expect_batch_sinhcosh_matches(make_range(-30.0, 30.0, 1001), fn); }
+	});
+}
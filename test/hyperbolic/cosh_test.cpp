@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
+
+TEST(CcmathHyperbolicTests, Cosh)
+{
+	for (const double x : make_inputs<double>(-40, 9, 64)) { EXPECT_LE(ulp_distance(ccm::cosh(x), std::cosh(x)), 1) << "input: " << x; }
+	for (const float x : make_inputs<float>(-20, 6, 64)) { EXPECT_LE(ulp_distance(ccm::coshf(x), std::cosh(x)), 1) << "input: " << x; }
+
+	// Around the edges of the Taylor, exponential and overflow ranges.
+	for (const double x : {0x1p-27, 0.55, 0.54999999999999993, 21.999999999999996, 22.0, 709.78, 710.47, -710.47})
+	{
+		EXPECT_LE(ulp_distance(ccm::cosh(x), std::cosh(x)), 1) << "input: " << x;
+	}
+}
+
+TEST(CcmathHyperbolicTests, CoshSpecialValues)
+{
+	EXPECT_EQ(ccm::cosh(0.0), 1.0);
+	EXPECT_EQ(ccm::cosh(-0.0), 1.0);
+	EXPECT_EQ(ccm::coshf(-0.0F), 1.0F);
+	EXPECT_EQ(ccm::cosh(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::cosh(-std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::cosh(-711.0), std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::cosh(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::coshf(-100.0F), std::numeric_limits<float>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::coshf(std::numeric_limits<float>::quiet_NaN())));
+	EXPECT_LE(ulp_distance(ccm::cosh(2), std::cosh(2.0)), 1);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::coshl(1.0L)), std::cosh(1.0)), 1);
+}
+
+TEST(CcmathHyperbolicTests, CoshCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::cosh(0.0) == 1.0);
+	static_assert(ccm::cosh(1.0) > 1.543080634 && ccm::cosh(1.0) < 1.543080635);
+	static_assert(ccm::cosh(-0.25) > 1.031413099 && ccm::cosh(-0.25) < 1.031413100);
+	static_assert(ccm::coshf(3.0F) > 10.067F && ccm::coshf(3.0F) < 10.068F);
+}
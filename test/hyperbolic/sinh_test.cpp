@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
+
+TEST(CcmathHyperbolicTests, Sinh)
+{
+	// Inputs past 2^9 only overflow, and the small ones cover the Taylor path.
+	for (const double x : make_inputs<double>(-40, 9, 64)) { EXPECT_LE(ulp_distance(ccm::sinh(x), std::sinh(x)), 1) << "input: " << x; }
+	for (const float x : make_inputs<float>(-20, 6, 64)) { EXPECT_LE(ulp_distance(ccm::sinhf(x), std::sinh(x)), 1) << "input: " << x; }
+
+	// Around the edges of the Taylor, exponential and overflow ranges.
+	for (const double x : {0x1p-27, 0x1.fffffffffffffp-28, 0x1.fffffffffffffp-1, 1.0, 21.999999999999996, 22.0, 709.78, 710.47, -710.47})
+	{
+		EXPECT_LE(ulp_distance(ccm::sinh(x), std::sinh(x)), 1) << "input: " << x;
+	}
+}
+
+TEST(CcmathHyperbolicTests, SinhSpecialValues)
+{
+	EXPECT_EQ(ccm::sinh(0.0), 0.0);
+	EXPECT_TRUE(std::signbit(ccm::sinh(-0.0)));
+	EXPECT_TRUE(std::signbit(ccm::sinhf(-0.0F)));
+	EXPECT_EQ(ccm::sinh(1e-300), 1e-300);
+	EXPECT_EQ(ccm::sinh(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::sinh(-std::numeric_limits<double>::infinity()), -std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::sinh(711.0), std::numeric_limits<double>::infinity());
+	EXPECT_EQ(ccm::sinh(-711.0), -std::numeric_limits<double>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::sinh(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::sinhf(100.0F), std::numeric_limits<float>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::sinhf(std::numeric_limits<float>::quiet_NaN())));
+	EXPECT_LE(ulp_distance(ccm::sinh(2), std::sinh(2.0)), 1);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::sinhl(1.0L)), std::sinh(1.0)), 1);
+}
+
+TEST(CcmathHyperbolicTests, SinhCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::sinh(0.0) == 0.0);
+	static_assert(ccm::sinh(1e-300) == 1e-300);
+	static_assert(ccm::sinh(1.0) > 1.175201193 && ccm::sinh(1.0) < 1.175201194);
+	static_assert(ccm::sinh(-30.0) < -5.343237290e12 && ccm::sinh(-30.0) > -5.343237291e12);
+	static_assert(ccm::sinhf(0.5F) > 0.5210F && ccm::sinhf(0.5F) < 0.5211F);
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
+
+TEST(CcmathHyperbolicTests, SinhcoshMatchesSinhAndCosh)
+{
+	// sinhcosh shares the exponential, so its results are the same as the separate calls bit for bit.
+	for (const double x : make_inputs<double>(-40, 10, 64))
+	{
+		double s{};
+		double c{};
+		ccm::sinhcosh(x, &s, &c);
+		EXPECT_EQ(ulp_distance(s, ccm::sinh(x)), 0) << "input: " << x;
+		EXPECT_EQ(ulp_distance(c, ccm::cosh(x)), 0) << "input: " << x;
+	}
+	for (const float x : make_inputs<float>(-20, 7, 64))
+	{
+		float s{};
+		float c{};
+		ccm::sinhcoshf(x, &s, &c);
+		EXPECT_EQ(ulp_distance(s, ccm::sinhf(x)), 0) << "input: " << x;
+		EXPECT_EQ(ulp_distance(c, ccm::coshf(x)), 0) << "input: " << x;
+	}
+
+	double s{};
+	double c{};
+	ccm::sinhcosh(-std::numeric_limits<double>::infinity(), &s, &c);
+	EXPECT_EQ(s, -std::numeric_limits<double>::infinity());
+	EXPECT_EQ(c, std::numeric_limits<double>::infinity());
+	ccm::sinhcosh(std::numeric_limits<double>::quiet_NaN(), &s, &c);
+	EXPECT_TRUE(std::isnan(s));
+	EXPECT_TRUE(std::isnan(c));
+	ccm::sinhcosh(-0.0, &s, &c);
+	EXPECT_TRUE(std::signbit(s));
+	EXPECT_EQ(c, 1.0);
+}
+
+namespace
+{
+	constexpr double sinhcosh_difference(double x)
+	{
+		double s{};
+		double c{};
+		ccm::sinhcosh(x, &s, &c);
+		return c * c - s * s;
+	}
+} // namespace
+
+TEST(CcmathHyperbolicTests, SinhcoshCanBeEvaluatedAtCompileTime)
+{
+	static_assert(sinhcosh_difference(0.0) == 1.0);
+	static_assert(sinhcosh_difference(3.0) > 0.9999999 && sinhcosh_difference(3.0) < 1.0000001);
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using ccm::test::has_wide_long_double;
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
+using ccm::test::worst_ulp_error;
+
+TEST(CcmathHyperbolicTests, Tanh)
+{
+	// tanh rounds to +-1 well before 2^5. Some standard libraries are up to 2 ULP off below 1 themselves.
+	for (const double x : make_inputs<double>(-40, 5, 64)) { EXPECT_LE(ulp_distance(ccm::tanh(x), std::tanh(x)), 2) << "input: " << x; }
+	for (const float x : make_inputs<float>(-20, 4, 64)) { EXPECT_LE(ulp_distance(ccm::tanhf(x), std::tanh(x)), 1) << "input: " << x; }
+
+	// Around the edges of the polynomial, exponential and saturated ranges.
+	for (const double x : {0x1p-27, 0.55, 0.54999999999999993, -0.55, 19.0, 21.999999999999996, 22.0})
+	{
+		EXPECT_LE(ulp_distance(ccm::tanh(x), std::tanh(x)), 1) << "input: " << x;
+	}
+}
+
+TEST(CcmathHyperbolicTests, TanhIsWithinOneUlpOfLongDouble)
+{
+	if (!has_wide_long_double) { GTEST_SKIP() << "long double is no wider than double"; }
+	// Densely below the switch from the Taylor quotient to the exp form at 0.55, where the quotient is hardest to round.
+	std::vector<double> inputs = make_inputs<double>(-30, 4, 1024);
+	for (int i = 0; i < (1 << 16); ++i) { inputs.push_back(0.5 + 0.05 * i / (1 << 16)); }
+	const auto [error, input] = worst_ulp_error(inputs, [](double x) { return ccm::tanh(x); }, [](long double x) { return std::tanh(x); });
+	EXPECT_LT(error, 1.0) << "input: " << input;
+}
+
+TEST(CcmathHyperbolicTests, TanhSpecialValues)
+{
+	EXPECT_EQ(ccm::tanh(0.0), 0.0);
+	EXPECT_TRUE(std::signbit(ccm::tanh(-0.0)));
+	EXPECT_TRUE(std::signbit(ccm::tanhf(-0.0F)));
+	EXPECT_EQ(ccm::tanh(1e-300), 1e-300);
+	EXPECT_EQ(ccm::tanh(std::numeric_limits<double>::infinity()), 1.0);
+	EXPECT_EQ(ccm::tanh(-std::numeric_limits<double>::infinity()), -1.0);
+	EXPECT_EQ(ccm::tanh(1e300), 1.0);
+	EXPECT_TRUE(std::isnan(ccm::tanh(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_EQ(ccm::tanhf(-std::numeric_limits<float>::infinity()), -1.0F);
+	EXPECT_TRUE(std::isnan(ccm::tanhf(std::numeric_limits<float>::quiet_NaN())));
+	EXPECT_LE(ulp_distance(ccm::tanh(1), std::tanh(1.0)), 1);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::tanhl(0.5L)), std::tanh(0.5)), 1);
+}
+
+TEST(CcmathHyperbolicTests, TanhCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::tanh(0.0) == 0.0);
+	static_assert(ccm::tanh(100.0) == 1.0);
+	static_assert(ccm::tanh(0.5) > 0.462117157 && ccm::tanh(0.5) < 0.462117158);
+	static_assert(ccm::tanh(-2.0) < -0.964027580 && ccm::tanh(-2.0) > -0.964027581);
+	static_assert(ccm::tanhf(1.0F) > 0.7615F && ccm::tanhf(1.0F) < 0.7616F);
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/internal/config/arch/check_simd_support.hpp"
+#include "ccmath/internal/config/runtime_detection.hpp"
+
+TEST(CcmathInternalConfigTests, RuntimeDetectionCoversCompileTimeTarget)
+{
+	// The binary is running, so everything the compiler was allowed to emit must be reported as available.
+	const auto features = ccm::rt::host_cpu_features();
+	if (!ccm::rt::has_runtime_detection) { GTEST_SKIP() << "No runtime detection for this architecture."; }
+
+#if defined(CCMATH_HAS_SIMD_SSE2)
+	EXPECT_TRUE(features.sse2);
+#endif
+#if defined(CCMATH_HAS_SIMD_SSE4)
+	EXPECT_TRUE(features.sse4_1);
+	EXPECT_TRUE(features.sse4_2);
+#endif
+#if defined(CCMATH_HAS_SIMD_AVX)
+	EXPECT_TRUE(features.avx);
+#endif
+#if defined(CCMATH_HAS_SIMD_AVX2)
+	EXPECT_TRUE(features.avx2);
+#endif
+#if defined(CCMATH_HAS_SIMD_AVX512F)
+	EXPECT_TRUE(features.avx512f);
+#endif
+#if defined(CCMATH_HAS_SIMD_NEON)
+	EXPECT_TRUE(features.neon);
+#endif
+	(void)features;
+}
+
+TEST(CcmathInternalConfigTests, RuntimeDetectionLevelsAreNested)
+{
+	ccm::rt::cpu_features features{};
+	EXPECT_EQ(ccm::rt::highest_simd_level(features), ccm::rt::simd_level::scalar);
+
+	features.sse2 = true;
+	EXPECT_EQ(ccm::rt::highest_simd_level(features), ccm::rt::simd_level::sse2);
+
+	// AVX2 without FMA is not enough for the avx2 level, and AVX-512 requires every lower level.
+	features.avx2	  = true;
+	features.avx512f  = true;
+	features.avx512dq = true;
+	features.avx512vl = true;
+	features.avx512bw = true;
+	EXPECT_EQ(ccm::rt::highest_simd_level(features), ccm::rt::simd_level::sse2);
+
+	features.sse3	= true;
+	features.ssse3	= true;
+	features.sse4_1 = true;
+	features.sse4_2 = true;
+	features.avx	= true;
+	EXPECT_EQ(ccm::rt::highest_simd_level(features), ccm::rt::simd_level::avx);
+
+	features.fma = true;
+	EXPECT_EQ(ccm::rt::highest_simd_level(features), ccm::rt::simd_level::avx512);
+
+	ccm::rt::cpu_features arm{};
+	arm.neon = true;
+	EXPECT_EQ(ccm::rt::highest_simd_level(arm), ccm::rt::simd_level::neon);
+	arm.sve = true;
+	EXPECT_EQ(ccm::rt::highest_simd_level(arm), ccm::rt::simd_level::sve);
+}
+
+TEST(CcmathInternalConfigTests, RuntimeDetectionParsesForcedAbi)
+{
+	ccm::rt::simd_level level = ccm::rt::simd_level::scalar;
+	EXPECT_TRUE(ccm::rt::detail::parse_simd_level("avx2", level));
+	EXPECT_EQ(level, ccm::rt::simd_level::avx2);
+	EXPECT_TRUE(ccm::rt::detail::parse_simd_level("neon", level));
+	EXPECT_EQ(level, ccm::rt::simd_level::neon);
+	EXPECT_FALSE(ccm::rt::detail::parse_simd_level("AVX2", level));
+	EXPECT_FALSE(ccm::rt::detail::parse_simd_level("", level));
+	EXPECT_FALSE(ccm::rt::detail::parse_simd_level(nullptr, level));
+	EXPECT_EQ(level, ccm::rt::simd_level::neon);
+
+	// Whatever was forced, the active level is always one the host can run.
+	EXPECT_TRUE(ccm::rt::supports_simd_level(ccm::rt::host_cpu_features(), ccm::rt::active_simd_level()));
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "ccmath/math/exponential/impl/exp_data.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+	using ccm::intrin::element_aligned_tag;
+	using ccm::intrin::simd;
+
+	template <class T, class Index, class Abi, std::size_t Size>
+	void check_gather(std::array<T, Size> const & table)
+	{
+		using V			 = simd<T, Abi>;
+		using IndexV	 = simd<Index, Abi>;
+		constexpr int n	 = V::size();
+
+		// Reversed, repeated and strided indices, so every lane reads a different position than its neighbours.
+		for (std::size_t start = 0; start < Size; start += 7)
+		{
+			std::array<Index, n> indices{};
+			for (int i = 0; i < n; ++i) { indices[i] = static_cast<Index>((start + static_cast<std::size_t>((n - i) * 13) + (i % 2 == 0 ? 0 : 5)) % Size); }
+			const IndexV index(indices.data(), element_aligned_tag());
+
+			std::array<T, n> lanes{};
+			ccm::intrin::gather(table.data(), index).copy_to(lanes.data(), element_aligned_tag());
+			for (int i = 0; i < n; ++i) { EXPECT_EQ(lanes[i], table[static_cast<std::size_t>(indices[i])]); }
+		}
+	}
+
+	template <class Abi>
+	void check_all_gathers()
+	{
+		std::array<double, 97> doubles{};
+		std::array<float, 97> floats{};
+		std::array<std::int32_t, 97> ints{};
+		for (std::size_t i = 0; i < doubles.size(); ++i)
+		{
+			doubles[i] = 1.0 / static_cast<double>(i + 1);
+			floats[i]  = static_cast<float>(i) * -0.5F;
+			ints[i]	   = static_cast<std::int32_t>(i * i) - 1000;
+		}
+
+		check_gather<double, std::int64_t, Abi>(doubles);
+		check_gather<double, std::uint64_t, Abi>(doubles);
+		check_gather<float, std::int32_t, Abi>(floats);
+		check_gather<float, std::uint32_t, Abi>(floats);
+		check_gather<std::int32_t, std::int32_t, Abi>(ints);
+		check_gather<std::uint64_t, std::uint64_t, Abi>(ccm::internal::exp_data<double>::tab);
+	}
+} // namespace
+
+TEST(CcmathInternalSimdTests, GatherScalar)
+{
+	check_all_gathers<ccm::intrin::abi::scalar>();
+}
+
+TEST(CcmathInternalSimdTests, GatherPack)
+{
+	check_all_gathers<ccm::intrin::abi::pack<4>>();
+}
+
+TEST(CcmathInternalSimdTests, GatherNative)
+{
+	check_all_gathers<ccm::intrin::abi::native>();
+}
+
+#ifdef CCMATH_HAS_SIMD_SSE2
+TEST(CcmathInternalSimdTests, GatherSse2)
+{
+	check_all_gathers<ccm::intrin::abi::sse2>();
+}
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX2
+TEST(CcmathInternalSimdTests, GatherAvx2)
+{
+	check_all_gathers<ccm::intrin::abi::avx2>();
+}
+#endif
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace
+{
+	using ccm::intrin::element_aligned_tag;
+	using ccm::intrin::simd;
+
+	template <class T>
+	std::array<T, 12> interesting_values()
+	{
+		return {T{0},
+				T{1},
+				T{2},
+				static_cast<T>(-1),
+				static_cast<T>(-2),
+				std::numeric_limits<T>::max(),
+				std::numeric_limits<T>::min(),
+				static_cast<T>(std::numeric_limits<T>::max() - 1),
+				static_cast<T>(std::numeric_limits<T>::min() + 1),
+				static_cast<T>(0x12345678),
+				static_cast<T>(~T{0x0F0F}),
+				static_cast<T>(std::numeric_limits<T>::max() / 3)};
+	}
+
+	template <class V>
+	std::array<typename V::value_type, V::size()> lanes_of(V const & v)
+	{
+		std::array<typename V::value_type, V::size()> lanes{};
+		v.copy_to(lanes.data(), element_aligned_tag());
+		return lanes;
+	}
+
+	template <class V>
+	std::array<bool, V::size()> lanes_of_mask(typename V::mask_type const & m)
+	{
+		using T								  = typename V::value_type;
+		const std::array<T, V::size()> chosen = lanes_of(choose(m, V(T{1}), V(T{0})));
+		std::array<bool, V::size()> lanes{};
+		for (int i = 0; i < V::size(); ++i) { lanes[i] = chosen[i] != 0; }
+		return lanes;
+	}
+
+	template <class T, class Abi>
+	void check_integer_lanes()
+	{
+		using V			 = simd<T, Abi>;
+		using U			 = std::make_unsigned_t<T>;
+		constexpr int n	 = V::size();
+		const auto values = interesting_values<T>();
+
+		// Slide a window over the values so every pair ends up in every lane.
+		for (std::size_t offset = 0; offset < values.size(); ++offset)
+		{
+			std::array<T, n> a{};
+			std::array<T, n> b{};
+			for (int i = 0; i < n; ++i)
+			{
+				a[i] = values[(offset + static_cast<std::size_t>(i)) % values.size()];
+				b[i] = values[(offset * 5 + static_cast<std::size_t>(i) * 7 + 3) % values.size()];
+			}
+			const V va(a.data(), element_aligned_tag());
+			const V vb(b.data(), element_aligned_tag());
+
+			const auto sum		  = lanes_of(va + vb);
+			const auto difference = lanes_of(va - vb);
+			const auto negated	  = lanes_of(-va);
+			const auto conj		  = lanes_of(va & vb);
+			const auto disj		  = lanes_of(va | vb);
+			const auto exclusive  = lanes_of(va ^ vb);
+			const auto inverted	  = lanes_of(~va);
+			const auto shifted_l  = lanes_of(va << 3);
+			const auto shifted_r  = lanes_of(va >> 3);
+			const auto shifted_31 = lanes_of(va >> 31);
+			const auto less		  = lanes_of_mask<V>(va < vb);
+			const auto equal	  = lanes_of_mask<V>(va == vb);
+			const auto chosen	  = lanes_of(choose(va < vb, va, vb));
+
+			for (int i = 0; i < n; ++i)
+			{
+				EXPECT_EQ(sum[i], static_cast<T>(static_cast<U>(a[i]) + static_cast<U>(b[i])));
+				EXPECT_EQ(difference[i], static_cast<T>(static_cast<U>(a[i]) - static_cast<U>(b[i])));
+				EXPECT_EQ(negated[i], static_cast<T>(U{0} - static_cast<U>(a[i])));
+				EXPECT_EQ(conj[i], static_cast<T>(a[i] & b[i]));
+				EXPECT_EQ(disj[i], static_cast<T>(a[i] | b[i]));
+				EXPECT_EQ(exclusive[i], static_cast<T>(a[i] ^ b[i]));
+				EXPECT_EQ(inverted[i], static_cast<T>(~a[i]));
+				EXPECT_EQ(shifted_l[i], static_cast<T>(static_cast<U>(a[i]) << 3));
+				EXPECT_EQ(shifted_r[i], static_cast<T>(a[i] >> 3));
+				EXPECT_EQ(shifted_31[i], static_cast<T>(a[i] >> 31));
+				EXPECT_EQ(less[i], a[i] < b[i]);
+				EXPECT_EQ(equal[i], a[i] == b[i]);
+				EXPECT_EQ(chosen[i], a[i] < b[i] ? a[i] : b[i]);
+			}
+		}
+
+		// Compound assignment and mask reductions.
+		V v(T{6});
+		v <<= 2;
+		v |= V(T{1});
+		v ^= V(T{3});
+		v &= V(T{0x1E});
+		v >>= 1;
+		for (const T lane : lanes_of(v)) { EXPECT_EQ(lane, T{13}); }
+		EXPECT_TRUE(all_of(v == V(T{13})));
+		EXPECT_FALSE(any_of(v == V(T{12})));
+		EXPECT_TRUE(any_of(!(v < V(T{13}))));
+		EXPECT_FALSE(all_of((v < V(T{13})) || (V(T{14}) < v)));
+
+		// Only the last lane differs.
+		std::array<T, n> ramp{};
+		for (int i = 0; i < n; ++i) { ramp[i] = i == n - 1 ? T{1} : T{0}; }
+		const V one_hot(ramp.data(), element_aligned_tag());
+		EXPECT_TRUE(any_of(one_hot == V(T{1})));
+		EXPECT_EQ(all_of(one_hot == V(T{1})), n == 1);
+	}
+
+	template <class Abi>
+	void check_all_integer_lanes()
+	{
+		check_integer_lanes<std::int32_t, Abi>();
+		check_integer_lanes<std::uint32_t, Abi>();
+		check_integer_lanes<std::int64_t, Abi>();
+		check_integer_lanes<std::uint64_t, Abi>();
+	}
+
+	template <class Abi>
+	void check_bit_cast()
+	{
+		using DoubleV		 = simd<double, Abi>;
+		using BitsV			 = simd<std::uint64_t, Abi>;
+		constexpr int n		 = DoubleV::size();
+		static_assert(BitsV::size() == n, "Double and 64 bit integer simd have the same width.");
+
+		std::array<double, n> x{};
+		for (int i = 0; i < n; ++i) { x[i] = (i % 2 == 0 ? 1.5 : -0.375) * static_cast<double>(1 << (3 * i)); }
+		const DoubleV v(x.data(), element_aligned_tag());
+
+		// Exponent field of every lane.
+		const BitsV bits	 = ccm::intrin::bit_cast<BitsV>(v);
+		const auto exponents = lanes_of((bits >> 52) & BitsV(std::uint64_t{0x7FF}));
+		for (int i = 0; i < n; ++i)
+		{
+			std::uint64_t expected = 0;
+			std::memcpy(&expected, &x[i], sizeof(double));
+			EXPECT_EQ(exponents[i], (expected >> 52) & 0x7FF);
+		}
+
+		// Clearing the sign bit and casting back is fabs.
+		const auto magnitude = lanes_of(ccm::intrin::bit_cast<DoubleV>(bits & BitsV(~(std::uint64_t{1} << 63))));
+		for (int i = 0; i < n; ++i) { EXPECT_EQ(magnitude[i], x[i] < 0 ? -x[i] : x[i]); }
+
+		using FloatV = simd<float, Abi>;
+		using IntV	 = simd<std::int32_t, Abi>;
+		const auto round_trip = lanes_of(ccm::intrin::bit_cast<FloatV>(ccm::intrin::bit_cast<IntV>(FloatV(-2.5F)) + IntV(1)));
+		for (const float lane : round_trip) { EXPECT_EQ(lane, std::nextafter(-2.5F, -3.0F)); }
+	}
+} // namespace
+
+TEST(CcmathInternalSimdTests, IntegerLanesScalar)
+{
+	check_all_integer_lanes<ccm::intrin::abi::scalar>();
+	check_bit_cast<ccm::intrin::abi::scalar>();
+}
+
+TEST(CcmathInternalSimdTests, IntegerLanesPack)
+{
+	check_all_integer_lanes<ccm::intrin::abi::pack<4>>();
+	check_bit_cast<ccm::intrin::abi::pack<4>>();
+}
+
+TEST(CcmathInternalSimdTests, IntegerLanesNative)
+{
+	check_all_integer_lanes<ccm::intrin::abi::native>();
+	check_bit_cast<ccm::intrin::abi::native>();
+}
+
+#ifdef CCMATH_HAS_SIMD_SSE2
+TEST(CcmathInternalSimdTests, IntegerLanesSse2)
+{
+	check_all_integer_lanes<ccm::intrin::abi::sse2>();
+	check_bit_cast<ccm::intrin::abi::sse2>();
+}
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX
+TEST(CcmathInternalSimdTests, IntegerLanesAvx)
+{
+	check_all_integer_lanes<ccm::intrin::abi::avx>();
+	check_bit_cast<ccm::intrin::abi::avx>();
+}
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX2
+TEST(CcmathInternalSimdTests, IntegerLanesAvx2)
+{
+	check_all_integer_lanes<ccm::intrin::abi::avx2>();
+	check_bit_cast<ccm::intrin::abi::avx2>();
+}
+#endif
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace
+{
+	using ccm::intrin::element_aligned_tag;
+	using ccm::intrin::simd;
+	using ccm::intrin::where;
+
+	template <class V>
+	std::array<typename V::value_type, V::size()> lanes_of(V const & v)
+	{
+		std::array<typename V::value_type, V::size()> lanes{};
+		v.copy_to(lanes.data(), element_aligned_tag());
+		return lanes;
+	}
+
+	template <class T, class Abi>
+	void check_where()
+	{
+		using V			= simd<T, Abi>;
+		constexpr int n = V::size();
+
+		std::array<T, n> a{};
+		std::array<T, n> b{};
+		for (int i = 0; i < n; ++i)
+		{
+			a[i] = static_cast<T>(3 * i + 4);
+			b[i] = static_cast<T>(i % 3 + 1);
+		}
+		const V va(a.data(), element_aligned_tag());
+		const V vb(b.data(), element_aligned_tag());
+
+		// Two of every three lanes, the lanes past a threshold and all lanes, so the first and the last lane are covered selected and not.
+		const T threshold = static_cast<T>(3 * (n / 2) + 4);
+		for (int pattern = 0; pattern < 3; ++pattern)
+		{
+			const auto mask = pattern == 0 ? vb == V(T{2}) || vb == V(T{3}) : (pattern == 1 ? V(threshold) < va : va == va);
+			std::array<bool, n> selected{};
+			for (int i = 0; i < n; ++i) { selected[i] = pattern == 0 ? b[i] != T{1} : (pattern == 1 ? a[i] > threshold : true); }
+
+			V assigned = va;
+			where(mask, assigned) = vb;
+			V added = va;
+			where(mask, added) += vb;
+			V subtracted = va;
+			where(mask, subtracted) -= vb;
+
+			const auto assigned_lanes	= lanes_of(assigned);
+			const auto added_lanes		= lanes_of(added);
+			const auto subtracted_lanes = lanes_of(subtracted);
+			for (int i = 0; i < n; ++i)
+			{
+				EXPECT_EQ(assigned_lanes[i], selected[i] ? b[i] : a[i]);
+				EXPECT_EQ(added_lanes[i], selected[i] ? static_cast<T>(a[i] + b[i]) : a[i]);
+				EXPECT_EQ(subtracted_lanes[i], selected[i] ? static_cast<T>(a[i] - b[i]) : a[i]);
+			}
+
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				V multiplied = va;
+				where(mask, multiplied) *= vb;
+				V divided = va;
+				where(mask, divided) /= vb;
+				const auto multiplied_lanes = lanes_of(multiplied);
+				const auto divided_lanes	= lanes_of(divided);
+				for (int i = 0; i < n; ++i)
+				{
+					EXPECT_EQ(multiplied_lanes[i], selected[i] ? a[i] * b[i] : a[i]);
+					EXPECT_EQ(divided_lanes[i], selected[i] ? a[i] / b[i] : a[i]);
+				}
+			}
+
+			// The unselected lanes of memory keep their old values.
+			std::array<T, n> stored{};
+			for (int i = 0; i < n; ++i) { stored[i] = static_cast<T>(-7); }
+			where(mask, va).copy_to(stored.data(), element_aligned_tag());
+			for (int i = 0; i < n; ++i) { EXPECT_EQ(stored[i], selected[i] ? a[i] : static_cast<T>(-7)); }
+		}
+	}
+
+	template <class Abi>
+	void check_all_where()
+	{
+		check_where<float, Abi>();
+		check_where<double, Abi>();
+		check_where<std::int32_t, Abi>();
+		check_where<std::int64_t, Abi>();
+	}
+} // namespace
+
+TEST(CcmathInternalSimdTests, WhereScalar)
+{
+	check_all_where<ccm::intrin::abi::scalar>();
+}
+
+TEST(CcmathInternalSimdTests, WherePack)
+{
+	check_all_where<ccm::intrin::abi::pack<4>>();
+}
+
+TEST(CcmathInternalSimdTests, WhereNative)
+{
+	check_all_where<ccm::intrin::abi::native>();
+}
+
+#ifdef CCMATH_HAS_SIMD_SSE2
+TEST(CcmathInternalSimdTests, WhereSse2)
+{
+	check_all_where<ccm::intrin::abi::sse2>();
+}
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX2
+TEST(CcmathInternalSimdTests, WhereAvx2)
+{
+	check_all_where<ccm::intrin::abi::avx2>();
+}
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX512F
+TEST(CcmathInternalSimdTests, WhereAvx512)
+{
+	check_all_where<ccm::intrin::abi::avx512>();
+}
+#endif
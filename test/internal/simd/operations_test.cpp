@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include "support/ulp.hpp"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace
+{
+	using ccm::intrin::element_aligned_tag;
+	using ccm::intrin::simd;
+	using ccm::test::same_bits;
+
+	template <class T>
+	std::vector<T> interesting_values()
+	{
+		const T inf = std::numeric_limits<T>::infinity();
+		const T big = static_cast<T>(sizeof(T) == 8 ? 0x1p52 : 0x1p23);
+		return {T{0},
+				-T{0},
+				T{1},
+				T{-1},
+				static_cast<T>(0.5),
+				static_cast<T>(-0.5),
+				static_cast<T>(1.5),
+				static_cast<T>(-2.5),
+				static_cast<T>(2.5),
+				static_cast<T>(0.49999997),
+				static_cast<T>(-0.3),
+				static_cast<T>(3.7),
+				static_cast<T>(-1234.5678),
+				big,
+				-big,
+				big - T{1},
+				static_cast<T>(big + static_cast<T>(0.5) * big),
+				std::numeric_limits<T>::max(),
+				std::numeric_limits<T>::min(),
+				std::numeric_limits<T>::denorm_min(),
+				inf,
+				-inf,
+				std::numeric_limits<T>::quiet_NaN(),
+				static_cast<T>(1e-3),
+				static_cast<T>(7e5)};
+	}
+
+	template <class V>
+	std::array<typename V::value_type, V::size()> lanes_of(V const & v)
+	{
+		std::array<typename V::value_type, V::size()> lanes{};
+		v.copy_to(lanes.data(), element_aligned_tag());
+		return lanes;
+	}
+
+	template <class V>
+	std::array<bool, V::size()> lanes_of_mask(typename V::mask_type const & m)
+	{
+		using T								  = typename V::value_type;
+		const std::array<T, V::size()> chosen = lanes_of(choose(m, V(T{1}), V(T{0})));
+		std::array<bool, V::size()> lanes{};
+		for (int i = 0; i < V::size(); ++i) { lanes[i] = chosen[i] != T{0}; }
+		return lanes;
+	}
+
+	/// |expected - actual| within tolerance * |expected|, with matching infinities, zeros and NaNs.
+	template <class T>
+	bool close(T expected, T actual, T tolerance)
+	{
+		if (std::isnan(expected)) { return std::isnan(actual); }
+		if (std::isinf(expected) || expected == T{0}) { return same_bits(expected, actual); }
+		return std::fabs(expected - actual) <= tolerance * std::fabs(expected);
+	}
+
+	template <class T, class Abi>
+	void check_operations()
+	{
+		using V			  = simd<T, Abi>;
+		constexpr int n	  = V::size();
+		const auto values = interesting_values<T>();
+		const T tolerance = std::numeric_limits<T>::epsilon() * 4;
+
+		for (std::size_t offset = 0; offset < values.size(); ++offset)
+		{
+			std::array<T, n> a{};
+			std::array<T, n> b{};
+			std::array<T, n> c{};
+			for (int i = 0; i < n; ++i)
+			{
+				a[i] = values[(offset + static_cast<std::size_t>(i)) % values.size()];
+				b[i] = values[(offset * 7 + static_cast<std::size_t>(i) * 3 + 1) % values.size()];
+				c[i] = values[(offset * 5 + static_cast<std::size_t>(i) * 11 + 2) % values.size()];
+			}
+			const V va(a.data(), element_aligned_tag());
+			const V vb(b.data(), element_aligned_tag());
+			const V vc(c.data(), element_aligned_tag());
+
+			const auto minimum	 = lanes_of(min(va, vb));
+			const auto maximum	 = lanes_of(max(va, vb));
+			const auto absolute	 = lanes_of(abs(va));
+			const auto signs	 = lanes_of(copysign(va, vb));
+			const auto floors	 = lanes_of(floor(va));
+			const auto ceils	 = lanes_of(ceil(va));
+			const auto truncs	 = lanes_of(trunc(va));
+			const auto rounds	 = lanes_of(round(va));
+			const auto rsqrts	 = lanes_of(rsqrt(va));
+			const auto rcps		 = lanes_of(rcp(va));
+			const auto fmas		 = lanes_of(fma(va, vb, vc));
+			const auto fmss		 = lanes_of(fms(va, vb, vc));
+			const auto fnmas	 = lanes_of(fnma(va, vb, vc));
+			const auto less		 = lanes_of_mask<V>(va < vb);
+			const auto less_eq	 = lanes_of_mask<V>(va <= vb);
+			const auto greater	 = lanes_of_mask<V>(va > vb);
+			const auto greater_eq = lanes_of_mask<V>(va >= vb);
+			const auto equal	 = lanes_of_mask<V>(va == vb);
+			const auto not_equal = lanes_of_mask<V>(va != vb);
+
+			for (int i = 0; i < n; ++i)
+			{
+				EXPECT_TRUE(same_bits(a[i] < b[i] ? a[i] : b[i], minimum[i])) << a[i] << ' ' << b[i];
+				EXPECT_TRUE(same_bits(b[i] < a[i] ? a[i] : b[i], maximum[i])) << a[i] << ' ' << b[i];
+				EXPECT_TRUE(same_bits(std::fabs(a[i]), absolute[i])) << a[i];
+				EXPECT_TRUE(same_bits(std::copysign(a[i], b[i]), signs[i])) << a[i] << ' ' << b[i];
+				EXPECT_TRUE(same_bits(std::floor(a[i]), floors[i])) << a[i];
+				EXPECT_TRUE(same_bits(std::ceil(a[i]), ceils[i])) << a[i];
+				EXPECT_TRUE(same_bits(std::trunc(a[i]), truncs[i])) << a[i];
+				EXPECT_TRUE(same_bits(std::round(a[i]), rounds[i])) << a[i];
+				EXPECT_EQ(less[i], a[i] < b[i]);
+				EXPECT_EQ(less_eq[i], a[i] <= b[i]);
+				EXPECT_EQ(greater[i], a[i] > b[i]);
+				EXPECT_EQ(greater_eq[i], a[i] >= b[i]);
+				EXPECT_EQ(equal[i], a[i] == b[i]);
+				EXPECT_EQ(not_equal[i], a[i] != b[i]);
+
+				// Estimates may flush subnormal inputs and results, so only normal ranges are compared.
+				const T magnitude = std::fabs(a[i]);
+				const bool normal = magnitude >= std::numeric_limits<T>::min() && magnitude <= std::numeric_limits<T>::max() / 4;
+				if (normal || std::isinf(a[i]) || std::isnan(a[i]) || a[i] == T{0})
+				{
+					EXPECT_TRUE(close(a[i] < T{0} ? std::numeric_limits<T>::quiet_NaN() : T{1} / std::sqrt(a[i]), rsqrts[i], tolerance)) << a[i];
+					EXPECT_TRUE(close(T{1} / a[i], rcps[i], tolerance)) << a[i];
+				}
+
+				// Only finite inputs whose products cannot overflow.
+				if (std::isfinite(a[i]) && std::isfinite(b[i]) && std::isfinite(c[i]) && std::fabs(a[i]) < 1e6 && std::fabs(b[i]) < 1e6)
+				{
+					EXPECT_TRUE(close(std::fma(a[i], b[i], c[i]), fmas[i], tolerance)) << a[i] << ' ' << b[i] << ' ' << c[i];
+					EXPECT_TRUE(close(std::fma(a[i], b[i], -c[i]), fmss[i], tolerance)) << a[i] << ' ' << b[i] << ' ' << c[i];
+					EXPECT_TRUE(close(std::fma(-a[i], b[i], c[i]), fnmas[i], tolerance)) << a[i] << ' ' << b[i] << ' ' << c[i];
+				}
+			}
+		}
+
+#ifdef CCMATH_HAS_SIMD_FMA
+		// (1 + e)(1 - e) - 1 is -e^2 only when the product is not rounded first.
+		const T e	   = std::numeric_limits<T>::epsilon();
+		const auto fused = lanes_of(fma(V(T{1} + e), V(T{1} - e), V(T{-1})));
+		for (const T lane : fused) { EXPECT_EQ(lane, -e * e); }
+#endif
+	}
+
+	template <class Abi>
+	void check_all_operations()
+	{
+		check_operations<float, Abi>();
+		check_operations<double, Abi>();
+	}
+} // namespace
+
+TEST(CcmathInternalSimdTests, OperationsScalar)
+{
+	check_all_operations<ccm::intrin::abi::scalar>();
+}
+
+TEST(CcmathInternalSimdTests, OperationsPack)
+{
+	check_all_operations<ccm::intrin::abi::pack<4>>();
+}
+
+TEST(CcmathInternalSimdTests, OperationsNative)
+{
+	check_all_operations<ccm::intrin::abi::native>();
+}
+
+#ifdef CCMATH_HAS_SIMD_SSE2
+TEST(CcmathInternalSimdTests, OperationsSse2)
+{
+	check_all_operations<ccm::intrin::abi::sse2>();
+}
+#endif
+
+#ifdef CCMATH_HAS_SIMD_SSE4
+TEST(CcmathInternalSimdTests, OperationsSse4)
+{
+	check_all_operations<ccm::intrin::abi::sse4>();
+}
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX
+TEST(CcmathInternalSimdTests, OperationsAvx)
+{
+	check_all_operations<ccm::intrin::abi::avx>();
+}
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX2
+TEST(CcmathInternalSimdTests, OperationsAvx2)
+{
+	check_all_operations<ccm::intrin::abi::avx2>();
+}
+#endif
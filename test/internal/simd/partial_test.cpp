@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include <array>
+#include <cstdint>
+
+namespace
+{
+	using ccm::intrin::element_aligned_tag;
+	using ccm::intrin::simd;
+	using ccm::intrin::vector_aligned_tag;
+
+	template <class T, class Abi>
+	void check_partial()
+	{
+		using V			= simd<T, Abi>;
+		constexpr int n = V::size();
+
+		std::array<T, n> source{};
+		for (int i = 0; i < n; ++i) { source[i] = static_cast<T>(3 * i + 1); }
+
+		for (int count = 0; count <= n; ++count)
+		{
+			// Lanes past count load as zero.
+			std::array<T, n> lanes{};
+			ccm::intrin::load_partial<V>(source.data(), count).copy_to(lanes.data(), element_aligned_tag());
+			for (int i = 0; i < n; ++i) { EXPECT_EQ(lanes[i], i < count ? source[i] : T{0}); }
+
+			// Elements past count keep their value.
+			std::array<T, n> target{};
+			for (T & element : target) { element = T{7}; }
+			ccm::intrin::store_partial(V(source.data(), element_aligned_tag()), target.data(), count);
+			for (int i = 0; i < n; ++i) { EXPECT_EQ(target[i], i < count ? source[i] : T{7}); }
+		}
+	}
+
+	template <class T, class Abi>
+	void check_vector_aligned()
+	{
+		using V			= simd<T, Abi>;
+		constexpr int n = V::size();
+
+		alignas(64) std::array<T, n> source{};
+		alignas(64) std::array<T, n> target{};
+		for (int i = 0; i < n; ++i) { source[i] = static_cast<T>(n - i); }
+
+		const V v(source.data(), vector_aligned_tag());
+		v.copy_to(target.data(), vector_aligned_tag());
+		EXPECT_EQ(target, source);
+	}
+
+	template <class Abi>
+	void check_all_partials()
+	{
+		check_partial<double, Abi>();
+		check_partial<float, Abi>();
+		check_partial<std::int32_t, Abi>();
+		check_partial<std::uint64_t, Abi>();
+		check_vector_aligned<double, Abi>();
+		check_vector_aligned<float, Abi>();
+		check_vector_aligned<std::int64_t, Abi>();
+		check_vector_aligned<std::uint32_t, Abi>();
+	}
+} // namespace
+
+TEST(CcmathInternalSimdTests, PartialScalar)
+{
+	check_all_partials<ccm::intrin::abi::scalar>();
+}
+
+TEST(CcmathInternalSimdTests, PartialPack)
+{
+	check_all_partials<ccm::intrin::abi::pack<4>>();
+}
+
+TEST(CcmathInternalSimdTests, PartialNative)
+{
+	check_all_partials<ccm::intrin::abi::native>();
+}
+
+#ifdef CCMATH_HAS_SIMD_SSE2
+TEST(CcmathInternalSimdTests, PartialSse2)
+{
+	check_all_partials<ccm::intrin::abi::sse2>();
+}
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX
+TEST(CcmathInternalSimdTests, PartialAvx)
+{
+	check_all_partials<ccm::intrin::abi::avx>();
+}
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX2
+TEST(CcmathInternalSimdTests, PartialAvx2)
+{
+	check_all_partials<ccm::intrin::abi::avx2>();
+}
+#endif
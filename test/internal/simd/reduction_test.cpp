@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/internal/math/runtime/simd/simd.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+	using ccm::intrin::element_aligned_tag;
+	using ccm::intrin::simd;
+
+	template <class T, class Abi>
+	void check_reductions()
+	{
+		using V			= simd<T, Abi>;
+		constexpr int n = V::size();
+
+		// Small integers and powers of two keep every sum and product exact, so any order of evaluation gives the same result.
+		for (int offset = 0; offset < 3 * n; ++offset)
+		{
+			std::array<T, n> lanes{};
+			std::array<T, n> factors{};
+			for (int i = 0; i < n; ++i)
+			{
+				const int k = (offset + i * 5) % 7;
+				lanes[i]	= static_cast<T>(k % 2 == 0 ? k * 3 + 1 : 2 * k);
+				factors[i]	= static_cast<T>(k % 2 == 0 ? 2 : 1);
+			}
+			const V v(lanes.data(), element_aligned_tag());
+
+			T sum	  = lanes[0];
+			T product = factors[0];
+			T minimum = lanes[0];
+			T maximum = lanes[0];
+			std::array<T, n> prefix{};
+			prefix[0] = lanes[0];
+			for (int i = 1; i < n; ++i)
+			{
+				sum += lanes[i];
+				product *= factors[i];
+				minimum = lanes[i] < minimum ? lanes[i] : minimum;
+				maximum = maximum < lanes[i] ? lanes[i] : maximum;
+				prefix[i] = prefix[i - 1] + lanes[i];
+			}
+
+			EXPECT_EQ(reduce_add(v), sum);
+			EXPECT_EQ(reduce_mul(V(factors.data(), element_aligned_tag())), product);
+			EXPECT_EQ(reduce_min(v), minimum);
+			EXPECT_EQ(reduce_max(v), maximum);
+
+			std::array<T, n> scanned{};
+			prefix_sum(v).copy_to(scanned.data(), element_aligned_tag());
+			for (int i = 0; i < n; ++i) { EXPECT_EQ(scanned[i], prefix[i]) << "lane " << i; }
+		}
+
+		// Negative lanes for the minimum and a single distinct lane in every position.
+		for (int position = 0; position < n; ++position)
+		{
+			std::array<T, n> lanes{};
+			for (int i = 0; i < n; ++i) { lanes[i] = static_cast<T>(i == position ? 9 : 4); }
+			const V v(lanes.data(), element_aligned_tag());
+			EXPECT_EQ(reduce_max(v), static_cast<T>(9));
+			EXPECT_EQ(reduce_min(v), static_cast<T>(n == 1 ? 9 : 4));
+			EXPECT_EQ(reduce_min(-v), static_cast<T>(-9));
+		}
+	}
+
+	template <class Abi>
+	void check_all_reductions()
+	{
+		check_reductions<float, Abi>();
+		check_reductions<double, Abi>();
+		check_reductions<std::int32_t, Abi>();
+		check_reductions<std::int64_t, Abi>();
+	}
+} // namespace
+
+TEST(CcmathInternalSimdTests, ReductionsScalar)
+{
+	check_all_reductions<ccm::intrin::abi::scalar>();
+}
+
+TEST(CcmathInternalSimdTests, ReductionsPack)
+{
+	check_all_reductions<ccm::intrin::abi::pack<4>>();
+}
+
+TEST(CcmathInternalSimdTests, ReductionsNative)
+{
+	check_all_reductions<ccm::intrin::abi::native>();
+}
+
+#ifdef CCMATH_HAS_SIMD_SSE2
+TEST(CcmathInternalSimdTests, ReductionsSse2)
+{
+	check_all_reductions<ccm::intrin::abi::sse2>();
+}
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX
+TEST(CcmathInternalSimdTests, ReductionsAvx)
+{
+	check_all_reductions<ccm::intrin::abi::avx>();
+}
+#endif
+
+#ifdef CCMATH_HAS_SIMD_AVX2
+TEST(CcmathInternalSimdTests, ReductionsAvx2)
+{
+	check_all_reductions<ccm::intrin::abi::avx2>();
+}
+#endif
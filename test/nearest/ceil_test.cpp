@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "ccmath/ccmath.hpp"
+
+namespace
+{
+	using testing::TestWithParam;
+	using testing::ValuesIn;
+
+	template <typename T>
+	struct CeilTestParams
+	{
+		T input{};
+		T expected{};
+	};
+
+	template <typename T>
+	std::vector<CeilTestParams<T>> make_ceil_test_params()
+	{
+		const std::vector<T> inputs{
+			// Zero values
+			T(0.0), T(-0.0),
+
+			// Fractional and halfway values
+			T(0.25), T(-0.25), T(0.5), T(-0.5), T(0.75), T(-0.75), T(1.5), T(-1.5), T(2.5), T(-2.5), T(123.1), T(-123.1), T(123.5), T(-123.5),
+
+			// Already integral values
+			T(1.0), T(-1.0), T(123.0), T(-123.0),
+
+			// Values where only the last few mantissa bits are fractional
+			T(1e6) + T(0.5), -T(1e6) - T(0.5), std::ldexp(T(1.0), std::numeric_limits<T>::digits - 2) + T(0.5),
+			-std::ldexp(T(1.0), std::numeric_limits<T>::digits - 2) - T(0.5), std::ldexp(T(1.0), std::numeric_limits<T>::digits - 1) + T(1.0),
+
+			// Edge cases
+			std::numeric_limits<T>::max(), -std::numeric_limits<T>::max(), std::numeric_limits<T>::min(), -std::numeric_limits<T>::min(),
+			std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::infinity(),
+			-std::numeric_limits<T>::infinity()};
+
+		std::vector<CeilTestParams<T>> params;
+		params.reserve(inputs.size());
+		for (const T input : inputs) { params.push_back({input, std::ceil(input)}); }
+		return params;
+	}
+} // namespace
+
+class CcmathCeilDoubleTests : public TestWithParam<CeilTestParams<double>>
+{
+};
+
+class CcmathCeilFloatTests : public TestWithParam<CeilTestParams<float>>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(CeilDoubleTests, CcmathCeilDoubleTests, ValuesIn(make_ceil_test_params<double>()));
+INSTANTIATE_TEST_SUITE_P(CeilFloatTests, CcmathCeilFloatTests, ValuesIn(make_ceil_test_params<float>()));
+
+TEST_P(CcmathCeilDoubleTests, CeilMatchesStd)
+{
+	const auto param{GetParam()};
+	const auto actual{ccm::ceil(param.input)};
+	EXPECT_EQ(actual, param.expected) << "ccm::ceil(" << param.input << ") expected to equal " << param.expected << ". Instead got " << actual << ".";
+	EXPECT_EQ(std::signbit(actual), std::signbit(param.expected)) << "ccm::ceil(" << param.input << ") has the wrong sign.";
+}
+
+TEST_P(CcmathCeilFloatTests, CeilMatchesStd)
+{
+	const auto param{GetParam()};
+	const auto actual{ccm::ceilf(param.input)};
+	EXPECT_EQ(actual, param.expected) << "ccm::ceilf(" << param.input << ") expected to equal " << param.expected << ". Instead got " << actual << ".";
+	EXPECT_EQ(std::signbit(actual), std::signbit(param.expected)) << "ccm::ceilf(" << param.input << ") has the wrong sign.";
+}
+
+TEST(CcmathNearestTests, CcmCeilGenericMatchesStd)
+{
+	for (const auto & param : make_ceil_test_params<double>())
+	{
+		EXPECT_EQ(ccm::gen::ceil_gen(param.input), param.expected) << "ccm::gen::ceil_gen(" << param.input << ")";
+	}
+	for (const auto & param : make_ceil_test_params<long double>())
+	{
+		EXPECT_EQ(ccm::ceill(param.input), param.expected) << "ccm::ceill(" << param.input << ")";
+	}
+}
+
+TEST(CcmathNearestTests, CcmCeilNanValues)
+{
+	EXPECT_TRUE(std::isnan(ccm::ceil(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::ceil(-std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::ceilf(std::numeric_limits<float>::quiet_NaN())));
+}
+
+TEST(CcmathNearestTests, CcmCeilIntegerReturnsDouble)
+{
+	EXPECT_EQ(ccm::ceil(42), 42.0);
+	EXPECT_EQ(ccm::ceil(-42), -42.0);
+}
+
+TEST(CcmathNearestTests, CcmCeilCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::ceil(1.5) == 2.0);
+	static_assert(ccm::ceil(-1.5) == -1.0);
+	static_assert(ccm::ceil(1e15 + 0.5) == 1e15 + 1.0);
+	static_assert(ccm::ceilf(0.25F) == 1.0F);
+}
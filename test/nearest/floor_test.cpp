@@ -51,6 +51,19 @@ namespace
 		{1.0000000000000001, std::floor(1.0000000000000001)},
 		{-1.0000000000000001, std::floor(-1.0000000000000001)},
 		{1.0000000000000000000000000000000000000000000001, std::floor(1.0000000000000000000000000000000000000000000001)},
+
+		// Large values that only have a few fractional bits left
+		{1e15 + 0.5, std::floor(1e15 + 0.5)},
+		{-1e15 - 0.5, std::floor(-1e15 - 0.5)},
+		{4503599627370495.5, std::floor(4503599627370495.5)},
+		{-4503599627370495.5, std::floor(-4503599627370495.5)},
+		{4503599627370497.0, std::floor(4503599627370497.0)},
+		{std::numeric_limits<double>::max(), std::floor(std::numeric_limits<double>::max())},
+		{-std::numeric_limits<double>::max(), std::floor(-std::numeric_limits<double>::max())},
+
+		// Subnormal values
+		{std::numeric_limits<double>::denorm_min(), std::floor(std::numeric_limits<double>::denorm_min())},
+		{-std::numeric_limits<double>::denorm_min(), std::floor(-std::numeric_limits<double>::denorm_min())},
 	};
 
 } // namespace
@@ -87,4 +100,10 @@ TEST(CcmathNearestTests, CcmFloorCanBeEvaluatedAtCompileTime)
 {
 	constexpr auto floor{ccm::floor(1.0)};
 	static_assert(floor == 1.0);
+
+	// Large magnitudes used to exceed the constexpr step limit.
+	static_assert(ccm::floor(1e15 + 0.5) == 1e15);
+	static_assert(ccm::floor(-1e15 - 0.5) == -1e15 - 1.0);
+	static_assert(ccm::floorf(-0.5F) == -1.0F);
+	static_assert(ccm::floorl(2.5L) == 2.0L);
 }
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include <cfenv>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <vector>
+#include "ccmath/ccmath.hpp"
+
+namespace
+{
+	using testing::TestWithParam;
+	using testing::ValuesIn;
+
+	template <typename T>
+	struct RintTestParams
+	{
+		T input{};
+		T expected{};
+	};
+
+	template <typename T>
+	std::vector<RintTestParams<T>> make_rint_test_params()
+	{
+		const std::vector<T> inputs{
+			// Zero values
+			T(0.0), T(-0.0),
+
+			// Fractional and halfway values
+			T(0.25), T(-0.25), T(0.5), T(-0.5), T(0.75), T(-0.75), T(1.5), T(-1.5), T(2.5), T(-2.5), T(123.1), T(-123.1), T(123.5), T(-123.5),
+
+			// Already integral values
+			T(1.0), T(-1.0), T(123.0), T(-123.0),
+
+			// Values where only the last few mantissa bits are fractional
+			T(1e6) + T(0.5), -T(1e6) - T(0.5), std::ldexp(T(1.0), std::numeric_limits<T>::digits - 2) + T(0.5),
+			-std::ldexp(T(1.0), std::numeric_limits<T>::digits - 2) - T(0.5), std::ldexp(T(1.0), std::numeric_limits<T>::digits - 1) + T(1.0),
+
+			// Edge cases
+			std::numeric_limits<T>::max(), -std::numeric_limits<T>::max(), std::numeric_limits<T>::min(), -std::numeric_limits<T>::min(),
+			std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::infinity(),
+			-std::numeric_limits<T>::infinity()};
+
+		std::vector<RintTestParams<T>> params;
+		params.reserve(inputs.size());
+		for (const T input : inputs) { params.push_back({input, std::rint(input)}); }
+		return params;
+	}
+} // namespace
+
+class CcmathRintDoubleTests : public TestWithParam<RintTestParams<double>>
+{
+};
+
+class CcmathRintFloatTests : public TestWithParam<RintTestParams<float>>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(RintDoubleTests, CcmathRintDoubleTests, ValuesIn(make_rint_test_params<double>()));
+INSTANTIATE_TEST_SUITE_P(RintFloatTests, CcmathRintFloatTests, ValuesIn(make_rint_test_params<float>()));
+
+TEST_P(CcmathRintDoubleTests, RintMatchesStd)
+{
+	const auto param{GetParam()};
+	const auto actual{ccm::rint(param.input)};
+	EXPECT_EQ(actual, param.expected) << "ccm::rint(" << param.input << ") expected to equal " << param.expected << ". Instead got " << actual << ".";
+	EXPECT_EQ(std::signbit(actual), std::signbit(param.expected)) << "ccm::rint(" << param.input << ") has the wrong sign.";
+}
+
+TEST_P(CcmathRintFloatTests, RintMatchesStd)
+{
+	const auto param{GetParam()};
+	const auto actual{ccm::rintf(param.input)};
+	EXPECT_EQ(actual, param.expected) << "ccm::rintf(" << param.input << ") expected to equal " << param.expected << ". Instead got " << actual << ".";
+	EXPECT_EQ(std::signbit(actual), std::signbit(param.expected)) << "ccm::rintf(" << param.input << ") has the wrong sign.";
+}
+
+TEST(CcmathNearestTests, CcmRintGenericMatchesStd)
+{
+	for (const auto & param : make_rint_test_params<double>())
+	{
+		EXPECT_EQ(ccm::gen::rint_gen(param.input), param.expected) << "ccm::gen::rint_gen(" << param.input << ")";
+	}
+	for (const auto & param : make_rint_test_params<long double>())
+	{
+		EXPECT_EQ(ccm::rintl(param.input), param.expected) << "ccm::rintl(" << param.input << ")";
+	}
+}
+
+TEST(CcmathNearestTests, CcmRintNanValues)
+{
+	EXPECT_TRUE(std::isnan(ccm::rint(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::rint(-std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::rintf(std::numeric_limits<float>::quiet_NaN())));
+}
+
+TEST(CcmathNearestTests, CcmRintIntegerReturnsDouble)
+{
+	EXPECT_EQ(ccm::rint(42), 42.0);
+	EXPECT_EQ(ccm::rint(-42), -42.0);
+}
+
+TEST(CcmathNearestTests, CcmRintCanBeEvaluatedAtCompileTime)
+{
+	// Constant evaluation always rounds to nearest, ties to even.
+	static_assert(ccm::rint(2.5) == 2.0);
+	static_assert(ccm::rint(3.5) == 4.0);
+	static_assert(ccm::rint(-0.5) == 0.0);
+	static_assert(ccm::rintf(1e6F + 0.5F) == 1e6F);
+}
+
+TEST(CcmathNearestTests, CcmRintHonoursCurrentRoundingMode)
+{
+	// The expected results are spelled out, as without -frounding-math the compiler may move std::rint across fesetround.
+	struct ModeCase
+	{
+		int mode;
+		double expected[8];
+	};
+	const ModeCase cases[]{
+		{FE_TONEAREST, {0.0, -0.0, 1.0, -1.0, 2.0, -2.0, 1e15, -1e15}},
+		{FE_DOWNWARD, {0.0, -1.0, 0.0, -1.0, 2.0, -3.0, 1e15, -1e15 - 1.0}},
+		{FE_UPWARD, {1.0, -0.0, 1.0, -0.0, 3.0, -2.0, 1e15 + 1.0, -1e15}},
+		{FE_TOWARDZERO, {0.0, -0.0, 0.0, -0.0, 2.0, -2.0, 1e15, -1e15}},
+	};
+
+	// Volatile inputs keep the compiler from folding the calls under the default rounding mode.
+	volatile double inputs[]{0.3, -0.3, 0.7, -0.7, 2.5, -2.5, 1e15 + 0.5, -1e15 - 0.5};
+	for (const ModeCase & test_case : cases)
+	{
+		ASSERT_EQ(std::fesetround(test_case.mode), 0);
+		for (std::size_t i = 0; i < std::size(inputs); ++i)
+		{
+			const double input{inputs[i]};
+			const double actual{ccm::rint(input)};
+			const double expected{test_case.expected[i]};
+			EXPECT_EQ(actual, expected) << "ccm::rint(" << input << ") in rounding mode " << test_case.mode;
+			EXPECT_EQ(std::signbit(actual), std::signbit(expected)) << "ccm::rint(" << input << ") in rounding mode " << test_case.mode;
+		}
+	}
+	std::fesetround(FE_TONEAREST);
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "ccmath/ccmath.hpp"
+
+namespace
+{
+	using testing::TestWithParam;
+	using testing::ValuesIn;
+
+	template <typename T>
+	struct RoundTestParams
+	{
+		T input{};
+		T expected{};
+	};
+
+	template <typename T>
+	std::vector<RoundTestParams<T>> make_round_test_params()
+	{
+		const std::vector<T> inputs{
+			// Zero values
+			T(0.0), T(-0.0),
+
+			// Fractional and halfway values
+			T(0.25), T(-0.25), T(0.5), T(-0.5), T(0.75), T(-0.75), T(1.5), T(-1.5), T(2.5), T(-2.5), T(123.1), T(-123.1), T(123.5), T(-123.5),
+
+			// Already integral values
+			T(1.0), T(-1.0), T(123.0), T(-123.0),
+
+			// Values where only the last few mantissa bits are fractional
+			T(1e6) + T(0.5), -T(1e6) - T(0.5), std::ldexp(T(1.0), std::numeric_limits<T>::digits - 2) + T(0.5),
+			-std::ldexp(T(1.0), std::numeric_limits<T>::digits - 2) - T(0.5), std::ldexp(T(1.0), std::numeric_limits<T>::digits - 1) + T(1.0),
+
+			// Edge cases
+			std::numeric_limits<T>::max(), -std::numeric_limits<T>::max(), std::numeric_limits<T>::min(), -std::numeric_limits<T>::min(),
+			std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::infinity(),
+			-std::numeric_limits<T>::infinity()};
+
+		std::vector<RoundTestParams<T>> params;
+		params.reserve(inputs.size());
+		for (const T input : inputs) { params.push_back({input, std::round(input)}); }
+		return params;
+	}
+} // namespace
+
+class CcmathRoundDoubleTests : public TestWithParam<RoundTestParams<double>>
+{
+};
+
+class CcmathRoundFloatTests : public TestWithParam<RoundTestParams<float>>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(RoundDoubleTests, CcmathRoundDoubleTests, ValuesIn(make_round_test_params<double>()));
+INSTANTIATE_TEST_SUITE_P(RoundFloatTests, CcmathRoundFloatTests, ValuesIn(make_round_test_params<float>()));
+
+TEST_P(CcmathRoundDoubleTests, RoundMatchesStd)
+{
+	const auto param{GetParam()};
+	const auto actual{ccm::round(param.input)};
+	EXPECT_EQ(actual, param.expected) << "ccm::round(" << param.input << ") expected to equal " << param.expected << ". Instead got " << actual << ".";
+	EXPECT_EQ(std::signbit(actual), std::signbit(param.expected)) << "ccm::round(" << param.input << ") has the wrong sign.";
+}
+
+TEST_P(CcmathRoundFloatTests, RoundMatchesStd)
+{
+	const auto param{GetParam()};
+	const auto actual{ccm::roundf(param.input)};
+	EXPECT_EQ(actual, param.expected) << "ccm::roundf(" << param.input << ") expected to equal " << param.expected << ". Instead got " << actual << ".";
+	EXPECT_EQ(std::signbit(actual), std::signbit(param.expected)) << "ccm::roundf(" << param.input << ") has the wrong sign.";
+}
+
+TEST(CcmathNearestTests, CcmRoundGenericMatchesStd)
+{
+	for (const auto & param : make_round_test_params<double>())
+	{
+		EXPECT_EQ(ccm::gen::round_gen(param.input), param.expected) << "ccm::gen::round_gen(" << param.input << ")";
+	}
+	for (const auto & param : make_round_test_params<long double>())
+	{
+		EXPECT_EQ(ccm::roundl(param.input), param.expected) << "ccm::roundl(" << param.input << ")";
+	}
+}
+
+TEST(CcmathNearestTests, CcmRoundNanValues)
+{
+	EXPECT_TRUE(std::isnan(ccm::round(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::round(-std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::roundf(std::numeric_limits<float>::quiet_NaN())));
+}
+
+TEST(CcmathNearestTests, CcmRoundIntegerReturnsDouble)
+{
+	EXPECT_EQ(ccm::round(42), 42.0);
+	EXPECT_EQ(ccm::round(-42), -42.0);
+}
+
+TEST(CcmathNearestTests, CcmRoundCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::round(2.5) == 3.0);
+	static_assert(ccm::round(-2.5) == -3.0);
+	static_assert(ccm::round(0.49999999999999994) == 0.0);
+	static_assert(ccm::round(1e15 + 0.5) == 1e15 + 1.0);
+	static_assert(ccm::roundf(-0.5F) == -1.0F);
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/batch.hpp"
+#include "support/ulp.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <vector>
+
+namespace
+{
+	using ccm::test::expect_batch_prefixes_match;
+	using ccm::test::for_each_runnable_simd_level;
+	using ccm::test::make_inputs;
+	using ccm::test::ulp_distance;
+
+	// batch::cbrt and every dispatch tier round correctly like ccm::cbrt, so the results must have the same bits, sign
+	// included.
+	template <typename Batch, typename T>
+	void expect_batch_cbrt_matches(Batch batch, const std::vector<T> & x)
+	{
+		expect_batch_prefixes_match(batch, x, [](T v) { return ccm::cbrt(v); }, 0);
+	}
+} // namespace
+
+TEST(CcmathPowerTests, Cbrt)
+{
+	// std::cbrt can be a few ulps off. The long double cube root rounded to double is only off by one when the root is
+	// within a 2^-11 ulp of a half way point, which is rare enough to also bound how often the results differ.
+	const auto reference = [](double x) { return static_cast<double>(std::cbrt(static_cast<long double>(x))); };
+	std::vector<double> inputs = make_inputs<double>(-1074, 1023);
+	const std::vector<double> near_one = make_inputs<double>(-4, 4, 2000);
+	inputs.insert(inputs.end(), near_one.begin(), near_one.end());
+	std::size_t differences = 0;
+	for (const double x : inputs)
+	{
+		const std::int64_t distance = ulp_distance(ccm::cbrt(x), reference(x));
+		EXPECT_LE(distance, 1) << x;
+		differences += distance != 0 ? 1 : 0;
+	}
+	EXPECT_LE(differences, inputs.size() / 500);
+	for (const float x : make_inputs<float>(-149, 127, 64)) { EXPECT_EQ(ccm::cbrtf(x), static_cast<float>(reference(static_cast<double>(x)))) << x; }
+
+	// Exact cubes have exact cube roots, at any scale.
+	for (int i = -2000; i <= 2000; ++i)
+	{
+		const auto root = static_cast<double>(i);
+		EXPECT_EQ(ccm::cbrt(root * root * root), root);
+		EXPECT_EQ(ccm::cbrt(std::ldexp(root * root * root, -1050)), std::ldexp(root, -350));
+		EXPECT_EQ(ccm::cbrt(std::ldexp(root * root * root, 990)), std::ldexp(root, 330));
+		// Float cubes are exact up to 255^3 < 2^24.
+		if (i >= -255 && i <= 255) { EXPECT_EQ(ccm::cbrtf(static_cast<float>(root * root * root)), static_cast<float>(root)) << root; }
+	}
+	EXPECT_EQ(ccm::cbrt(0x1p-1074), 0x1p-358);
+	EXPECT_EQ(ccm::cbrt(-std::numeric_limits<double>::max()), -std::cbrt(std::numeric_limits<double>::max()));
+	EXPECT_EQ(ccm::cbrt(2.0), 0x1.428a2f98d728bp+0);
+	EXPECT_EQ(ccm::cbrt(3.0), 0x1.7137449123ef6p+0);
+	EXPECT_EQ(ccm::cbrtf(2.0F), 0x1.428a30p+0F);
+}
+
+TEST(CcmathPowerTests, CbrtSpecialValues)
+{
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+	for (const double x : {0.0, -0.0, inf, -inf})
+	{
+		EXPECT_EQ(ccm::cbrt(x), x);
+		EXPECT_EQ(std::signbit(ccm::cbrt(x)), std::signbit(x));
+		EXPECT_EQ(ccm::cbrtf(static_cast<float>(x)), static_cast<float>(x));
+		EXPECT_EQ(std::signbit(ccm::cbrtf(static_cast<float>(x))), std::signbit(x));
+	}
+	EXPECT_TRUE(std::isnan(ccm::cbrt(nan)));
+	EXPECT_TRUE(std::isnan(ccm::cbrt(-nan)));
+	EXPECT_TRUE(std::isnan(ccm::cbrtf(std::numeric_limits<float>::quiet_NaN())));
+	EXPECT_EQ(ccm::cbrt(-27), -3.0);
+	EXPECT_EQ(ccm::cbrtl(-8.0L), -2.0L);
+	EXPECT_EQ(ccm::cbrt(std::numeric_limits<float>::denorm_min()), std::cbrt(std::numeric_limits<float>::denorm_min()));
+}
+
+TEST(CcmathPowerTests, CbrtCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::cbrt(27.0) == 3.0);
+	static_assert(ccm::cbrt(-0x1p-1074) == -0x1p-358);
+	static_assert(ccm::cbrt(2.0) == 0x1.428a2f98d728bp+0);
+	static_assert(ccm::cbrtf(-64.0F) == -4.0F);
+	static_assert(ccm::cbrtl(1000.0L) == 10.0L);
+}
+
+TEST(CcmathPowerTests, Cbrt_Batch)
+{
+	const auto batch = [](auto... a) { ccm::batch::cbrt(a...); };
+	expect_batch_cbrt_matches(batch, make_inputs<double>(-1074, 1023));
+	expect_batch_cbrt_matches(batch, make_inputs<double>(-4, 4, 2000));
+	expect_batch_cbrt_matches(batch, make_inputs<float>(-149, 127, 64));
+
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	const std::vector<double> special = {0.0, -0.0, inf, -inf, 0x1p-1074, -0x1p-900, 0x1p900, std::numeric_limits<double>::max(), -8.0};
+	expect_batch_cbrt_matches(batch, special);
+	constexpr float inf_f = std::numeric_limits<float>::infinity();
+	const std::vector<float> special_f = {0.0F, -0.0F, inf_f, -inf_f, 1e-45F, -std::numeric_limits<float>::max(), 27.0F};
+	expect_batch_cbrt_matches(batch, special_f);
+
+	std::vector<double> nan = {std::numeric_limits<double>::quiet_NaN(), 1.0};
+	ccm::batch::cbrt(nan.data(), nan.data(), nan.size());
+	EXPECT_TRUE(std::isnan(nan[0]));
+
+	// The output may be the input.
+	std::vector<float> x = {8.0F, -27.0F, 64.0F};
+	ccm::batch::cbrt(x.data(), x.data(), x.size());
+	EXPECT_EQ(x, (std::vector<float>{2.0F, -3.0F, 4.0F}));
+}
+
+TEST(CcmathPowerTests, Cbrt_BatchEveryDispatchTier)
+{
+	const auto x  = make_inputs<double>(-1074, 1023);
+	const auto xf = make_inputs<float>(-149, 127, 64);
+	for_each_runnable_simd_level([&](ccm::rt::simd_level level) {
+		if (auto * fn = ccm::rt::simd_impl::cbrt_batch_kernel_for<double>(level)) { expect_batch_cbrt_matches(fn, x); }
+		if (auto * fn = ccm::rt::simd_impl::cbrt_batch_kernel_for<float>(level)) { expect_batch_cbrt_matches(fn, xf); }
+	});
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/batch.hpp"
+#include "support/ulp.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	using ccm::test::expect_binary_batch_prefixes_match;
+	using ccm::test::for_each_runnable_simd_level;
+	using ccm::test::make_input_arrays;
+	using ccm::test::make_input_pairs;
+	using ccm::test::ulp_distance;
+
+	// batch::hypot and every dispatch tier are checked against ccm::hypot.
+	template <typename Batch, typename T>
+	void expect_batch_hypot_matches(Batch batch, const std::vector<T> & x, const std::vector<T> & y)
+	{
+		expect_binary_batch_prefixes_match(batch, x, y, [](T a, T b) { return ccm::hypot(a, b); });
+	}
+} // namespace
+
+TEST(CcmathPowerTests, Hypot)
+{
+	for (const auto & [x, y] : make_input_pairs<double>(-1074, 1023, 30)) { EXPECT_LE(ulp_distance(ccm::hypot(x, y), std::hypot(x, y)), 1) << x << ", " << y; }
+	for (const auto & [x, y] : make_input_pairs<double>(-8, 8, 30)) { EXPECT_LE(ulp_distance(ccm::hypot(x, y), std::hypot(x, y)), 1) << x << ", " << y; }
+	for (const auto & [x, y] : make_input_pairs<float>(-149, 127, 30)) { EXPECT_LE(ulp_distance(ccm::hypotf(x, y), std::hypot(x, y)), 1) << x << ", " << y; }
+
+	// Pythagorean triples are exact, at any scale.
+	EXPECT_EQ(ccm::hypot(3.0, 4.0), 5.0);
+	EXPECT_EQ(ccm::hypot(5.0, -12.0), 13.0);
+	EXPECT_EQ(ccm::hypot(3e300, 4e300), 5e300);
+	EXPECT_EQ(ccm::hypot(0x3p-1074, 0x4p-1074), 0x5p-1074);
+	EXPECT_EQ(ccm::hypotf(3.0F, 4.0F), 5.0F);
+	EXPECT_EQ(ccm::hypot(std::numeric_limits<double>::max(), 1.0), std::numeric_limits<double>::max());
+}
+
+TEST(CcmathPowerTests, HypotThreeArguments)
+{
+	std::mt19937_64 generator(11);
+	std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+	std::uniform_int_distribution<int> exponent(-1074, 1023);
+	for (int i = 0; i < 20000; ++i)
+	{
+		const int base	 = exponent(generator);
+		const double x	 = std::ldexp(mantissa(generator), base);
+		const double y	 = std::ldexp(-mantissa(generator), base - i % 5);
+		const double z	 = std::ldexp(mantissa(generator), i % 2 == 0 ? exponent(generator) : base - i % 7);
+		const double big = std::fmax(std::fabs(x), std::fmax(std::fabs(y), std::fabs(z)));
+		// The reference is exact enough in long double when the squares stay in range of it.
+		const long double sx	= static_cast<long double>(x) / big;
+		const long double sy	= static_cast<long double>(y) / big;
+		const long double sz	= static_cast<long double>(z) / big;
+		const double expected = static_cast<double>(std::sqrt(sx * sx + sy * sy + sz * sz) * big);
+		EXPECT_LE(ulp_distance(ccm::hypot(x, y, z), expected), 1) << "input: " << x << ", " << y << ", " << z;
+	}
+
+	EXPECT_EQ(ccm::hypot(2.0, 3.0, 6.0), 7.0);
+	EXPECT_EQ(ccm::hypot(2e-310, -3e-310, 6e-310), 7e-310);
+	EXPECT_EQ(ccm::hypot(1.0F, 4.0F, 8.0F), 9.0F);
+	EXPECT_EQ(ccm::hypot(2, 3, 6), 7.0);
+	EXPECT_EQ(ccm::hypot(2.0F, 3.0, 6.0L), 7.0L);
+}
+
+TEST(CcmathPowerTests, HypotSpecialValues)
+{
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+	const double values[] = {0.0, -0.0, 1.0, -2.5, inf, -inf, nan, std::numeric_limits<double>::denorm_min(), -std::numeric_limits<double>::max()};
+	for (const double x : values)
+	{
+		for (const double y : values)
+		{
+			const double expected = std::hypot(x, y);
+			const double result	  = ccm::hypot(x, y);
+			EXPECT_LE(ulp_distance(result, expected), 0) << "input: " << x << ", " << y;
+			EXPECT_EQ(std::signbit(result), std::signbit(expected)) << "input: " << x << ", " << y;
+		}
+	}
+	EXPECT_EQ(ccm::hypot(nan, -inf, 1.0), inf);
+	EXPECT_EQ(ccm::hypotf(std::numeric_limits<float>::quiet_NaN(), -std::numeric_limits<float>::infinity()), std::numeric_limits<float>::infinity());
+	EXPECT_TRUE(std::isnan(ccm::hypot(nan, 0.0, 1.0)));
+	EXPECT_EQ(ccm::hypot(3, 4), 5.0);
+	EXPECT_EQ(ccm::hypot(3.0F, 4.0), 5.0);
+	EXPECT_EQ(ccm::hypotl(3.0L, 4.0L), 5.0L);
+}
+
+TEST(CcmathPowerTests, HypotCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::hypot(3.0, 4.0) == 5.0);
+	static_assert(ccm::hypot(3e300, 4e300) == 5e300);
+	static_assert(ccm::hypotf(3.0F, 4.0F) == 5.0F);
+	static_assert(ccm::hypot(2.0, 3.0, 6.0) == 7.0);
+	static_assert(ccm::hypot(0.0, -0.0) == 0.0);
+}
+
+TEST(CcmathPowerTests, Hypot_Batch)
+{
+	const auto batch = [](auto... a) { ccm::batch::hypot(a...); };
+	const auto wide		= make_input_arrays<double>(-1074, 1023, 30);
+	const auto moderate = make_input_arrays<double>(-8, 8, 30);
+	const auto wide_f	= make_input_arrays<float>(-149, 127, 30);
+	expect_batch_hypot_matches(batch, wide.first, wide.second);
+	expect_batch_hypot_matches(batch, moderate.first, moderate.second);
+	expect_batch_hypot_matches(batch, wide_f.first, wide_f.second);
+
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+	expect_batch_hypot_matches(batch, std::vector<double>{0.0, inf, nan, nan, -0.0, 1e308, 4e-320}, std::vector<double>{-0.0, nan, -inf, 1.0, 3.0, 1e308, 3e-320});
+	constexpr float inf_f = std::numeric_limits<float>::infinity();
+	constexpr float nan_f = std::numeric_limits<float>::quiet_NaN();
+	expect_batch_hypot_matches(batch, std::vector<float>{0.0F, inf_f, nan_f, 3e38F, 1e-45F}, std::vector<float>{-0.0F, nan_f, -inf_f, 3e38F, 1e-45F});
+
+	// The output may be one of the inputs.
+	std::vector<double> x = {3.0, 5.0, 8.0};
+	std::vector<double> y = {4.0, 12.0, 15.0};
+	ccm::batch::hypot(x.data(), y.data(), x.data(), x.size());
+	EXPECT_EQ(x, (std::vector<double>{5.0, 13.0, 17.0}));
+}
+
+TEST(CcmathPowerTests, Hypot_BatchEveryDispatchTier)
+{
+	const auto wide	  = make_input_arrays<double>(-1074, 1023, 30);
+	const auto wide_f = make_input_arrays<float>(-149, 127, 30);
+	for_each_runnable_simd_level([&](ccm::rt::simd_level level) {
+		if (auto * fn = ccm::rt::simd_impl::hypot_batch_kernel_for<double>(level)) { expect_batch_hypot_matches(fn, wide.first, wide.second); }
+		if (auto * fn = ccm::rt::simd_impl::hypot_batch_kernel_for<float>(level)) { expect_batch_hypot_matches(fn, wide_f.first, wide_f.second); }
+	});
+}
@@ -11,15 +11,79 @@
 #include <gtest/gtest.h>
 
 #include "ccmath/ccmath.hpp"
+#include "support/batch.hpp"
+#include "support/ulp.hpp"
 
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <random>
+#include <vector>
 
 namespace {
+	using ccm::test::expect_binary_batch_prefixes_match;
+	using ccm::test::same_bits;
+
 	// Equivelant to EXPECT_EQ but allows for NaN values to be equal.
 	bool IsNanOrEquivalent(double a, double b) {
 		return (std::isnan(a) && std::isnan(b)) || (a == b);
 	}
+
+	// The exponent paths are correctly rounded except for rare inputs, and std::pow is within about half an ulp,
+	// so the two agree to one ulp.
+	template <typename T>
+	bool IsWithinOneUlp(T a, T b) {
+		return a == b || std::nextafter(a, b) == b;
+	}
+
+	template <typename T>
+	T RandomBase(std::mt19937_64 & gen) {
+		std::uniform_real_distribution<T> exponent(-4, 4);
+		return std::exp2(exponent(gen)) * ((gen() & 1) != 0 ? T(-1) : T(1));
+	}
+
+	// Bases and exponents for the batch overloads: special values first, then random pairs. The odd count leaves a
+	// tail shorter than every SIMD width.
+	template <typename T>
+	void BatchInputs(std::vector<T> & bases, std::vector<T> & exps) {
+		const T specials[] = {T(0), T(-0.0), T(1), T(-1), T(-2.5), T(0.5), T(-0.5), T(3), T(1e-30), std::numeric_limits<T>::denorm_min(),
+							  std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN()};
+		for (const T x : specials) {
+			for (const T y : specials) {
+				bases.push_back(x);
+				exps.push_back(y);
+			}
+		}
+		std::mt19937_64 gen(20);
+		std::uniform_real_distribution<T> exponent(-20, 20);
+		for (int i = 0; i < 1001; ++i) {
+			bases.push_back(RandomBase<T>(gen) * T(8));
+			exps.push_back(exponent(gen));
+		}
+	}
+
+	template <typename T>
+	void ExpectBatchMatchesScalar() {
+		std::vector<T> bases;
+		std::vector<T> exps;
+		BatchInputs(bases, exps);
+		expect_binary_batch_prefixes_match([](auto... a) { ccm::batch::pow(a...); }, bases, exps, [](T x, T y) { return ccm::pow(x, y); }, 0);
+
+		// The same arrays against each fixed exponent and each fixed base of the special values.
+		std::vector<T> out(bases.size());
+		for (std::size_t j = 0; j < 13; ++j) {
+			ccm::batch::pow(bases.data(), exps[j], out.data(), bases.size());
+			for (std::size_t i = 0; i < bases.size(); ++i) { EXPECT_PRED2(same_bits<T>, out[i], ccm::pow(bases[i], exps[j])) << bases[i] << " ^ " << exps[j]; }
+
+			ccm::batch::pow(bases[j * 13], exps.data(), out.data(), exps.size());
+			for (std::size_t i = 0; i < exps.size(); ++i) { EXPECT_PRED2(same_bits<T>, out[i], ccm::pow(bases[j * 13], exps[i])) << bases[j * 13] << " ^ " << exps[i]; }
+		}
+
+		const T gamma = T(2.2);
+		ccm::batch::pow(bases.data(), gamma, out.data(), bases.size());
+		for (std::size_t i = 0; i < bases.size(); ++i) { EXPECT_PRED2(same_bits<T>, out[i], ccm::pow(bases[i], gamma)) << bases[i]; }
+	}
 }
 
 /*
@@ -172,3 +236,141 @@ TEST(CcmathPowerTests, Pow_Double)
 	EXPECT_EQ(ccm::pow(0.8, 123456.7), std::pow(0.8, 123456.7));
 }
  */
+
+TEST(CcmathPowerTests, Pow_CompileTimeExponent)
+{
+	static_assert(ccm::pow<0>(std::numeric_limits<double>::quiet_NaN()) == 1.0);
+	static_assert(ccm::pow<2>(3.0) == 9.0);
+	static_assert(ccm::pow<3>(-2.0F) == -8.0F);
+	static_assert(ccm::pow<15>(2.0) == 32768.0);
+	static_assert(ccm::pow<-2>(4.0) == 0.0625);
+	static_assert(ccm::pow<3>(2) == 8.0);
+
+	std::mt19937_64 gen(18);
+	for (int i = 0; i < 1000; ++i)
+	{
+		const double x = RandomBase<double>(gen);
+		EXPECT_PRED2(IsWithinOneUlp<double>, ccm::pow<3>(x), std::pow(x, 3.0)) << x;
+		EXPECT_PRED2(IsWithinOneUlp<double>, ccm::pow<15>(x), std::pow(x, 15.0)) << x;
+		EXPECT_PRED2(IsWithinOneUlp<double>, ccm::pow<27>(x), std::pow(x, 27.0)) << x;
+		EXPECT_PRED2(IsWithinOneUlp<double>, ccm::pow<-1>(x), std::pow(x, -1.0)) << x;
+		EXPECT_PRED2(IsWithinOneUlp<double>, ccm::pow<-7>(x), std::pow(x, -7.0)) << x;
+
+		const float xf = RandomBase<float>(gen);
+		EXPECT_PRED2(IsWithinOneUlp<float>, ccm::pow<5>(xf), std::pow(xf, 5.0F)) << xf;
+		EXPECT_PRED2(IsWithinOneUlp<float>, ccm::pow<-6>(xf), std::pow(xf, -6.0F)) << xf;
+	}
+
+	EXPECT_PRED2(same_bits<double>, ccm::pow<3>(-0.0), -0.0);
+	EXPECT_PRED2(same_bits<double>, ccm::pow<-3>(-0.0), -std::numeric_limits<double>::infinity());
+	EXPECT_PRED2(same_bits<double>, ccm::pow<-2>(-std::numeric_limits<double>::infinity()), 0.0);
+	EXPECT_PRED2(same_bits<double>, ccm::pow<3>(1e200), std::numeric_limits<double>::infinity());
+	EXPECT_PRED2(same_bits<double>, ccm::pow<-3>(-1e200), -0.0);
+	EXPECT_PRED2(same_bits<double>, ccm::pow<2>(std::numeric_limits<double>::quiet_NaN()), std::numeric_limits<double>::quiet_NaN());
+}
+
+TEST(CcmathPowerTests, Pow_IntegerExponent)
+{
+	std::mt19937_64 gen(180);
+	for (int i = 0; i < 2000; ++i)
+	{
+		const double x = RandomBase<double>(gen);
+		const auto n	= static_cast<double>(static_cast<int>(gen() % 401) - 200);
+		EXPECT_PRED2(IsWithinOneUlp<double>, ccm::pow(x, n), std::pow(x, n)) << x << " ^ " << n;
+
+		const float xf = RandomBase<float>(gen);
+		const auto nf	= static_cast<float>(static_cast<int>(gen() % 41) - 20);
+		EXPECT_PRED2(IsWithinOneUlp<float>, ccm::pow(xf, nf), std::pow(xf, nf)) << xf << " ^ " << nf;
+	}
+
+	// Bases near 1 with the largest exponents of the fast path.
+	EXPECT_PRED2(IsWithinOneUlp<double>, ccm::pow(1.0 + 0x1p-20, 65536.0), std::pow(1.0 + 0x1p-20, 65536.0));
+	EXPECT_PRED2(IsWithinOneUlp<double>, ccm::pow(1.0 - 0x1p-30, -65535.0), std::pow(1.0 - 0x1p-30, -65535.0));
+
+	const double values[] = {0.0, -0.0, 1.0, -1.0, 2.0, -2.0, 1e-300, -1e300, std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::infinity(),
+							 -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()};
+	const double exponents[] = {0.0, -0.0, 1.0, -1.0, 2.0, -2.0, 3.0, -3.0, 401.0, -401.0};
+	for (const double x : values)
+	{
+		for (const double n : exponents) { EXPECT_PRED2(same_bits<double>, ccm::pow(x, n), std::pow(x, n)) << x << " ^ " << n; }
+	}
+}
+
+TEST(CcmathPowerTests, Pow_HalfExponent)
+{
+	std::mt19937_64 gen(1800);
+	for (int i = 0; i < 1000; ++i)
+	{
+		const double x = std::abs(RandomBase<double>(gen));
+		EXPECT_EQ(ccm::pow(x, 0.5), std::sqrt(x));
+		EXPECT_PRED2(IsWithinOneUlp<double>, ccm::pow(x, -0.5), std::pow(x, -0.5)) << x;
+
+		const float xf = std::abs(RandomBase<float>(gen));
+		EXPECT_EQ(ccm::pow(xf, 0.5F), std::sqrt(xf));
+		EXPECT_PRED2(IsWithinOneUlp<float>, ccm::pow(xf, -0.5F), std::pow(xf, -0.5F)) << xf;
+	}
+
+	const double values[] = {0.0, -0.0, 4.0, -4.0, std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::infinity(),
+							 -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()};
+	for (const double x : values)
+	{
+		EXPECT_PRED2(same_bits<double>, ccm::pow(x, 0.5), std::pow(x, 0.5)) << x;
+		EXPECT_PRED2(same_bits<double>, ccm::pow(x, -0.5), std::pow(x, -0.5)) << x;
+	}
+}
+
+TEST(CcmathPowerTests, Pow_GeneralExponent)
+{
+	static_assert(ccm::pow(16.0, 0.25) == 2.0);
+	static_assert(ccm::pow(0.25F, 1.5F) == 0.125F);
+
+	std::mt19937_64 gen(19);
+	std::uniform_real_distribution<double> exponent(-10, 10);
+	for (int i = 0; i < 2000; ++i)
+	{
+		const double x = std::abs(RandomBase<double>(gen)) * 100;
+		const double y = exponent(gen);
+		EXPECT_PRED2(IsWithinOneUlp<double>, ccm::pow(x, y), std::pow(x, y)) << x << " ^ " << y;
+
+		const float xf = std::abs(RandomBase<float>(gen)) * 100;
+		const auto yf	= static_cast<float>(exponent(gen));
+		EXPECT_PRED2(IsWithinOneUlp<float>, ccm::pow(xf, yf), std::pow(xf, yf)) << xf << " ^ " << yf;
+	}
+
+	// Bases near 1, where log(x) is tiny, with large exponents.
+	std::uniform_real_distribution<double> near_one(-0x1p-10, 0x1p-10);
+	std::uniform_real_distribution<double> large(-1000, 1000);
+	for (int i = 0; i < 1000; ++i)
+	{
+		const double x = 1.0 + near_one(gen);
+		const double y = large(gen);
+		EXPECT_PRED2(IsWithinOneUlp<double>, ccm::pow(x, y), std::pow(x, y)) << x << " ^ " << y;
+	}
+
+	// Results near the overflow threshold, in the subnormal range, and past both.
+	const double extremes[][2] = {{10.0, 308.25}, {10.0, 308.3}, {10.0, 309.5}, {10.0, -307.5}, {10.0, -310.5}, {10.0, -323.5}, {10.0, -324.5},
+								  {0x1p-1022, 1.0001}, {std::numeric_limits<double>::denorm_min(), 0.75}, {1.0 + 0x1p-52, 0x1p60}, {1e-300, 1e-20}};
+	for (const auto & pair : extremes) { EXPECT_PRED2(IsWithinOneUlp<double>, ccm::pow(pair[0], pair[1]), std::pow(pair[0], pair[1])) << pair[0] << " ^ " << pair[1]; }
+
+	const double values[] = {0.0, -0.0, 1.0, -1.0, 0.5, -0.5, 2.0, -2.0, std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+							 std::numeric_limits<double>::quiet_NaN()};
+	const double exponents[] = {0.25, -0.25, 2.5, -2.5, 1e300, -1e300, std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+								std::numeric_limits<double>::quiet_NaN()};
+	for (const double x : values)
+	{
+		for (const double y : exponents) { EXPECT_PRED2(same_bits<double>, ccm::pow(x, y), std::pow(x, y)) << x << " ^ " << y; }
+	}
+}
+
+TEST(CcmathPowerTests, Pow_Batch)
+{
+	ExpectBatchMatchesScalar<double>();
+	ExpectBatchMatchesScalar<float>();
+
+	// The output may be the input array.
+	std::vector<double> values = {0.25, 2.0, 9.0, 1e10, 3.5};
+	ccm::batch::pow(values.data(), 1.5, values.data(), values.size());
+	EXPECT_EQ(values[0], 0.125);
+	EXPECT_EQ(values[2], 27.0);
+	EXPECT_EQ(values[3], 1e15);
+}
@@ -11,9 +11,46 @@
 #include <gtest/gtest.h>
 
 #include "ccmath/ccmath.hpp"
+#include "support/batch.hpp"
+#include "support/ulp.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <limits>
+#include <vector>
+
+namespace
+{
+	using ccm::test::expect_batch_prefixes_match;
+	using ccm::test::for_each_runnable_simd_level;
+	using ccm::test::same_bits;
+
+	template <typename T>
+	std::vector<T> sqrt_batch_inputs()
+	{
+		// An odd count leaves a tail shorter than every SIMD width.
+		std::vector<T> values = {T{0},
+								 -T{0},
+								 T{1},
+								 T{-1},
+								 T{4},
+								 std::numeric_limits<T>::min(),
+								 std::numeric_limits<T>::denorm_min(),
+								 std::numeric_limits<T>::max(),
+								 std::numeric_limits<T>::infinity(),
+								 -std::numeric_limits<T>::infinity(),
+								 std::numeric_limits<T>::quiet_NaN()};
+		for (int i = 0; i < 1000; ++i) { values.push_back(static_cast<T>(i) * static_cast<T>(0.731) + static_cast<T>(1e-3)); }
+		return values;
+	}
+
+	// sqrt is correctly rounded, so the batch must match std::sqrt bit for bit.
+	template <typename T, typename Batch>
+	void expect_sqrt_batch_matches(Batch batch)
+	{
+		expect_batch_prefixes_match(batch, sqrt_batch_inputs<T>(), [](T x) { return std::sqrt(x); }, 0);
+	}
+} // namespace
 
 TEST(CcmathPowerTests, Sqrt_StaticAssert)
 {
@@ -204,3 +241,23 @@ TEST(CcmathPowerTests, Sqrt_RT_LDouble_EdgeCases)
 	//EXPECT_EQ(ccm::sqrt(std::numeric_limits<double>::lowest()), std::sqrt(std::numeric_limits<double>::lowest()));
 }
 #endif
+
+TEST(CcmathPowerTests, Sqrt_Batch)
+{
+	expect_sqrt_batch_matches<double>([](auto... a) { ccm::batch::sqrt(a...); });
+	expect_sqrt_batch_matches<float>([](auto... a) { ccm::batch::sqrt(a...); });
+
+	// In place.
+	std::vector<double> values = sqrt_batch_inputs<double>();
+	const std::vector<double> in = values;
+	ccm::batch::sqrt(values.data(), values.data(), values.size());
+	for (std::size_t i = 0; i < values.size(); ++i) { EXPECT_TRUE(same_bits(values[i], std::sqrt(in[i]))) << "input: " << in[i]; }
+}
+
+TEST(CcmathPowerTests, Sqrt_BatchEveryDispatchTier)
+{
+	for_each_runnable_simd_level([](ccm::rt::simd_level level) {
+		if (auto * fn = ccm::rt::simd_impl::sqrt_batch_kernel_for<double>(level)) { expect_sqrt_batch_matches<double>(fn); }
+		if (auto * fn = ccm::rt::simd_impl::sqrt_batch_kernel_for<float>(level)) { expect_sqrt_batch_matches<float>(fn); }
+	});
+}
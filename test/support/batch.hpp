@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "ccmath/internal/math/runtime/func/dispatch_rt.hpp"
+#include "support/ulp.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ccm::test
+{
+	/// count evenly spaced values from lo to hi, both included.
+	template <typename T>
+	std::vector<T> make_range(T lo, T hi, std::size_t count)
+	{
+		std::vector<T> values(count);
+		for (std::size_t i = 0; i < count; ++i) { values[i] = lo + (hi - lo) * static_cast<T>(i) / static_cast<T>(count - 1); }
+		return values;
+	}
+
+	/**
+	 * @brief Runs batch(in, out, n) over the inputs and expects every output within tolerance ulp of reference.
+	 *
+	 * An odd number of inputs also covers the tail shorter than one SIMD vector.
+	 */
+	template <typename T, typename Batch, typename Reference>
+	void expect_batch_matches(const std::vector<T> & in, Batch batch, Reference reference, std::int64_t tolerance = 1)
+	{
+		std::vector<T> out(in.size());
+		batch(in.data(), out.data(), in.size());
+		for (std::size_t i = 0; i < in.size(); ++i) { EXPECT_LE(ulp_distance(out[i], reference(in[i])), tolerance) << "input: " << in[i]; }
+	}
+
+	/// The prefix lengths expect_batch_prefixes_match runs: all of them up to 40, which covers every tail length, then doubling ones up to size.
+	inline std::vector<std::size_t> batch_prefix_lengths(std::size_t size)
+	{
+		std::vector<std::size_t> lengths;
+		for (std::size_t count = 0; count < size; count = count < 40 ? count + 1 : 2 * count + 1) { lengths.push_back(count); }
+		lengths.push_back(size);
+		return lengths;
+	}
+
+	/// True when actual is within tolerance ulp of expected. A tolerance of 0 asks for the same bits, which also tells +0 from -0.
+	template <typename T>
+	bool matches_within(T actual, T expected, std::int64_t tolerance)
+	{
+		return tolerance == 0 ? same_bits(actual, expected) : ulp_distance(actual, expected) <= tolerance;
+	}
+
+	/**
+	 * @brief Runs batch(in, out, count) on prefixes of the inputs and expects every output to match reference within tolerance ulp.
+	 *
+	 * See batch_prefix_lengths for the prefixes and matches_within for the tolerance. The output element past count holds a
+	 * sentinel that the batch must leave alone.
+	 */
+	template <typename T, typename Batch, typename Reference>
+	void expect_batch_prefixes_match(Batch batch, const std::vector<T> & in, Reference reference, std::int64_t tolerance = 1)
+	{
+		for (const std::size_t count : batch_prefix_lengths(in.size()))
+		{
+			std::vector<T> out(count + 1, T{-7});
+			batch(in.data(), out.data(), count);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				EXPECT_TRUE(matches_within(out[i], static_cast<T>(reference(in[i])), tolerance)) << "input: " << in[i] << " result: " << out[i] << " count: " << count;
+			}
+			EXPECT_EQ(out[count], T{-7}) << "count: " << count;
+		}
+	}
+
+	/// expect_batch_prefixes_match for a batch(x, y, out, count) with two inputs, against reference(x, y).
+	template <typename T, typename Batch, typename Reference>
+	void expect_binary_batch_prefixes_match(Batch batch, const std::vector<T> & x, const std::vector<T> & y, Reference reference, std::int64_t tolerance = 1)
+	{
+		for (const std::size_t count : batch_prefix_lengths(x.size()))
+		{
+			std::vector<T> out(count + 1, T{-7});
+			batch(x.data(), y.data(), out.data(), count);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				EXPECT_TRUE(matches_within(out[i], static_cast<T>(reference(x[i], y[i])), tolerance))
+					<< "input: " << x[i] << ", " << y[i] << " result: " << out[i] << " count: " << count;
+			}
+			EXPECT_EQ(out[count], T{-7}) << "count: " << count;
+		}
+	}
+
+	/// Calls f(level) for every SIMD level compiled into this binary that the host can run, not just the one picked by the dispatcher.
+	template <typename F>
+	void for_each_runnable_simd_level(F f)
+	{
+		const auto host = ccm::rt::host_cpu_features();
+		for (std::size_t i = 0; i < ccm::rt::simd_level_count; ++i)
+		{
+			const auto level = static_cast<ccm::rt::simd_level>(i);
+			if (ccm::rt::supports_simd_level(host, level) || level == ccm::rt::simd_impl::compiled_simd_level()) { f(level); }
+		}
+	}
+} // namespace ccm::test
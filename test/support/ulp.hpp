@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Accuracy helpers shared by the tests that compare against a reference implementation.
+namespace ccm::test
+{
+	/// Bitwise equality, so zeros of different sign differ, with every NaN equal to every other NaN.
+	template <typename T>
+	bool same_bits(T a, T b)
+	{
+		if (std::isnan(a) && std::isnan(b)) { return true; }
+		return std::memcmp(&a, &b, sizeof(T)) == 0;
+	}
+
+	/// Distance in units in the last place between two values. NaNs compare equal to each other, and so do zeros of either sign.
+	template <typename T>
+	std::int64_t ulp_distance(T a, T b)
+	{
+		static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "ulp_distance only supports float and double.");
+		using bits_t = std::conditional_t<std::is_same_v<T, double>, std::int64_t, std::int32_t>;
+
+		if (std::isnan(a) && std::isnan(b)) { return 0; }
+		if (a == b) { return 0; }
+		bits_t ia{};
+		bits_t ib{};
+		std::memcpy(&ia, &a, sizeof(a));
+		std::memcpy(&ib, &b, sizeof(b));
+		// Map negative values below the positive ones so that the distance across zero is the number of values in between.
+		if (ia < 0) { ia = std::numeric_limits<bits_t>::min() - ia; }
+		if (ib < 0) { ib = std::numeric_limits<bits_t>::min() - ib; }
+		return ia > ib ? static_cast<std::int64_t>(ia) - ib : static_cast<std::int64_t>(ib) - ia;
+	}
+
+	/**
+	 * @brief Error of a in units in the last place of the reference rounded to T, fraction included.
+	 *
+	 * ulp_distance only counts whole steps, so a result that is off by 1.1 ulp can still be one step away from the rounded
+	 * reference. Comparing against a wider reference shows how far below one ulp a kernel really is.
+	 */
+	template <typename T>
+	double ulp_error(T a, long double reference)
+	{
+		static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "ulp_error only supports float and double.");
+		if (std::isnan(a) && std::isnan(reference)) { return 0.0; }
+		if (static_cast<long double>(a) == reference) { return 0.0; }
+		const T rounded		  = static_cast<T>(reference);
+		const int exponent	  = rounded == T(0) ? std::numeric_limits<T>::min_exponent - 1 : std::ilogb(rounded);
+		const long double ulp = std::ldexp(1.0L, std::max(exponent, std::numeric_limits<T>::min_exponent - 1) - (std::numeric_limits<T>::digits - 1));
+		return static_cast<double>(std::fabs(static_cast<long double>(a) - reference) / ulp);
+	}
+
+	/// True when long double is wide enough to serve as the reference of ulp_error for double.
+	constexpr bool has_wide_long_double = std::numeric_limits<long double>::digits > std::numeric_limits<double>::digits;
+
+	/**
+	 * @brief The largest ulp_error of f over the inputs against reference evaluated in long double, and its input.
+	 *
+	 * Tests check the worst error instead of failing per value, as a kernel that is slightly off is slightly off almost everywhere.
+	 */
+	template <typename T, typename F, typename Reference>
+	std::pair<double, T> worst_ulp_error(const std::vector<T> & inputs, F f, Reference reference)
+	{
+		std::pair<double, T> worst{0.0, T(0)};
+		for (const T x : inputs)
+		{
+			const double error = ulp_error(f(x), reference(static_cast<long double>(x)));
+			if (error > worst.first) { worst = {error, x}; }
+		}
+		return worst;
+	}
+
+	/// Which signs make_inputs generates.
+	enum class input_signs
+	{
+		both,
+		positive,
+	};
+
+	/**
+	 * @brief Values spread over every binade from 2^min_exponent to 2^max_exponent, subnormals included.
+	 *
+	 * Each binade gets per_binade random magnitudes, each of them with both signs unless only positive values are asked for.
+	 * The generator is seeded, so every run checks the same values.
+	 */
+	template <typename T>
+	std::vector<T> make_inputs(int min_exponent, int max_exponent, int per_binade = 16, input_signs signs = input_signs::both)
+	{
+		std::mt19937_64 generator(42);
+		std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+		std::vector<T> values;
+		for (int e = min_exponent; e <= max_exponent; ++e)
+		{
+			for (int i = 0; i < per_binade; ++i)
+			{
+				const auto value = static_cast<T>(std::ldexp(mantissa(generator), e));
+				values.push_back(value);
+				if (signs == input_signs::both) { values.push_back(-value); }
+			}
+		}
+		return values;
+	}
+
+	/**
+	 * @brief Pairs spread over every binade of both operands, in all four quadrants.
+	 *
+	 * Exponents are drawn uniformly from [min_exponent, max_exponent]. With max_gap > 0, every second pair instead has a
+	 * second operand at most 2^max_gap smaller than the first, which covers operands of similar magnitude.
+	 */
+	template <typename T>
+	std::vector<std::pair<T, T>> make_input_pairs(int min_exponent, int max_exponent, int max_gap = 0)
+	{
+		std::mt19937_64 generator(42);
+		std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+		std::uniform_int_distribution<int> exponent(min_exponent, max_exponent);
+		std::uniform_int_distribution<int> gap(0, max_gap);
+		std::vector<std::pair<T, T>> values;
+		for (int i = 0; i < 20000; ++i)
+		{
+			const int first_exponent  = exponent(generator);
+			const int second_exponent = (max_gap > 0 && i % 2 != 0) ? first_exponent - gap(generator) : exponent(generator);
+			const auto first		  = static_cast<T>(std::ldexp(mantissa(generator), first_exponent));
+			const auto second		  = static_cast<T>(std::ldexp(mantissa(generator), second_exponent));
+			values.emplace_back(first, second);
+			values.emplace_back(-first, second);
+			values.emplace_back(first, -second);
+			values.emplace_back(-first, -second);
+		}
+		return values;
+	}
+
+	/// make_input_pairs split into the array of first operands and the array of second operands, as the batch functions take them.
+	template <typename T>
+	std::pair<std::vector<T>, std::vector<T>> make_input_arrays(int min_exponent, int max_exponent, int max_gap = 0)
+	{
+		std::pair<std::vector<T>, std::vector<T>> arrays;
+		for (const auto & [first, second] : make_input_pairs<T>(min_exponent, max_exponent, max_gap))
+		{
+			arrays.first.push_back(first);
+			arrays.second.push_back(second);
+		}
+		return arrays;
+	}
+} // namespace ccm::test
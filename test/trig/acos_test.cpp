@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using ccm::test::ulp_distance;
+
+	// Values spread evenly over [-1, 1], plus values next to +-1/2 and +-1 where the reductions switch.
+	template <typename T>
+	std::vector<T> make_inputs()
+	{
+		std::mt19937_64 generator(42);
+		std::uniform_real_distribution<double> value(-1.0, 1.0);
+		std::vector<T> values;
+		for (int i = 0; i < 20000; ++i) { values.push_back(static_cast<T>(value(generator))); }
+		for (int e = 1; e <= 40; ++e)
+		{
+			const double offset = std::ldexp(1.0, -e);
+			for (const double centre : {0.5, 1.0})
+			{
+				values.push_back(static_cast<T>(centre - offset));
+				values.push_back(static_cast<T>(-(centre - offset)));
+			}
+			values.push_back(static_cast<T>(offset));
+			values.push_back(static_cast<T>(-offset));
+		}
+		return values;
+	}
+} // namespace
+
+TEST(CcmathTrigTests, Acos)
+{
+	for (const double x : make_inputs<double>()) { EXPECT_LE(ulp_distance(ccm::acos(x), std::acos(x)), 1) << "input: " << x; }
+	for (const float x : make_inputs<float>()) { EXPECT_LE(ulp_distance(ccm::acosf(x), std::acos(x)), 1) << "input: " << x; }
+}
+
+TEST(CcmathTrigTests, AcosSpecialValues)
+{
+	EXPECT_EQ(ccm::acos(0.0), std::acos(0.0));
+	EXPECT_EQ(ccm::acos(-0.0), std::acos(-0.0));
+	EXPECT_EQ(ccm::acos(1.0), 0.0);
+	EXPECT_FALSE(std::signbit(ccm::acos(1.0)));
+	EXPECT_EQ(ccm::acos(-1.0), std::acos(-1.0));
+	EXPECT_TRUE(std::isnan(ccm::acos(1.5)));
+	EXPECT_TRUE(std::isnan(ccm::acos(-std::numeric_limits<double>::infinity())));
+	EXPECT_TRUE(std::isnan(ccm::acos(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::acosf(2.0F)));
+	EXPECT_EQ(ccm::acos(1), std::acos(1.0));
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::acosl(0.75L)), std::acos(0.75)), 1);
+}
+
+TEST(CcmathTrigTests, AcosCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::acos(1.0) == 0.0);
+	static_assert(ccm::acos(-1.0) == 3.141592653589793);
+	static_assert(ccm::acosf(0.5F) > 1.0471F && ccm::acosf(0.5F) < 1.0472F);
+}
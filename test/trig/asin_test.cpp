@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using ccm::test::ulp_distance;
+
+	// Values spread evenly over [-1, 1], plus values next to +-1/2 and +-1 where the reductions switch.
+	template <typename T>
+	std::vector<T> make_inputs()
+	{
+		std::mt19937_64 generator(42);
+		std::uniform_real_distribution<double> value(-1.0, 1.0);
+		std::vector<T> values;
+		for (int i = 0; i < 20000; ++i) { values.push_back(static_cast<T>(value(generator))); }
+		for (int e = 1; e <= 40; ++e)
+		{
+			const double offset = std::ldexp(1.0, -e);
+			for (const double centre : {0.5, 1.0})
+			{
+				values.push_back(static_cast<T>(centre - offset));
+				values.push_back(static_cast<T>(-(centre - offset)));
+			}
+			values.push_back(static_cast<T>(offset));
+			values.push_back(static_cast<T>(-offset));
+		}
+		return values;
+	}
+} // namespace
+
+TEST(CcmathTrigTests, Asin)
+{
+	for (const double x : make_inputs<double>()) { EXPECT_LE(ulp_distance(ccm::asin(x), std::asin(x)), 1) << "input: " << x; }
+	for (const float x : make_inputs<float>()) { EXPECT_LE(ulp_distance(ccm::asinf(x), std::asin(x)), 1) << "input: " << x; }
+}
+
+TEST(CcmathTrigTests, AsinSpecialValues)
+{
+	EXPECT_EQ(ccm::asin(0.0), 0.0);
+	EXPECT_TRUE(std::signbit(ccm::asin(-0.0)));
+	EXPECT_EQ(ccm::asin(1.0), std::asin(1.0));
+	EXPECT_EQ(ccm::asin(-1.0), std::asin(-1.0));
+	EXPECT_EQ(ccm::asin(std::numeric_limits<double>::denorm_min()), std::numeric_limits<double>::denorm_min());
+	EXPECT_TRUE(std::isnan(ccm::asin(1.5)));
+	EXPECT_TRUE(std::isnan(ccm::asin(-std::numeric_limits<double>::infinity())));
+	EXPECT_TRUE(std::isnan(ccm::asin(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::asinf(2.0F)));
+	EXPECT_EQ(ccm::asin(1), std::asin(1.0));
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::asinl(0.75L)), std::asin(0.75)), 1);
+}
+
+TEST(CcmathTrigTests, AsinCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::asin(0.0) == 0.0);
+	static_assert(ccm::asin(1.0) == 1.5707963267948966);
+	static_assert(ccm::asinf(0.5F) > 0.5235F && ccm::asinf(0.5F) < 0.5236F);
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+using ccm::test::has_wide_long_double;
+using ccm::test::make_input_pairs;
+using ccm::test::ulp_distance;
+using ccm::test::ulp_error;
+
+TEST(CcmathTrigTests, Atan2)
+{
+	for (const auto & [y, x] : make_input_pairs<double>(-1074, 1023))
+	{
+		EXPECT_LE(ulp_distance(ccm::atan2(y, x), std::atan2(y, x)), 1) << "input: " << y << ", " << x;
+	}
+	for (const auto & [y, x] : make_input_pairs<double>(-8, 8))
+	{
+		EXPECT_LE(ulp_distance(ccm::atan2(y, x), std::atan2(y, x)), 1) << "input: " << y << ", " << x;
+	}
+	for (const auto & [y, x] : make_input_pairs<float>(-149, 127))
+	{
+		EXPECT_LE(ulp_distance(ccm::atan2f(y, x), std::atan2(y, x)), 1) << "input: " << y << ", " << x;
+	}
+
+	// Coordinates of equal magnitude land on the odd multiples of pi/4.
+	for (const double v : {1.0, 3.0, 1e-300, 1e300})
+	{
+		EXPECT_EQ(ccm::atan2(v, v), std::atan2(v, v));
+		EXPECT_EQ(ccm::atan2(-v, -v), std::atan2(-v, -v));
+	}
+}
+
+TEST(CcmathTrigTests, Atan2IsScaleInvariantForHugeAndTinyOperands)
+{
+	if (!has_wide_long_double) { GTEST_SKIP() << "long double is no wider than double"; }
+	// The generic kernel is called directly, as the runtime call may go to the standard library. Operands of close
+	// magnitude outside [2^-500, 2^500] need the rounding error of y/x as much as any others.
+	std::vector<std::pair<double, double>> inputs = make_input_pairs<double>(500, 1023, 4);
+	const std::vector<std::pair<double, double>> tiny = make_input_pairs<double>(-1074, -500, 4);
+	inputs.insert(inputs.end(), tiny.begin(), tiny.end());
+	inputs.emplace_back(-1.2213185361565701e173, 2.2572814578347247e173);
+	for (const auto & [y, x] : inputs)
+	{
+		const double error = ulp_error(ccm::gen::atan2_gen<double>(y, x), std::atan2(static_cast<long double>(y), static_cast<long double>(x)));
+		EXPECT_LT(error, 1.0) << "input: " << y << ", " << x;
+	}
+}
+
+TEST(CcmathTrigTests, Atan2SpecialValues)
+{
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	const double values[] = {0.0, -0.0, 1.0, -1.0, inf, -inf, std::numeric_limits<double>::denorm_min(), -std::numeric_limits<double>::max()};
+	for (const double y : values)
+	{
+		for (const double x : values)
+		{
+			const double expected = std::atan2(y, x);
+			const double result	  = ccm::atan2(y, x);
+			EXPECT_LE(ulp_distance(result, expected), 1) << "input: " << y << ", " << x;
+			EXPECT_EQ(std::signbit(result), std::signbit(expected)) << "input: " << y << ", " << x;
+		}
+	}
+	EXPECT_TRUE(std::isnan(ccm::atan2(std::numeric_limits<double>::quiet_NaN(), 1.0)));
+	EXPECT_TRUE(std::isnan(ccm::atan2(1.0, std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::atan2f(std::numeric_limits<float>::quiet_NaN(), 1.0F)));
+	EXPECT_LE(ulp_distance(ccm::atan2(1, 2), std::atan2(1.0, 2.0)), 1);
+	EXPECT_LE(ulp_distance(ccm::atan2(1.0F, 2.0), std::atan2(1.0, 2.0)), 1);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::atan2l(1.0L, -2.0L)), std::atan2(1.0, -2.0)), 1);
+}
+
+TEST(CcmathTrigTests, Atan2CanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::atan2(0.0, 1.0) == 0.0);
+	static_assert(ccm::atan2(1.0, 0.0) == 1.5707963267948966);
+	static_assert(ccm::atan2(0.0, -1.0) == 3.141592653589793);
+	static_assert(ccm::atan2f(-1.0F, -1.0F) < -2.3561F && ccm::atan2f(-1.0F, -1.0F) > -2.3562F);
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
+
+TEST(CcmathTrigTests, Atan)
+{
+	for (const double x : make_inputs<double>(-40, 1023)) { EXPECT_LE(ulp_distance(ccm::atan(x), std::atan(x)), 1) << "input: " << x; }
+	for (const float x : make_inputs<float>(-30, 127)) { EXPECT_LE(ulp_distance(ccm::atanf(x), std::atan(x)), 1) << "input: " << x; }
+
+	// The breakpoints of the reduction table and their neighbours.
+	for (const double x : {0.4375, 0.6875, 1.1875, 2.4375, 0.43749999999999994, 0.68749999999999989, 1.1874999999999998, 2.4374999999999996})
+	{
+		EXPECT_LE(ulp_distance(ccm::atan(x), std::atan(x)), 1) << "input: " << x;
+		EXPECT_LE(ulp_distance(ccm::atan(-x), std::atan(-x)), 1) << "input: " << -x;
+	}
+}
+
+TEST(CcmathTrigTests, AtanSpecialValues)
+{
+	EXPECT_EQ(ccm::atan(0.0), 0.0);
+	EXPECT_TRUE(std::signbit(ccm::atan(-0.0)));
+	EXPECT_EQ(ccm::atan(std::numeric_limits<double>::infinity()), std::atan(std::numeric_limits<double>::infinity()));
+	EXPECT_EQ(ccm::atan(-std::numeric_limits<double>::infinity()), std::atan(-std::numeric_limits<double>::infinity()));
+	EXPECT_EQ(ccm::atan(std::numeric_limits<double>::denorm_min()), std::numeric_limits<double>::denorm_min());
+	EXPECT_TRUE(std::isnan(ccm::atan(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::atanf(std::numeric_limits<float>::quiet_NaN())));
+	EXPECT_EQ(ccm::atan(1.0), std::atan(1.0));
+	EXPECT_LE(ulp_distance(ccm::atan(2), std::atan(2.0)), 1);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::atanl(2.0L)), std::atan(2.0)), 1);
+}
+
+TEST(CcmathTrigTests, AtanCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::atan(0.0) == 0.0);
+	static_assert(ccm::atan(1.0) == 0.78539816339744828);
+	static_assert(ccm::atanf(2.0F) > 1.1071F && ccm::atanf(2.0F) < 1.1072F);
+}
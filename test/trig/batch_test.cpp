@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/batch.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	using ccm::test::expect_batch_matches;
+	using ccm::test::for_each_runnable_simd_level;
+	using ccm::test::make_range;
+	using ccm::test::ulp_distance;
+	using ccm::test::ulp_error;
+
+	// Keeps the worst error instead of failing per value, as a kernel that is slightly off is slightly off almost everywhere.
+	template <typename Batch>
+	void expect_batch_tan_below_one_ulp(const std::vector<double> & in, Batch batch)
+	{
+		std::vector<double> out(in.size());
+		batch(in.data(), out.data(), in.size());
+		double worst_error = 0.0;
+		double worst_input = 0.0;
+		for (std::size_t i = 0; i < in.size(); ++i)
+		{
+			const double error = ulp_error(out[i], std::tan(static_cast<long double>(in[i])));
+			if (error > worst_error)
+			{
+				worst_error = error;
+				worst_input = in[i];
+			}
+		}
+		EXPECT_LT(worst_error, 1.0) << "input: " << worst_input;
+	}
+
+	template <typename T, typename Batch>
+	void expect_batch_sincos_matches(const std::vector<T> & in, Batch batch)
+	{
+		std::vector<T> sin_out(in.size());
+		std::vector<T> cos_out(in.size());
+		batch(in.data(), sin_out.data(), cos_out.data(), in.size());
+		for (std::size_t i = 0; i < in.size(); ++i)
+		{
+			EXPECT_LE(ulp_distance(sin_out[i], static_cast<T>(std::sin(in[i]))), 1) << "input: " << in[i];
+			EXPECT_LE(ulp_distance(cos_out[i], static_cast<T>(std::cos(in[i]))), 1) << "input: " << in[i];
+		}
+	}
+
+	// Points over many binades in all four quadrants, including points on the axes and points left to the scalar kernel.
+	template <typename T>
+	void make_points(std::vector<T> & x, std::vector<T> & y)
+	{
+		std::mt19937_64 generator(42);
+		std::uniform_real_distribution<double> mantissa(-2.0, 2.0);
+		std::uniform_int_distribution<int> exponent(-80, 80);
+		for (int i = 0; i < 2001; ++i)
+		{
+			x.push_back(static_cast<T>(std::ldexp(mantissa(generator), exponent(generator))));
+			y.push_back(static_cast<T>(std::ldexp(mantissa(generator), exponent(generator))));
+		}
+		const T inf = std::numeric_limits<T>::infinity();
+		const T nan = std::numeric_limits<T>::quiet_NaN();
+		const T special_x[] = {T(0.0), T(-0.0), T(1.0), T(-1.0), T(0.0), inf, -inf, nan, T(1.0), std::numeric_limits<T>::max(), std::numeric_limits<T>::denorm_min()};
+		const T special_y[] = {T(1.0), T(-1.0), T(0.0), T(-0.0), T(-0.0), T(1.0), inf, T(1.0), nan, T(1.0), T(-1.0)};
+		x.insert(x.end(), std::begin(special_x), std::end(special_x));
+		y.insert(y.end(), std::begin(special_y), std::end(special_y));
+	}
+
+	template <typename T, typename Batch>
+	void expect_batch_atan2_matches(const std::vector<T> & y, const std::vector<T> & x, Batch batch)
+	{
+		std::vector<T> out(y.size());
+		batch(y.data(), x.data(), out.data(), y.size());
+		for (std::size_t i = 0; i < y.size(); ++i)
+		{
+			const T expected = std::atan2(y[i], x[i]);
+			EXPECT_LE(ulp_distance(out[i], expected), 1) << "input: " << y[i] << ", " << x[i];
+			if (!std::isnan(expected)) { EXPECT_EQ(std::signbit(out[i]), std::signbit(expected)) << "input: " << y[i] << ", " << x[i]; }
+		}
+	}
+
+	template <typename T, typename Batch>
+	void expect_batch_polar_matches(const std::vector<T> & x, const std::vector<T> & y, Batch batch)
+	{
+		std::vector<T> r(x.size());
+		std::vector<T> theta(x.size());
+		batch(x.data(), y.data(), r.data(), theta.data(), x.size());
+		for (std::size_t i = 0; i < x.size(); ++i)
+		{
+			EXPECT_LE(ulp_distance(r[i], std::hypot(x[i], y[i])), 1) << "input: " << x[i] << ", " << y[i];
+			EXPECT_LE(ulp_distance(theta[i], std::atan2(y[i], x[i])), 1) << "input: " << x[i] << ", " << y[i];
+		}
+	}
+
+	template <typename T>
+	std::vector<T> special_values()
+	{
+		// Zeros, huge values that need the Payne-Hanek reduction and values next to multiples of pi/2 are routed to the scalar kernel.
+		return {T(0.0),
+				T(-0.0),
+				T(1e-30),
+				static_cast<T>(1.5707963267948966),
+				static_cast<T>(3.141592653589793),
+				T(1e6),
+				T(-3e7),
+				std::numeric_limits<T>::max(),
+				std::numeric_limits<T>::infinity(),
+				-std::numeric_limits<T>::infinity(),
+				std::numeric_limits<T>::quiet_NaN(),
+				T(1.0)};
+	}
+} // namespace
+
+TEST(CcmathTrigTests, BatchSin)
+{
+	// Use an odd count so the scalar tail is exercised for every SIMD width.
+	expect_batch_matches(make_range(-100.0, 100.0, 1001), [](auto... a) { ccm::batch::sin(a...); }, [](double x) { return std::sin(x); });
+	expect_batch_matches(make_range(-1e6, 1e6, 1001), [](auto... a) { ccm::batch::sin(a...); }, [](double x) { return std::sin(x); });
+	expect_batch_matches(make_range(-100.0F, 100.0F, 1001), [](auto... a) { ccm::batch::sin(a...); }, [](float x) { return std::sin(x); });
+	expect_batch_matches(special_values<double>(), [](auto... a) { ccm::batch::sin(a...); }, [](double x) { return std::sin(x); });
+	expect_batch_matches(special_values<float>(), [](auto... a) { ccm::batch::sin(a...); }, [](float x) { return std::sin(x); });
+}
+
+TEST(CcmathTrigTests, BatchCos)
+{
+	expect_batch_matches(make_range(-100.0, 100.0, 1001), [](auto... a) { ccm::batch::cos(a...); }, [](double x) { return std::cos(x); });
+	expect_batch_matches(make_range(-1e6F, 1e6F, 1001), [](auto... a) { ccm::batch::cos(a...); }, [](float x) { return std::cos(x); });
+	expect_batch_matches(special_values<double>(), [](auto... a) { ccm::batch::cos(a...); }, [](double x) { return std::cos(x); });
+}
+
+TEST(CcmathTrigTests, BatchTan)
+{
+	expect_batch_matches(make_range(-100.0, 100.0, 1001), [](auto... a) { ccm::batch::tan(a...); }, [](double x) { return std::tan(x); });
+	expect_batch_matches(make_range(-100.0F, 100.0F, 1001), [](auto... a) { ccm::batch::tan(a...); }, [](float x) { return std::tan(x); });
+	expect_batch_matches(special_values<double>(), [](auto... a) { ccm::batch::tan(a...); }, [](double x) { return std::tan(x); });
+}
+
+TEST(CcmathTrigTests, BatchTanBelowOneUlp)
+{
+	// The odd quadrants compute -1/tan with a correction term that a contracted multiply-add spoils. That costs a fraction of an ulp,
+	// which ulp_distance against the double reference does not see, so measure every tier against a long double reference.
+	// CTest runs this once more with CCM_FORCE_SIMD_ABI=avx512.
+	if (std::numeric_limits<long double>::digits <= std::numeric_limits<double>::digits) { GTEST_SKIP() << "long double is no wider than double"; }
+
+	std::mt19937_64 generator(42);
+	std::uniform_real_distribution<double> distribution(-10.0, 10.0);
+	std::vector<double> in(100001);
+	for (auto & x : in) { x = distribution(generator); }
+
+	expect_batch_tan_below_one_ulp(in, [](auto... a) { ccm::batch::tan(a...); });
+	for_each_runnable_simd_level([&](ccm::rt::simd_level level) {
+		if (auto * fn = ccm::rt::simd_impl::batch_kernel_for<ccm::rt::simd_impl::tan_batch_kernel, double>(level)) { expect_batch_tan_below_one_ulp(in, fn); }
+	});
+}
+
+TEST(CcmathTrigTests, BatchSincos)
+{
+	expect_batch_sincos_matches(make_range(-100.0, 100.0, 1001), [](auto... a) { ccm::batch::sincos(a...); });
+	expect_batch_sincos_matches(make_range(-100.0F, 100.0F, 1001), [](auto... a) { ccm::batch::sincos(a...); });
+	expect_batch_sincos_matches(special_values<double>(), [](auto... a) { ccm::batch::sincos(a...); });
+
+	// The input array may double as one of the outputs.
+	std::vector<double> values = make_range(-10.0, 10.0, 101);
+	std::vector<double> cos_out(values.size());
+	const std::vector<double> in = values;
+	ccm::batch::sincos(values.data(), values.data(), cos_out.data(), values.size());
+	for (std::size_t i = 0; i < in.size(); ++i) { EXPECT_LE(ulp_distance(values[i], std::sin(in[i])), 1) << "input: " << in[i]; }
+}
+
+TEST(CcmathTrigTests, BatchAtan2)
+{
+	std::vector<double> x;
+	std::vector<double> y;
+	make_points(x, y);
+	expect_batch_atan2_matches(y, x, [](auto... a) { ccm::batch::atan2(a...); });
+
+	std::vector<float> xf;
+	std::vector<float> yf;
+	make_points(xf, yf);
+	expect_batch_atan2_matches(yf, xf, [](auto... a) { ccm::batch::atan2(a...); });
+
+	// The output array may double as one of the inputs.
+	std::vector<double> values = y;
+	ccm::batch::atan2(values.data(), x.data(), values.data(), values.size());
+	for (std::size_t i = 0; i < y.size(); ++i) { EXPECT_LE(ulp_distance(values[i], std::atan2(y[i], x[i])), 1) << "input: " << y[i] << ", " << x[i]; }
+}
+
+TEST(CcmathTrigTests, BatchPolar)
+{
+	std::vector<double> x;
+	std::vector<double> y;
+	make_points(x, y);
+	expect_batch_polar_matches(x, y, [](auto... a) { ccm::batch::polar(a...); });
+
+	std::vector<float> xf;
+	std::vector<float> yf;
+	make_points(xf, yf);
+	expect_batch_polar_matches(xf, yf, [](auto... a) { ccm::batch::polar(a...); });
+
+	// Converting in place overwrites the coordinates with the radius and the angle.
+	std::vector<double> r = x;
+	std::vector<double> theta = y;
+	ccm::batch::polar(r.data(), theta.data(), r.data(), theta.data(), r.size());
+	for (std::size_t i = 0; i < x.size(); ++i)
+	{
+		EXPECT_LE(ulp_distance(r[i], std::hypot(x[i], y[i])), 1) << "input: " << x[i] << ", " << y[i];
+		EXPECT_LE(ulp_distance(theta[i], std::atan2(y[i], x[i])), 1) << "input: " << x[i] << ", " << y[i];
+	}
+}
+
+TEST(CcmathTrigTests, BatchEveryDispatchTier)
+{
+	for_each_runnable_simd_level([](ccm::rt::simd_level level) {
+		using namespace ccm::rt::simd_impl;
+		if (auto * fn = batch_kernel_for<sin_batch_kernel, double>(level))
+		{
+			expect_batch_matches(make_range(-1e5, 1e5, 1001), fn, [](double x) { return std::sin(x); });
+		}
+		if (auto * fn = batch_kernel_for<cos_batch_kernel, float>(level))
+		{
+			expect_batch_matches(make_range(-100.0F, 100.0F, 1001), fn, [](float x) { return std::cos(x); });
+		}
+		if (auto * fn = batch_kernel_for<tan_batch_kernel, double>(level))
+		{
+			expect_batch_matches(make_range(-100.0, 100.0, 1001), fn, [](double x) { return std::tan(x); });
+		}
+		if (auto * fn = batch_pair_kernel_for<sincos_batch_kernel, double>(level)) { expect_batch_sincos_matches(make_range(-1e5, 1e5, 1001), fn); }
+
+		std::vector<double> x;
+		std::vector<double> y;
+		make_points(x, y);
+		if (auto * fn = batch_binary_kernel_for<atan2_batch_kernel, double>(level)) { expect_batch_atan2_matches(y, x, fn); }
+		if (auto * fn = batch_binary_pair_kernel_for<polar_batch_kernel, double>(level)) { expect_batch_polar_matches(x, y, fn); }
+	});
+}
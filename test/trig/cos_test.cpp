@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
+
+TEST(CcmathTrigTests, Cos)
+{
+	for (const double x : make_inputs<double>(-30, 1023)) { EXPECT_LE(ulp_distance(ccm::cos(x), std::cos(x)), 1) << "input: " << x; }
+	for (const float x : make_inputs<float>(-20, 127)) { EXPECT_LE(ulp_distance(ccm::cosf(x), std::cos(x)), 1) << "input: " << x; }
+
+	for (const double x : {1.5707963267948966, 3.141592653589793, 4.71238898038469, 6.283185307179586, 1e22, 0x1.921fb54442d18p+1023})
+	{
+		EXPECT_LE(ulp_distance(ccm::cos(x), std::cos(x)), 1) << "input: " << x;
+	}
+}
+
+TEST(CcmathTrigTests, CosSpecialValues)
+{
+	EXPECT_EQ(ccm::cos(0.0), 1.0);
+	EXPECT_EQ(ccm::cos(-0.0), 1.0);
+	EXPECT_EQ(ccm::cosf(1e-30F), 1.0F);
+	EXPECT_TRUE(std::isnan(ccm::cos(std::numeric_limits<double>::infinity())));
+	EXPECT_TRUE(std::isnan(ccm::cos(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::cosf(-std::numeric_limits<float>::infinity())));
+	EXPECT_LE(ulp_distance(ccm::cos(3), std::cos(3.0)), 1);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::cosl(1.0L)), std::cos(1.0)), 1);
+}
+
+TEST(CcmathTrigTests, CosCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::cos(0.0) == 1.0);
+	static_assert(ccm::cos(3.141592653589793) == -1.0);
+	static_assert(ccm::cosf(1.0F) > 0.5403F && ccm::cosf(1.0F) < 0.5404F);
+
+	constexpr double huge = ccm::cos(0x1.921fb54442d18p+1023);
+	EXPECT_EQ(huge, std::cos(0x1.921fb54442d18p+1023));
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
+
+TEST(CcmathTrigTests, Sin)
+{
+	for (const double x : make_inputs<double>(-30, 1023)) { EXPECT_LE(ulp_distance(ccm::sin(x), std::sin(x)), 1) << "input: " << x; }
+	for (const float x : make_inputs<float>(-20, 127)) { EXPECT_LE(ulp_distance(ccm::sinf(x), std::sin(x)), 1) << "input: " << x; }
+
+	// Arguments that are the closest doubles to multiples of pi/2 lose the most bits to cancellation.
+	for (const double x : {1.5707963267948966, 3.141592653589793, 4.71238898038469, 6.283185307179586, 1e22, 0x1.921fb54442d18p+1023,
+						   0x1.6ac5b262ca1ffp+849, 5.319372648326541e+255})
+	{
+		EXPECT_LE(ulp_distance(ccm::sin(x), std::sin(x)), 1) << "input: " << x;
+	}
+}
+
+TEST(CcmathTrigTests, SinSpecialValues)
+{
+	EXPECT_EQ(ccm::sin(0.0), 0.0);
+	EXPECT_TRUE(std::signbit(ccm::sin(-0.0)));
+	EXPECT_TRUE(std::signbit(ccm::sinf(-0.0F)));
+	EXPECT_EQ(ccm::sin(1e-300), 1e-300);
+	EXPECT_TRUE(std::isnan(ccm::sin(std::numeric_limits<double>::infinity())));
+	EXPECT_TRUE(std::isnan(ccm::sin(-std::numeric_limits<double>::infinity())));
+	EXPECT_TRUE(std::isnan(ccm::sin(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::sinf(std::numeric_limits<float>::infinity())));
+	EXPECT_LE(ulp_distance(ccm::sin(2), std::sin(2.0)), 1);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::sinl(1.0L)), std::sin(1.0)), 1);
+}
+
+TEST(CcmathTrigTests, SinCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::sin(0.0) == 0.0);
+	static_assert(ccm::sin(0.5) > 0.479 && ccm::sin(0.5) < 0.4795);
+	static_assert(ccm::sinf(3.0F) > 0.1411F && ccm::sinf(3.0F) < 0.1412F);
+
+	// The Payne-Hanek reduction is constexpr as well.
+	constexpr double huge = ccm::sin(1e22);
+	EXPECT_EQ(huge, std::sin(1e22));
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
+
+TEST(CcmathTrigTests, SincosMatchesSinAndCos)
+{
+	// sincos shares the reduction, so its results are the same as the separate calls bit for bit.
+	for (const double x : make_inputs<double>(-30, 1023))
+	{
+		double s{};
+		double c{};
+		ccm::sincos(x, &s, &c);
+		EXPECT_EQ(ulp_distance(s, ccm::sin(x)), 0) << "input: " << x;
+		EXPECT_EQ(ulp_distance(c, ccm::cos(x)), 0) << "input: " << x;
+	}
+	for (const float x : make_inputs<float>(-20, 127))
+	{
+		float s{};
+		float c{};
+		ccm::sincosf(x, &s, &c);
+		EXPECT_EQ(ulp_distance(s, ccm::sinf(x)), 0) << "input: " << x;
+		EXPECT_EQ(ulp_distance(c, ccm::cosf(x)), 0) << "input: " << x;
+	}
+
+	double s{};
+	double c{};
+	ccm::sincos(std::numeric_limits<double>::infinity(), &s, &c);
+	EXPECT_TRUE(std::isnan(s));
+	EXPECT_TRUE(std::isnan(c));
+}
+
+namespace
+{
+	constexpr double sincos_sum(double x)
+	{
+		double s{};
+		double c{};
+		ccm::sincos(x, &s, &c);
+		return s * s + c * c;
+	}
+} // namespace
+
+TEST(CcmathTrigTests, SincosCanBeEvaluatedAtCompileTime)
+{
+	static_assert(sincos_sum(0.0) == 1.0);
+	static_assert(sincos_sum(1e10) > 0.9999999 && sincos_sum(1e10) < 1.0000001);
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Ian Pike
+ * Copyright (c) CCMath contributors
+ *
+ * CCMath is provided under the Apache-2.0 License WITH LLVM-exception.
+ * See LICENSE for more information.
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ */
+
+#include <gtest/gtest.h>
+
+#include "ccmath/ccmath.hpp"
+#include "support/ulp.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using ccm::test::make_inputs;
+using ccm::test::ulp_distance;
+
+TEST(CcmathTrigTests, Tan)
+{
+	for (const double x : make_inputs<double>(-30, 1023)) { EXPECT_LE(ulp_distance(ccm::tan(x), std::tan(x)), 1) << "input: " << x; }
+	for (const float x : make_inputs<float>(-20, 127)) { EXPECT_LE(ulp_distance(ccm::tanf(x), std::tan(x)), 1) << "input: " << x; }
+
+	// Near odd multiples of pi/2 the result is huge and comes from the -1/tan branch.
+	for (const double x : {1.5707963267948966, -1.5707963267948966, 4.71238898038469, 0.6744, 0.7853981633974483, 1e22})
+	{
+		EXPECT_LE(ulp_distance(ccm::tan(x), std::tan(x)), 1) << "input: " << x;
+	}
+}
+
+TEST(CcmathTrigTests, TanSpecialValues)
+{
+	EXPECT_EQ(ccm::tan(0.0), 0.0);
+	EXPECT_TRUE(std::signbit(ccm::tan(-0.0)));
+	EXPECT_TRUE(std::isnan(ccm::tan(std::numeric_limits<double>::infinity())));
+	EXPECT_TRUE(std::isnan(ccm::tan(std::numeric_limits<double>::quiet_NaN())));
+	EXPECT_TRUE(std::isnan(ccm::tanf(std::numeric_limits<float>::infinity())));
+	EXPECT_LE(ulp_distance(ccm::tan(1), std::tan(1.0)), 1);
+	EXPECT_LE(ulp_distance(static_cast<double>(ccm::tanl(1.0L)), std::tan(1.0)), 1);
+}
+
+TEST(CcmathTrigTests, TanCanBeEvaluatedAtCompileTime)
+{
+	static_assert(ccm::tan(0.0) == 0.0);
+	static_assert(ccm::tan(0.7853981633974483) > 0.99999 && ccm::tan(0.7853981633974483) < 1.00001);
+	static_assert(ccm::tanf(1.0F) > 1.5574F && ccm::tanf(1.0F) < 1.5575F);
+}